@@ -18,10 +18,18 @@
 
 /* IAR toolchain doesn't define POSIX error codes, so we re-define those we need for this toolchain */
 
+#ifndef EAGAIN
+#define EAGAIN 11 /* Resource temporarily unavailable */
+#endif
+
 #ifndef ENOMEM
 #define ENOMEM 12 /* Not enough space */
 #endif
 
+#ifndef EBUSY
+#define EBUSY 16 /* Device or resource busy */
+#endif
+
 #ifndef ENODEV
 #define ENODEV 19 /* No such device */
 #endif
@@ -30,6 +38,10 @@
 #define EINVAL 22 /* Invalid argument */
 #endif
 
+#ifndef EDEADLK
+#define EDEADLK 45 /* Resource deadlock would occur */
+#endif
+
 #endif /* __IAR_SYSTEMS_ICC__ */
 
 #endif /* _FWK_ERRNO_H_ */
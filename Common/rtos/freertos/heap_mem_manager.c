@@ -1,10 +1,11 @@
 /*
- * Copyright 2020 NXP
+ * Copyright 2020, 2025 NXP
  * All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdbool.h>
 #include <stdlib.h>
 
 /* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
@@ -15,6 +16,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "fsl_component_mem_manager.h"
+#include "heap_mem_manager.h"
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
@@ -22,24 +24,372 @@
 #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
 
+/* Free size of the memory manager. MEM_GetFreeHeapSize() is only provided by the light memory manager, a port using
+ * another memory manager can define its own query. Without a query, the free size is estimated from the bytes taken
+ * by the FreeRTOS heap when CONFIG_FWK_HEAP_STATS is set and FreeRTOSConfig.h defines configTOTAL_HEAP_SIZE, otherwise
+ * it is unknown, as before the statistics were added. */
+#if !defined(FWK_HEAP_GET_FREE_SIZE) && defined(gMemManagerLight) && (gMemManagerLight == 1)
+#define FWK_HEAP_GET_FREE_SIZE() MEM_GetFreeHeapSize()
+#endif
+
+#if defined(FWK_HEAP_GET_FREE_SIZE) || ((CONFIG_FWK_HEAP_STATS > 0) && defined(configTOTAL_HEAP_SIZE))
+#define HEAP_FREE_SIZE_KNOWN 1
+#else
+#define HEAP_FREE_SIZE_KNOWN 0
+#endif
+
+/* Largest block the memory manager can allocate, reported as 0 when the port doesn't define a query. Finding it with
+ * test allocations would mask the interrupts for long and raise the heap upper limit used by the low power code. */
+#if !defined(FWK_HEAP_GET_LARGEST_FREE_BLOCK)
+#define FWK_HEAP_GET_LARGEST_FREE_BLOCK() 0U
+#endif
+
+/* Class of the blocks allocated directly from the memory manager */
+#define HEAP_SLAB_DIRECT 0xFFU
+
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+
+#if (CONFIG_FWK_HEAP_SLAB_CLASSES < 1) || (CONFIG_FWK_HEAP_SLAB_CLASSES > 8)
+#error CONFIG_FWK_HEAP_SLAB_CLASSES must be between 1 and 8
+#endif
+
+#if (CONFIG_FWK_HEAP_SLAB_MIN_SIZE < 8)
+#error CONFIG_FWK_HEAP_SLAB_MIN_SIZE must be at least 8 to hold the free list link
+#endif
+
+#if (CONFIG_FWK_HEAP_SLAB_REFILL < 1)
+#error CONFIG_FWK_HEAP_SLAB_REFILL must be at least 1
+#endif
+
+/* Header preceding each allocated block, it keeps the alignment of the memory manager buffers */
+typedef union heap_slab_header
+{
+    uint8_t sizeClass;
+    uint8_t reserved[portBYTE_ALIGNMENT];
+} heap_slab_header_t;
+
+/* Free block of a class, the link is stored in the user area */
+typedef struct heap_slab_block
+{
+    struct heap_slab_block *next;
+} heap_slab_block_t;
+
+typedef struct heap_slab_class
+{
+    heap_slab_block_t *free;
+    uint16_t           count;
+#if (CONFIG_FWK_HEAP_STATS > 0)
+    uint16_t blocks; /* blocks taken from the memory manager */
+#endif
+} heap_slab_class_t;
+
+static heap_slab_class_t s_slabClasses[CONFIG_FWK_HEAP_SLAB_CLASSES];
+
+#endif /* CONFIG_FWK_HEAP_SLAB */
+
+#if (CONFIG_FWK_HEAP_STATS > 0)
+/* Counters of the FreeRTOS heap, updated in a critical section */
+typedef struct heap_stats
+{
+    uint32_t minFree;
+    uint32_t allocations;
+    uint32_t frees;
+    uint32_t failures;
+    uint32_t usedBytes;
+    uint32_t peakUsedBytes;
+} heap_stats_t;
+
+static heap_stats_t s_heapStats = {
+    .minFree = UINT32_MAX,
+};
+#endif
+
+static uint8_t s_heapInit = 0U;
+
+#if (HEAP_FREE_SIZE_KNOWN > 0)
+static uint32_t heap_free_size(void)
+{
+#if defined(FWK_HEAP_GET_FREE_SIZE)
+    return FWK_HEAP_GET_FREE_SIZE();
+#else
+    /* the block headers of the memory manager are not accounted */
+    uint32_t usedBytes = s_heapStats.usedBytes;
+
+    return (usedBytes < (uint32_t)configTOTAL_HEAP_SIZE) ? ((uint32_t)configTOTAL_HEAP_SIZE - usedBytes) : 0U;
+#endif
+}
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* Must be called with the scheduler suspended */
+static void heap_init(void)
+{
+    if (s_heapInit == 0U)
+    {
+        MEM_Init();
+        s_heapInit = 1U;
+    }
+}
+
+/* Accounts a buffer taken from the memory manager. Must be called with the scheduler suspended. */
+static void heap_stats_taken(void *buffer, uint8_t sizeClass)
+{
+#if (CONFIG_FWK_HEAP_STATS > 0)
+    uint32_t size = MEM_BufferGetSize(buffer);
+
+    taskENTER_CRITICAL();
+    s_heapStats.usedBytes += size;
+#if (HEAP_FREE_SIZE_KNOWN > 0)
+    {
+        uint32_t freeBytes = heap_free_size();
+
+        if (freeBytes < s_heapStats.minFree)
+        {
+            s_heapStats.minFree = freeBytes;
+        }
+    }
+#endif
+    if (s_heapStats.usedBytes > s_heapStats.peakUsedBytes)
+    {
+        s_heapStats.peakUsedBytes = s_heapStats.usedBytes;
+    }
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+    if (sizeClass != HEAP_SLAB_DIRECT)
+    {
+        s_slabClasses[sizeClass].blocks++;
+    }
+#endif
+    taskEXIT_CRITICAL();
+#endif
+
+    (void)buffer;
+    (void)sizeClass;
+}
+
+/* Accounts a buffer given back to the memory manager, before it's freed */
+static void heap_stats_released(void *buffer, uint8_t sizeClass)
+{
+#if (CONFIG_FWK_HEAP_STATS > 0)
+    uint32_t size = MEM_BufferGetSize(buffer);
+
+    taskENTER_CRITICAL();
+    s_heapStats.usedBytes -= size;
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+    if (sizeClass != HEAP_SLAB_DIRECT)
+    {
+        s_slabClasses[sizeClass].blocks--;
+    }
+#endif
+    taskEXIT_CRITICAL();
+#endif
+
+    (void)buffer;
+    (void)sizeClass;
+}
+
+#if (CONFIG_FWK_HEAP_STATS > 0)
+static void heap_stats_count(uint32_t *counter)
+{
+    taskENTER_CRITICAL();
+    (*counter)++;
+    taskEXIT_CRITICAL();
+}
+
+#define HEAP_STATS_COUNT(counter) heap_stats_count(&s_heapStats.counter)
+#else
+#define HEAP_STATS_COUNT(counter) \
+    do                            \
+    {                             \
+    } while (false)
+#endif
+
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+
+static uint8_t heap_slab_class(size_t size)
+{
+    uint8_t sizeClass = HEAP_SLAB_DIRECT;
+
+    for (uint8_t i = 0U; i < (uint8_t)CONFIG_FWK_HEAP_SLAB_CLASSES; i++)
+    {
+        if (size <= ((size_t)CONFIG_FWK_HEAP_SLAB_MIN_SIZE << i))
+        {
+            sizeClass = i;
+            break;
+        }
+    }
+
+    return sizeClass;
+}
+
+/* Allocates a block with its header from the memory manager. Must be called with the scheduler suspended. */
+static void *heap_slab_block_alloc(size_t size, uint8_t sizeClass)
+{
+    heap_slab_header_t *header = NULL;
+
+    if (size <= ((size_t)UINT32_MAX - sizeof(heap_slab_header_t)))
+    {
+        header = (heap_slab_header_t *)MEM_BufferAlloc((uint32_t)(size + sizeof(heap_slab_header_t)));
+    }
+
+    if (header != NULL)
+    {
+        heap_stats_taken(header, sizeClass);
+        header->sizeClass = sizeClass;
+        header++;
+    }
+
+    return (void *)header;
+}
+
+/* Gives a block back to the memory manager. Must be called with the scheduler suspended. */
+static void heap_slab_block_free(void *pv)
+{
+    heap_slab_header_t *header = (heap_slab_header_t *)pv - 1;
+
+    heap_stats_released(header, header->sizeClass);
+    (void)MEM_BufferFree(header);
+}
+
+static void *heap_slab_pop(uint8_t sizeClass)
+{
+    heap_slab_class_t *slab = &s_slabClasses[sizeClass];
+    heap_slab_block_t *block;
+
+    taskENTER_CRITICAL();
+    block = slab->free;
+    if (block != NULL)
+    {
+        slab->free = block->next;
+        slab->count--;
+#if (CONFIG_FWK_HEAP_STATS > 0)
+        s_heapStats.allocations++;
+#endif
+    }
+    taskEXIT_CRITICAL();
+
+    return (void *)block;
+}
+
+/* Returns false if the class cache is full. freed is true when the block is freed by the user. */
+static bool heap_slab_push(uint8_t sizeClass, void *pv, bool freed)
+{
+    heap_slab_class_t *slab  = &s_slabClasses[sizeClass];
+    heap_slab_block_t *block = (heap_slab_block_t *)pv;
+    bool               ret   = false;
+
+    taskENTER_CRITICAL();
+    if (slab->count < (uint16_t)CONFIG_FWK_HEAP_SLAB_MAX_FREE)
+    {
+        block->next = slab->free;
+        slab->free  = block;
+        slab->count++;
+#if (CONFIG_FWK_HEAP_STATS > 0)
+        if (freed)
+        {
+            s_heapStats.frees++;
+        }
+#endif
+        ret = true;
+    }
+    taskEXIT_CRITICAL();
+
+    return ret;
+}
+
+/* Allocates a batch of blocks for an empty class, returns the first one and caches the others.
+ * Must be called with the scheduler suspended. */
+static void *heap_slab_refill(uint8_t sizeClass)
+{
+    size_t blockSize = (size_t)CONFIG_FWK_HEAP_SLAB_MIN_SIZE << sizeClass;
+    void  *pvReturn  = heap_slab_block_alloc(blockSize, sizeClass);
+
+    if (pvReturn != NULL)
+    {
+        for (uint32_t i = 1U; i < (uint32_t)CONFIG_FWK_HEAP_SLAB_REFILL; i++)
+        {
+            void *pv = heap_slab_block_alloc(blockSize, sizeClass);
+
+            if (pv == NULL)
+            {
+                break;
+            }
+
+            if (heap_slab_push(sizeClass, pv, false) == false)
+            {
+                heap_slab_block_free(pv);
+                break;
+            }
+        }
+    }
+
+    return pvReturn;
+}
+
+#endif /* CONFIG_FWK_HEAP_SLAB */
+
 /*-----------------------------------------------------------*/
 void *pvPortMalloc(size_t xWantedSize)
 {
-    void          *pvReturn = NULL;
-    static uint8_t init     = 0U;
+    void *pvReturn = NULL;
 
-    vTaskSuspendAll();
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+    uint8_t sizeClass = heap_slab_class(xWantedSize);
+
+    if (sizeClass != HEAP_SLAB_DIRECT)
+    {
+        /* fast path, the scheduler is not suspended */
+        pvReturn = heap_slab_pop(sizeClass);
+    }
+
+    if (pvReturn == NULL)
     {
-        if (init == 0U)
+        vTaskSuspendAll();
+        {
+            heap_init();
+            if (sizeClass != HEAP_SLAB_DIRECT)
+            {
+                pvReturn = heap_slab_refill(sizeClass);
+            }
+            else
+            {
+                pvReturn = heap_slab_block_alloc(xWantedSize, HEAP_SLAB_DIRECT);
+            }
+        }
+        (void)xTaskResumeAll();
+
+        if (pvReturn != NULL)
+        {
+            HEAP_STATS_COUNT(allocations);
+        }
+        else
         {
-            MEM_Init();
-            init = 1U;
+            HEAP_STATS_COUNT(failures);
         }
+    }
+#else
+    vTaskSuspendAll();
+    {
+        heap_init();
         /* allocate here */
         pvReturn = MEM_BufferAlloc(xWantedSize);
+        if (pvReturn != NULL)
+        {
+            heap_stats_taken(pvReturn, HEAP_SLAB_DIRECT);
+        }
     }
     (void)xTaskResumeAll();
 
+    if (pvReturn != NULL)
+    {
+        HEAP_STATS_COUNT(allocations);
+    }
+    else
+    {
+        HEAP_STATS_COUNT(failures);
+    }
+#endif
+
 #if (configUSE_MALLOC_FAILED_HOOK == 1)
     {
         if (pvReturn == NULL)
@@ -63,25 +413,61 @@ void vPortFree(void *pv)
 {
     if (pv != NULL)
     {
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+        heap_slab_header_t *header = (heap_slab_header_t *)pv - 1;
+
+        if ((header->sizeClass == HEAP_SLAB_DIRECT) || (heap_slab_push(header->sizeClass, pv, true) == false))
+        {
+            vTaskSuspendAll();
+            {
+                heap_slab_block_free(pv);
+            }
+            (void)xTaskResumeAll();
+
+            HEAP_STATS_COUNT(frees);
+        }
+#else
         vTaskSuspendAll();
         {
             /* free */
+            heap_stats_released(pv, HEAP_SLAB_DIRECT);
             MEM_BufferFree(pv);
         }
         (void)xTaskResumeAll();
+
+        HEAP_STATS_COUNT(frees);
+#endif
     }
 }
 /*-----------------------------------------------------------*/
 
 size_t xPortGetFreeHeapSize(void)
 {
-    return -1;
+#if (HEAP_FREE_SIZE_KNOWN > 0)
+    return (size_t)heap_free_size();
+#else
+    /* unknown */
+    return (size_t)-1;
+#endif
 }
 /*-----------------------------------------------------------*/
 
 size_t xPortGetMinimumEverFreeHeapSize(void)
 {
-    return 0;
+#if (CONFIG_FWK_HEAP_STATS > 0) && (HEAP_FREE_SIZE_KNOWN > 0)
+    uint32_t freeBytes = heap_free_size();
+    uint32_t minFree;
+
+    taskENTER_CRITICAL();
+    minFree = s_heapStats.minFree;
+    taskEXIT_CRITICAL();
+
+    /* nothing allocated yet */
+    return (size_t)((minFree < freeBytes) ? minFree : freeBytes);
+#else
+    /* not tracked */
+    return 0U;
+#endif
 }
 /*-----------------------------------------------------------*/
 
@@ -92,5 +478,90 @@ void vPortInitialiseBlocks(void)
 
 void vPortGetHeapStats(HeapStats_t *pxHeapStats)
 {
-    (void)pxHeapStats;
+    if (pxHeapStats != NULL)
+    {
+#if (HEAP_FREE_SIZE_KNOWN > 0)
+        uint32_t freeBytes = heap_free_size();
+#else
+        /* not reported */
+        uint32_t freeBytes = 0U;
+#endif
+
+        pxHeapStats->xAvailableHeapSpaceInBytes     = freeBytes;
+        pxHeapStats->xSizeOfLargestFreeBlockInBytes = FWK_HEAP_GET_LARGEST_FREE_BLOCK();
+        /* not reported by the memory manager */
+        pxHeapStats->xSizeOfSmallestFreeBlockInBytes = 0U;
+#if defined(FWK_HEAP_GET_FREE_BLOCKS)
+        pxHeapStats->xNumberOfFreeBlocks = FWK_HEAP_GET_FREE_BLOCKS();
+#else
+        pxHeapStats->xNumberOfFreeBlocks = 0U;
+#endif
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xPortGetMinimumEverFreeHeapSize();
+
+#if (CONFIG_FWK_HEAP_STATS > 0)
+        taskENTER_CRITICAL();
+        pxHeapStats->xNumberOfSuccessfulAllocations = s_heapStats.allocations;
+        pxHeapStats->xNumberOfSuccessfulFrees       = s_heapStats.frees;
+        taskEXIT_CRITICAL();
+#else
+        pxHeapStats->xNumberOfSuccessfulAllocations = 0U;
+        pxHeapStats->xNumberOfSuccessfulFrees       = 0U;
+#endif
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if (CONFIG_FWK_HEAP_STATS > 0)
+void HEAP_GetStats(fwk_heap_stats_t *stats)
+{
+    if (stats != NULL)
+    {
+#if (HEAP_FREE_SIZE_KNOWN > 0)
+        stats->freeBytes = heap_free_size();
+#else
+        /* not reported, the minimum free size is 0 too */
+        stats->freeBytes = 0U;
+#endif
+        stats->largestFreeBlock = FWK_HEAP_GET_LARGEST_FREE_BLOCK();
+#if defined(FWK_HEAP_GET_FREE_BLOCKS)
+        stats->freeBlocks = FWK_HEAP_GET_FREE_BLOCKS();
+#else
+        stats->freeBlocks = 0U;
+#endif
+
+        taskENTER_CRITICAL();
+        stats->minFreeBytes  = (s_heapStats.minFree < stats->freeBytes) ? s_heapStats.minFree : stats->freeBytes;
+        stats->usedBytes     = s_heapStats.usedBytes;
+        stats->peakUsedBytes = s_heapStats.peakUsedBytes;
+        stats->allocations   = s_heapStats.allocations;
+        stats->frees         = s_heapStats.frees;
+        stats->failures      = s_heapStats.failures;
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+        for (uint8_t i = 0U; i < (uint8_t)CONFIG_FWK_HEAP_SLAB_CLASSES; i++)
+        {
+            stats->classes[i].blockSize = (uint16_t)((uint32_t)CONFIG_FWK_HEAP_SLAB_MIN_SIZE << i);
+            stats->classes[i].blocks    = s_slabClasses[i].blocks;
+            stats->classes[i].cached    = s_slabClasses[i].count;
+        }
+#endif
+        taskEXIT_CRITICAL();
+    }
+}
+
+void HEAP_ResetStats(void)
+{
+#if (HEAP_FREE_SIZE_KNOWN > 0)
+    uint32_t freeBytes = heap_free_size();
+#else
+    uint32_t freeBytes = UINT32_MAX;
+#endif
+
+    taskENTER_CRITICAL();
+    s_heapStats.minFree       = freeBytes;
+    s_heapStats.peakUsedBytes = s_heapStats.usedBytes;
+    s_heapStats.allocations   = 0U;
+    s_heapStats.frees         = 0U;
+    s_heapStats.failures      = 0U;
+    taskEXIT_CRITICAL();
 }
+#endif /* CONFIG_FWK_HEAP_STATS */
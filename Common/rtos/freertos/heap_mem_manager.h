@@ -0,0 +1,124 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file heap_mem_manager.h
+ * \brief FreeRTOS heap wrapper to the MCUX SDK memory manager: configuration and statistics.
+ *
+ */
+
+#ifndef _HEAP_MEM_MANAGER_H_
+#define _HEAP_MEM_MANAGER_H_
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <stdint.h>
+
+/* -------------------------------------------------------------------------- */
+/*                                Public macros                               */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Size-class slab cache in front of the memory manager
+ *
+ * The small allocations are served from per-class free lists protected by a short critical section, the scheduler
+ * is suspended only to refill a class from the memory manager or to release a block that doesn't fit in the cache.
+ */
+#ifndef CONFIG_FWK_HEAP_SLAB
+#define CONFIG_FWK_HEAP_SLAB 0
+#endif
+
+/*!
+ * \brief Number of size classes, the class n holds the blocks of CONFIG_FWK_HEAP_SLAB_MIN_SIZE << n bytes
+ */
+#ifndef CONFIG_FWK_HEAP_SLAB_CLASSES
+#define CONFIG_FWK_HEAP_SLAB_CLASSES 4
+#endif
+
+#ifndef CONFIG_FWK_HEAP_SLAB_MIN_SIZE
+#define CONFIG_FWK_HEAP_SLAB_MIN_SIZE 16
+#endif
+
+/*!
+ * \brief Number of blocks allocated from the memory manager when a class is empty
+ */
+#ifndef CONFIG_FWK_HEAP_SLAB_REFILL
+#define CONFIG_FWK_HEAP_SLAB_REFILL 4
+#endif
+
+/*!
+ * \brief Maximum number of free blocks kept by a class, the next freed blocks go back to the memory manager
+ */
+#ifndef CONFIG_FWK_HEAP_SLAB_MAX_FREE
+#define CONFIG_FWK_HEAP_SLAB_MAX_FREE 16
+#endif
+
+/*!
+ * \brief Enables the heap statistics API and the FSCI GetHeapStats request
+ *
+ * Records the bytes taken from the memory manager by the FreeRTOS heap, its peak, the minimum free size, the numbers of
+ * allocations and frees, and the usage of the slab classes. Without it, xPortGetMinimumEverFreeHeapSize() and the
+ * counters of vPortGetHeapStats() return 0 and the allocations don't take any additional critical section.
+ */
+#ifndef CONFIG_FWK_HEAP_STATS
+#define CONFIG_FWK_HEAP_STATS 0
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                                Public types                                */
+/* -------------------------------------------------------------------------- */
+
+#if (CONFIG_FWK_HEAP_STATS > 0)
+/*! Usage of a slab class */
+typedef struct fwk_heap_class_stats_t
+{
+    uint16_t blockSize;
+    uint16_t blocks; /* blocks taken from the memory manager */
+    uint16_t cached; /* free blocks kept by the class, the others are in use */
+} fwk_heap_class_stats_t;
+
+/*! Heap statistics, sizes in bytes */
+typedef struct fwk_heap_stats_t
+{
+    uint32_t freeBytes;        /* free size of the memory manager, see FWK_HEAP_GET_FREE_SIZE. 0 if unknown */
+    uint32_t minFreeBytes;     /* minimum free size seen after an allocation from the memory manager, 0 if unknown */
+    uint32_t largestFreeBlock; /* 0 if not reported by the memory manager, see FWK_HEAP_GET_LARGEST_FREE_BLOCK. The
+                                  fragmentation is 1 - largestFreeBlock / freeBytes */
+    uint32_t freeBlocks;       /* 0 if not reported by the memory manager, see FWK_HEAP_GET_FREE_BLOCKS */
+    uint32_t usedBytes;        /* taken from the memory manager by the FreeRTOS heap, slab caches included */
+    uint32_t peakUsedBytes;
+    uint32_t allocations;
+    uint32_t frees;
+    uint32_t failures;
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+    fwk_heap_class_stats_t classes[CONFIG_FWK_HEAP_SLAB_CLASSES];
+#endif
+} fwk_heap_stats_t;
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+#if (CONFIG_FWK_HEAP_STATS > 0)
+/*!
+ * \brief Returns the statistics of the FreeRTOS heap.
+ *
+ * The memory manager doesn't give its largest free block nor its number of free blocks. A port that can get them
+ * defines FWK_HEAP_GET_LARGEST_FREE_BLOCK() and FWK_HEAP_GET_FREE_BLOCKS(), otherwise they are reported as 0. The free
+ * size comes from MEM_GetFreeHeapSize() with the light memory manager (gMemManagerLight) or FWK_HEAP_GET_FREE_SIZE()
+ * defined by the port, otherwise it is estimated from configTOTAL_HEAP_SIZE and the used size, or reported as 0.
+ *
+ * \param[out] stats pointer to the statistics to fill.
+ */
+void HEAP_GetStats(fwk_heap_stats_t *stats);
+
+/*!
+ * \brief Restarts the minimum free size, the peak used size and the counters from the current state.
+ */
+void HEAP_ResetStats(void);
+#endif
+
+#endif /* _HEAP_MEM_MANAGER_H_ */
@@ -0,0 +1,250 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file heap_bench.c
+ * \brief Host benchmark of the FreeRTOS heap shim (heap_mem_manager.c).
+ *
+ * Each thread allocates a window of buffers with the sizes of the usual kernel objects (queues, timers, event groups,
+ * small messages), then frees them, in a loop. The benchmark reports the cost of pvPortMalloc() and vPortFree(), the
+ * percentiles of pvPortMalloc(), the time spent with the scheduler suspended per operation, and the heap statistics
+ * when CONFIG_FWK_HEAP_STATS is enabled.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "heap_mem_manager.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#define BENCH_MAX_THREADS 8U
+#define BENCH_MAX_WINDOW  64U
+#define BENCH_SAMPLES     4096U
+
+/* -------------------------------------------------------------------------- */
+/*                               Private types                                */
+/* -------------------------------------------------------------------------- */
+
+typedef struct
+{
+    pthread_t thread;
+    uint64_t  allocNs;
+    uint64_t  freeNs;
+    uint64_t  ops;
+    uint64_t  failures;
+    uint64_t  samples[BENCH_SAMPLES];
+    uint32_t  sampleCount;
+} bench_thread_t;
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+/* sizes of the small FreeRTOS objects and messages, the last one goes to the memory manager directly */
+static const size_t s_sizes[] = {24U, 40U, 48U, 80U, 96U, 120U, 16U, 64U, 32U, 512U};
+
+static bench_thread_t s_threads[BENCH_MAX_THREADS];
+static unsigned int   s_threadCount = 1U;
+static unsigned int   s_window      = 8U;
+static unsigned int   s_iterations  = 100000U;
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+static void *bench_thread(void *arg)
+{
+    bench_thread_t *bench = (bench_thread_t *)arg;
+    void           *buffers[BENCH_MAX_WINDOW];
+    unsigned int    sizeIndex = (unsigned int)(bench - s_threads);
+
+    for (unsigned int i = 0U; i < s_iterations; i++)
+    {
+        uint64_t start;
+
+        for (unsigned int j = 0U; j < s_window; j++)
+        {
+            size_t size = s_sizes[sizeIndex % (sizeof(s_sizes) / sizeof(s_sizes[0]))];
+
+            sizeIndex++;
+            start      = bench_now_ns();
+            buffers[j] = pvPortMalloc(size);
+            start      = bench_now_ns() - start;
+
+            bench->allocNs += start;
+            if (bench->sampleCount < BENCH_SAMPLES)
+            {
+                bench->samples[bench->sampleCount] = start;
+                bench->sampleCount++;
+            }
+            if (buffers[j] == NULL)
+            {
+                bench->failures++;
+            }
+            else
+            {
+                (void)memset(buffers[j], 0xA5, size);
+            }
+        }
+
+        start = bench_now_ns();
+        for (unsigned int j = 0U; j < s_window; j++)
+        {
+            vPortFree(buffers[j]);
+        }
+        bench->freeNs += bench_now_ns() - start;
+        bench->ops += s_window;
+    }
+
+    return NULL;
+}
+
+static int bench_compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+#if (CONFIG_FWK_HEAP_STATS > 0)
+static void bench_print_heap_stats(void)
+{
+    fwk_heap_stats_t stats;
+
+    HEAP_GetStats(&stats);
+    printf("heap: %u bytes free, min %u, used %u, peak %u\n", stats.freeBytes, stats.minFreeBytes, stats.usedBytes,
+           stats.peakUsedBytes);
+    if ((stats.largestFreeBlock != 0U) && (stats.freeBytes != 0U))
+    {
+        printf("heap: largest block %u, fragmentation %.1f%%\n", stats.largestFreeBlock,
+               100.0 * (1.0 - ((double)stats.largestFreeBlock / (double)stats.freeBytes)));
+    }
+    printf("heap: %u allocations, %u frees, %u failures\n", stats.allocations, stats.frees, stats.failures);
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+    for (unsigned int i = 0U; i < (unsigned int)CONFIG_FWK_HEAP_SLAB_CLASSES; i++)
+    {
+        printf("heap: class %u bytes, %u blocks, %u cached\n", stats.classes[i].blockSize, stats.classes[i].blocks,
+               stats.classes[i].cached);
+    }
+#endif
+}
+#endif
+
+static void bench_usage(const char *name)
+{
+    printf("usage: %s [-t threads] [-w live buffers per thread] [-n iterations]\n", name);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+int main(int argc, char **argv)
+{
+    TaskHostStats_t suspend;
+    uint64_t        allocNs  = 0U;
+    uint64_t        freeNs   = 0U;
+    uint64_t        ops      = 0U;
+    uint64_t        failures = 0U;
+    uint64_t       *samples;
+    uint32_t        sampleCount = 0U;
+    int             opt;
+
+    while ((opt = getopt(argc, argv, "t:w:n:")) != -1)
+    {
+        switch (opt)
+        {
+            case 't':
+                s_threadCount = (unsigned int)strtoul(optarg, NULL, 0);
+                break;
+            case 'w':
+                s_window = (unsigned int)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                s_iterations = (unsigned int)strtoul(optarg, NULL, 0);
+                break;
+            default:
+                bench_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if ((s_threadCount == 0U) || (s_threadCount > BENCH_MAX_THREADS) || (s_window == 0U) ||
+        (s_window > BENCH_MAX_WINDOW))
+    {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    /* first allocation initializes the memory manager, keep it out of the measure */
+    vPortFree(pvPortMalloc(s_sizes[0]));
+    vTaskHostGetStats(&suspend);
+
+    for (unsigned int i = 0U; i < s_threadCount; i++)
+    {
+        (void)pthread_create(&s_threads[i].thread, NULL, bench_thread, &s_threads[i]);
+    }
+
+    samples = calloc(BENCH_SAMPLES * s_threadCount, sizeof(uint64_t));
+    for (unsigned int i = 0U; i < s_threadCount; i++)
+    {
+        (void)pthread_join(s_threads[i].thread, NULL);
+        allocNs += s_threads[i].allocNs;
+        freeNs += s_threads[i].freeNs;
+        ops += s_threads[i].ops;
+        failures += s_threads[i].failures;
+        if (samples != NULL)
+        {
+            (void)memcpy(&samples[sampleCount], s_threads[i].samples, s_threads[i].sampleCount * sizeof(uint64_t));
+            sampleCount += s_threads[i].sampleCount;
+        }
+    }
+
+    vTaskHostGetStats(&suspend);
+
+    printf("%u threads, %u live buffers per thread, %llu allocations, %llu failures\n", s_threadCount, s_window,
+           (unsigned long long)ops, (unsigned long long)failures);
+    printf("pvPortMalloc: %.1f ns, vPortFree: %.1f ns\n", (double)allocNs / (double)ops, (double)freeNs / (double)ops);
+    if ((samples != NULL) && (sampleCount != 0U))
+    {
+        qsort(samples, sampleCount, sizeof(uint64_t), bench_compare);
+        printf("pvPortMalloc: p50 %llu ns, p99 %llu ns, max %llu ns\n",
+               (unsigned long long)samples[sampleCount / 2U], (unsigned long long)samples[(sampleCount * 99U) / 100U],
+               (unsigned long long)samples[sampleCount - 1U]);
+    }
+    printf("scheduler suspended: %.3f times per operation, %.1f ns per operation, max %llu ns\n",
+           (double)suspend.suspendCount / (double)(2U * ops), (double)suspend.suspendTotal / (double)(2U * ops),
+           (unsigned long long)suspend.suspendMax);
+
+#if (CONFIG_FWK_HEAP_STATS > 0)
+    bench_print_heap_stats();
+#endif
+
+    free(samples);
+
+    return 0;
+}
@@ -0,0 +1,16 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_adapter_flash.h
+ * \brief Host replacement of the SDK flash adapter header. The framework services built on the host include it but
+ *        don't access the flash, so it declares nothing.
+ *
+ */
+
+#ifndef _FSL_ADAPTER_FLASH_H_
+#define _FSL_ADAPTER_FLASH_H_
+
+#include "fsl_common.h"
+
+#endif /* _FSL_ADAPTER_FLASH_H_ */
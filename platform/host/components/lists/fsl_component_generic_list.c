@@ -0,0 +1,210 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_generic_list.c
+ * \brief Host replacement of the SDK generic list component. As in the SDK component, the list functions don't lock,
+ *        the callers protect the lists, and an element is searched in the list before being added to it.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include "fsl_component_generic_list.h"
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+static list_status_t LIST_Check(list_handle_t list, list_element_handle_t element)
+{
+    list_status_t         status = kLIST_Ok;
+    list_element_handle_t node   = list->head;
+
+    if ((list->max != 0U) && (list->size >= list->max))
+    {
+        status = kLIST_Full;
+    }
+    else
+    {
+        while (node != NULL)
+        {
+            if (node == element)
+            {
+                status = kLIST_DuplicateError;
+                break;
+            }
+            node = node->next;
+        }
+    }
+
+    return status;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+void LIST_Init(list_handle_t list, uint32_t max)
+{
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0U;
+    list->max  = max;
+}
+
+list_status_t LIST_AddTail(list_handle_t list, list_element_handle_t element)
+{
+    list_status_t status = LIST_Check(list, element);
+
+    if (status == kLIST_Ok)
+    {
+        element->next = NULL;
+        element->prev = list->tail;
+        element->list = list;
+        if (list->tail != NULL)
+        {
+            list->tail->next = element;
+        }
+        else
+        {
+            list->head = element;
+        }
+        list->tail = element;
+        list->size++;
+    }
+
+    return status;
+}
+
+list_status_t LIST_AddHead(list_handle_t list, list_element_handle_t element)
+{
+    list_status_t status = LIST_Check(list, element);
+
+    if (status == kLIST_Ok)
+    {
+        element->next = list->head;
+        element->prev = NULL;
+        element->list = list;
+        if (list->head != NULL)
+        {
+            list->head->prev = element;
+        }
+        else
+        {
+            list->tail = element;
+        }
+        list->head = element;
+        list->size++;
+    }
+
+    return status;
+}
+
+list_element_handle_t LIST_RemoveHead(list_handle_t list)
+{
+    list_element_handle_t element = list->head;
+
+    if (element != NULL)
+    {
+        (void)LIST_RemoveElement(element);
+    }
+
+    return element;
+}
+
+list_element_handle_t LIST_GetHead(list_handle_t list)
+{
+    return list->head;
+}
+
+list_element_handle_t LIST_GetNext(list_element_handle_t element)
+{
+    return element->next;
+}
+
+list_element_handle_t LIST_GetPrev(list_element_handle_t element)
+{
+    return element->prev;
+}
+
+list_status_t LIST_RemoveElement(list_element_handle_t element)
+{
+    list_status_t status = kLIST_Ok;
+    list_handle_t list   = element->list;
+
+    if (list == NULL)
+    {
+        status = kLIST_OrphanElement;
+    }
+    else
+    {
+        if (element->prev != NULL)
+        {
+            element->prev->next = element->next;
+        }
+        else
+        {
+            list->head = element->next;
+        }
+        if (element->next != NULL)
+        {
+            element->next->prev = element->prev;
+        }
+        else
+        {
+            list->tail = element->prev;
+        }
+        list->size--;
+        element->next = NULL;
+        element->prev = NULL;
+        element->list = NULL;
+    }
+
+    return status;
+}
+
+list_status_t LIST_AddPrevElement(list_element_handle_t element, list_element_handle_t newElement)
+{
+    list_status_t status;
+    list_handle_t list = element->list;
+
+    if (list == NULL)
+    {
+        status = kLIST_OrphanElement;
+    }
+    else
+    {
+        status = LIST_Check(list, newElement);
+        if (status == kLIST_Ok)
+        {
+            newElement->list = list;
+            newElement->next = element;
+            newElement->prev = element->prev;
+            if (element->prev != NULL)
+            {
+                element->prev->next = newElement;
+            }
+            else
+            {
+                list->head = newElement;
+            }
+            element->prev = newElement;
+            list->size++;
+        }
+    }
+
+    return status;
+}
+
+uint32_t LIST_GetSize(list_handle_t list)
+{
+    return list->size;
+}
+
+list_handle_t LIST_GetList(list_element_handle_t element)
+{
+    return element->list;
+}
@@ -0,0 +1,151 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_generic_list.h
+ * \brief Host replacement of the SDK generic list component, limited to the API used by the host OSA port and the
+ *        framework services built on the host. The types and the status codes match the SDK component.
+ *
+ */
+
+#ifndef _FSL_COMPONENT_GENERIC_LIST_H_
+#define _FSL_COMPONENT_GENERIC_LIST_H_
+
+#include "fsl_common.h"
+
+/* -------------------------------------------------------------------------- */
+/*                                Public types                                */
+/* -------------------------------------------------------------------------- */
+
+/*! \brief The list status */
+typedef enum _list_status
+{
+    kLIST_Ok             = kStatus_Success,                   /*!< Success */
+    kLIST_DuplicateError = MAKE_STATUS(kStatusGroup_LIST, 1), /*!< Duplicate Error */
+    kLIST_Full           = MAKE_STATUS(kStatusGroup_LIST, 2), /*!< Full */
+    kLIST_Empty          = MAKE_STATUS(kStatusGroup_LIST, 3), /*!< Empty */
+    kLIST_OrphanElement  = MAKE_STATUS(kStatusGroup_LIST, 4), /*!< Orphan Element */
+    kLIST_NotSupport     = MAKE_STATUS(kStatusGroup_LIST, 5), /*!< Not Support */
+} list_status_t;
+
+/*! \brief The list structure */
+typedef struct list_label
+{
+    struct list_element_tag *head; /*!< list head */
+    struct list_element_tag *tail; /*!< list tail */
+    uint32_t                 size; /*!< list size */
+    uint32_t                 max;  /*!< list max number of elements, 0 if unlimited */
+} list_label_t, *list_handle_t;
+
+/*! \brief The list element */
+typedef struct list_element_tag
+{
+    struct list_element_tag *next; /*!< next list element */
+    struct list_element_tag *prev; /*!< previous list element */
+    struct list_label       *list; /*!< pointer to the list */
+} list_element_t, *list_element_handle_t;
+
+/* -------------------------------------------------------------------------- */
+/*                              Public prototypes                             */
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * \brief Initializes the list descriptor.
+ *
+ * \param[in] list handle of the list
+ * \param[in] max maximum number of elements in the list, 0 for unlimited
+ */
+void LIST_Init(list_handle_t list, uint32_t max);
+
+/*!
+ * \brief Links an element at the tail of the list.
+ *
+ * \param[in] list handle of the list
+ * \param[in] element element to add
+ * \return kLIST_Ok, kLIST_Full if the list is full, kLIST_DuplicateError if the element is already in a list
+ */
+list_status_t LIST_AddTail(list_handle_t list, list_element_handle_t element);
+
+/*!
+ * \brief Links an element at the head of the list.
+ *
+ * \param[in] list handle of the list
+ * \param[in] element element to add
+ * \return kLIST_Ok, kLIST_Full if the list is full, kLIST_DuplicateError if the element is already in a list
+ */
+list_status_t LIST_AddHead(list_handle_t list, list_element_handle_t element);
+
+/*!
+ * \brief Unlinks the element at the head of the list.
+ *
+ * \param[in] list handle of the list
+ * \return the element, or NULL if the list is empty
+ */
+list_element_handle_t LIST_RemoveHead(list_handle_t list);
+
+/*!
+ * \brief Gets the head element of the list.
+ *
+ * \param[in] list handle of the list
+ * \return the element, or NULL if the list is empty
+ */
+list_element_handle_t LIST_GetHead(list_handle_t list);
+
+/*!
+ * \brief Gets the next element of the list.
+ *
+ * \param[in] element element of the list
+ * \return the next element, or NULL at the tail of the list
+ */
+list_element_handle_t LIST_GetNext(list_element_handle_t element);
+
+/*!
+ * \brief Gets the previous element of the list.
+ *
+ * \param[in] element element of the list
+ * \return the previous element, or NULL at the head of the list
+ */
+list_element_handle_t LIST_GetPrev(list_element_handle_t element);
+
+/*!
+ * \brief Unlinks an element from its list.
+ *
+ * \param[in] element element to remove
+ * \return kLIST_Ok, or kLIST_OrphanElement if the element is not in a list
+ */
+list_status_t LIST_RemoveElement(list_element_handle_t element);
+
+/*!
+ * \brief Links an element before another element of a list.
+ *
+ * \param[in] element element of the list
+ * \param[in] newElement element to add before it
+ * \return kLIST_Ok, kLIST_OrphanElement, kLIST_Full or kLIST_DuplicateError
+ */
+list_status_t LIST_AddPrevElement(list_element_handle_t element, list_element_handle_t newElement);
+
+/*!
+ * \brief Gets the number of elements of the list.
+ *
+ * \param[in] list handle of the list
+ * \return the number of elements
+ */
+uint32_t LIST_GetSize(list_handle_t list);
+
+/*!
+ * \brief Gets the list an element is linked to.
+ *
+ * \param[in] element element
+ * \return the handle of the list, or NULL if the element is not in a list
+ */
+list_handle_t LIST_GetList(list_element_handle_t element);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _FSL_COMPONENT_GENERIC_LIST_H_ */
@@ -0,0 +1,233 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_mem_manager.c
+ * \brief Host replacement of the SDK memory manager component. The heap is protected by the global interrupt
+ *        masking, which is the OSA critical section on the host.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include "fsl_component_mem_manager.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#define MEM_BLOCK_ALIGN       16U
+#define MEM_BLOCK_HEADER_SIZE ((uint32_t)sizeof(mem_block_t))
+#define MEM_BLOCK_MIN_SIZE    (MEM_BLOCK_HEADER_SIZE + MEM_BLOCK_ALIGN)
+#define MEM_BLOCK_MAGIC       0x4D454D42U
+
+/* -------------------------------------------------------------------------- */
+/*                               Private types                                */
+/* -------------------------------------------------------------------------- */
+
+/* Header of the blocks, the buffers follow it. The free blocks are linked in address order. */
+typedef struct mem_block
+{
+    _Alignas(MEM_BLOCK_ALIGN) uint32_t size; /* size of the block including the header */
+    uint32_t          reqSize;               /* size requested by the caller, 0 for a free block */
+    uint32_t          magic;                 /* MEM_BLOCK_MAGIC while the block is allocated */
+    struct mem_block *next;                  /* next free block */
+} mem_block_t;
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+static _Alignas(MEM_BLOCK_ALIGN) uint8_t s_heap[MinimalHeapSize_c];
+static mem_block_t *s_freeList;
+static uint32_t     s_freeSize;
+static bool         s_initialized;
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+static void MEM_HeapInit(void)
+{
+    s_freeList          = (mem_block_t *)(void *)s_heap;
+    s_freeList->size    = (uint32_t)(sizeof(s_heap) & ~(MEM_BLOCK_ALIGN - 1U));
+    s_freeList->reqSize = 0U;
+    s_freeList->magic   = 0U;
+    s_freeList->next    = NULL;
+    s_freeSize          = s_freeList->size;
+    s_initialized       = true;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+mem_status_t MEM_Init(void)
+{
+    uint32_t regPrimask = DisableGlobalIRQ();
+
+    MEM_HeapInit();
+
+    EnableGlobalIRQ(regPrimask);
+
+    return kStatus_MemSuccess;
+}
+
+void *MEM_BufferAllocWithId(uint32_t numBytes, uint8_t poolId)
+{
+    void        *buffer = NULL;
+    mem_block_t **link;
+    mem_block_t  *block;
+    uint32_t      size;
+    uint32_t      regPrimask;
+
+    (void)poolId;
+
+    do
+    {
+        if ((numBytes == 0U) || (numBytes > (sizeof(s_heap) - MEM_BLOCK_HEADER_SIZE)))
+        {
+            break;
+        }
+
+        size = (numBytes + MEM_BLOCK_HEADER_SIZE + MEM_BLOCK_ALIGN - 1U) & ~(MEM_BLOCK_ALIGN - 1U);
+
+        regPrimask = DisableGlobalIRQ();
+
+        if (!s_initialized)
+        {
+            MEM_HeapInit();
+        }
+
+        /* first fit */
+        link = &s_freeList;
+        while ((*link != NULL) && ((*link)->size < size))
+        {
+            link = &(*link)->next;
+        }
+
+        block = *link;
+        if (block != NULL)
+        {
+            if ((block->size - size) >= MEM_BLOCK_MIN_SIZE)
+            {
+                /* split, the remainder stays in the free list at the same position */
+                mem_block_t *remainder = (mem_block_t *)(void *)((uint8_t *)block + size);
+
+                remainder->size    = block->size - size;
+                remainder->reqSize = 0U;
+                remainder->magic   = 0U;
+                remainder->next    = block->next;
+                *link              = remainder;
+                block->size        = size;
+            }
+            else
+            {
+                *link = block->next;
+            }
+
+            block->reqSize = numBytes;
+            block->magic   = MEM_BLOCK_MAGIC;
+            block->next    = NULL;
+            s_freeSize -= block->size;
+            buffer = (uint8_t *)block + MEM_BLOCK_HEADER_SIZE;
+        }
+
+        EnableGlobalIRQ(regPrimask);
+    } while (false);
+
+    return buffer;
+}
+
+void *MEM_BufferAlloc(uint32_t numBytes)
+{
+    return MEM_BufferAllocWithId(numBytes, 0U);
+}
+
+mem_status_t MEM_BufferFree(void *buffer)
+{
+    mem_status_t status = kStatus_MemFreeError;
+    mem_block_t *block;
+    mem_block_t *prev = NULL;
+    mem_block_t *next;
+    uint32_t     regPrimask;
+
+    do
+    {
+        if ((buffer == NULL) || ((uint8_t *)buffer < &s_heap[MEM_BLOCK_HEADER_SIZE]) ||
+            ((uint8_t *)buffer >= &s_heap[sizeof(s_heap)]))
+        {
+            break;
+        }
+
+        block = (mem_block_t *)(void *)((uint8_t *)buffer - MEM_BLOCK_HEADER_SIZE);
+
+        regPrimask = DisableGlobalIRQ();
+
+        if (block->magic == MEM_BLOCK_MAGIC)
+        {
+            block->magic   = 0U;
+            block->reqSize = 0U;
+            s_freeSize += block->size;
+
+            /* insert in address order, then merge with the neighbours */
+            next = s_freeList;
+            while ((next != NULL) && (next < block))
+            {
+                prev = next;
+                next = next->next;
+            }
+
+            if ((next != NULL) && (((uint8_t *)block + block->size) == (uint8_t *)next))
+            {
+                block->size += next->size;
+                block->next = next->next;
+            }
+            else
+            {
+                block->next = next;
+            }
+
+            if ((prev != NULL) && (((uint8_t *)prev + prev->size) == (uint8_t *)block))
+            {
+                prev->size += block->size;
+                prev->next = block->next;
+            }
+            else if (prev != NULL)
+            {
+                prev->next = block;
+            }
+            else
+            {
+                s_freeList = block;
+            }
+
+            status = kStatus_MemSuccess;
+        }
+
+        EnableGlobalIRQ(regPrimask);
+    } while (false);
+
+    return status;
+}
+
+uint16_t MEM_BufferGetSize(void *buffer)
+{
+    const mem_block_t *block = (const mem_block_t *)(const void *)((uint8_t *)buffer - MEM_BLOCK_HEADER_SIZE);
+
+    return (uint16_t)block->reqSize;
+}
+
+uint32_t MEM_GetFreeHeapSize(void)
+{
+    uint32_t freeSize = sizeof(s_heap);
+
+    if (s_initialized)
+    {
+        freeSize = s_freeSize;
+    }
+
+    return freeSize;
+}
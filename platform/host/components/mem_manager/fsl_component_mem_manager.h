@@ -0,0 +1,99 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_mem_manager.h
+ * \brief Host replacement of the SDK memory manager component, limited to the API used by the framework services
+ *        built on the host. The buffers are allocated from a static heap of MinimalHeapSize_c bytes, first fit, and the
+ *        free blocks are merged with their neighbours, so the heap can fragment as on the target.
+ *
+ */
+
+#ifndef _FSL_COMPONENT_MEM_MANAGER_H_
+#define _FSL_COMPONENT_MEM_MANAGER_H_
+
+#include "fsl_common.h"
+
+/* -------------------------------------------------------------------------- */
+/*                        Public macros and definitions                       */
+/* -------------------------------------------------------------------------- */
+
+/*! \brief Size of the heap in bytes, can be overridden on the command line */
+#ifndef MinimalHeapSize_c
+#define MinimalHeapSize_c (256U * 1024U)
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                                Public types                                */
+/* -------------------------------------------------------------------------- */
+
+/*! \brief The memory manager status */
+typedef enum _mem_status
+{
+    kStatus_MemSuccess      = kStatus_Success,                          /*!< No error occurred */
+    kStatus_MemInitError    = MAKE_STATUS(kStatusGroup_MEM_MANAGER, 1), /*!< Memory initialization error */
+    kStatus_MemAllocError   = MAKE_STATUS(kStatusGroup_MEM_MANAGER, 2), /*!< Memory allocation error */
+    kStatus_MemFreeError    = MAKE_STATUS(kStatusGroup_MEM_MANAGER, 3), /*!< Memory free error */
+    kStatus_MemUnknownError = MAKE_STATUS(kStatusGroup_MEM_MANAGER, 4), /*!< Something bad has happened... */
+} mem_status_t;
+
+/* -------------------------------------------------------------------------- */
+/*                              Public prototypes                             */
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * \brief Initializes the heap, all the buffers allocated before are lost.
+ *
+ * \return kStatus_MemSuccess
+ */
+mem_status_t MEM_Init(void);
+
+/*!
+ * \brief Allocates a buffer.
+ *
+ * \param[in] numBytes size of the buffer in bytes
+ * \return pointer to the buffer, or NULL if the heap has no free block large enough or numBytes is 0
+ */
+void *MEM_BufferAlloc(uint32_t numBytes);
+
+/*!
+ * \brief Allocates a buffer, the host heap has a single pool so poolId is ignored.
+ *
+ * \param[in] numBytes size of the buffer in bytes
+ * \param[in] poolId identifier of the pool
+ * \return pointer to the buffer, or NULL if the heap has no free block large enough or numBytes is 0
+ */
+void *MEM_BufferAllocWithId(uint32_t numBytes, uint8_t poolId);
+
+/*!
+ * \brief Frees a buffer.
+ *
+ * \param[in] buffer pointer to the buffer
+ * \return kStatus_MemSuccess, or kStatus_MemFreeError if the buffer is not an allocated buffer of the heap
+ */
+mem_status_t MEM_BufferFree(void *buffer);
+
+/*!
+ * \brief Gets the size requested when a buffer was allocated.
+ *
+ * \param[in] buffer pointer to the buffer
+ * \return size of the buffer in bytes
+ */
+uint16_t MEM_BufferGetSize(void *buffer);
+
+/*!
+ * \brief Gets the free size of the heap, the sum of the free blocks.
+ *
+ * \return free size in bytes
+ */
+uint32_t MEM_GetFreeHeapSize(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _FSL_COMPONENT_MEM_MANAGER_H_ */
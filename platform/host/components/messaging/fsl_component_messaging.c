@@ -0,0 +1,105 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_messaging.c
+ * \brief Host replacement of the SDK messaging component. The queues are protected by the global interrupt masking,
+ *        which is the OSA critical section on the host.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include "fsl_component_messaging.h"
+#include "fsl_component_mem_manager.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#define MSG_ELEMENT(msg) (((list_element_handle_t)(msg)) - 1)
+#define MSG_PAYLOAD(elm) ((void *)(((list_element_handle_t)(elm)) + 1))
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+void MSG_QueueInit(messaging_t *msgQueue)
+{
+    LIST_Init(msgQueue, 0U);
+}
+
+messaging_status_t MSG_QueueAddTail(messaging_t *msgQueue, void *msg)
+{
+    messaging_status_t status     = kStatus_MSG_Success;
+    uint32_t           regPrimask = DisableGlobalIRQ();
+
+    if (LIST_AddTail(msgQueue, MSG_ELEMENT(msg)) != kLIST_Ok)
+    {
+        status = kStatus_MSG_Error;
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    return status;
+}
+
+void *MSG_QueueRemoveHead(messaging_t *msgQueue)
+{
+    void                 *msg        = NULL;
+    list_element_handle_t element;
+    uint32_t              regPrimask = DisableGlobalIRQ();
+
+    element = LIST_RemoveHead(msgQueue);
+    if (element != NULL)
+    {
+        msg = MSG_PAYLOAD(element);
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    return msg;
+}
+
+void *MSG_QueueGetHead(messaging_t *msgQueue)
+{
+    void                 *msg        = NULL;
+    list_element_handle_t element;
+    uint32_t              regPrimask = DisableGlobalIRQ();
+
+    element = LIST_GetHead(msgQueue);
+    if (element != NULL)
+    {
+        msg = MSG_PAYLOAD(element);
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    return msg;
+}
+
+void *MSG_Alloc(uint32_t length)
+{
+    void                 *msg     = NULL;
+    list_element_handle_t element = MEM_BufferAlloc((uint32_t)sizeof(list_element_t) + length);
+
+    if (element != NULL)
+    {
+        element->next = NULL;
+        element->prev = NULL;
+        element->list = NULL;
+        msg           = MSG_PAYLOAD(element);
+    }
+
+    return msg;
+}
+
+void MSG_Free(void *msg)
+{
+    if (msg != NULL)
+    {
+        (void)MEM_BufferFree(MSG_ELEMENT(msg));
+    }
+}
@@ -0,0 +1,90 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_messaging.h
+ * \brief Host replacement of the SDK messaging component, limited to the API used by the framework services built on
+ *        the host. As in the SDK component, the messages are memory manager buffers prefixed by a list element.
+ *
+ */
+
+#ifndef _FSL_COMPONENT_MESSAGING_H_
+#define _FSL_COMPONENT_MESSAGING_H_
+
+#include "fsl_common.h"
+#include "fsl_component_generic_list.h"
+
+/* -------------------------------------------------------------------------- */
+/*                                Public types                                */
+/* -------------------------------------------------------------------------- */
+
+/*! \brief The messaging status */
+typedef enum _messaging_status
+{
+    kStatus_MSG_Success = kStatus_Success,                  /*!< Success */
+    kStatus_MSG_Error   = MAKE_STATUS(kStatusGroup_MSG, 1), /*!< Failed */
+} messaging_status_t;
+
+/*! \brief A message queue */
+typedef list_label_t messaging_t;
+
+/* -------------------------------------------------------------------------- */
+/*                              Public prototypes                             */
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * \brief Initializes a message queue.
+ *
+ * \param[in] msgQueue message queue
+ */
+void MSG_QueueInit(messaging_t *msgQueue);
+
+/*!
+ * \brief Links a message at the tail of a queue.
+ *
+ * \param[in] msgQueue message queue
+ * \param[in] msg message allocated with MSG_Alloc()
+ * \return kStatus_MSG_Success, or kStatus_MSG_Error if the message is already in the queue
+ */
+messaging_status_t MSG_QueueAddTail(messaging_t *msgQueue, void *msg);
+
+/*!
+ * \brief Unlinks the message at the head of a queue.
+ *
+ * \param[in] msgQueue message queue
+ * \return the message, or NULL if the queue is empty
+ */
+void *MSG_QueueRemoveHead(messaging_t *msgQueue);
+
+/*!
+ * \brief Gets the message at the head of a queue.
+ *
+ * \param[in] msgQueue message queue
+ * \return the message, or NULL if the queue is empty
+ */
+void *MSG_QueueGetHead(messaging_t *msgQueue);
+
+/*!
+ * \brief Allocates a message.
+ *
+ * \param[in] length size of the message in bytes
+ * \return the message, or NULL if the memory manager has no free buffer
+ */
+void *MSG_Alloc(uint32_t length);
+
+/*!
+ * \brief Frees a message, which must not be in a queue.
+ *
+ * \param[in] msg message
+ */
+void MSG_Free(void *msg);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _FSL_COMPONENT_MESSAGING_H_ */
@@ -0,0 +1,17 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_adapter_reset.c
+ * \brief Host replacement of the SDK reset adapter.
+ *
+ */
+
+#include <stdlib.h>
+
+#include "fsl_adapter_reset.h"
+
+void HAL_ResetMCU(void)
+{
+    exit(EXIT_SUCCESS);
+}
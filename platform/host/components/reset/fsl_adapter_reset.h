@@ -0,0 +1,28 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_adapter_reset.h
+ * \brief Host replacement of the SDK reset adapter.
+ *
+ */
+
+#ifndef _FSL_ADAPTER_RESET_H_
+#define _FSL_ADAPTER_RESET_H_
+
+#include "fsl_common.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * \brief Resets the MCU, the host process exits with EXIT_SUCCESS so that a supervisor can start it again.
+ */
+void HAL_ResetMCU(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _FSL_ADAPTER_RESET_H_ */
@@ -0,0 +1,406 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_serial_manager.c
+ * \brief Host replacement of the SDK serial manager component, on top of a file descriptor. A reader thread fills the
+ *        ring buffer and calls the RX callback, a writer thread writes the non-blocking buffers in order and calls
+ *        their TX callbacks.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "fsl_component_serial_manager.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+/* period of the reader thread checks for a stop request */
+#define SERIAL_MANAGER_POLL_TIMEOUT_MS 50
+
+/* -------------------------------------------------------------------------- */
+/*                               Private types                                */
+/* -------------------------------------------------------------------------- */
+
+typedef struct serial_manager_handle serial_manager_handle_t;
+
+typedef struct serial_manager_write_handle
+{
+    serial_manager_handle_t            *serialHandle;
+    struct serial_manager_write_handle *next;
+    serial_manager_callback_t           callback;
+    void                               *callbackParam;
+    uint8_t                            *buffer;
+    uint32_t                            length;
+    bool                                busy;
+} serial_manager_write_handle_t;
+
+typedef struct serial_manager_read_handle
+{
+    serial_manager_handle_t  *serialHandle;
+    serial_manager_callback_t callback;
+    void                     *callbackParam;
+} serial_manager_read_handle_t;
+
+struct serial_manager_handle
+{
+    int                            fd;
+    uint8_t                       *ringBuffer;
+    uint32_t                       ringBufferSize;
+    uint32_t                       ringHead;
+    uint32_t                       ringTail;
+    serial_manager_read_handle_t  *readHandle;
+    serial_manager_write_handle_t *txHead;
+    serial_manager_write_handle_t *txTail;
+    pthread_mutex_t                txLock;
+    pthread_cond_t                 txCond;
+    pthread_mutex_t                writeLock;
+    pthread_t                      reader;
+    pthread_t                      writer;
+    volatile bool                  stop;
+};
+
+_Static_assert(sizeof(serial_manager_handle_t) <= SERIAL_MANAGER_HANDLE_SIZE, "SERIAL_MANAGER_HANDLE_SIZE too small");
+_Static_assert(sizeof(serial_manager_write_handle_t) <= SERIAL_MANAGER_WRITE_HANDLE_SIZE,
+               "SERIAL_MANAGER_WRITE_HANDLE_SIZE too small");
+_Static_assert(sizeof(serial_manager_read_handle_t) <= SERIAL_MANAGER_READ_HANDLE_SIZE,
+               "SERIAL_MANAGER_READ_HANDLE_SIZE too small");
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+static bool SerialManager_WriteFd(serial_manager_handle_t *handle, const uint8_t *buffer, uint32_t length)
+{
+    bool    ok = true;
+    ssize_t written;
+
+    (void)pthread_mutex_lock(&handle->writeLock);
+    while (length != 0U)
+    {
+        written = write(handle->fd, buffer, length);
+        if (written < 0)
+        {
+            if (errno != EINTR)
+            {
+                ok = false;
+                break;
+            }
+        }
+        else
+        {
+            buffer += written;
+            length -= (uint32_t)written;
+        }
+    }
+    (void)pthread_mutex_unlock(&handle->writeLock);
+
+    return ok;
+}
+
+static void *SerialManager_ReaderThread(void *arg)
+{
+    serial_manager_handle_t          *handle = (serial_manager_handle_t *)arg;
+    serial_manager_read_handle_t     *readHandle;
+    serial_manager_callback_message_t msg;
+    struct pollfd                     pfd = {.fd = handle->fd, .events = POLLIN};
+    uint8_t                           chunk[256];
+    ssize_t                           count;
+    uint32_t                          regPrimask;
+    uint32_t                          next;
+
+    while (!handle->stop)
+    {
+        if (poll(&pfd, 1, SERIAL_MANAGER_POLL_TIMEOUT_MS) <= 0)
+        {
+            continue;
+        }
+
+        count = read(handle->fd, chunk, sizeof(chunk));
+        if (count <= 0)
+        {
+            if ((count < 0) && ((errno == EINTR) || (errno == EAGAIN)))
+            {
+                continue;
+            }
+            /* the peer closed the port, wait for it to be opened again */
+            (void)usleep(SERIAL_MANAGER_POLL_TIMEOUT_MS * 1000);
+            continue;
+        }
+
+        /* the ring buffer is shared with the "thread" context readers, as with the UART interrupt */
+        regPrimask = DisableGlobalIRQ();
+        for (ssize_t i = 0; i < count; i++)
+        {
+            next = (handle->ringHead + 1U) % handle->ringBufferSize;
+            if (next == handle->ringTail)
+            {
+                /* overflow, the oldest byte is dropped */
+                handle->ringTail = (handle->ringTail + 1U) % handle->ringBufferSize;
+            }
+            handle->ringBuffer[handle->ringHead] = chunk[i];
+            handle->ringHead                     = next;
+        }
+        readHandle = handle->readHandle;
+        EnableGlobalIRQ(regPrimask);
+
+        if ((readHandle != NULL) && (readHandle->callback != NULL))
+        {
+            msg.buffer = NULL;
+            msg.length = (uint32_t)count;
+            readHandle->callback(readHandle->callbackParam, &msg, kStatus_SerialManager_Notify);
+        }
+    }
+
+    return NULL;
+}
+
+static void *SerialManager_WriterThread(void *arg)
+{
+    serial_manager_handle_t          *handle = (serial_manager_handle_t *)arg;
+    serial_manager_write_handle_t    *writeHandle;
+    serial_manager_callback_message_t msg;
+    serial_manager_status_t           status;
+
+    for (;;)
+    {
+        (void)pthread_mutex_lock(&handle->txLock);
+        while ((handle->txHead == NULL) && !handle->stop)
+        {
+            (void)pthread_cond_wait(&handle->txCond, &handle->txLock);
+        }
+        writeHandle = handle->txHead;
+        if (writeHandle != NULL)
+        {
+            handle->txHead = writeHandle->next;
+            if (handle->txHead == NULL)
+            {
+                handle->txTail = NULL;
+            }
+        }
+        (void)pthread_mutex_unlock(&handle->txLock);
+
+        if (writeHandle == NULL)
+        {
+            break;
+        }
+
+        status = SerialManager_WriteFd(handle, writeHandle->buffer, writeHandle->length) ?
+                     kStatus_SerialManager_Success :
+                     kStatus_SerialManager_Error;
+
+        msg.buffer        = writeHandle->buffer;
+        msg.length        = writeHandle->length;
+        writeHandle->busy = false;
+        /* the callback may free the write handle */
+        if (writeHandle->callback != NULL)
+        {
+            writeHandle->callback(writeHandle->callbackParam, &msg, status);
+        }
+    }
+
+    return NULL;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+serial_manager_status_t SerialManager_Init(serial_handle_t serialHandle, const serial_manager_config_t *config)
+{
+    serial_manager_status_t  status = kStatus_SerialManager_Success;
+    serial_manager_handle_t *handle = (serial_manager_handle_t *)serialHandle;
+
+    assert((handle != NULL) && (config != NULL) && (config->ringBuffer != NULL) && (config->ringBufferSize > 1U));
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->fd             = config->fd;
+    handle->ringBuffer     = config->ringBuffer;
+    handle->ringBufferSize = config->ringBufferSize;
+    (void)pthread_mutex_init(&handle->txLock, NULL);
+    (void)pthread_cond_init(&handle->txCond, NULL);
+    (void)pthread_mutex_init(&handle->writeLock, NULL);
+
+    if ((pthread_create(&handle->reader, NULL, SerialManager_ReaderThread, handle) != 0) ||
+        (pthread_create(&handle->writer, NULL, SerialManager_WriterThread, handle) != 0))
+    {
+        status = kStatus_SerialManager_Error;
+    }
+
+    return status;
+}
+
+serial_manager_status_t SerialManager_Deinit(serial_handle_t serialHandle)
+{
+    serial_manager_handle_t *handle = (serial_manager_handle_t *)serialHandle;
+
+    (void)pthread_mutex_lock(&handle->txLock);
+    handle->stop = true;
+    (void)pthread_cond_signal(&handle->txCond);
+    (void)pthread_mutex_unlock(&handle->txLock);
+
+    (void)pthread_join(handle->reader, NULL);
+    (void)pthread_join(handle->writer, NULL);
+
+    return kStatus_SerialManager_Success;
+}
+
+serial_manager_status_t SerialManager_OpenWriteHandle(serial_handle_t serialHandle, serial_write_handle_t writeHandle)
+{
+    serial_manager_write_handle_t *handle = (serial_manager_write_handle_t *)writeHandle;
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->serialHandle = (serial_manager_handle_t *)serialHandle;
+
+    return kStatus_SerialManager_Success;
+}
+
+serial_manager_status_t SerialManager_CloseWriteHandle(serial_write_handle_t writeHandle)
+{
+    (void)memset(writeHandle, 0, sizeof(serial_manager_write_handle_t));
+
+    return kStatus_SerialManager_Success;
+}
+
+serial_manager_status_t SerialManager_OpenReadHandle(serial_handle_t serialHandle, serial_read_handle_t readHandle)
+{
+    serial_manager_status_t       status       = kStatus_SerialManager_Success;
+    serial_manager_handle_t      *handle       = (serial_manager_handle_t *)serialHandle;
+    serial_manager_read_handle_t *pReadHandle  = (serial_manager_read_handle_t *)readHandle;
+    uint32_t                      regPrimask   = DisableGlobalIRQ();
+
+    if (handle->readHandle != NULL)
+    {
+        status = kStatus_SerialManager_Busy;
+    }
+    else
+    {
+        (void)memset(pReadHandle, 0, sizeof(*pReadHandle));
+        pReadHandle->serialHandle = handle;
+        handle->readHandle        = pReadHandle;
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    return status;
+}
+
+serial_manager_status_t SerialManager_CloseReadHandle(serial_read_handle_t readHandle)
+{
+    serial_manager_read_handle_t *pReadHandle = (serial_manager_read_handle_t *)readHandle;
+    uint32_t                      regPrimask  = DisableGlobalIRQ();
+
+    if ((pReadHandle->serialHandle != NULL) && (pReadHandle->serialHandle->readHandle == pReadHandle))
+    {
+        pReadHandle->serialHandle->readHandle = NULL;
+    }
+    pReadHandle->serialHandle = NULL;
+
+    EnableGlobalIRQ(regPrimask);
+
+    return kStatus_SerialManager_Success;
+}
+
+serial_manager_status_t SerialManager_WriteBlocking(serial_write_handle_t writeHandle,
+                                                    uint8_t              *buffer,
+                                                    uint32_t              length)
+{
+    serial_manager_write_handle_t *handle = (serial_manager_write_handle_t *)writeHandle;
+
+    return SerialManager_WriteFd(handle->serialHandle, buffer, length) ? kStatus_SerialManager_Success :
+                                                                         kStatus_SerialManager_Error;
+}
+
+serial_manager_status_t SerialManager_WriteNonBlocking(serial_write_handle_t writeHandle,
+                                                       uint8_t              *buffer,
+                                                       uint32_t              length)
+{
+    serial_manager_status_t        status = kStatus_SerialManager_Success;
+    serial_manager_write_handle_t *handle = (serial_manager_write_handle_t *)writeHandle;
+    serial_manager_handle_t       *serial = handle->serialHandle;
+
+    (void)pthread_mutex_lock(&serial->txLock);
+    if (handle->busy)
+    {
+        status = kStatus_SerialManager_Busy;
+    }
+    else
+    {
+        handle->busy   = true;
+        handle->buffer = buffer;
+        handle->length = length;
+        handle->next   = NULL;
+        if (serial->txTail != NULL)
+        {
+            serial->txTail->next = handle;
+        }
+        else
+        {
+            serial->txHead = handle;
+        }
+        serial->txTail = handle;
+        (void)pthread_cond_signal(&serial->txCond);
+    }
+    (void)pthread_mutex_unlock(&serial->txLock);
+
+    return status;
+}
+
+serial_manager_status_t SerialManager_TryRead(serial_read_handle_t readHandle,
+                                              uint8_t             *buffer,
+                                              uint32_t             length,
+                                              uint32_t            *receivedLength)
+{
+    serial_manager_handle_t *handle     = ((serial_manager_read_handle_t *)readHandle)->serialHandle;
+    uint32_t                 count      = 0U;
+    uint32_t                 regPrimask = DisableGlobalIRQ();
+
+    while ((count < length) && (handle->ringTail != handle->ringHead))
+    {
+        buffer[count] = handle->ringBuffer[handle->ringTail];
+        handle->ringTail = (handle->ringTail + 1U) % handle->ringBufferSize;
+        count++;
+    }
+
+    EnableGlobalIRQ(regPrimask);
+
+    *receivedLength = count;
+
+    return kStatus_SerialManager_Success;
+}
+
+serial_manager_status_t SerialManager_InstallTxCallback(serial_write_handle_t     writeHandle,
+                                                        serial_manager_callback_t callback,
+                                                        void                     *callbackParam)
+{
+    serial_manager_write_handle_t *handle = (serial_manager_write_handle_t *)writeHandle;
+
+    handle->callback      = callback;
+    handle->callbackParam = callbackParam;
+
+    return kStatus_SerialManager_Success;
+}
+
+serial_manager_status_t SerialManager_InstallRxCallback(serial_read_handle_t      readHandle,
+                                                        serial_manager_callback_t callback,
+                                                        void                     *callbackParam)
+{
+    serial_manager_read_handle_t *handle     = (serial_manager_read_handle_t *)readHandle;
+    uint32_t                      regPrimask = DisableGlobalIRQ();
+
+    handle->callback      = callback;
+    handle->callbackParam = callbackParam;
+
+    EnableGlobalIRQ(regPrimask);
+
+    return kStatus_SerialManager_Success;
+}
@@ -0,0 +1,202 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_serial_manager.h
+ * \brief Host replacement of the SDK serial manager component, limited to the API used by the framework services
+ *        built on the host. The port is a file descriptor opened by the application, such as a pty master or a
+ *        socket, instead of a UART.
+ *
+ */
+
+#ifndef _FSL_COMPONENT_SERIAL_MANAGER_H_
+#define _FSL_COMPONENT_SERIAL_MANAGER_H_
+
+#include "fsl_common.h"
+
+/* -------------------------------------------------------------------------- */
+/*                        Public macros and definitions                       */
+/* -------------------------------------------------------------------------- */
+
+#define SERIAL_MANAGER_HANDLE_SIZE       (512U)
+#define SERIAL_MANAGER_WRITE_HANDLE_SIZE (64U)
+#define SERIAL_MANAGER_READ_HANDLE_SIZE  (32U)
+
+#define SERIAL_MANAGER_HANDLE_DEFINE(name) \
+    uint64_t name[((SERIAL_MANAGER_HANDLE_SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t))]
+#define SERIAL_MANAGER_WRITE_HANDLE_DEFINE(name) \
+    uint64_t name[((SERIAL_MANAGER_WRITE_HANDLE_SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t))]
+#define SERIAL_MANAGER_READ_HANDLE_DEFINE(name) \
+    uint64_t name[((SERIAL_MANAGER_READ_HANDLE_SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t))]
+
+/* -------------------------------------------------------------------------- */
+/*                                Public types                                */
+/* -------------------------------------------------------------------------- */
+
+typedef void *serial_handle_t;
+typedef void *serial_write_handle_t;
+typedef void *serial_read_handle_t;
+
+/*! \brief The serial manager status */
+typedef enum _serial_manager_status
+{
+    kStatus_SerialManager_Success            = kStatus_Success,                            /*!< Success */
+    kStatus_SerialManager_Error              = MAKE_STATUS(kStatusGroup_SERIALMANAGER, 1), /*!< Failed */
+    kStatus_SerialManager_Busy               = MAKE_STATUS(kStatusGroup_SERIALMANAGER, 2), /*!< Busy */
+    kStatus_SerialManager_Notify             = MAKE_STATUS(kStatusGroup_SERIALMANAGER, 3), /*!< Ring buffer is not empty */
+    kStatus_SerialManager_Canceled           = MAKE_STATUS(kStatusGroup_SERIALMANAGER, 4), /*!< Canceled */
+    kStatus_SerialManager_HandleConflict     = MAKE_STATUS(kStatusGroup_SERIALMANAGER, 5), /*!< Handle conflict */
+    kStatus_SerialManager_RingBufferOverflow = MAKE_STATUS(kStatusGroup_SERIALMANAGER, 6), /*!< Ring buffer overflow */
+    kStatus_SerialManager_NotConnected       = MAKE_STATUS(kStatusGroup_SERIALMANAGER, 7), /*!< Not connected */
+} serial_manager_status_t;
+
+/*! \brief Callback message structure */
+typedef struct _serial_manager_callback_message
+{
+    uint8_t *buffer; /*!< Transferred buffer */
+    uint32_t length; /*!< Transferred data length */
+} serial_manager_callback_message_t;
+
+/*! \brief Callback function */
+typedef void (*serial_manager_callback_t)(void                              *callbackParam,
+                                          serial_manager_callback_message_t *message,
+                                          serial_manager_status_t            status);
+
+/*! \brief Serial manager configuration */
+typedef struct _serial_manager_config
+{
+    uint8_t *ringBuffer;     /*!< Ring buffer of the received bytes */
+    uint32_t ringBufferSize; /*!< Size of the ring buffer in bytes */
+    int      fd;             /*!< Host file descriptor of the port, opened by the application */
+} serial_manager_config_t;
+
+/* -------------------------------------------------------------------------- */
+/*                              Public prototypes                             */
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * \brief Initializes a serial manager instance on a file descriptor, and starts its reader and writer threads. The
+ *        received bytes are stored in the ring buffer, and the RX callbacks are called from the reader thread, which
+ *        stands for the UART interrupt. The non-blocking writes are done by the writer thread, which calls their TX
+ *        callbacks.
+ *
+ * \param[in] serialHandle handle of the instance, defined with SERIAL_MANAGER_HANDLE_DEFINE()
+ * \param[in] config configuration of the instance
+ * \return kStatus_SerialManager_Success, or kStatus_SerialManager_Error if the threads could not be started
+ */
+serial_manager_status_t SerialManager_Init(serial_handle_t serialHandle, const serial_manager_config_t *config);
+
+/*!
+ * \brief Stops the threads of a serial manager instance, the file descriptor is not closed.
+ *
+ * \param[in] serialHandle handle of the instance
+ * \return kStatus_SerialManager_Success
+ */
+serial_manager_status_t SerialManager_Deinit(serial_handle_t serialHandle);
+
+/*!
+ * \brief Opens a write handle on a serial manager instance.
+ *
+ * \param[in] serialHandle handle of the instance
+ * \param[in] writeHandle write handle, defined with SERIAL_MANAGER_WRITE_HANDLE_DEFINE()
+ * \return kStatus_SerialManager_Success
+ */
+serial_manager_status_t SerialManager_OpenWriteHandle(serial_handle_t serialHandle, serial_write_handle_t writeHandle);
+
+/*!
+ * \brief Closes a write handle.
+ *
+ * \param[in] writeHandle write handle
+ * \return kStatus_SerialManager_Success
+ */
+serial_manager_status_t SerialManager_CloseWriteHandle(serial_write_handle_t writeHandle);
+
+/*!
+ * \brief Opens the read handle of a serial manager instance, only one read handle can be opened.
+ *
+ * \param[in] serialHandle handle of the instance
+ * \param[in] readHandle read handle, defined with SERIAL_MANAGER_READ_HANDLE_DEFINE()
+ * \return kStatus_SerialManager_Success, or kStatus_SerialManager_Busy if a read handle is already opened
+ */
+serial_manager_status_t SerialManager_OpenReadHandle(serial_handle_t serialHandle, serial_read_handle_t readHandle);
+
+/*!
+ * \brief Closes a read handle.
+ *
+ * \param[in] readHandle read handle
+ * \return kStatus_SerialManager_Success
+ */
+serial_manager_status_t SerialManager_CloseReadHandle(serial_read_handle_t readHandle);
+
+/*!
+ * \brief Writes a buffer and waits until it is written.
+ *
+ * \param[in] writeHandle write handle
+ * \param[in] buffer data to write
+ * \param[in] length number of bytes
+ * \return kStatus_SerialManager_Success, or kStatus_SerialManager_Error if the port is closed
+ */
+serial_manager_status_t SerialManager_WriteBlocking(serial_write_handle_t writeHandle,
+                                                    uint8_t              *buffer,
+                                                    uint32_t              length);
+
+/*!
+ * \brief Queues a buffer for the writer thread, the TX callback of the write handle is called once it is written. The
+ *        buffer must remain valid until then, and a write handle can only have one write in progress.
+ *
+ * \param[in] writeHandle write handle
+ * \param[in] buffer data to write
+ * \param[in] length number of bytes
+ * \return kStatus_SerialManager_Success, or kStatus_SerialManager_Busy if a write of the handle is in progress
+ */
+serial_manager_status_t SerialManager_WriteNonBlocking(serial_write_handle_t writeHandle,
+                                                       uint8_t              *buffer,
+                                                       uint32_t              length);
+
+/*!
+ * \brief Reads the bytes available in the ring buffer, without waiting.
+ *
+ * \param[in] readHandle read handle
+ * \param[out] buffer destination buffer
+ * \param[in] length size of the destination buffer
+ * \param[out] receivedLength number of bytes read
+ * \return kStatus_SerialManager_Success
+ */
+serial_manager_status_t SerialManager_TryRead(serial_read_handle_t readHandle,
+                                              uint8_t             *buffer,
+                                              uint32_t             length,
+                                              uint32_t            *receivedLength);
+
+/*!
+ * \brief Installs the TX callback of a write handle.
+ *
+ * \param[in] writeHandle write handle
+ * \param[in] callback callback function
+ * \param[in] callbackParam parameter of the callback
+ * \return kStatus_SerialManager_Success
+ */
+serial_manager_status_t SerialManager_InstallTxCallback(serial_write_handle_t     writeHandle,
+                                                        serial_manager_callback_t callback,
+                                                        void                     *callbackParam);
+
+/*!
+ * \brief Installs the RX callback of a read handle, called when bytes are received.
+ *
+ * \param[in] readHandle read handle
+ * \param[in] callback callback function
+ * \param[in] callbackParam parameter of the callback
+ * \return kStatus_SerialManager_Success
+ */
+serial_manager_status_t SerialManager_InstallRxCallback(serial_read_handle_t      readHandle,
+                                                        serial_manager_callback_t callback,
+                                                        void                     *callbackParam);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _FSL_COMPONENT_SERIAL_MANAGER_H_ */
@@ -0,0 +1,240 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_timer_manager.c
+ * \brief Host replacement of the SDK timer manager component. The running timers are kept in a list sorted by
+ *        expiration, a thread waits for the first one and calls the callbacks, as the timer task does on the target.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <pthread.h>
+#include <time.h>
+
+#include "fsl_component_timer_manager.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private types                                */
+/* -------------------------------------------------------------------------- */
+
+typedef struct timer_handle_struct
+{
+    struct timer_handle_struct *next;
+    timer_callback_t            callback;
+    void                       *callbackParam;
+    uint64_t                    expireUs;
+    uint64_t                    periodUs;
+    bool                        running;
+} timer_handle_struct_t;
+
+_Static_assert(sizeof(timer_handle_struct_t) <= TIMER_HANDLE_SIZE, "TIMER_HANDLE_SIZE too small");
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+static pthread_mutex_t        s_timerLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t         s_timerCond;
+static pthread_t              s_timerThread;
+static bool                   s_timerStarted;
+static timer_handle_struct_t *s_timerList;
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+/* must be called with s_timerLock held */
+static void TM_Unlink(timer_handle_struct_t *timer)
+{
+    timer_handle_struct_t **link = &s_timerList;
+
+    while ((*link != NULL) && (*link != timer))
+    {
+        link = &(*link)->next;
+    }
+    if (*link != NULL)
+    {
+        *link = timer->next;
+    }
+    timer->next    = NULL;
+    timer->running = false;
+}
+
+/* must be called with s_timerLock held */
+static void TM_Insert(timer_handle_struct_t *timer)
+{
+    timer_handle_struct_t **link = &s_timerList;
+
+    while ((*link != NULL) && ((*link)->expireUs <= timer->expireUs))
+    {
+        link = &(*link)->next;
+    }
+    timer->next    = *link;
+    timer->running = true;
+    *link          = timer;
+}
+
+static void *TM_Thread(void *arg)
+{
+    timer_handle_struct_t *timer;
+    timer_callback_t       callback;
+    void                  *callbackParam;
+    struct timespec        ts;
+    uint64_t               now;
+
+    (void)arg;
+
+    (void)pthread_mutex_lock(&s_timerLock);
+    for (;;)
+    {
+        timer = s_timerList;
+        now   = TM_GetTimestamp();
+
+        if (timer == NULL)
+        {
+            (void)pthread_cond_wait(&s_timerCond, &s_timerLock);
+        }
+        else if (timer->expireUs > now)
+        {
+            ts.tv_sec  = (time_t)(timer->expireUs / 1000000U);
+            ts.tv_nsec = (long)((timer->expireUs % 1000000U) * 1000U);
+            (void)pthread_cond_timedwait(&s_timerCond, &s_timerLock, &ts);
+        }
+        else
+        {
+            TM_Unlink(timer);
+            if (timer->periodUs != 0U)
+            {
+                timer->expireUs += timer->periodUs;
+                TM_Insert(timer);
+            }
+            callback      = timer->callback;
+            callbackParam = timer->callbackParam;
+
+            /* the callback can start or stop the timers */
+            (void)pthread_mutex_unlock(&s_timerLock);
+            if (callback != NULL)
+            {
+                callback(callbackParam);
+            }
+            (void)pthread_mutex_lock(&s_timerLock);
+        }
+    }
+
+    return NULL;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+timer_status_t TM_Init(timer_config_t *timerConfig)
+{
+    timer_status_t     status = kStatus_TimerSuccess;
+    pthread_condattr_t attr;
+
+    (void)timerConfig;
+
+    (void)pthread_mutex_lock(&s_timerLock);
+    if (!s_timerStarted)
+    {
+        (void)pthread_condattr_init(&attr);
+        (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        (void)pthread_cond_init(&s_timerCond, &attr);
+        (void)pthread_condattr_destroy(&attr);
+
+        if (pthread_create(&s_timerThread, NULL, TM_Thread, NULL) == 0)
+        {
+            (void)pthread_detach(s_timerThread);
+            s_timerStarted = true;
+        }
+        else
+        {
+            status = kStatus_TimerError;
+        }
+    }
+    (void)pthread_mutex_unlock(&s_timerLock);
+
+    return status;
+}
+
+timer_status_t TM_Open(timer_handle_t timerHandle)
+{
+    (void)memset(timerHandle, 0, sizeof(timer_handle_struct_t));
+
+    return TM_Init(NULL);
+}
+
+timer_status_t TM_Close(timer_handle_t timerHandle)
+{
+    return TM_Stop(timerHandle);
+}
+
+timer_status_t TM_InstallCallback(timer_handle_t timerHandle, timer_callback_t callback, void *callbackParam)
+{
+    timer_handle_struct_t *timer = (timer_handle_struct_t *)timerHandle;
+
+    (void)pthread_mutex_lock(&s_timerLock);
+    timer->callback      = callback;
+    timer->callbackParam = callbackParam;
+    (void)pthread_mutex_unlock(&s_timerLock);
+
+    return kStatus_TimerSuccess;
+}
+
+timer_status_t TM_Start(timer_handle_t timerHandle, uint8_t timerType, uint32_t timerTimeout)
+{
+    timer_status_t         status = kStatus_TimerSuccess;
+    timer_handle_struct_t *timer  = (timer_handle_struct_t *)timerHandle;
+    uint64_t               timeoutUs;
+
+    if ((timerType & ((uint8_t)kTimerModeSetMinuteTimer | (uint8_t)kTimerModeSetSecondTimer)) != 0U)
+    {
+        status = kStatus_TimerNotSupport;
+    }
+    else
+    {
+        timeoutUs = ((timerType & (uint8_t)kTimerModeSetMicrosTimer) != 0U) ? (uint64_t)timerTimeout :
+                                                                                (uint64_t)timerTimeout * 1000U;
+
+        (void)pthread_mutex_lock(&s_timerLock);
+        if (timer->running)
+        {
+            TM_Unlink(timer);
+        }
+        timer->expireUs = TM_GetTimestamp() + timeoutUs;
+        timer->periodUs = ((timerType & (uint8_t)kTimerModeIntervalTimer) != 0U) ? timeoutUs : 0U;
+        TM_Insert(timer);
+        (void)pthread_cond_signal(&s_timerCond);
+        (void)pthread_mutex_unlock(&s_timerLock);
+    }
+
+    return status;
+}
+
+timer_status_t TM_Stop(timer_handle_t timerHandle)
+{
+    timer_handle_struct_t *timer = (timer_handle_struct_t *)timerHandle;
+
+    (void)pthread_mutex_lock(&s_timerLock);
+    if (timer->running)
+    {
+        TM_Unlink(timer);
+    }
+    (void)pthread_mutex_unlock(&s_timerLock);
+
+    return kStatus_TimerSuccess;
+}
+
+uint64_t TM_GetTimestamp(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U);
+}
@@ -0,0 +1,132 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_component_timer_manager.h
+ * \brief Host replacement of the SDK timer manager component, limited to the API used by the framework services
+ *        built on the host. The timers follow the host monotonic clock.
+ *
+ */
+
+#ifndef _FSL_COMPONENT_TIMER_MANAGER_H_
+#define _FSL_COMPONENT_TIMER_MANAGER_H_
+
+#include "fsl_common.h"
+
+/* -------------------------------------------------------------------------- */
+/*                        Public macros and definitions                       */
+/* -------------------------------------------------------------------------- */
+
+#define TIMER_HANDLE_SIZE (64U)
+
+#define TIMER_MANAGER_HANDLE_DEFINE(name) uint64_t name[((TIMER_HANDLE_SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t))]
+
+/* -------------------------------------------------------------------------- */
+/*                                Public types                                */
+/* -------------------------------------------------------------------------- */
+
+typedef void *timer_handle_t;
+
+/*! \brief The timer status */
+typedef enum _timer_status
+{
+    kStatus_TimerSuccess    = kStatus_Success,                           /*!< Success */
+    kStatus_TimerInvalidId  = MAKE_STATUS(kStatusGroup_TIMERMANAGER, 1), /*!< Invalid Id */
+    kStatus_TimerNotSupport = MAKE_STATUS(kStatusGroup_TIMERMANAGER, 2), /*!< Not Supported */
+    kStatus_TimerOutOfRange = MAKE_STATUS(kStatusGroup_TIMERMANAGER, 3), /*!< Timer is out of range */
+    kStatus_TimerError      = MAKE_STATUS(kStatusGroup_TIMERMANAGER, 4), /*!< Failed */
+} timer_status_t;
+
+/*! \brief The timer modes, the host timers only support the single shot and interval modes in milliseconds */
+typedef enum _timer_mode
+{
+    kTimerModeSingleShot     = 0x01U, /*!< The timer will expire only once */
+    kTimerModeIntervalTimer  = 0x02U, /*!< The timer will repeat its expiration */
+    kTimerModeSetMinuteTimer = 0x04U, /*!< The timer will one minute timer */
+    kTimerModeSetSecondTimer = 0x08U, /*!< The timer will one second timer */
+    kTimerModeLowPowerTimer  = 0x10U, /*!< The timer will count in low power mode */
+    kTimerModeSetMicrosTimer = 0x20U, /*!< The timer will count in microseconds */
+} timer_mode_t;
+
+/*! \brief Timer callback, called from the timer thread */
+typedef void (*timer_callback_t)(void *param);
+
+/*! \brief Timer configuration, ignored on the host */
+typedef struct _timer_config
+{
+    uint32_t srcClock_Hz; /*!< Source clock */
+    uint8_t  instance;    /*!< Hardware timer module instance */
+} timer_config_t;
+
+/* -------------------------------------------------------------------------- */
+/*                              Public prototypes                             */
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * \brief Starts the timer thread, which calls the callbacks of the expired timers.
+ *
+ * \param[in] timerConfig configuration, ignored
+ * \return kStatus_TimerSuccess, or kStatus_TimerError if the thread could not be started
+ */
+timer_status_t TM_Init(timer_config_t *timerConfig);
+
+/*!
+ * \brief Opens a timer, the timer thread is started if TM_Init() was not called.
+ *
+ * \param[in] timerHandle handle of the timer, of TIMER_HANDLE_SIZE bytes
+ * \return kStatus_TimerSuccess, or kStatus_TimerError if the timer thread could not be started
+ */
+timer_status_t TM_Open(timer_handle_t timerHandle);
+
+/*!
+ * \brief Stops and closes a timer.
+ *
+ * \param[in] timerHandle handle of the timer
+ * \return kStatus_TimerSuccess
+ */
+timer_status_t TM_Close(timer_handle_t timerHandle);
+
+/*!
+ * \brief Installs the callback of a timer.
+ *
+ * \param[in] timerHandle handle of the timer
+ * \param[in] callback callback function
+ * \param[in] callbackParam parameter of the callback
+ * \return kStatus_TimerSuccess
+ */
+timer_status_t TM_InstallCallback(timer_handle_t timerHandle, timer_callback_t callback, void *callbackParam);
+
+/*!
+ * \brief Starts or restarts a timer.
+ *
+ * \param[in] timerHandle handle of the timer
+ * \param[in] timerType kTimerModeSingleShot or kTimerModeIntervalTimer, optionally with kTimerModeSetMicrosTimer
+ * \param[in] timerTimeout timeout in milliseconds, or in microseconds with kTimerModeSetMicrosTimer
+ * \return kStatus_TimerSuccess, or kStatus_TimerNotSupport for the minute and second modes
+ */
+timer_status_t TM_Start(timer_handle_t timerHandle, uint8_t timerType, uint32_t timerTimeout);
+
+/*!
+ * \brief Stops a timer.
+ *
+ * \param[in] timerHandle handle of the timer
+ * \return kStatus_TimerSuccess
+ */
+timer_status_t TM_Stop(timer_handle_t timerHandle);
+
+/*!
+ * \brief Gets the timestamp of the host monotonic clock.
+ *
+ * \return timestamp in microseconds
+ */
+uint64_t TM_GetTimestamp(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _FSL_COMPONENT_TIMER_MANAGER_H_ */
@@ -0,0 +1,17 @@
+/*
+ * Copyright 2025 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FWK_CONFIG_H_
+#define _FWK_CONFIG_H_
+
+/* The FSCI memory access commands carry 32-bit target addresses, which cannot address the host memory. The ranges are
+ * empty so that these commands are rejected. */
+#define gPlatformRamStartAddress_c   (0xFFFFFFFFU)
+#define gPlatformRamEndAddress_c     (0U)
+#define gPlatformFlashStartAddress_c (0xFFFFFFFFU)
+#define gPlatformFlashEndAddress_c   (0U)
+
+#endif /* _FWK_CONFIG_H_ */
@@ -0,0 +1,63 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file FreeRTOS.h
+ * \brief Host replacement of the FreeRTOS kernel header, limited to the definitions used by the framework FreeRTOS
+ *        ports (heap_mem_manager.c) when they are built on the host with the POSIX OSA port.
+ *
+ */
+
+#ifndef _FREERTOS_HOST_H_
+#define _FREERTOS_HOST_H_
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fsl_os_abstraction.h"
+
+#ifndef configSUPPORT_DYNAMIC_ALLOCATION
+#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#endif
+
+#ifndef configUSE_MALLOC_FAILED_HOOK
+#define configUSE_MALLOC_FAILED_HOOK 0
+#endif
+
+#ifndef configASSERT
+#define configASSERT(x) assert(x)
+#endif
+
+#define portBYTE_ALIGNMENT      8
+#define portBYTE_ALIGNMENT_MASK (0x0007)
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE  ((BaseType_t)1)
+
+#define mtCOVERAGE_TEST_MARKER()
+
+typedef long          BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t      TickType_t;
+
+/* Used to pass information about the heap out of vPortGetHeapStats() */
+typedef struct xHeapStats
+{
+    size_t xAvailableHeapSpaceInBytes;
+    size_t xSizeOfLargestFreeBlockInBytes;
+    size_t xSizeOfSmallestFreeBlockInBytes;
+    size_t xNumberOfFreeBlocks;
+    size_t xMinimumEverFreeBytesRemaining;
+    size_t xNumberOfSuccessfulAllocations;
+    size_t xNumberOfSuccessfulFrees;
+} HeapStats_t;
+
+void  *pvPortMalloc(size_t xWantedSize);
+void   vPortFree(void *pv);
+size_t xPortGetFreeHeapSize(void);
+size_t xPortGetMinimumEverFreeHeapSize(void);
+void   vPortGetHeapStats(HeapStats_t *pxHeapStats);
+
+#endif /* _FREERTOS_HOST_H_ */
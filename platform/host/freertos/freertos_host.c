@@ -0,0 +1,85 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file freertos_host.c
+ * \brief Host implementation of the FreeRTOS scheduler suspension, see task.h.
+ *
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+static pthread_mutex_t s_schedulerLock;
+static pthread_once_t  s_schedulerOnce = PTHREAD_ONCE_INIT;
+static uint32_t        s_suspendDepth;
+static uint64_t        s_suspendStart;
+static TaskHostStats_t s_stats;
+
+static void freertos_host_init(void)
+{
+    pthread_mutexattr_t attr;
+
+    (void)pthread_mutexattr_init(&attr);
+    (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    (void)pthread_mutex_init(&s_schedulerLock, &attr);
+    (void)pthread_mutexattr_destroy(&attr);
+}
+
+static uint64_t freertos_host_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+void vTaskSuspendAll(void)
+{
+    (void)pthread_once(&s_schedulerOnce, freertos_host_init);
+    (void)pthread_mutex_lock(&s_schedulerLock);
+
+    if (s_suspendDepth == 0U)
+    {
+        s_suspendStart = freertos_host_now_ns();
+    }
+    s_suspendDepth++;
+}
+
+BaseType_t xTaskResumeAll(void)
+{
+    s_suspendDepth--;
+    if (s_suspendDepth == 0U)
+    {
+        uint64_t duration = freertos_host_now_ns() - s_suspendStart;
+
+        s_stats.suspendCount++;
+        s_stats.suspendTotal += duration;
+        if (duration > s_stats.suspendMax)
+        {
+            s_stats.suspendMax = duration;
+        }
+    }
+
+    (void)pthread_mutex_unlock(&s_schedulerLock);
+
+    return pdFALSE;
+}
+
+void vTaskHostGetStats(TaskHostStats_t *pxStats)
+{
+    (void)pthread_once(&s_schedulerOnce, freertos_host_init);
+    (void)pthread_mutex_lock(&s_schedulerLock);
+    *pxStats = s_stats;
+    (void)memset(&s_stats, 0, sizeof(s_stats));
+    (void)pthread_mutex_unlock(&s_schedulerLock);
+}
@@ -0,0 +1,42 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file task.h
+ * \brief Host replacement of the FreeRTOS task API, limited to the scheduler suspension and the critical sections.
+ *
+ * The scheduler suspension is a recursive lock shared by the host threads, and the critical sections are the ones of
+ * the POSIX OSA port. The time spent with the scheduler suspended is recorded, so that the host benchmarks can report
+ * it.
+ *
+ */
+
+#ifndef _TASK_HOST_H_
+#define _TASK_HOST_H_
+
+#include "FreeRTOS.h"
+
+#define taskENTER_CRITICAL()     OSA_InterruptDisable()
+#define taskEXIT_CRITICAL()      OSA_InterruptEnable()
+#define taskDISABLE_INTERRUPTS() OSA_InterruptDisable()
+#define taskENABLE_INTERRUPTS()  OSA_InterruptEnable()
+
+/*! Scheduler suspension statistics of the host port, times in ns */
+typedef struct
+{
+    uint32_t suspendCount; /* number of outermost vTaskSuspendAll() calls */
+    uint64_t suspendTotal;
+    uint64_t suspendMax;
+} TaskHostStats_t;
+
+void       vTaskSuspendAll(void);
+BaseType_t xTaskResumeAll(void);
+
+/*!
+ * \brief Returns the scheduler suspension statistics and clears them
+ *
+ * \param[out] pxStats statistics since the previous call
+ */
+void vTaskHostGetStats(TaskHostStats_t *pxStats);
+
+#endif /* _TASK_HOST_H_ */
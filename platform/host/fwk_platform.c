@@ -0,0 +1,33 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fwk_platform.c
+ * \brief Host platform API.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <errno.h>
+#include <time.h>
+
+#include "fwk_platform.h"
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+void PLATFORM_Delay(uint64_t delayUs)
+{
+    struct timespec ts;
+
+    ts.tv_sec  = (time_t)(delayUs / 1000000U);
+    ts.tv_nsec = (long)((delayUs % 1000000U) * 1000U);
+
+    while ((nanosleep(&ts, &ts) != 0) && (errno == EINTR))
+    {
+    }
+}
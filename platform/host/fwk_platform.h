@@ -0,0 +1,36 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fwk_platform.h
+ * \brief Host platform API, limited to the functions used by the framework services built on the host.
+ *
+ */
+
+#ifndef _FWK_PLATFORM_H_
+#define _FWK_PLATFORM_H_
+
+#include <stdint.h>
+
+#include "fwk_config.h"
+
+/* -------------------------------------------------------------------------- */
+/*                              Public prototypes                             */
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * \brief Waits for a number of microseconds, the calling thread sleeps.
+ *
+ * \param[in] delayUs delay in microseconds
+ */
+void PLATFORM_Delay(uint64_t delayUs);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _FWK_PLATFORM_H_ */
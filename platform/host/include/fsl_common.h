@@ -0,0 +1,70 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_common.h
+ * \brief Host replacement of the SDK common driver header, limited to the definitions needed by the host SDK
+ *        components of platform/host/components and by the framework services built on the host.
+ *
+ */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cmsis_compiler.h"
+#include "fsl_os_abstraction.h"
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100L) + (code)))
+
+enum _status_groups
+{
+    kStatusGroup_Generic       = 0,
+    kStatusGroup_TIMERMANAGER  = 135,
+    kStatusGroup_SERIALMANAGER = 136,
+    kStatusGroup_MEM_MANAGER   = 141,
+    kStatusGroup_LIST          = 142,
+    kStatusGroup_OSA           = 143,
+    kStatusGroup_MSG           = 145,
+};
+
+enum
+{
+    kStatus_Success              = MAKE_STATUS(kStatusGroup_Generic, 0),
+    kStatus_Fail                 = MAKE_STATUS(kStatusGroup_Generic, 1),
+    kStatus_ReadOnly             = MAKE_STATUS(kStatusGroup_Generic, 2),
+    kStatus_OutOfRange           = MAKE_STATUS(kStatusGroup_Generic, 3),
+    kStatus_InvalidArgument      = MAKE_STATUS(kStatusGroup_Generic, 4),
+    kStatus_Timeout              = MAKE_STATUS(kStatusGroup_Generic, 5),
+    kStatus_NoTransferInProgress = MAKE_STATUS(kStatusGroup_Generic, 6),
+    kStatus_Busy                 = MAKE_STATUS(kStatusGroup_Generic, 7),
+    kStatus_NoData               = MAKE_STATUS(kStatusGroup_Generic, 8),
+};
+
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#endif
+
+/* The interrupt masking of the target is replaced by the OSA critical section */
+static inline uint32_t DisableGlobalIRQ(void)
+{
+    uint32_t sr = 0U;
+
+    OSA_EnterCritical(&sr);
+
+    return sr;
+}
+
+static inline void EnableGlobalIRQ(uint32_t primask)
+{
+    OSA_ExitCritical(primask);
+}
+
+#endif /* _FSL_COMMON_H_ */
@@ -0,0 +1,16 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_device_registers.h
+ * \brief Host replacement of the SDK device header. The host has no peripheral, in particular no MMCAU, LTC or AES
+ *        hardware, so the services select their software implementations.
+ *
+ */
+
+#ifndef _FSL_DEVICE_REGISTERS_H_
+#define _FSL_DEVICE_REGISTERS_H_
+
+#include "fsl_common.h"
+
+#endif /* _FSL_DEVICE_REGISTERS_H_ */
@@ -0,0 +1,218 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_os_abstraction.h
+ * \brief Host (POSIX) implementation of the subset of the SDK OS abstraction layer used by the framework services.
+ *        It allows to build and run these services on a Linux host, for unit tests and benchmarks.
+ *
+ */
+
+#ifndef _FSL_OS_ABSTRACTION_H_
+#define _FSL_OS_ABSTRACTION_H_
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* -------------------------------------------------------------------------- */
+/*                                Public macros                               */
+/* -------------------------------------------------------------------------- */
+
+/*! \brief The host port always runs the services with threads */
+#ifndef gUseRtos_c
+#define gUseRtos_c 1U
+#endif
+
+#ifndef USE_RTOS
+#define USE_RTOS 1
+#endif
+
+/*! \brief Constant to pass as timeout value in order to wait indefinitely */
+#define osaWaitForever_c ((uint32_t)(-1))
+/*! \brief Constant to pass as timeout value in order to return immediately */
+#define osaWaitNone_c ((uint32_t)(0))
+/*! \brief Constant to pass as waitAll value of OSA_EventWait() */
+#define osaEventFlagsAll_c ((osa_event_flags_t)(0x00FFFFFF))
+
+#define osaStatus_Success KOSA_StatusSuccess
+#define osaStatus_Error   KOSA_StatusError
+#define osaStatus_Timeout KOSA_StatusTimeout
+#define osaStatus_Idle    KOSA_StatusIdle
+
+/* The handle sizes are large enough for the pthread objects of the supported hosts, this is checked by the port */
+#define OSA_TASK_HANDLE_SIZE  (64U)
+#define OSA_EVENT_HANDLE_SIZE (96U)
+#define OSA_SEM_HANDLE_SIZE   (96U)
+#define OSA_MUTEX_HANDLE_SIZE (96U)
+
+#define OSA_TASK_HANDLE_DEFINE(name) \
+    uint64_t name[(OSA_TASK_HANDLE_SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t)]
+#define OSA_EVENT_HANDLE_DEFINE(name) \
+    uint64_t name[(OSA_EVENT_HANDLE_SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t)]
+#define OSA_SEMAPHORE_HANDLE_DEFINE(name) \
+    uint64_t name[(OSA_SEM_HANDLE_SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t)]
+#define OSA_MUTEX_HANDLE_DEFINE(name) \
+    uint64_t name[(OSA_MUTEX_HANDLE_SIZE + sizeof(uint64_t) - 1U) / sizeof(uint64_t)]
+
+/*! \brief Defines a thread, the priority and the stack size are recorded but not used by the host port */
+#define OSA_TASK_DEFINE(name, priority, instances, stackSz, useFloat) \
+    const osa_task_def_t os_thread_def_##name = {(name),                \
+                                                 (priority),            \
+                                                 (instances),           \
+                                                 (stackSz),             \
+                                                 NULL,                  \
+                                                 NULL,                  \
+                                                 (uint8_t *)#name,      \
+                                                 (useFloat)}
+
+/*! \brief Access a thread definition */
+#define OSA_TASK(name) (&os_thread_def_##name)
+
+#define OSA_SR_ALLOC()       uint32_t osa_sr_ = 0U;
+#define OSA_ENTER_CRITICAL() OSA_EnterCritical(&osa_sr_)
+#define OSA_EXIT_CRITICAL()  OSA_ExitCritical(osa_sr_)
+
+/* -------------------------------------------------------------------------- */
+/*                                Public types                                */
+/* -------------------------------------------------------------------------- */
+
+typedef enum _osa_status
+{
+    KOSA_StatusSuccess = 0, /*!< Success */
+    KOSA_StatusError   = 1, /*!< Failed */
+    KOSA_StatusTimeout = 2, /*!< Timeout occurs while waiting */
+    KOSA_StatusIdle    = 3, /*!< Used for bare metal only, the wait object is not ready and timeout still not occur */
+} osa_status_t;
+
+typedef void *osa_task_handle_t;
+typedef void *osa_event_handle_t;
+typedef void *osa_semaphore_handle_t;
+typedef void *osa_mutex_handle_t;
+typedef void *osa_task_param_t;
+typedef uint32_t osa_event_flags_t;
+typedef void (*osa_task_ptr_t)(osa_task_param_t task_param);
+
+typedef struct osa_task_def_tag
+{
+    osa_task_ptr_t pthread;   /*!< start address of thread function */
+    uint32_t       tpriority; /*!< initial thread priority, not used */
+    uint32_t       instances; /*!< maximum number of instances of that thread function */
+    uint32_t       stacksize; /*!< stack size requirements in bytes, not used */
+    uint32_t      *tstack;    /*!< stack pointer, not used */
+    void          *tlink;     /*!< link pointer, not used */
+    uint8_t       *tname;     /*!< name pointer */
+    uint8_t        useFloat;  /*!< is use float, not used */
+} osa_task_def_t;
+
+/* -------------------------------------------------------------------------- */
+/*                              Public prototypes                             */
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * \brief Creates a thread running thread_def->pthread(task_param)
+ *
+ * \param[in] taskHandle buffer defined with OSA_TASK_HANDLE_DEFINE
+ * \param[in] thread_def thread definition, see OSA_TASK_DEFINE
+ * \param[in] task_param parameter of the thread function
+ * \return osa_status_t KOSA_StatusSuccess or KOSA_StatusError
+ */
+osa_status_t OSA_TaskCreate(osa_task_handle_t taskHandle, const osa_task_def_t *thread_def, osa_task_param_t task_param);
+
+/*!
+ * \brief Destroys a thread. The host threads can't be killed, so the thread is only detached: it must return by itself.
+ *
+ * \param[in] taskHandle thread handle
+ * \return osa_status_t KOSA_StatusSuccess
+ */
+osa_status_t OSA_TaskDestroy(osa_task_handle_t taskHandle);
+
+/*!
+ * \brief Returns the handle of the calling thread, NULL if it was not created with OSA_TaskCreate()
+ */
+osa_task_handle_t OSA_TaskGetCurrentHandle(void);
+
+/*!
+ * \brief Yields the processor to the other threads
+ */
+void OSA_TaskYield(void);
+
+/*!
+ * \brief Blocks the calling thread for millisec milliseconds of OSA time (simulated or real)
+ */
+void OSA_TimeDelay(uint32_t millisec);
+
+/*!
+ * \brief Returns the current OSA time in milliseconds
+ */
+uint32_t OSA_TimeGetMsec(void);
+
+osa_status_t OSA_EventCreate(osa_event_handle_t eventHandle, uint8_t autoClear);
+osa_status_t OSA_EventSet(osa_event_handle_t eventHandle, osa_event_flags_t flagsToSet);
+osa_status_t OSA_EventClear(osa_event_handle_t eventHandle, osa_event_flags_t flagsToClear);
+osa_status_t OSA_EventGet(osa_event_handle_t eventHandle, osa_event_flags_t flagsMask, osa_event_flags_t *pFlagsOfEvent);
+osa_status_t OSA_EventWait(osa_event_handle_t eventHandle,
+                           osa_event_flags_t flagsToWait,
+                           uint8_t waitAll,
+                           uint32_t millisec,
+                           osa_event_flags_t *pSetFlags);
+osa_status_t OSA_EventDestroy(osa_event_handle_t eventHandle);
+
+osa_status_t OSA_SemaphoreCreate(osa_semaphore_handle_t semaphoreHandle, uint32_t initValue);
+osa_status_t OSA_SemaphoreWait(osa_semaphore_handle_t semaphoreHandle, uint32_t millisec);
+osa_status_t OSA_SemaphorePost(osa_semaphore_handle_t semaphoreHandle);
+osa_status_t OSA_SemaphoreDestroy(osa_semaphore_handle_t semaphoreHandle);
+
+/* The mutexes are recursive, as on the SDK RTOS ports */
+osa_status_t OSA_MutexCreate(osa_mutex_handle_t mutexHandle);
+osa_status_t OSA_MutexLock(osa_mutex_handle_t mutexHandle, uint32_t millisec);
+osa_status_t OSA_MutexUnlock(osa_mutex_handle_t mutexHandle);
+osa_status_t OSA_MutexDestroy(osa_mutex_handle_t mutexHandle);
+
+/*!
+ * \brief Enters a critical section. On the host, the critical sections of all the threads are serialized by a single
+ *        recursive lock, which stands for the interrupt masking of the target. Don't block inside.
+ *
+ * \param[out] sr unused, kept for API compatibility
+ */
+void OSA_EnterCritical(uint32_t *sr);
+void OSA_ExitCritical(uint32_t sr);
+
+/* The interrupt masking functions share the lock of the critical sections */
+void OSA_InterruptEnable(void);
+void OSA_InterruptDisable(void);
+void OSA_EnableIRQGlobal(void);
+void OSA_DisableIRQGlobal(void);
+
+void *OSA_MemoryAllocate(uint32_t memLength);
+void OSA_MemoryFree(void *p);
+
+/*!
+ * \brief Selects the time base of the port. By default, the OSA time follows the host monotonic clock. Once the
+ *        simulated tick is enabled, the OSA time only moves with OSA_HostTickAdvance(), which makes the timeouts and
+ *        the delayed processing deterministic in the tests.
+ *
+ * \param[in] enable true to use the simulated tick, false to go back to the host clock
+ */
+void OSA_HostTickSimulate(bool enable);
+
+/*!
+ * \brief Advances the simulated tick and wakes up the threads whose timeout has elapsed
+ *
+ * \param[in] millisec number of milliseconds to add to the simulated time
+ */
+void OSA_HostTickAdvance(uint32_t millisec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FSL_OS_ABSTRACTION_H_ */
@@ -0,0 +1,605 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsl_os_abstraction_posix.c
+ * \brief Host (POSIX) implementation of the OS abstraction layer, built on pthreads and condition variables.
+ *
+ * All the events, semaphores and mutexes share a single lock protecting their state, and each of them has its own
+ * condition variable. The waits with a timeout either use the host monotonic clock, or the simulated tick: in the
+ * latter case, the waiters register their condition variable so that OSA_HostTickAdvance() can wake them up.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "fsl_os_abstraction.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private types                                */
+/* -------------------------------------------------------------------------- */
+
+typedef struct
+{
+    pthread_t        thread;
+    osa_task_ptr_t   func;
+    osa_task_param_t param;
+} osa_host_task_t;
+
+typedef struct
+{
+    pthread_cond_t    cond;
+    osa_event_flags_t flags;
+    bool              autoClear;
+} osa_host_event_t;
+
+typedef struct
+{
+    pthread_cond_t cond;
+    uint32_t       count;
+} osa_host_sem_t;
+
+typedef struct
+{
+    pthread_cond_t cond;
+    pthread_t      owner;
+    uint32_t       depth;
+} osa_host_mutex_t;
+
+/* Deadline of a wait, in simulated or host time depending on the time base at the start of the wait */
+typedef struct
+{
+    bool            forever;
+    bool            simulated;
+    uint64_t        simDeadline;
+    struct timespec hostDeadline;
+} osa_host_deadline_t;
+
+/* Timed waiter on the simulated tick, linked on the stack of the waiting thread */
+typedef struct osa_host_waiter
+{
+    pthread_cond_t         *cond;
+    struct osa_host_waiter *next;
+} osa_host_waiter_t;
+
+_Static_assert(sizeof(osa_host_task_t) <= OSA_TASK_HANDLE_SIZE, "OSA_TASK_HANDLE_SIZE too small");
+_Static_assert(sizeof(osa_host_event_t) <= OSA_EVENT_HANDLE_SIZE, "OSA_EVENT_HANDLE_SIZE too small");
+_Static_assert(sizeof(osa_host_sem_t) <= OSA_SEM_HANDLE_SIZE, "OSA_SEM_HANDLE_SIZE too small");
+_Static_assert(sizeof(osa_host_mutex_t) <= OSA_MUTEX_HANDLE_SIZE, "OSA_MUTEX_HANDLE_SIZE too small");
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+/* Protects the state of all the OSA objects, the simulated time and the waiters list */
+static pthread_mutex_t s_osaLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Stands for the interrupt masking of the target, it may be taken again by the same thread */
+static pthread_mutex_t s_criticalLock;
+static pthread_once_t  s_criticalOnce = PTHREAD_ONCE_INIT;
+
+/* Used by OSA_TimeDelay() */
+static pthread_cond_t s_delayCond;
+static pthread_once_t s_delayOnce = PTHREAD_ONCE_INIT;
+
+static bool               s_tickSimulated;
+static uint64_t           s_tickMsec;
+static osa_host_waiter_t *s_waiters;
+
+static __thread osa_host_task_t *s_currentTask;
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+static void osa_host_critical_init(void)
+{
+    pthread_mutexattr_t attr;
+
+    (void)pthread_mutexattr_init(&attr);
+    (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    (void)pthread_mutex_init(&s_criticalLock, &attr);
+    (void)pthread_mutexattr_destroy(&attr);
+}
+
+static int osa_host_cond_init(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+    int                ret;
+
+    (void)pthread_condattr_init(&attr);
+    (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    ret = pthread_cond_init(cond, &attr);
+    (void)pthread_condattr_destroy(&attr);
+
+    return ret;
+}
+
+static void osa_host_delay_init(void)
+{
+    (void)osa_host_cond_init(&s_delayCond);
+}
+
+static uint64_t osa_host_clock_msec(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000U) + ((uint64_t)now.tv_nsec / 1000000U);
+}
+
+/* Must be called with s_osaLock held */
+static void osa_host_deadline_init(osa_host_deadline_t *deadline, uint32_t millisec)
+{
+    deadline->forever   = (millisec == osaWaitForever_c);
+    deadline->simulated = s_tickSimulated;
+
+    if (deadline->simulated)
+    {
+        deadline->simDeadline = s_tickMsec + millisec;
+    }
+    else
+    {
+        (void)clock_gettime(CLOCK_MONOTONIC, &deadline->hostDeadline);
+        deadline->hostDeadline.tv_sec += (time_t)(millisec / 1000U);
+        deadline->hostDeadline.tv_nsec += (long)(millisec % 1000U) * 1000000L;
+        if (deadline->hostDeadline.tv_nsec >= 1000000000L)
+        {
+            deadline->hostDeadline.tv_sec++;
+            deadline->hostDeadline.tv_nsec -= 1000000000L;
+        }
+    }
+}
+
+/* Blocks on cond with s_osaLock held, returns false once the deadline has elapsed. Spurious wakeups are possible, so
+ * the caller checks its condition again each time true is returned. */
+static bool osa_host_wait(pthread_cond_t *cond, const osa_host_deadline_t *deadline)
+{
+    bool waited = true;
+
+    if (deadline->forever)
+    {
+        (void)pthread_cond_wait(cond, &s_osaLock);
+    }
+    else if (deadline->simulated)
+    {
+        if (s_tickMsec >= deadline->simDeadline)
+        {
+            waited = false;
+        }
+        else
+        {
+            osa_host_waiter_t   waiter;
+            osa_host_waiter_t **link;
+
+            waiter.cond = cond;
+            waiter.next = s_waiters;
+            s_waiters   = &waiter;
+
+            (void)pthread_cond_wait(cond, &s_osaLock);
+
+            for (link = &s_waiters; *link != &waiter; link = &(*link)->next)
+            {
+            }
+            *link = waiter.next;
+        }
+    }
+    else
+    {
+        waited = (pthread_cond_timedwait(cond, &s_osaLock, &deadline->hostDeadline) != ETIMEDOUT);
+    }
+
+    return waited;
+}
+
+static void *osa_host_task_entry(void *arg)
+{
+    osa_host_task_t *task = (osa_host_task_t *)arg;
+
+    s_currentTask = task;
+    task->func(task->param);
+
+    return NULL;
+}
+
+static bool osa_host_event_ready(const osa_host_event_t *event, osa_event_flags_t flagsToWait, uint8_t waitAll)
+{
+    bool ready;
+
+    if (waitAll != 0U)
+    {
+        ready = ((event->flags & flagsToWait) == flagsToWait);
+    }
+    else
+    {
+        ready = ((event->flags & flagsToWait) != 0U);
+    }
+
+    return ready;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+osa_status_t OSA_TaskCreate(osa_task_handle_t taskHandle, const osa_task_def_t *thread_def, osa_task_param_t task_param)
+{
+    osa_host_task_t *task   = (osa_host_task_t *)taskHandle;
+    osa_status_t     status = KOSA_StatusSuccess;
+
+    task->func  = thread_def->pthread;
+    task->param = task_param;
+
+    if (pthread_create(&task->thread, NULL, osa_host_task_entry, task) != 0)
+    {
+        status = KOSA_StatusError;
+    }
+
+    return status;
+}
+
+osa_status_t OSA_TaskDestroy(osa_task_handle_t taskHandle)
+{
+    osa_host_task_t *task = (osa_host_task_t *)taskHandle;
+
+    (void)pthread_detach(task->thread);
+
+    return KOSA_StatusSuccess;
+}
+
+osa_task_handle_t OSA_TaskGetCurrentHandle(void)
+{
+    return (osa_task_handle_t)s_currentTask;
+}
+
+void OSA_TaskYield(void)
+{
+    (void)sched_yield();
+}
+
+void OSA_TimeDelay(uint32_t millisec)
+{
+    osa_host_deadline_t deadline;
+
+    (void)pthread_once(&s_delayOnce, osa_host_delay_init);
+
+    (void)pthread_mutex_lock(&s_osaLock);
+    osa_host_deadline_init(&deadline, millisec);
+    while (osa_host_wait(&s_delayCond, &deadline))
+    {
+    }
+    (void)pthread_mutex_unlock(&s_osaLock);
+}
+
+uint32_t OSA_TimeGetMsec(void)
+{
+    uint64_t msec;
+
+    (void)pthread_mutex_lock(&s_osaLock);
+    msec = s_tickSimulated ? s_tickMsec : osa_host_clock_msec();
+    (void)pthread_mutex_unlock(&s_osaLock);
+
+    return (uint32_t)msec;
+}
+
+void OSA_HostTickSimulate(bool enable)
+{
+    (void)pthread_mutex_lock(&s_osaLock);
+    if (enable && !s_tickSimulated)
+    {
+        /* start from the host time, so the OSA time doesn't go backward */
+        s_tickMsec = osa_host_clock_msec();
+    }
+    s_tickSimulated = enable;
+    (void)pthread_mutex_unlock(&s_osaLock);
+}
+
+void OSA_HostTickAdvance(uint32_t millisec)
+{
+    osa_host_waiter_t *waiter;
+
+    (void)pthread_once(&s_delayOnce, osa_host_delay_init);
+
+    (void)pthread_mutex_lock(&s_osaLock);
+    s_tickMsec += millisec;
+    for (waiter = s_waiters; waiter != NULL; waiter = waiter->next)
+    {
+        (void)pthread_cond_broadcast(waiter->cond);
+    }
+    (void)pthread_mutex_unlock(&s_osaLock);
+}
+
+osa_status_t OSA_EventCreate(osa_event_handle_t eventHandle, uint8_t autoClear)
+{
+    osa_host_event_t *event  = (osa_host_event_t *)eventHandle;
+    osa_status_t      status = KOSA_StatusSuccess;
+
+    event->flags     = 0U;
+    event->autoClear = (autoClear != 0U);
+    if (osa_host_cond_init(&event->cond) != 0)
+    {
+        status = KOSA_StatusError;
+    }
+
+    return status;
+}
+
+osa_status_t OSA_EventSet(osa_event_handle_t eventHandle, osa_event_flags_t flagsToSet)
+{
+    osa_host_event_t *event = (osa_host_event_t *)eventHandle;
+
+    (void)pthread_mutex_lock(&s_osaLock);
+    event->flags |= flagsToSet;
+    (void)pthread_cond_broadcast(&event->cond);
+    (void)pthread_mutex_unlock(&s_osaLock);
+
+    return KOSA_StatusSuccess;
+}
+
+osa_status_t OSA_EventClear(osa_event_handle_t eventHandle, osa_event_flags_t flagsToClear)
+{
+    osa_host_event_t *event = (osa_host_event_t *)eventHandle;
+
+    (void)pthread_mutex_lock(&s_osaLock);
+    event->flags &= ~flagsToClear;
+    (void)pthread_mutex_unlock(&s_osaLock);
+
+    return KOSA_StatusSuccess;
+}
+
+osa_status_t OSA_EventGet(osa_event_handle_t eventHandle, osa_event_flags_t flagsMask, osa_event_flags_t *pFlagsOfEvent)
+{
+    osa_host_event_t *event  = (osa_host_event_t *)eventHandle;
+    osa_status_t      status = KOSA_StatusError;
+
+    if (pFlagsOfEvent != NULL)
+    {
+        (void)pthread_mutex_lock(&s_osaLock);
+        *pFlagsOfEvent = event->flags & flagsMask;
+        (void)pthread_mutex_unlock(&s_osaLock);
+        status = KOSA_StatusSuccess;
+    }
+
+    return status;
+}
+
+osa_status_t OSA_EventWait(osa_event_handle_t eventHandle,
+                           osa_event_flags_t flagsToWait,
+                           uint8_t waitAll,
+                           uint32_t millisec,
+                           osa_event_flags_t *pSetFlags)
+{
+    osa_host_event_t   *event = (osa_host_event_t *)eventHandle;
+    osa_host_deadline_t deadline;
+    osa_event_flags_t   flags;
+    osa_status_t        status;
+
+    (void)pthread_mutex_lock(&s_osaLock);
+
+    osa_host_deadline_init(&deadline, millisec);
+    while (!osa_host_event_ready(event, flagsToWait, waitAll) && osa_host_wait(&event->cond, &deadline))
+    {
+    }
+
+    flags = event->flags & flagsToWait;
+    if (osa_host_event_ready(event, flagsToWait, waitAll))
+    {
+        if (event->autoClear)
+        {
+            event->flags &= ~flags;
+        }
+        status = KOSA_StatusSuccess;
+    }
+    else
+    {
+        status = KOSA_StatusTimeout;
+    }
+
+    (void)pthread_mutex_unlock(&s_osaLock);
+
+    if (pSetFlags != NULL)
+    {
+        *pSetFlags = flags;
+    }
+
+    return status;
+}
+
+osa_status_t OSA_EventDestroy(osa_event_handle_t eventHandle)
+{
+    osa_host_event_t *event = (osa_host_event_t *)eventHandle;
+
+    (void)pthread_cond_destroy(&event->cond);
+
+    return KOSA_StatusSuccess;
+}
+
+osa_status_t OSA_SemaphoreCreate(osa_semaphore_handle_t semaphoreHandle, uint32_t initValue)
+{
+    osa_host_sem_t *sem    = (osa_host_sem_t *)semaphoreHandle;
+    osa_status_t    status = KOSA_StatusSuccess;
+
+    sem->count = initValue;
+    if (osa_host_cond_init(&sem->cond) != 0)
+    {
+        status = KOSA_StatusError;
+    }
+
+    return status;
+}
+
+osa_status_t OSA_SemaphoreWait(osa_semaphore_handle_t semaphoreHandle, uint32_t millisec)
+{
+    osa_host_sem_t     *sem = (osa_host_sem_t *)semaphoreHandle;
+    osa_host_deadline_t deadline;
+    osa_status_t        status = KOSA_StatusTimeout;
+
+    (void)pthread_mutex_lock(&s_osaLock);
+
+    osa_host_deadline_init(&deadline, millisec);
+    while ((sem->count == 0U) && osa_host_wait(&sem->cond, &deadline))
+    {
+    }
+
+    if (sem->count != 0U)
+    {
+        sem->count--;
+        status = KOSA_StatusSuccess;
+    }
+
+    (void)pthread_mutex_unlock(&s_osaLock);
+
+    return status;
+}
+
+osa_status_t OSA_SemaphorePost(osa_semaphore_handle_t semaphoreHandle)
+{
+    osa_host_sem_t *sem = (osa_host_sem_t *)semaphoreHandle;
+
+    (void)pthread_mutex_lock(&s_osaLock);
+    sem->count++;
+    (void)pthread_cond_signal(&sem->cond);
+    (void)pthread_mutex_unlock(&s_osaLock);
+
+    return KOSA_StatusSuccess;
+}
+
+osa_status_t OSA_SemaphoreDestroy(osa_semaphore_handle_t semaphoreHandle)
+{
+    osa_host_sem_t *sem = (osa_host_sem_t *)semaphoreHandle;
+
+    (void)pthread_cond_destroy(&sem->cond);
+
+    return KOSA_StatusSuccess;
+}
+
+osa_status_t OSA_MutexCreate(osa_mutex_handle_t mutexHandle)
+{
+    osa_host_mutex_t *mutex  = (osa_host_mutex_t *)mutexHandle;
+    osa_status_t      status = KOSA_StatusSuccess;
+
+    mutex->depth = 0U;
+    if (osa_host_cond_init(&mutex->cond) != 0)
+    {
+        status = KOSA_StatusError;
+    }
+
+    return status;
+}
+
+osa_status_t OSA_MutexLock(osa_mutex_handle_t mutexHandle, uint32_t millisec)
+{
+    osa_host_mutex_t   *mutex = (osa_host_mutex_t *)mutexHandle;
+    pthread_t           self  = pthread_self();
+    osa_host_deadline_t deadline;
+    osa_status_t        status = KOSA_StatusTimeout;
+
+    (void)pthread_mutex_lock(&s_osaLock);
+
+    osa_host_deadline_init(&deadline, millisec);
+    while ((mutex->depth != 0U) && (pthread_equal(mutex->owner, self) == 0) && osa_host_wait(&mutex->cond, &deadline))
+    {
+    }
+
+    if ((mutex->depth == 0U) || (pthread_equal(mutex->owner, self) != 0))
+    {
+        mutex->owner = self;
+        mutex->depth++;
+        status = KOSA_StatusSuccess;
+    }
+
+    (void)pthread_mutex_unlock(&s_osaLock);
+
+    return status;
+}
+
+osa_status_t OSA_MutexUnlock(osa_mutex_handle_t mutexHandle)
+{
+    osa_host_mutex_t *mutex  = (osa_host_mutex_t *)mutexHandle;
+    osa_status_t      status = KOSA_StatusError;
+
+    (void)pthread_mutex_lock(&s_osaLock);
+    if ((mutex->depth != 0U) && (pthread_equal(mutex->owner, pthread_self()) != 0))
+    {
+        mutex->depth--;
+        if (mutex->depth == 0U)
+        {
+            (void)pthread_cond_signal(&mutex->cond);
+        }
+        status = KOSA_StatusSuccess;
+    }
+    (void)pthread_mutex_unlock(&s_osaLock);
+
+    return status;
+}
+
+osa_status_t OSA_MutexDestroy(osa_mutex_handle_t mutexHandle)
+{
+    osa_host_mutex_t *mutex = (osa_host_mutex_t *)mutexHandle;
+
+    (void)pthread_cond_destroy(&mutex->cond);
+
+    return KOSA_StatusSuccess;
+}
+
+void OSA_EnterCritical(uint32_t *sr)
+{
+    (void)sr;
+    (void)pthread_once(&s_criticalOnce, osa_host_critical_init);
+    (void)pthread_mutex_lock(&s_criticalLock);
+}
+
+void OSA_ExitCritical(uint32_t sr)
+{
+    (void)sr;
+    (void)pthread_mutex_unlock(&s_criticalLock);
+}
+
+void OSA_InterruptEnable(void)
+{
+    OSA_ExitCritical(0U);
+}
+
+void OSA_InterruptDisable(void)
+{
+    uint32_t sr;
+
+    OSA_EnterCritical(&sr);
+}
+
+void OSA_EnableIRQGlobal(void)
+{
+    OSA_ExitCritical(0U);
+}
+
+void OSA_DisableIRQGlobal(void)
+{
+    uint32_t sr;
+
+    OSA_EnterCritical(&sr);
+}
+
+void *OSA_MemoryAllocate(uint32_t memLength)
+{
+    /* the SDK ports return zeroed memory */
+    return calloc(1U, memLength);
+}
+
+void OSA_MemoryFree(void *p)
+{
+    free(p);
+}
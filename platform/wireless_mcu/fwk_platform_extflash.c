@@ -14,6 +14,7 @@
 #include "board_extflash.h"
 #include "fsl_nor_flash.h"
 #include "fsl_lpspi_nor_flash.h"
+#include "fwk_blank_check.h"
 
 /* -------------------------------------------------------------------------- */
 /*                               Private macros                               */
@@ -29,24 +30,6 @@
 static nor_config_t norConfig = {NULL};
 static nor_handle_t norHandle = {NULL};
 
-/* -------------------------------------------------------------------------- */
-/*                               Private functions                               */
-/* -------------------------------------------------------------------------- */
-
-static bool MemCmpToEraseValue(uint8_t *ptr, uint32_t blen)
-{
-    bool ret = true;
-    for (uint32_t i = 0u; i < blen; i++)
-    {
-        if (ptr[i] != 0xffu)
-        {
-            ret = false;
-            break;
-        }
-    }
-    return ret;
-}
-
 /* -------------------------------------------------------------------------- */
 /*                              Public functions                              */
 /* -------------------------------------------------------------------------- */
@@ -173,34 +156,7 @@ int PLATFORM_IsExternalFlashBusy(bool *isBusy)
 
 bool PLATFORM_ExternalFlashAreaIsBlank(uint32_t address, uint32_t len)
 {
-    uint8_t  read_buf[PLATFORM_EXTFLASH_PAGE_SIZE] = {0U};
-    uint32_t remaining_sz                          = len;
-    bool     ret                                   = false;
-
-    while (remaining_sz > 0u)
-    {
-        uint32_t read_sz;
-        read_sz = MIN(remaining_sz, PLATFORM_EXTFLASH_PAGE_SIZE);
-        if (kStatus_Success != Nor_Flash_Read(&norHandle, address, (uint8_t *)read_buf, len))
-        {
-            ret = false;
-        }
-        else
-        {
-            if (!MemCmpToEraseValue((uint8_t *)address, read_sz))
-            {
-                ret = false;
-                /* Can stop at once if one byte differ */
-                break;
-            }
-        }
-        remaining_sz -= read_sz;
-    }
-    if (remaining_sz == 0u)
-    {
-        ret = true;
-    }
-    return ret;
+    return BLANK_CHECK_Stream(PLATFORM_ReadExternalFlash, address, len);
 }
 
 bool PLATFORM_IsExternalFlashPageBlank(uint32_t address)
@@ -216,5 +172,5 @@ bool PLATFORM_IsExternalFlashSectorBlank(uint32_t address)
     /* Start from address of sector containing argument address */
     uint32_t sect_addr = _SECTOR_ADDR(address);
 
-    return PLATFORM_ExternalFlashAreaIsBlank(sect_addr, PLATFORM_EXTFLASH_PAGE_SIZE);
+    return PLATFORM_ExternalFlashAreaIsBlank(sect_addr, PLATFORM_EXTFLASH_SECTOR_SIZE);
 }
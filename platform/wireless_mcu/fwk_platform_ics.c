@@ -23,6 +23,10 @@
 #include "fwk_hal_macros.h"
 #endif
 
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+#include "fwk_mem_track.h"
+#endif
+
 #if defined(NBU_VERSION_DBG) && (NBU_VERSION_DBG == 1)
 #include "fsl_debug_console.h"
 #endif
@@ -138,6 +142,8 @@ static void (*PLATFORM_RxCallbackService[gFwkSrvNbu2HostLast_c - gFwkSrvNbu2Host
 #if defined(gPlatformIcsUseWorkqueueRxProcessing_d) && (gPlatformIcsUseWorkqueueRxProcessing_d > 0)
 static rx_work_t rx_work = {
     .work.handler = PLATFORM_RxWorkHandler,
+    /* RX processing is latency sensitive, run it before the other works of the queue */
+    .work.prio = FWK_WORK_PRIO_HIGHEST,
 };
 #endif
 
@@ -537,8 +543,12 @@ static hal_rpmsg_return_status_t PLATFORM_FwkSrv_RxCallBack(void *param, uint8_t
                 rx_data->len  = len;
                 (void)memcpy(rx_data->data, data, len);
                 (void)LIST_AddTail(&rx_work.pending, &rx_data->node);
-                if (WORKQ_Submit(&rx_work.work) < 0)
+                if (WORKQ_SubmitFromIsr(&rx_work.work) < 0)
                 {
+                    /* -EBUSY if the system workqueue is drained before a low power mode, the message is processed in
+                     * the ISR, it must not stay in the pending list for the next submission */
+                    (void)LIST_RemoveElement(&rx_data->node);
+                    (void)MEM_BufferFree(rx_data);
                     process_now = true;
                     break;
                 }
@@ -115,7 +115,11 @@ void ADC0_IRQHandler(void)
     {
         new_temperature_value = 10 * (int32_t)float_temperature_value;
 
-        if (WORKQ_Submit(&temperature_ready_work) < 0)
+        int status = WORKQ_SubmitFromIsr(&temperature_ready_work);
+
+        /* -EBUSY: the system workqueue is drained before a low power mode, the sample is dropped. The Sensors
+         * module reads it on its next trigger and the next sample is sent to the NBU */
+        if ((status < 0) && (status != -EBUSY))
         {
             assert(0);
         }
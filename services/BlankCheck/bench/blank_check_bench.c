@@ -0,0 +1,290 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file blank_check_bench.c
+ * \brief Benchmark of the blank check backends against the byte loops they replace.
+ *
+ * The same file builds on the target, where BLANK_CHECK_BENCH_Run() is called by the application with a blank area of
+ * the internal flash and PLATFORM_ReadExternalFlash(), and on the host with services/BlankCheck/host/CMakeLists.txt,
+ * where BLANK_CHECK_BENCH_MAIN adds a main() function measuring a RAM area.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <string.h>
+
+#include "EmbeddedTypes.h"
+#include "FunctionLib.h"
+#include "fwk_blank_check.h"
+#include "blank_check_bench.h"
+
+#ifndef BLANK_CHECK_BENCH_PRINTF
+#include <stdio.h>
+#define BLANK_CHECK_BENCH_PRINTF printf
+#endif
+
+#if !defined(BLANK_CHECK_BENCH_GET_TIME)
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+#include "fsl_device_registers.h"
+#if !defined(DWT_CTRL_CYCCNTENA_Msk)
+#error No DWT cycle counter on this core, define BLANK_CHECK_BENCH_GET_TIME
+#endif
+#define BLANK_CHECK_BENCH_TIME_UNIT  "cycles"
+#define BLANK_CHECK_BENCH_GET_TIME() (DWT->CYCCNT)
+#else
+#include <time.h>
+#define BLANK_CHECK_BENCH_TIME_UNIT  "ns"
+#define BLANK_CHECK_BENCH_GET_TIME() blank_check_bench_host_time()
+#endif
+#endif
+
+#ifndef BLANK_CHECK_BENCH_TIME_UNIT
+#define BLANK_CHECK_BENCH_TIME_UNIT "ticks"
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+/* chunk size of the previous external flash implementation, the flash page size */
+#define BLANK_CHECK_BENCH_LEGACY_CHUNK 256U
+#define BLANK_CHECK_BENCH_VERIFY_MAX   72U
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+static uint32_t s_verifyBuf[(BLANK_CHECK_BENCH_VERIFY_MAX / sizeof(uint32_t)) + 2U];
+
+#if defined(BLANK_CHECK_BENCH_MAIN)
+/* host stand-in of the flash */
+static uint32_t s_hostFlash[(64U * 1024U) / sizeof(uint32_t)];
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+#if !defined(__ARM_ARCH_PROFILE) || (__ARM_ARCH_PROFILE != 'M')
+static uint32_t blank_check_bench_host_time(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec);
+}
+#endif
+
+/* the byte loop of the previous external flash implementations */
+static bool blank_check_bench_byte_loop(const void *pData, uint32_t len)
+{
+    const uint8_t *pByte = (const uint8_t *)pData;
+    bool           blank = true;
+
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        if (pByte[i] != FWK_BLANK_CHECK_ERASE_VALUE)
+        {
+            blank = false;
+            break;
+        }
+    }
+
+    return blank;
+}
+
+/* page by page reads compared with the byte loop, as done by the previous external flash implementations */
+static bool blank_check_bench_legacy_stream(fwk_blank_check_read_t read, uint32_t offset, uint32_t len)
+{
+    uint8_t  page[BLANK_CHECK_BENCH_LEGACY_CHUNK];
+    uint32_t readSize;
+    bool     blank = true;
+
+    while ((len != 0U) && blank)
+    {
+        readSize = (len > sizeof(page)) ? (uint32_t)sizeof(page) : len;
+        blank    = (read(page, readSize, offset, false) == 0) && blank_check_bench_byte_loop(page, readSize);
+        offset += readSize;
+        len -= readSize;
+    }
+
+    return blank;
+}
+
+/* Compares BLANK_CHECK_Memory() to the byte loop with one byte at every position set to a non erased value */
+static int blank_check_bench_verify(void)
+{
+    int      ret = 0;
+    uint8_t *pBuf;
+
+    for (uint32_t len = 0U; len <= BLANK_CHECK_BENCH_VERIFY_MAX; len++)
+    {
+        for (uint32_t offset = 0U; offset < sizeof(uint32_t); offset++)
+        {
+            pBuf = (uint8_t *)s_verifyBuf + offset;
+
+            /* pos == len is the blank case */
+            for (uint32_t pos = 0U; pos <= len; pos++)
+            {
+                (void)memset(s_verifyBuf, 0x00, sizeof(s_verifyBuf));
+                (void)memset(pBuf, (int)FWK_BLANK_CHECK_ERASE_VALUE, len);
+                if (pos < len)
+                {
+                    /* a single programmed bit */
+                    pBuf[pos] = (uint8_t)(FWK_BLANK_CHECK_ERASE_VALUE & ~(1U << (pos % 8U)));
+                }
+
+                if (BLANK_CHECK_Memory(pBuf, len) != blank_check_bench_byte_loop(pBuf, len))
+                {
+                    BLANK_CHECK_BENCH_PRINTF("verify: failed, len %u, offset %u, position %u\r\n", (unsigned int)len,
+                                             (unsigned int)offset, (unsigned int)pos);
+                    ret = -1;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+static void blank_check_bench_print(const char *backend, const char *method, uint32_t len, uint32_t time, bool blank)
+{
+    BLANK_CHECK_BENCH_PRINTF("%-10s %-26s %8u %12u %s/call%s\r\n", backend, method, (unsigned int)len,
+                             (unsigned int)(time / BLANK_CHECK_BENCH_ITERATIONS), BLANK_CHECK_BENCH_TIME_UNIT,
+                             blank ? "" : " (not blank)");
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+int BLANK_CHECK_BENCH_Run(const void *pMapped, fwk_blank_check_read_t read, uint32_t offset, uint32_t len)
+{
+    int      ret;
+    uint32_t start;
+    bool     blank;
+
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M') && defined(DWT_CTRL_CYCCNTENA_Msk)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    ret = blank_check_bench_verify();
+    BLANK_CHECK_BENCH_PRINTF("verify: %s\r\n", (ret == 0) ? "ok" : "FAILED");
+
+    BLANK_CHECK_BENCH_PRINTF("%-10s %-26s %8s %12s\r\n", "backend", "method", "len", "time");
+
+    if (pMapped != NULL)
+    {
+        blank = true;
+        start = BLANK_CHECK_BENCH_GET_TIME();
+        for (uint32_t i = 0U; i < BLANK_CHECK_BENCH_ITERATIONS; i++)
+        {
+            blank = blank_check_bench_byte_loop(pMapped, len) && blank;
+        }
+        blank_check_bench_print("memory", "byte loop", len, BLANK_CHECK_BENCH_GET_TIME() - start, blank);
+
+        blank = true;
+        start = BLANK_CHECK_BENCH_GET_TIME();
+        for (uint32_t i = 0U; i < BLANK_CHECK_BENCH_ITERATIONS; i++)
+        {
+            blank = (FLib_MemCmpToVal(pMapped, FWK_BLANK_CHECK_ERASE_VALUE, len) == TRUE) && blank;
+        }
+        blank_check_bench_print("memory", "FLib_MemCmpToVal", len, BLANK_CHECK_BENCH_GET_TIME() - start, blank);
+
+        blank = true;
+        start = BLANK_CHECK_BENCH_GET_TIME();
+        for (uint32_t i = 0U; i < BLANK_CHECK_BENCH_ITERATIONS; i++)
+        {
+            blank = BLANK_CHECK_Memory(pMapped, len) && blank;
+        }
+        blank_check_bench_print("memory", "BLANK_CHECK_Memory", len, BLANK_CHECK_BENCH_GET_TIME() - start, blank);
+        if (!blank)
+        {
+            ret = -1;
+        }
+
+#if (gBlankCheckInternalFlash_d > 0)
+        blank = true;
+        start = BLANK_CHECK_BENCH_GET_TIME();
+        for (uint32_t i = 0U; i < BLANK_CHECK_BENCH_ITERATIONS; i++)
+        {
+            blank = BLANK_CHECK_InternalFlash((uint32_t)(uintptr_t)pMapped, len, kHAL_Flash_MarginValueNormal) && blank;
+        }
+        blank_check_bench_print("intflash", "verify erase, normal", len, BLANK_CHECK_BENCH_GET_TIME() - start, blank);
+
+        start = BLANK_CHECK_BENCH_GET_TIME();
+        for (uint32_t i = 0U; i < BLANK_CHECK_BENCH_ITERATIONS; i++)
+        {
+            blank = BLANK_CHECK_InternalFlash((uint32_t)(uintptr_t)pMapped, len, kHAL_Flash_MarginValueUser) && blank;
+        }
+        blank_check_bench_print("intflash", "verify erase, user margin", len, BLANK_CHECK_BENCH_GET_TIME() - start,
+                                blank);
+        if (!blank)
+        {
+            ret = -1;
+        }
+#endif
+    }
+
+    if (read != NULL)
+    {
+        blank = true;
+        start = BLANK_CHECK_BENCH_GET_TIME();
+        for (uint32_t i = 0U; i < BLANK_CHECK_BENCH_ITERATIONS; i++)
+        {
+            blank = blank_check_bench_legacy_stream(read, offset, len) && blank;
+        }
+        blank_check_bench_print("stream", "page reads, byte loop", len, BLANK_CHECK_BENCH_GET_TIME() - start, blank);
+
+        blank = true;
+        start = BLANK_CHECK_BENCH_GET_TIME();
+        for (uint32_t i = 0U; i < BLANK_CHECK_BENCH_ITERATIONS; i++)
+        {
+            blank = BLANK_CHECK_Stream(read, offset, len) && blank;
+        }
+        blank_check_bench_print("stream", "BLANK_CHECK_Stream", len, BLANK_CHECK_BENCH_GET_TIME() - start, blank);
+        if (!blank)
+        {
+            ret = -1;
+        }
+    }
+
+    return ret;
+}
+
+#if defined(BLANK_CHECK_BENCH_MAIN)
+static int blank_check_bench_host_read(uint8_t *dest, uint32_t length, uint32_t offset, bool requestFastRead)
+{
+    int ret = -1;
+
+    (void)requestFastRead;
+    if ((offset <= sizeof(s_hostFlash)) && (length <= (sizeof(s_hostFlash) - offset)))
+    {
+        (void)memcpy(dest, (uint8_t *)s_hostFlash + offset, length);
+        ret = 0;
+    }
+
+    return ret;
+}
+
+int main(void)
+{
+    int ret = 0;
+
+    (void)memset(s_hostFlash, (int)FWK_BLANK_CHECK_ERASE_VALUE, sizeof(s_hostFlash));
+
+    for (uint32_t len = 256U; (len <= sizeof(s_hostFlash)) && (ret == 0); len *= 16U)
+    {
+        ret = BLANK_CHECK_BENCH_Run(s_hostFlash, blank_check_bench_host_read, 0U, len);
+    }
+
+    return (ret == 0) ? 0 : 1;
+}
+#endif
@@ -0,0 +1,52 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file blank_check_bench.h
+ * \brief Benchmark of the blank check backends against the byte loops they replace.
+ *
+ */
+
+#ifndef _BLANK_CHECK_BENCH_H_
+#define _BLANK_CHECK_BENCH_H_
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include "fwk_blank_check.h"
+
+/* -------------------------------------------------------------------------- */
+/*                                Public macros                               */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Number of calls measured for each backend
+ */
+#ifndef BLANK_CHECK_BENCH_ITERATIONS
+#define BLANK_CHECK_BENCH_ITERATIONS 100U
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Checks BLANK_CHECK_Memory() against a byte loop on RAM buffers, then prints the average duration of a blank
+ *        check of len bytes for each backend, with the previous implementation next to it.
+ *
+ * On Cortex-M targets the durations are in cycles of the DWT counter, on the host in ns. The results are printed with
+ * BLANK_CHECK_BENCH_PRINTF, printf by default.
+ *
+ * \param[in] pMapped blank memory mapped area, measured with the memory backend and, with
+ *                    gBlankCheckInternalFlash_d, with the verify erase command at the normal and user margins. NULL
+ *                    to skip.
+ * \param[in] read read function of the stream backend, PLATFORM_ReadExternalFlash() for the external flash. NULL to
+ *                 skip.
+ * \param[in] offset offset of a blank area for the read function.
+ * \param[in] len length of the areas in bytes.
+ * \return 0 if the checks passed and the areas are blank, -1 otherwise.
+ */
+int BLANK_CHECK_BENCH_Run(const void *pMapped, fwk_blank_check_read_t read, uint32_t offset, uint32_t len);
+
+#endif /* _BLANK_CHECK_BENCH_H_ */
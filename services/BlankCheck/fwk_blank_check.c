@@ -0,0 +1,116 @@
+/*
+ * Copyright 2025 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <stddef.h>
+#include "fwk_blank_check.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#if (CONFIG_FWK_BLANK_CHECK_CHUNK_SIZE < 16)
+#error CONFIG_FWK_BLANK_CHECK_CHUNK_SIZE must be at least 16
+#endif
+
+#define BLANK_CHECK_ERASE_WORD         0xFFFFFFFFU
+#define BLANK_CHECK_BLOCK_WORDS        4U
+#define BLANK_CHECK_BLOCK_SIZE         (BLANK_CHECK_BLOCK_WORDS * sizeof(uint32_t))
+#define BLANK_CHECK_CHUNK_WORDS        ((CONFIG_FWK_BLANK_CHECK_CHUNK_SIZE + 3U) / sizeof(uint32_t))
+#define BLANK_CHECK_IS_WORD_ALIGNED(p) ((((uintptr_t)(p)) & (sizeof(uint32_t) - 1U)) == 0U)
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+bool BLANK_CHECK_Memory(const void *pData, uint32_t len)
+{
+    const uint8_t  *pByte     = (const uint8_t *)pData;
+    const uint32_t *pWord;
+    uint32_t        remaining = len;
+
+    /* leading bytes up to the first word boundary */
+    while ((remaining != 0U) && !BLANK_CHECK_IS_WORD_ALIGNED(pByte) && (*pByte == FWK_BLANK_CHECK_ERASE_VALUE))
+    {
+        pByte++;
+        remaining--;
+    }
+
+    if (BLANK_CHECK_IS_WORD_ALIGNED(pByte))
+    {
+        pWord = (const uint32_t *)(const void *)pByte;
+
+        /* the erase value has all bits set, so a block is blank only if the AND of its words is too: one test per
+         * block on the common blank path */
+        while (remaining >= BLANK_CHECK_BLOCK_SIZE)
+        {
+            if ((pWord[0] & pWord[1] & pWord[2] & pWord[3]) != BLANK_CHECK_ERASE_WORD)
+            {
+                break;
+            }
+            pWord += BLANK_CHECK_BLOCK_WORDS;
+            remaining -= BLANK_CHECK_BLOCK_SIZE;
+        }
+
+        /* remaining words, or up to the first word of the block that is not blank */
+        while ((remaining >= sizeof(uint32_t)) && (*pWord == BLANK_CHECK_ERASE_WORD))
+        {
+            pWord++;
+            remaining -= sizeof(uint32_t);
+        }
+
+        pByte = (const uint8_t *)pWord;
+    }
+
+    /* trailing bytes, or up to the first byte that is not blank */
+    while ((remaining != 0U) && (*pByte == FWK_BLANK_CHECK_ERASE_VALUE))
+    {
+        pByte++;
+        remaining--;
+    }
+
+    return (remaining == 0U);
+}
+
+#if (gBlankCheckInternalFlash_d > 0)
+bool BLANK_CHECK_InternalFlash(uint32_t address, uint32_t len, hal_flash_margin_value_t margin)
+{
+    return (HAL_FlashVerifyErase(address, len, margin) == kStatus_HAL_Flash_Success);
+}
+#endif
+
+bool BLANK_CHECK_Stream(fwk_blank_check_read_t read, uint32_t offset, uint32_t len)
+{
+    /* word aligned so that BLANK_CHECK_Memory() goes straight to the blocks */
+    uint32_t chunk[BLANK_CHECK_CHUNK_WORDS];
+    uint32_t remaining = len;
+    uint32_t readSize;
+    bool     blank = true;
+
+    while ((remaining != 0U) && blank)
+    {
+        readSize = remaining;
+        if (readSize > (uint32_t)CONFIG_FWK_BLANK_CHECK_CHUNK_SIZE)
+        {
+            readSize = (uint32_t)CONFIG_FWK_BLANK_CHECK_CHUNK_SIZE;
+        }
+        if (read((uint8_t *)chunk, readSize, offset, false) != 0)
+        {
+            blank = false;
+        }
+        else
+        {
+            blank = BLANK_CHECK_Memory(chunk, readSize);
+            offset += readSize;
+            remaining -= readSize;
+        }
+    }
+
+    return blank;
+}
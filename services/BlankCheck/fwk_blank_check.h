@@ -0,0 +1,126 @@
+/*
+ * Copyright 2025 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __FWK_BLANK_CHECK_H__
+#define __FWK_BLANK_CHECK_H__
+
+/*!
+ * \file fwk_blank_check.h
+ * \brief Blank check of flash areas, used by NVM, OtaSupport and the external flash platform layer.
+ *
+ * Three backends are provided:
+ *  - memory mapped areas (XIP external flash, RAM copies) are compared to the erase value 4 words at a time, with an
+ *    early exit on the first non blank block,
+ *  - the internal flash is checked by the flash controller verify erase command through HAL_FlashVerifyErase(), which
+ *    also works on areas with ECC faults, when the flash adapter is built,
+ *  - areas that can only be read through a driver (external flash over SPI) are read in chunks of
+ *    CONFIG_FWK_BLANK_CHECK_CHUNK_SIZE bytes and compared as memory mapped areas.
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* -------------------------------------------------------------------------- */
+/*                                Public macros                               */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Internal flash backend, BLANK_CHECK_InternalFlash()
+ *
+ * Set to 0 by the build when the flash adapter is not part of it. There is no fallback reading the internal flash as
+ * memory: the read of an area with ECC faults raises a bus fault.
+ */
+#ifndef gBlankCheckInternalFlash_d
+#define gBlankCheckInternalFlash_d 1
+#endif
+
+/* the margin type of the internal flash backend */
+#if (gBlankCheckInternalFlash_d > 0)
+#include "fsl_adapter_flash.h"
+#endif
+
+/*!
+ * \brief Size of the read requests of BLANK_CHECK_Stream(), the buffer is on the stack of the caller
+ */
+#ifndef CONFIG_FWK_BLANK_CHECK_CHUNK_SIZE
+#define CONFIG_FWK_BLANK_CHECK_CHUNK_SIZE 512
+#endif
+
+/*!
+ * \brief Value of an erased flash byte
+ */
+#define FWK_BLANK_CHECK_ERASE_VALUE 0xFFU
+
+/* -------------------------------------------------------------------------- */
+/*                                Public types                                */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Read function of BLANK_CHECK_Stream(), same prototype as PLATFORM_ReadExternalFlash()
+ *
+ * \param[out] dest buffer to fill
+ * \param[in] length number of bytes to read
+ * \param[in] offset offset of the first byte in the flash
+ * \param[in] requestFastRead passed as false
+ * \return 0 on success, other on failure
+ */
+typedef int (*fwk_blank_check_read_t)(uint8_t *dest, uint32_t length, uint32_t offset, bool requestFastRead);
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * \brief Tells whether a memory mapped area only contains the erase value.
+ *
+ * \param[in] pData start of the area, no alignment required
+ * \param[in] len length of the area in bytes
+ * \return true if the area is blank, true as well if len is 0
+ */
+bool BLANK_CHECK_Memory(const void *pData, uint32_t len);
+
+#if (gBlankCheckInternalFlash_d > 0)
+/*!
+ * \brief Tells whether an area of the internal flash is blank, with the verify erase command of the flash controller.
+ *
+ * The address and length must meet the alignment constraints of HAL_FlashVerifyErase(), usually the flash phrase
+ * size.
+ *
+ * \param[in] address physical address of the area
+ * \param[in] len length of the area in bytes
+ * \param[in] margin read level of the check, kHAL_Flash_MarginValueNormal for the normal read level,
+ *                   kHAL_Flash_MarginValueUser to also detect the cells partially erased or weakly programmed
+ * \return true if the area is blank
+ */
+bool BLANK_CHECK_InternalFlash(uint32_t address, uint32_t len, hal_flash_margin_value_t margin);
+#endif
+
+/*!
+ * \brief Tells whether an area readable only through a driver is blank.
+ *
+ * The area is read in chunks of CONFIG_FWK_BLANK_CHECK_CHUNK_SIZE bytes, the check stops at the first chunk that is
+ * not blank.
+ *
+ * \param[in] read read function of the driver, PLATFORM_ReadExternalFlash() for the external flash
+ * \param[in] offset offset of the area, passed to the read function
+ * \param[in] len length of the area in bytes
+ * \return true if the area is blank, false if not or if a read failed
+ */
+bool BLANK_CHECK_Stream(fwk_blank_check_read_t read, uint32_t offset, uint32_t len);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* __FWK_BLANK_CHECK_H__ */
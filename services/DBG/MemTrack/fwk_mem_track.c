@@ -0,0 +1,342 @@
+/*
+ * Copyright 2025 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <stddef.h>
+#include "EmbeddedTypes.h"
+#include "fsl_os_abstraction.h"
+
+/* the tracker calls the memory manager functions */
+#define FWK_MEM_TRACK_NO_REMAP
+#include "fwk_mem_track.h"
+
+#if (CONFIG_FWK_MEM_TRACK > 0)
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#if (CONFIG_FWK_MEM_TRACK_MAX_LIVE < 1) || (CONFIG_FWK_MEM_TRACK_MAX_LIVE > 0xFFFF)
+#error CONFIG_FWK_MEM_TRACK_MAX_LIVE must be between 1 and 65535
+#endif
+
+#if (CONFIG_FWK_MEM_TRACK_MAX_SITES < 1) || (CONFIG_FWK_MEM_TRACK_MAX_SITES > 0xFFFF)
+#error CONFIG_FWK_MEM_TRACK_MAX_SITES must be between 1 and 65535
+#endif
+
+/* Saturated increment of a 16 bits counter */
+#define MEM_TRACK_INC16(counter)    \
+    do                              \
+    {                               \
+        if ((counter) < UINT16_MAX) \
+        {                           \
+            (counter)++;            \
+        }                           \
+    } while (false)
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+/* live buffers, packed at the beginning of the table */
+static fwk_mem_track_buffer_t  s_buffers[CONFIG_FWK_MEM_TRACK_MAX_LIVE];
+static fwk_mem_track_site_t    s_sites[CONFIG_FWK_MEM_TRACK_MAX_SITES];
+static fwk_mem_track_summary_t s_summary;
+
+/* -------------------------------------------------------------------------- */
+/*                             Private prototypes                             */
+/* -------------------------------------------------------------------------- */
+
+#if defined(gFSCI_MemAllocTest_Enabled_d) && (gFSCI_MemAllocTest_Enabled_d)
+extern mem_alloc_test_status_t FSCI_MemAllocTestCanAllocate(void *pCaller);
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+/* Returns the site of a caller, adds it if needed. Must be called with the interrupts masked. */
+static fwk_mem_track_site_t *mem_track_site(uint32_t caller, bool add)
+{
+    fwk_mem_track_site_t *site = NULL;
+
+    for (uint16_t i = 0U; i < s_summary.sites; i++)
+    {
+        if (s_sites[i].caller == caller)
+        {
+            site = &s_sites[i];
+            break;
+        }
+    }
+
+    if ((site == NULL) && add)
+    {
+        if (s_summary.sites < (uint16_t)CONFIG_FWK_MEM_TRACK_MAX_SITES)
+        {
+            site = &s_sites[s_summary.sites];
+            s_summary.sites++;
+            site->caller = caller;
+        }
+        else
+        {
+            MEM_TRACK_INC16(s_summary.sitesOverflow);
+        }
+    }
+
+    return site;
+}
+
+/* Removes the live buffer at index and updates the counters of its site. Must be called with the interrupts masked. */
+static void mem_track_remove(uint16_t index)
+{
+    fwk_mem_track_buffer_t *entry = &s_buffers[index];
+    fwk_mem_track_site_t   *site  = mem_track_site(entry->caller, false);
+
+    if (site != NULL)
+    {
+        site->frees++;
+        site->live--;
+        site->liveBytes -= entry->size;
+    }
+
+    s_summary.live--;
+    s_summary.liveBytes -= entry->size;
+
+    /* keep the table packed */
+    *entry = s_buffers[s_summary.live];
+}
+
+/* Must be called with the interrupts masked */
+static uint16_t mem_track_find(void *buffer)
+{
+    uint16_t index;
+
+    for (index = 0U; index < s_summary.live; index++)
+    {
+        if (s_buffers[index].buffer == buffer)
+        {
+            break;
+        }
+    }
+
+    return index;
+}
+
+static void mem_track_record(void *buffer, uint32_t numBytes, uint32_t caller)
+{
+    uint32_t              timestamp = FWK_MEM_TRACK_GET_TIME_MS();
+    uint16_t              size      = (numBytes > UINT16_MAX) ? UINT16_MAX : (uint16_t)numBytes;
+    fwk_mem_track_site_t *site;
+    uint16_t              index;
+
+    OSA_InterruptDisable();
+
+    site = mem_track_site(caller, true);
+    if (buffer == NULL)
+    {
+        if (site != NULL)
+        {
+            MEM_TRACK_INC16(site->failures);
+        }
+    }
+    else
+    {
+        /* A buffer freed without the tracker is still in the table, its address being allocated again proves it
+         * was freed */
+        index = mem_track_find(buffer);
+        if (index < s_summary.live)
+        {
+            mem_track_remove(index);
+        }
+
+        if (site != NULL)
+        {
+            site->allocs++;
+            if (size > site->maxSize)
+            {
+                site->maxSize = size;
+            }
+        }
+
+        if (s_summary.live < (uint16_t)CONFIG_FWK_MEM_TRACK_MAX_LIVE)
+        {
+            s_buffers[s_summary.live].buffer    = buffer;
+            s_buffers[s_summary.live].caller    = caller;
+            s_buffers[s_summary.live].timestamp = timestamp;
+            s_buffers[s_summary.live].size      = size;
+            s_summary.live++;
+            s_summary.liveBytes += size;
+            if (s_summary.live > s_summary.peakLive)
+            {
+                s_summary.peakLive = s_summary.live;
+            }
+            if (s_summary.liveBytes > s_summary.peakLiveBytes)
+            {
+                s_summary.peakLiveBytes = s_summary.liveBytes;
+            }
+
+            if (site != NULL)
+            {
+                site->live++;
+                site->liveBytes += size;
+                if (site->live > site->peakLive)
+                {
+                    site->peakLive = site->live;
+                }
+            }
+        }
+        else
+        {
+            MEM_TRACK_INC16(s_summary.untracked);
+        }
+    }
+
+    OSA_InterruptEnable();
+}
+
+#if defined(gFSCI_MemAllocTest_Enabled_d) && (gFSCI_MemAllocTest_Enabled_d)
+/* The memory manager sees the tracker as the caller, so the FSCI MemAllocTest check is done here with the address of
+ * the real caller */
+static bool mem_track_blocked(uint32_t caller)
+{
+    fwk_mem_track_site_t *site;
+    bool                  blocked = false;
+
+    if (FSCI_MemAllocTestCanAllocate((void *)(uintptr_t)caller) == kStatus_AllocBlock)
+    {
+        OSA_InterruptDisable();
+        site = mem_track_site(caller, true);
+        if (site != NULL)
+        {
+            MEM_TRACK_INC16(site->blocked);
+        }
+        OSA_InterruptEnable();
+        blocked = true;
+    }
+
+    return blocked;
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+void *MEM_TRACK_BufferAlloc(uint32_t numBytes)
+{
+    uint32_t caller = (uint32_t)(uintptr_t)__get_LR();
+    void    *buffer = NULL;
+
+#if defined(gFSCI_MemAllocTest_Enabled_d) && (gFSCI_MemAllocTest_Enabled_d)
+    if (mem_track_blocked(caller) == false)
+#endif
+    {
+        buffer = MEM_BufferAlloc(numBytes);
+        mem_track_record(buffer, numBytes, caller);
+    }
+
+    return buffer;
+}
+
+void *MEM_TRACK_BufferAllocWithId(uint32_t numBytes, uint8_t poolId)
+{
+    uint32_t caller = (uint32_t)(uintptr_t)__get_LR();
+    void    *buffer = NULL;
+
+#if defined(gFSCI_MemAllocTest_Enabled_d) && (gFSCI_MemAllocTest_Enabled_d)
+    if (mem_track_blocked(caller) == false)
+#endif
+    {
+        buffer = MEM_BufferAllocWithId(numBytes, poolId);
+        mem_track_record(buffer, numBytes, caller);
+    }
+
+    return buffer;
+}
+
+mem_status_t MEM_TRACK_BufferFree(void *buffer)
+{
+    uint16_t index;
+
+    if (buffer != NULL)
+    {
+        OSA_InterruptDisable();
+        index = mem_track_find(buffer);
+        if (index < s_summary.live)
+        {
+            mem_track_remove(index);
+        }
+        else
+        {
+            MEM_TRACK_INC16(s_summary.unknownFrees);
+        }
+        OSA_InterruptEnable();
+    }
+
+    return MEM_BufferFree(buffer);
+}
+
+void MEM_TRACK_GetSummary(fwk_mem_track_summary_t *summary)
+{
+    OSA_InterruptDisable();
+    *summary = s_summary;
+    OSA_InterruptEnable();
+}
+
+uint16_t MEM_TRACK_GetSites(fwk_mem_track_site_t *sites, uint16_t start, uint16_t count)
+{
+    uint16_t copied = 0U;
+
+    OSA_InterruptDisable();
+    while ((copied < count) && ((uint32_t)start + copied < s_summary.sites))
+    {
+        sites[copied] = s_sites[start + copied];
+        copied++;
+    }
+    OSA_InterruptEnable();
+
+    return copied;
+}
+
+uint16_t MEM_TRACK_GetBuffers(fwk_mem_track_buffer_t *buffers, uint16_t start, uint16_t count)
+{
+    uint16_t copied = 0U;
+
+    OSA_InterruptDisable();
+    while ((copied < count) && ((uint32_t)start + copied < s_summary.live))
+    {
+        buffers[copied] = s_buffers[start + copied];
+        copied++;
+    }
+    OSA_InterruptEnable();
+
+    return copied;
+}
+
+void MEM_TRACK_Reset(void)
+{
+    OSA_InterruptDisable();
+    for (uint16_t i = 0U; i < s_summary.sites; i++)
+    {
+        s_sites[i].allocs   = 0U;
+        s_sites[i].frees    = 0U;
+        s_sites[i].failures = 0U;
+        s_sites[i].blocked  = 0U;
+        s_sites[i].peakLive = s_sites[i].live;
+        s_sites[i].maxSize  = 0U;
+    }
+    s_summary.peakLive      = s_summary.live;
+    s_summary.peakLiveBytes = s_summary.liveBytes;
+    s_summary.untracked     = 0U;
+    s_summary.unknownFrees  = 0U;
+    s_summary.sitesOverflow = 0U;
+    OSA_InterruptEnable();
+}
+
+#endif /* CONFIG_FWK_MEM_TRACK */
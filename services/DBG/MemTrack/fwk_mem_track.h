@@ -0,0 +1,174 @@
+/*
+ * Copyright 2025 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __FWK_MEM_TRACK_H__
+#define __FWK_MEM_TRACK_H__
+
+/*!
+ * \file fwk_mem_track.h
+ * \brief Allocation tracker of the memory manager users.
+ *
+ * A module includes this header after fsl_component_mem_manager.h to route its MEM_BufferAlloc(),
+ * MEM_BufferAllocWithId() and MEM_BufferFree() calls through the tracker. The tracker records the caller address,
+ * size and timestamp of each live buffer, and counters per call site. The caller address is the link register value,
+ * the same value the FSCI MemAllocTest request matches, clear bit 0 to resolve it on Thumb targets.
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <stdint.h>
+#include "fsl_component_mem_manager.h"
+#include "fsl_os_abstraction.h"
+
+/* -------------------------------------------------------------------------- */
+/*                                Public macros                               */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Enables the allocation tracker, the header has no effect when disabled
+ */
+#ifndef CONFIG_FWK_MEM_TRACK
+#define CONFIG_FWK_MEM_TRACK 0
+#endif
+
+/*!
+ * \brief Number of live buffers tracked, the next allocations are counted as untracked
+ */
+#ifndef CONFIG_FWK_MEM_TRACK_MAX_LIVE
+#define CONFIG_FWK_MEM_TRACK_MAX_LIVE 64
+#endif
+
+/*!
+ * \brief Number of call sites with counters
+ */
+#ifndef CONFIG_FWK_MEM_TRACK_MAX_SITES
+#define CONFIG_FWK_MEM_TRACK_MAX_SITES 32
+#endif
+
+/*!
+ * \brief Time base of the allocation timestamps in ms, OSA_TimeGetMsec() by default
+ */
+#ifndef FWK_MEM_TRACK_GET_TIME_MS
+#define FWK_MEM_TRACK_GET_TIME_MS() OSA_TimeGetMsec()
+#endif
+
+#if (CONFIG_FWK_MEM_TRACK > 0) && !defined(FWK_MEM_TRACK_NO_REMAP)
+#undef MEM_BufferAlloc
+#undef MEM_BufferAllocWithId
+#undef MEM_BufferFree
+#define MEM_BufferAlloc(numBytes)               MEM_TRACK_BufferAlloc(numBytes)
+#define MEM_BufferAllocWithId(numBytes, poolId) MEM_TRACK_BufferAllocWithId(numBytes, poolId)
+#define MEM_BufferFree(buffer)                  MEM_TRACK_BufferFree(buffer)
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                                Public types                                */
+/* -------------------------------------------------------------------------- */
+
+/*! Counters of a call site */
+typedef struct fwk_mem_track_site_t
+{
+    uint32_t caller;    /* link register of the allocation */
+    uint32_t allocs;    /* successful allocations */
+    uint32_t frees;     /* frees of the tracked buffers allocated by this site */
+    uint32_t liveBytes; /* bytes held by the live buffers of this site */
+    uint16_t failures;  /* allocations failed by the memory manager */
+    uint16_t blocked;   /* allocations failed by the FSCI MemAllocTest request */
+    uint16_t live;      /* tracked buffers allocated by this site and not yet freed */
+    uint16_t peakLive;
+    uint16_t maxSize;
+} fwk_mem_track_site_t;
+
+/*! Live buffer */
+typedef struct fwk_mem_track_buffer_t
+{
+    void    *buffer;
+    uint32_t caller;    /* link register of the allocation */
+    uint32_t timestamp; /* allocation time in ms, see FWK_MEM_TRACK_GET_TIME_MS */
+    uint16_t size;      /* requested size */
+} fwk_mem_track_buffer_t;
+
+/*! Global counters */
+typedef struct fwk_mem_track_summary_t
+{
+    uint32_t liveBytes;
+    uint32_t peakLiveBytes;
+    uint16_t live;
+    uint16_t peakLive;
+    uint16_t sites;
+    uint16_t untracked;     /* allocations not recorded because the live buffer table was full */
+    uint16_t unknownFrees;  /* frees of buffers not allocated through the tracker */
+    uint16_t sitesOverflow; /* allocations from call sites not counted because the site table was full */
+} fwk_mem_track_summary_t;
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+#if (CONFIG_FWK_MEM_TRACK > 0)
+/*!
+ * \brief Allocates a buffer with MEM_BufferAlloc() and records it with the address of the caller.
+ *
+ * \param[in] numBytes number of bytes to allocate.
+ * \return pointer to the buffer, NULL if the allocation failed or was blocked by the FSCI MemAllocTest request.
+ */
+void *MEM_TRACK_BufferAlloc(uint32_t numBytes);
+
+/*!
+ * \brief Allocates a buffer with MEM_BufferAllocWithId() and records it with the address of the caller.
+ *
+ * \param[in] numBytes number of bytes to allocate.
+ * \param[in] poolId identifier of the memory pool.
+ * \return pointer to the buffer, NULL if the allocation failed or was blocked by the FSCI MemAllocTest request.
+ */
+void *MEM_TRACK_BufferAllocWithId(uint32_t numBytes, uint8_t poolId);
+
+/*!
+ * \brief Frees a buffer with MEM_BufferFree() and removes it from the live buffers.
+ *
+ * The buffer may have been allocated without the tracker, it's then counted in the unknown frees.
+ *
+ * \param[in] buffer pointer to the buffer to free.
+ * \return status of MEM_BufferFree().
+ */
+mem_status_t MEM_TRACK_BufferFree(void *buffer);
+
+/*!
+ * \brief Returns the global counters.
+ *
+ * \param[out] summary pointer to the counters to fill.
+ */
+void MEM_TRACK_GetSummary(fwk_mem_track_summary_t *summary);
+
+/*!
+ * \brief Copies the counters of the call sites, in order of first allocation.
+ *
+ * \param[out] sites array to fill.
+ * \param[in] start index of the first site to copy.
+ * \param[in] count size of the array.
+ * \return number of sites copied.
+ */
+uint16_t MEM_TRACK_GetSites(fwk_mem_track_site_t *sites, uint16_t start, uint16_t count);
+
+/*!
+ * \brief Copies the live buffers. The order changes as the buffers are freed.
+ *
+ * \param[out] buffers array to fill.
+ * \param[in] start index of the first live buffer to copy.
+ * \param[in] count size of the array.
+ * \return number of buffers copied.
+ */
+uint16_t MEM_TRACK_GetBuffers(fwk_mem_track_buffer_t *buffers, uint16_t start, uint16_t count);
+
+/*!
+ * \brief Clears the counters of the call sites and the global peaks. The live buffers are kept.
+ */
+void MEM_TRACK_Reset(void);
+#endif /* CONFIG_FWK_MEM_TRACK */
+
+#endif /* __FWK_MEM_TRACK_H__ */
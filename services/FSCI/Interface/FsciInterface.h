@@ -77,6 +77,10 @@
 #ifndef gFsciTaskPriority_c
 #define gFsciTaskPriority_c (3)
 #endif
+/* Create one Fsci task per interface instead of a single task servicing all interfaces */
+#ifndef gFsciTaskPerInterface_c
+#define gFsciTaskPerInterface_c 0 /* boolean */
+#endif
 
 #endif /* gFsciUseDedicatedTask_c */
 
@@ -112,6 +116,17 @@
 #define gFsciUseFileDataLog_c 0 /* boolean */
 #endif
 
+/* Deferred formatting logging: only the format string ID and the raw arguments are sent */
+#ifndef gFsciUseBinLog_c
+#define gFsciUseBinLog_c 0 /* boolean */
+#endif
+
+#if gFsciUseBinLog_c
+#ifndef gFsciBinLogBufferSize_c
+#define gFsciBinLogBufferSize_c 256U /* 32-bit words, must be a power of 2 */
+#endif
+#endif
+
 #ifndef gFsciTimestampSize_c
 #define gFsciTimestampSize_c 0 /* bytes */
 #endif
@@ -140,6 +155,42 @@
 #define gFsciRxTimeout_c 1 /* boolean */
 #endif
 
+/* Coalesce consecutive non-blocking TX frames of an interface into a single serial write */
+#ifndef gFsciTxAggregation_c
+#define gFsciTxAggregation_c 0 /* boolean */
+#endif
+
+#if gFsciTxAggregation_c
+/* Size of the aggregation buffer, a write is issued as soon as it cannot hold the next frame */
+#ifndef gFsciTxAggregationThreshold_c
+#define gFsciTxAggregationThreshold_c 512U /* bytes */
+#endif
+/* Maximum time a frame is held in the aggregation buffer before it is written */
+#ifndef gFsciTxAggregationTimeoutMs_c
+#define gFsciTxAggregationTimeoutMs_c 2U /* milliseconds */
+#endif
+#endif
+
+/* Streaming bulk transfer commands: memory dump, NVM snapshot and NVM image restore */
+#ifndef gFsciBulkTransfer_c
+#define gFsciBulkTransfer_c 0 /* boolean */
+#endif
+
+#if gFsciBulkTransfer_c
+/* Number of data frames which may be in flight before an acknowledgement is required */
+#ifndef gFsciBulkWindow_c
+#define gFsciBulkWindow_c 8U /* frames */
+#endif
+#ifndef gFsciBulkMaxTargets_c
+#define gFsciBulkMaxTargets_c 2U
+#endif
+#endif
+
+/* CRC-16/CRC-32 frame trailer instead of the XOR checksum, negotiated per interface with Mode Select */
+#ifndef gFsciCrcFraming_c
+#define gFsciCrcFraming_c 0 /* boolean */
+#endif
+
 /* Use RPMSG instead of Serial Manager for FSCI communication on the application core */
 #ifndef gFsciOverRpmsgBridge_c
 #define gFsciOverRpmsgBridge_c 0 /* boolean */
@@ -150,6 +201,18 @@
 #define gFsciOverRpmsg_c 0 /* boolean */
 #endif
 
+#if gFsciOverRpmsg_c
+/* FSCI owns the RPMsg endpoints passed to FSCI_Init(): received buffers are held until they are
+ * copied by the Fsci task into the packet given to the handlers, FSCI_transmitPayload() builds its frames
+ * directly in RPMsg TX buffers and the formatted packets are copied once into them */
+#ifndef gFsciRpmsgSharedBuffers_c
+#define gFsciRpmsgSharedBuffers_c 0 /* boolean */
+#endif
+#ifndef gFsciRpmsgRxQueueLen_c
+#define gFsciRpmsgRxQueueLen_c 4U /* RPMsg buffers held */
+#endif
+#endif
+
 #define mFsciInvalidInterface_c (0xFF)
 
 /* Used for maintaining backward compatibility */
@@ -173,7 +236,9 @@
 #define gFSCI_ReservedOpGroup_c    0x52
 
 /* Additional bytes added by FSCI to a packet */
-#if (gFsciMaxVirtualInterfaces_c > 0)
+#if gFsciCrcFraming_c
+#define gFsci_TailBytes_c (4U)
+#elif (gFsciMaxVirtualInterfaces_c > 0)
 #define gFsci_TailBytes_c (2U)
 #else
 #define gFsci_TailBytes_c (1U)
@@ -286,6 +351,17 @@ typedef enum
     gFsciInvalidMode   = 0xFF /*!<  invalid mode */
 } gFsciMode_t;
 
+/*!
+ * \brief  Data type definition for the trailer of the frames exchanged on an interface.
+ *         CRCs are computed from the opGroup to the end of the payload and sent little endian.
+ */
+typedef enum
+{
+    gFsciFramingXor_c   = 0, /*!<  8-bit XOR checksum */
+    gFsciFramingCrc16_c = 1, /*!<  CRC-16/CCITT-FALSE */
+    gFsciFramingCrc32_c = 2, /*!<  CRC-32 (IEEE 802.3) */
+} gFsciFraming_t;
+
 /*!
  * \brief Data type definition for the message handler function
  */
@@ -313,6 +389,25 @@ typedef struct gFsciOpGroup_tag
     uint8_t        fsciInterfaceId;  /*!<  FSCI interface Id*/
 } gFsciOpGroup_t;
 
+#if gFsciBulkTransfer_c
+/*! Bulk transfer targets provided by the framework */
+#define gFsciBulkTargetMemory_c 0U /*!< RAM (read/write) and flash (read only), addresses are absolute */
+#define gFsciBulkTargetNvm_c    1U /*!< NVM storage, addresses are offsets in the storage */
+
+/*!
+ * \struct fsciBulkTarget_t
+ * \brief Storage accessed by the FSCI bulk transfer commands.
+ *        A NULL pfRead or pfWrite means the direction is not supported, pfStart and pfEnd are optional.
+ */
+typedef struct fsciBulkTarget_tag
+{
+    gFsciStatus_t (*pfStart)(uint32_t address, uint32_t size, bool_t write); /*!< check and prepare the transfer */
+    gFsciStatus_t (*pfRead)(uint32_t address, uint8_t *pBuf, uint16_t len);  /*!< read a chunk */
+    gFsciStatus_t (*pfWrite)(uint32_t address, uint8_t *pBuf, uint16_t len); /*!< write a chunk */
+    void (*pfEnd)(bool_t commit); /*!< end of transfer, commit is FALSE on abort or CRC mismatch */
+} fsciBulkTarget_t;
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -402,6 +497,42 @@ void FSCI_transmitPayload(uint8_t OG, uint8_t OC, const uint8_t *pMsg, uint16_t
 void FSCI_Error(uint8_t errorCode, uint32_t fsciInterface);
 
 uint8_t *FSCI_GetFormattedPacket(uint8_t OG, uint8_t OC, void *pMsg, uint16_t msgLen, uint16_t *pOutLen);
+
+#if gFsciCrcFraming_c
+/*!*********************************************************************************
+ * \brief Selects the trailer of the frames sent and received on an interface.
+ *
+ * \details The host normally negotiates the framing with the Mode Select request.
+ *          CRC framing is not available on interfaces using a virtual interface Id.
+ *
+ * \param[in] fsciInterface  FSCI interface
+ * \param[in] framing        frame trailer
+ *
+ * \return gFsciSuccess_c if the framing was applied, gFsciError_c otherwise
+ ********************************************************************************* */
+gFsciStatus_t FSCI_SetFramingMode(uint32_t fsciInterface, gFsciFraming_t framing);
+
+/*!*********************************************************************************
+ * \brief Returns the trailer of the frames sent and received on an interface.
+ *
+ * \param[in] fsciInterface  FSCI interface
+ *
+ * \return the current framing of the interface
+ ********************************************************************************* */
+gFsciFraming_t FSCI_GetFramingMode(uint32_t fsciInterface);
+#endif
+
+#if gFsciBulkTransfer_c
+/*!*********************************************************************************
+ * \brief Registers a storage for the bulk transfer commands.
+ *
+ * \param[in] targetId  target ID used by the host, [0..gFsciBulkMaxTargets_c)
+ * \param[in] pTarget   target callbacks, NULL to unregister
+ *
+ * \return gFsciSuccess_c if the target was registered, gFsciError_c otherwise
+ ********************************************************************************* */
+gFsciStatus_t FSCI_BulkRegisterTarget(uint8_t targetId, const fsciBulkTarget_t *pTarget);
+#endif
 #endif
 
 #if gFsciTxAck_c
@@ -454,6 +585,66 @@ void FSCI_LogFormatedText(const char *fmt, ...);
 void FSCI_LogToFile(char *fileName, uint8_t *pData, uint16_t dataSize, uint8_t mode);
 #endif
 
+/*!
+ * \brief Logs a printf-like message without formatting it on the device.
+ *
+ * \details The format string is placed in the .fsci_binlog_fmt section and is never sent,
+ *          its address is used as the message ID. Only the ID and the raw arguments are
+ *          stored in RAM, the text is rebuilt on the host from the ELF file.
+ *          Arguments must be integers or pointers of at most 32 bits, at most
+ *          gFsciBinLogMaxArgs_c arguments are supported.
+ */
+#if gFsciUseBinLog_c
+#define gFsciBinLogMaxArgs_c 7U
+
+#if defined(__IAR_SYSTEMS_ICC__)
+#define FSCI_BIN_LOG_FMT_DEFINE(name, fmt)                                             \
+    _Pragma("location=\".fsci_binlog_fmt\"") _Pragma("data_alignment=8") static const \
+        __root char name[] = fmt
+#elif defined(__GNUC__) || defined(__CC_ARM) || defined(__ARMCC_VERSION)
+#define FSCI_BIN_LOG_FMT_DEFINE(name, fmt) \
+    static const char name[] __attribute__((section(".fsci_binlog_fmt"), aligned(8), used)) = fmt
+#else
+#define FSCI_BIN_LOG_FMT_DEFINE(name, fmt) static const char name[] = fmt
+#endif
+
+/* Counts up to 15 arguments, so that a call with too many arguments is rejected instead of being truncated */
+#define FSCI_BIN_LOG_NARGS(...) \
+    FSCI_BIN_LOG_NARGS_(0, ##__VA_ARGS__, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define FSCI_BIN_LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, N, ...) N
+
+#if defined(__cplusplus)
+#define FSCI_BIN_LOG_CHECK_NARGS(n) static_assert((n) <= gFsciBinLogMaxArgs_c, "FSCI_BinLog: too many arguments")
+#else
+#define FSCI_BIN_LOG_CHECK_NARGS(n) _Static_assert((n) <= gFsciBinLogMaxArgs_c, "FSCI_BinLog: too many arguments")
+#endif
+
+#define FSCI_BinLog(fmt, ...)                                                                                  \
+    do                                                                                                         \
+    {                                                                                                          \
+        FSCI_BIN_LOG_CHECK_NARGS(FSCI_BIN_LOG_NARGS(__VA_ARGS__));                                             \
+        FSCI_BIN_LOG_FMT_DEFINE(mFsciBinLogFmt, fmt);                                                          \
+        FSCI_BinLogPush((uint32_t)mFsciBinLogFmt | (uint32_t)FSCI_BIN_LOG_NARGS(__VA_ARGS__), ##__VA_ARGS__); \
+    } while (false)
+
+/*!*********************************************************************************
+ * \brief Stores a binary log record. Use the FSCI_BinLog() macro instead of calling it directly.
+ *
+ * \param[in] header  format string ID ORed with the number of arguments
+ * \param[in] ...     the arguments, as 32-bit words
+ ********************************************************************************* */
+void FSCI_BinLogPush(uint32_t header, ...);
+
+/*!*********************************************************************************
+ * \brief Sends the stored binary log records to the host.
+ *
+ * \details Should be called from a low priority context, the idle task for instance.
+ *          Each packet starts with the number of records dropped since the previous
+ *          packet because the log buffer was full.
+ ********************************************************************************* */
+void FSCI_BinLogFlush(void);
+#endif
+
 /*!
  * @}  end of FSCI addtogroup
  */
@@ -60,6 +60,18 @@
 #include "fwk_platform_reset.h"
 #endif
 
+#if defined(CONFIG_FWK_WORKQ_STATS) && (CONFIG_FWK_WORKQ_STATS > 0)
+#include "fwk_workq.h"
+#endif
+
+#if defined(CONFIG_FWK_HEAP_STATS) && (CONFIG_FWK_HEAP_STATS > 0)
+#include "heap_mem_manager.h"
+#endif
+
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+#include "fwk_mem_track.h"
+#endif
+
 #if gFsciIncluded_c
 /************************************************************************************
 *************************************************************************************
@@ -100,6 +112,35 @@
 #define TmrMillisecondsToMicroseconds(n) ((uint64_t)((n)*1000UL))
 #endif
 
+#if gFsciBulkTransfer_c
+/* Data bytes per bulk frame: the payload minus the sequence number, rounded down to a multiple of 16
+ * so that every frame but the last one keeps flash program operations phrase aligned */
+#define mFsciBulkChunkSize_c ((uint16_t)((gFsciMaxPayloadLen_c - sizeof(uint16_t)) & ~0xFU))
+/* target ID, address, size, window */
+#define mFsciBulkStartReqLen_c (1U + sizeof(uint32_t) + sizeof(uint32_t) + 1U)
+/* status, size, CRC */
+#define mFsciBulkEndIndLen_c (1U + sizeof(uint32_t) + sizeof(uint32_t))
+#endif
+
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+/* MemAllocTrack request types */
+#define mFsciMemTrackSummary_c 0U
+#define mFsciMemTrackSites_c   1U
+#define mFsciMemTrackBuffers_c 2U
+#define mFsciMemTrackReset_c   3U
+/* status, type, total, count */
+#define mFsciMemTrackHdrLen_c (2U + sizeof(uint16_t) + 1U)
+/* caller, allocs, frees, live bytes, failures, blocked, live, peak live, max size */
+#define mFsciMemTrackSiteLen_c (4U * sizeof(uint32_t) + 5U * sizeof(uint16_t))
+/* buffer, caller, size, age */
+#define mFsciMemTrackBufferLen_c (3U * sizeof(uint32_t) + sizeof(uint16_t))
+#endif
+
+#if gFsciCrcFraming_c
+/* No framing change requested by Mode Select */
+#define mFsciInvalidFraming_c 0xFFU
+#endif
+
 /************************************************************************************
 *************************************************************************************
 * Private prototypes
@@ -117,6 +158,18 @@ extern uint8_t PhyGetLastRxLqiValue(void);
 mem_alloc_test_status_t FSCI_MemAllocTestCanAllocate(void *pCaller);
 #endif
 
+#if gFsciBulkTransfer_c
+static bool_t   FSCI_BulkStart(clientPacket_t *pData, uint32_t fsciInterface, bool_t write);
+static void     FSCI_BulkPump(void);
+static void     FSCI_BulkSendEnd(gFsciStatus_t status);
+static void     FSCI_BulkClose(bool_t commit);
+#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+static gFsciStatus_t FSCI_BulkMemoryStart(uint32_t address, uint32_t size, bool_t write);
+static gFsciStatus_t FSCI_BulkMemoryRead(uint32_t address, uint8_t *pBuf, uint16_t len);
+static gFsciStatus_t FSCI_BulkMemoryWrite(uint32_t address, uint8_t *pBuf, uint16_t len);
+#endif
+#endif
+
 /************************************************************************************
 *************************************************************************************
 * Private type definitions
@@ -147,13 +200,27 @@ typedef PACKED_STRUCT FsciMemAllocBufferTest_tag
 }
 FsciMemAllocBufferTest_t;
 #endif
+
+#if gFsciBulkTransfer_c
+typedef struct fsciBulkSession_tag
+{
+    const fsciBulkTarget_t *pTarget;       /* target of the transfer in progress, NULL when idle */
+    uint32_t                fsciInterface; /* interface on which the transfer was started */
+    uint32_t                address;       /* next address to read or write */
+    uint32_t                remaining;     /* bytes left to transfer */
+    uint32_t                size;          /* total size of the transfer */
+    uint32_t                crc;           /* running CRC-32 of the transferred data */
+    uint16_t                seq;           /* sequence number of the next frame */
+    uint16_t                ackedSeq;      /* sequence number of the first frame not acknowledged */
+    uint8_t                 window;        /* frames allowed between two acknowledgements */
+    bool_t                  write;         /* TRUE for host to device transfers */
+} fsciBulkSession_t;
+#endif
 /************************************************************************************
 *************************************************************************************
 * Public memory declarations
 *************************************************************************************
 ************************************************************************************/
-/* Set to TRUE when FSCI_Error() is called. */
-uint8_t mFsciErrorReported;
 bool_t (*pfFSCI_OtaSupportCalback)(clientPacket_t *pPacket) = NULL;
 
 /************************************************************************************
@@ -161,8 +228,8 @@ bool_t (*pfFSCI_OtaSupportCalback)(clientPacket_t *pPacket) = NULL;
 * Private memory declarations
 *************************************************************************************
 ************************************************************************************/
-/* FSCI Error message */
-static gFsciErrorMsg_t mFsciErrorMsg = {
+/* FSCI Error message template */
+static const gFsciErrorMsg_t mFsciErrorMsg = {
     .header =
         {
             .startMarker = gFSCI_StartMarker_c,
@@ -170,15 +237,13 @@ static gFsciErrorMsg_t mFsciErrorMsg = {
             .opCode      = mFsciMsgError_c,
             .len         = sizeof(clientPacketStatus_t),
         },
-    .status    = (uint8_t)gFsciSuccess_c,
-    .checksum  = 0u,
-    .checksum2 = 0u,
+    .status = (uint8_t)gFsciSuccess_c,
 };
 
 /* FSCI Ack message */
 #if gFsciTxAck_c
 static gFsciAckMsg_t mFsciAckMsg = {
-    {gFSCI_StartMarker_c, gFSCI_CnfOpcodeGroup_c, mFsciMsgAck_c, sizeof(uint8_t)}, 0, 0, 0};
+    {gFSCI_StartMarker_c, gFSCI_CnfOpcodeGroup_c, mFsciMsgAck_c, sizeof(uint8_t)}, 0, {0}};
 #endif
 
 /* FSCI OpCodes and corresponding handler functions */
@@ -192,6 +257,14 @@ static const gFsciOpCode_t FSCI_ReqOCtable[] = {
     {mFsciMsgWriteExtendedAdrReq_c, FSCI_MsgWriteExtendedAdrReqFunc},
     {mFsciLowLevelMemoryWriteBlock_c, FSCI_WriteMemoryBlock},
     {mFsciLowLevelMemoryReadBlock_c, FSCI_ReadMemoryBlock},
+#if gFsciBulkTransfer_c
+    {mFsciBulkReadStart_c, FSCI_BulkReadStart},
+    {mFsciBulkWriteStart_c, FSCI_BulkWriteStart},
+    {mFsciBulkData_c, FSCI_BulkData},
+    {mFsciBulkAck_c, FSCI_BulkAck},
+    {mFsciBulkEnd_c, FSCI_BulkEnd},
+    {mFsciBulkAbort_c, FSCI_BulkAbort},
+#endif
     {mFsciLowLevelPing_c, FSCI_Ping},
 
     {mFsciOtaSupportImageNotifyReq_c, FSCI_OtaSupportHandlerFunc},
@@ -219,10 +292,19 @@ static const gFsciOpCode_t FSCI_ReqOCtable[] = {
 #if defined(gPlatformHasNbu_d) && (gPlatformHasNbu_d == 1)
     {mFsciGetNbuVersion_c, FSCI_ReadNbuVer},
 #endif
+#if defined(CONFIG_FWK_WORKQ_STATS) && (CONFIG_FWK_WORKQ_STATS > 0)
+    {mFsciGetWorkQStats_c, FSCI_GetWorkQStats},
+#endif
+#if defined(CONFIG_FWK_HEAP_STATS) && (CONFIG_FWK_HEAP_STATS > 0)
+    {mFsciGetHeapStats_c, FSCI_GetHeapStats},
+#endif
 
 #if defined(gFSCI_MemAllocTest_Enabled_d) && (gFSCI_MemAllocTest_Enabled_d)
     {mFSCIMemAllocTestReq_c, FSCI_MemAllocTest},
 #endif
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+    {mFSCIMemAllocTrackReq_c, FSCI_MemAllocTrack},
+#endif
 };
 
 /* Used for maintaining backward compatibility */
@@ -245,6 +327,29 @@ FsciMemAllocBufferTest_t mFSCI_MemAllocBufferTest[gFSCI_NotAllocMemoryBufferSize
 uint8_t                  mFSCI_MemAllocBufferTestIndex                              = 0;
 #endif
 
+#if gFsciBulkTransfer_c
+#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+static const fsciBulkTarget_t mFsciBulkMemoryTarget = {
+    .pfStart = FSCI_BulkMemoryStart,
+    .pfRead  = FSCI_BulkMemoryRead,
+    .pfWrite = FSCI_BulkMemoryWrite,
+    .pfEnd   = NULL,
+};
+#endif
+
+/* Bulk transfer targets, indexed by target ID */
+static const fsciBulkTarget_t *mFsciBulkTargets[gFsciBulkMaxTargets_c] = {
+#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+    [gFsciBulkTargetMemory_c] = &mFsciBulkMemoryTarget,
+#else
+    NULL,
+#endif
+};
+
+/* Only one bulk transfer at a time, a new start request cancels the previous one */
+static fsciBulkSession_t mFsciBulkSession;
+#endif
+
 /************************************************************************************
 *************************************************************************************
 * Public functions
@@ -297,43 +402,29 @@ void fsciMsgHandler(clientPacket_t *pPkt, uint32_t fsciInterface)
  ********************************************************************************** */
 void FSCI_Error(uint8_t errorCode, uint32_t fsciInterface)
 {
-    uint8_t virtInterface = FSCI_GetVirtualInterface(fsciInterface);
-    uint8_t size          = sizeof(gFsciErrorMsg_t) - offsetof(gFsciErrorMsg_t, header.opGroup);
+    uint16_t           size = sizeof(clientPacketHdr_t) + sizeof(clientPacketStatus_t);
+    fsciIntfContext_t *pCtx = FSCI_GetIntfContext(fsciInterface);
 
     /* Don't cascade error messages. */
-    if (mFsciErrorReported == 0u)
+    if (pCtx->errorReported == 0u)
     {
-        uint16_t checksum_comp_sz = (offsetof(gFsciErrorMsg_t, checksum) - offsetof(gFsciErrorMsg_t, header.opGroup));
-        mFsciErrorMsg.status      = errorCode;
-        /* sizeof(gFsciErrorMsg_t) is 7 or 8 depending on length field size : checksum_comp_sz is 4 or 5
-         * and checksum is computed from offset 1  */
-        // coverity[overrun-buffer-arg:FALSE] Out-of-bounds access (OVERRUN) is false positive
-        mFsciErrorMsg.checksum = FSCI_computeChecksum(&mFsciErrorMsg.header.opGroup, checksum_comp_sz);
+        /* Built on the stack: interfaces may report errors concurrently */
+        gFsciErrorMsg_t errorMsg = mFsciErrorMsg;
+
+        errorMsg.status = errorCode;
+        size += FSCI_computeTrailer(&errorMsg.header.opGroup, size - 1u, NULL, 0u, fsciInterface, errorMsg.trailer);
 
-        if (virtInterface != 0u)
-        {
-#if (gFsciMaxVirtualInterfaces_c > 0)
-            mFsciErrorMsg.checksum2 = mFsciErrorMsg.checksum;
-            mFsciErrorMsg.checksum += virtInterface;
-            mFsciErrorMsg.checksum2 ^= mFsciErrorMsg.checksum;
-            size++;
-#else
-            (void)virtInterface;
-#endif
-        }
 #if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+#if gFsciTxAggregation_c
+        /* Frames still held for aggregation must go out before the error message */
+        FSCI_TxAggregationFlush(fsciInterface);
+#endif
         (void)SerialManager_WriteBlocking((serial_write_handle_t)gFsciSerialWriteHandle[fsciInterface],
-                                          (uint8_t *)&mFsciErrorMsg, size);
+                                          (uint8_t *)&errorMsg, size);
 #else
-        union
-        {
-            void         *pVoid;
-            pfFSCI_Send_t pfFSCI_Send;
-        } fsciHandle;
-        fsciHandle.pVoid = gFsciSerialInterfaces[fsciInterface];
-        fsciHandle.pfFSCI_Send((uint8_t *)&mFsciErrorMsg, size, FALSE);
+        FSCI_RpmsgSend(fsciInterface, (uint8_t *)&errorMsg, size, FALSE);
 #endif
-        mFsciErrorReported = 1u;
+        pCtx->errorReported = 1u;
     }
 }
 
@@ -348,23 +439,10 @@ void FSCI_Error(uint8_t errorCode, uint32_t fsciInterface)
  ********************************************************************************** */
 void FSCI_Ack(uint8_t checksum, uint32_t fsciInterface)
 {
-    uint8_t virtInterface = FSCI_GetVirtualInterface(fsciInterface);
-    uint8_t size          = sizeof(mFsciAckMsg) - 1u;
+    uint16_t size = sizeof(clientPacketHdr_t) + sizeof(mFsciAckMsg.checksumPacketReceived);
 
     mFsciAckMsg.checksumPacketReceived = checksum;
-    mFsciAckMsg.checksum               = FSCI_computeChecksum(&mFsciAckMsg.header.opGroup, (uint16_t)size - 2u);
-
-    if (virtInterface != 0u)
-    {
-#if (gFsciMaxVirtualInterfaces_c > 0)
-        mFsciAckMsg.checksum2 = mFsciAckMsg.checksum;
-        mFsciAckMsg.checksum += virtInterface;
-        mFsciAckMsg.checksum2 ^= mFsciAckMsg.checksum;
-        size++;
-#else
-        (void)virtInterface;
-#endif
-    }
+    size += FSCI_computeTrailer(&mFsciAckMsg.header.opGroup, size - 1u, NULL, 0u, fsciInterface, mFsciAckMsg.trailer);
 
     (void)Serial_SyncWrite(gFsciSerialInterfaces[fsciInterface], (uint8_t *)&mFsciAckMsg, size);
 }
@@ -407,11 +485,13 @@ gFsciStatus_t FSCI_ResetReq(uint32_t fsciInterface)
 
 /*! *********************************************************************************
  * \brief   Set FSCI operating mode for certain OpGroups
+ *          An optional last byte selects the frame trailer (gFsciFraming_t) of the interface
  *
  * \param[in] pData pointer to location of the received data
  * \param[in] fsciInterface the interface on which the packet was received
  *
- * \return  TRUE in order to recycle the received message
+ * \return  TRUE in order to recycle the received message,
+ *          FALSE if the confirm was already sent because the framing changed
  *
  ********************************************************************************** */
 bool_t FSCI_MsgModeSelectReqFunc(clientPacket_t *pData, uint32_t fsciInterface)
@@ -419,6 +499,10 @@ bool_t FSCI_MsgModeSelectReqFunc(clientPacket_t *pData, uint32_t fsciInterface)
     uint8_t         i;
     uint8_t         payloadIndex = 0u;
     gFsciOpGroup_t *p;
+    bool_t          status = TRUE;
+#if gFsciCrcFraming_c
+    uint8_t framing = mFsciInvalidFraming_c;
+#endif
 
     fsciLen_t dataLen = pData->structured.header.len;
 
@@ -429,7 +513,7 @@ bool_t FSCI_MsgModeSelectReqFunc(clientPacket_t *pData, uint32_t fsciInterface)
         dataLen--;
     }
 
-    for (i = 0; i < dataLen; i++)
+    for (i = 0; (i < dataLen) && (i < NumberOfElements(mFsciModeSelectSAPs)); i++)
     {
         p = FSCI_GetReqOpGroup(mFsciModeSelectSAPs[i], (uint8_t)fsciInterface);
         if (NULL != p)
@@ -439,8 +523,32 @@ bool_t FSCI_MsgModeSelectReqFunc(clientPacket_t *pData, uint32_t fsciInterface)
     }
 
     pData->structured.payload[0] = (uint8_t)gFsciSuccess_c;
+
+#if gFsciCrcFraming_c
+    /* An optional byte after the OpGroup modes selects the frame trailer */
+    if (dataLen > NumberOfElements(mFsciModeSelectSAPs))
+    {
+        framing = pData->structured.payload[payloadIndex + NumberOfElements(mFsciModeSelectSAPs)];
+        if (!FSCI_IsFramingModeValid(fsciInterface, framing))
+        {
+            pData->structured.payload[0] = (uint8_t)gFsciError_c;
+            framing                      = mFsciInvalidFraming_c;
+        }
+    }
+#endif
     pData->structured.header.len = sizeof(uint8_t);
-    return TRUE;
+
+#if gFsciCrcFraming_c
+    if (framing != mFsciInvalidFraming_c)
+    {
+        /* The confirm still uses the previous framing, the new one applies to the next frames */
+        pData->structured.header.opGroup = gFSCI_CnfOpcodeGroup_c;
+        FSCI_transmitFormatedPacket(pData, fsciInterface);
+        (void)FSCI_SetFramingMode(fsciInterface, (gFsciFraming_t)framing);
+        status = FALSE;
+    }
+#endif
+    return status;
 }
 
 /*! *********************************************************************************
@@ -457,25 +565,63 @@ bool_t FSCI_MsgGetModeReqFunc(clientPacket_t *pData, uint32_t fsciInterface)
     uint8_t         i;
     uint8_t         payloadIndex = 0u;
     gFsciOpGroup_t *p;
+    clientPacket_t *pPkt;
+    bool_t          status = TRUE; /* Try to reuse the received buffer */
+    /* Status, TX blocking, the OpGroup modes and the framing byte */
+    uint32_t len = 2u + NumberOfElements(mFsciModeSelectSAPs) + (uint32_t)gFsciCrcFraming_c;
 
-    pData->structured.payload[payloadIndex++] = (uint8_t)gFsciSuccess_c;
-    pData->structured.payload[payloadIndex++] = (uint8_t)gFsciTxBlocking;
+    /* The request carries no payload, so its buffer may be too small for the confirm */
+    if (MEM_BufferGetSize(pData) >= (sizeof(clientPacketHdr_t) + len + gFsci_TailBytes_c))
+    {
+        pPkt = pData;
+    }
+    else
+    {
+        pPkt = MEM_BufferAlloc((uint32_t)sizeof(clientPacketHdr_t) + len + gFsci_TailBytes_c);
+    }
 
-    for (i = 0u; i < NumberOfElements(mFsciModeSelectSAPs); i++)
+    if (pPkt == NULL)
     {
-        p = FSCI_GetReqOpGroup(mFsciModeSelectSAPs[i], (uint8_t)fsciInterface);
-        if (NULL != p)
+        FSCI_Error((uint8_t)gFsciOutOfMessages_c, fsciInterface);
+        (void)MEM_BufferFree(pData);
+        status = FALSE;
+    }
+    else
+    {
+        pPkt->structured.payload[payloadIndex++] = (uint8_t)gFsciSuccess_c;
+        pPkt->structured.payload[payloadIndex++] = (uint8_t)gFsciTxBlocking;
+
+        for (i = 0u; i < NumberOfElements(mFsciModeSelectSAPs); i++)
         {
-            pData->structured.payload[payloadIndex++] = (uint8_t)(p->mode);
+            p = FSCI_GetReqOpGroup(mFsciModeSelectSAPs[i], (uint8_t)fsciInterface);
+            if (NULL != p)
+            {
+                pPkt->structured.payload[payloadIndex++] = (uint8_t)(p->mode);
+            }
+            else
+            {
+                pPkt->structured.payload[payloadIndex++] = (uint8_t)gFsciInvalidMode;
+            }
         }
-        else
+#if gFsciCrcFraming_c
+        pPkt->structured.payload[payloadIndex++] = (uint8_t)FSCI_GetFramingMode(fsciInterface);
+#endif
+
+        pPkt->structured.header.len = payloadIndex;
+
+        /* Check if the received buffer was reused. */
+        if (pPkt != pData)
         {
-            pData->structured.payload[payloadIndex++] = (uint8_t)gFsciInvalidMode;
+            /* A new buffer was allocated. Fill with aditional information */
+            pPkt->structured.header.opGroup = gFSCI_CnfOpcodeGroup_c;
+            pPkt->structured.header.opCode  = mFsciMsgGetModeReq_c;
+            FSCI_transmitFormatedPacket(pPkt, fsciInterface);
+            (void)MEM_BufferFree(pData);
+            status = FALSE;
         }
     }
 
-    pData->structured.header.len = payloadIndex;
-    return TRUE;
+    return status;
 }
 
 /*! *********************************************************************************
@@ -590,6 +736,243 @@ bool_t FSCI_ReadMemoryBlock(clientPacket_t *pData, uint32_t fsciInterface)
     return status;
 }
 
+#if gFsciBulkTransfer_c
+/*! *********************************************************************************
+ * \brief   Starts a device to host bulk transfer.
+ *          Payload contains the packet received over the serial interface
+ *          byte  0   --> target ID
+ *          bytes 1-4 --> start address
+ *          bytes 5-8 --> number of bytes to read
+ *          byte  9   --> number of frames sent ahead of the acknowledgements, 0 for default
+ *          The confirm carries the status, the data bytes per frame and the window. Then the
+ *          data is pushed in BulkData indications, and a BulkEnd indication closes the transfer.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ * \return  FALSE, the confirm is sent before the first data frame
+ *
+ ********************************************************************************** */
+bool_t FSCI_BulkReadStart(clientPacket_t *pData, uint32_t fsciInterface)
+{
+    return FSCI_BulkStart(pData, fsciInterface, FALSE);
+}
+
+/*! *********************************************************************************
+ * \brief   Starts a host to device bulk transfer.
+ *          Same payload and confirm as FSCI_BulkReadStart(). The host then sends BulkData
+ *          requests, which are acknowledged once per window, and a BulkEnd request with the CRC.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ * \return  FALSE, the confirm is sent by FSCI_BulkStart()
+ *
+ ********************************************************************************** */
+bool_t FSCI_BulkWriteStart(clientPacket_t *pData, uint32_t fsciInterface)
+{
+    return FSCI_BulkStart(pData, fsciInterface, TRUE);
+}
+
+/*! *********************************************************************************
+ * \brief   Receives a data frame of a host to device bulk transfer.
+ *          bytes 0-1 --> sequence number
+ *          bytes 2+  --> data, mFsciBulkChunkSize_c bytes except for the last frame
+ *          A BulkAck indication with the sequence number and the status is sent after
+ *          each window of frames and after the last frame.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ * \return  TRUE if the received message is reused for the acknowledgement
+ *
+ ********************************************************************************** */
+bool_t FSCI_BulkData(clientPacket_t *pData, uint32_t fsciInterface)
+{
+    fsciBulkSession_t *pSession = &mFsciBulkSession;
+    gFsciStatus_t      status   = gFsciError_c;
+    bool_t             reuse    = FALSE;
+    uint16_t           seq;
+    uint16_t           len;
+
+    if ((pSession->pTarget == NULL) || (pSession->write == FALSE) || (pSession->fsciInterface != fsciInterface) ||
+        (pData->structured.header.len < sizeof(seq)))
+    {
+        FSCI_Error((uint8_t)gFsciError_c, fsciInterface);
+    }
+    else
+    {
+        FLib_MemCpy(&seq, pData->structured.payload, sizeof(seq));
+        len = (uint16_t)pData->structured.header.len - (uint16_t)sizeof(seq);
+
+        /* Frames are expected in order and full, a lost frame cancels the transfer */
+        if ((seq == pSession->seq) && (len <= pSession->remaining) &&
+            ((len == mFsciBulkChunkSize_c) || (len == pSession->remaining)))
+        {
+            status = pSession->pTarget->pfWrite(pSession->address, &pData->structured.payload[sizeof(seq)], len);
+        }
+
+        if (status == gFsciSuccess_c)
+        {
+            pSession->crc = FSCI_computeCrc32(pSession->crc, &pData->structured.payload[sizeof(seq)], len);
+            pSession->address += len;
+            pSession->remaining -= len;
+            pSession->seq++;
+
+            if (((uint16_t)(pSession->seq - pSession->ackedSeq) >= pSession->window) || (pSession->remaining == 0U))
+            {
+                pSession->ackedSeq                     = pSession->seq;
+                pData->structured.header.opCode        = mFsciBulkAck_c;
+                pData->structured.header.len           = (fsciLen_t)(sizeof(seq) + sizeof(clientPacketStatus_t));
+                pData->structured.payload[sizeof(seq)] = (uint8_t)status;
+                reuse                                  = TRUE;
+            }
+        }
+        else
+        {
+            FSCI_BulkSendEnd(status);
+            FSCI_BulkClose(FALSE);
+        }
+    }
+
+    if (!reuse)
+    {
+        (void)MEM_BufferFree(pData);
+    }
+    return reuse;
+}
+
+/*! *********************************************************************************
+ * \brief   Acknowledges the data frames of a device to host bulk transfer.
+ *          bytes 0-1 --> sequence number of the last frame received
+ *          No confirm is sent, the next data frames are pushed instead. A short request
+ *          is answered with an FSCI error.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ * \return  FALSE
+ *
+ ********************************************************************************** */
+bool_t FSCI_BulkAck(clientPacket_t *pData, uint32_t fsciInterface)
+{
+    fsciBulkSession_t *pSession = &mFsciBulkSession;
+    uint16_t           seq      = 0U;
+    bool_t             valid    = FALSE;
+
+    if (pData->structured.header.len >= sizeof(seq))
+    {
+        FLib_MemCpy(&seq, pData->structured.payload, sizeof(seq));
+        valid = TRUE;
+    }
+    (void)MEM_BufferFree(pData);
+
+    if (valid == FALSE)
+    {
+        FSCI_Error((uint8_t)gFsciError_c, fsciInterface);
+    }
+    /* Ignore stale acknowledgements, which are outside of the frames in flight */
+    else if ((pSession->pTarget != NULL) && (pSession->write == FALSE) && (pSession->fsciInterface == fsciInterface) &&
+             ((uint16_t)(seq - pSession->ackedSeq) < (uint16_t)(pSession->seq - pSession->ackedSeq)))
+    {
+        pSession->ackedSeq = seq + 1U;
+        FSCI_BulkPump();
+    }
+    else
+    {
+        /* MISRA rule 15.7 */
+    }
+
+    return FALSE;
+}
+
+/*! *********************************************************************************
+ * \brief   Ends a host to device bulk transfer.
+ *          bytes 0-3 --> CRC-32 of the data computed by the host
+ *          The data is committed by the target only if all the data was received and the
+ *          CRC matches. The confirm carries the status and the CRC computed by the device.
+ *          A short request gets an error status.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ * \return  TRUE in order to recycle the received message
+ *
+ ********************************************************************************** */
+bool_t FSCI_BulkEnd(clientPacket_t *pData, uint32_t fsciInterface)
+{
+    fsciBulkSession_t *pSession = &mFsciBulkSession;
+    gFsciStatus_t      status   = gFsciError_c;
+    uint32_t           hostCrc;
+    uint32_t           crc = 0U;
+
+    /* A short request is rejected with an error status, the transfer in progress is kept */
+    if ((pData->structured.header.len >= sizeof(hostCrc)) && (pSession->pTarget != NULL) &&
+        (pSession->write == TRUE) && (pSession->fsciInterface == fsciInterface))
+    {
+        FLib_MemCpy(&hostCrc, pData->structured.payload, sizeof(hostCrc));
+        crc = ~pSession->crc;
+        if ((pSession->remaining == 0U) && (crc == hostCrc))
+        {
+            status = gFsciSuccess_c;
+        }
+        FSCI_BulkClose(status == gFsciSuccess_c);
+    }
+
+    pData->structured.header.len = (fsciLen_t)(sizeof(clientPacketStatus_t) + sizeof(crc));
+    pData->structured.payload[0] = (uint8_t)status;
+    FLib_MemCpy(&pData->structured.payload[1], &crc, sizeof(crc));
+    return TRUE;
+}
+
+/*! *********************************************************************************
+ * \brief   Cancels the bulk transfer in progress, if any. Data already written is not committed.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ * \return  TRUE in order to recycle the received message
+ *
+ ********************************************************************************** */
+bool_t FSCI_BulkAbort(clientPacket_t *pData, uint32_t fsciInterface)
+{
+    if (mFsciBulkSession.pTarget != NULL)
+    {
+        FSCI_BulkClose(FALSE);
+    }
+
+    pData->structured.header.len = (fsciLen_t)sizeof(clientPacketStatus_t);
+    pData->structured.payload[0] = (uint8_t)gFsciSuccess_c;
+    return TRUE;
+}
+
+/*! *********************************************************************************
+ * \brief   Registers a storage for the bulk transfer commands.
+ *
+ * \param[in] targetId target ID used by the host
+ * \param[in] pTarget target callbacks, NULL to unregister
+ *
+ * \return  gFsciSuccess_c if the target was registered, gFsciError_c otherwise
+ *
+ ********************************************************************************** */
+gFsciStatus_t FSCI_BulkRegisterTarget(uint8_t targetId, const fsciBulkTarget_t *pTarget)
+{
+    gFsciStatus_t status = gFsciError_c;
+
+    if (targetId < gFsciBulkMaxTargets_c)
+    {
+        if ((mFsciBulkSession.pTarget != NULL) && (mFsciBulkSession.pTarget == mFsciBulkTargets[targetId]))
+        {
+            FSCI_BulkClose(FALSE);
+        }
+        mFsciBulkTargets[targetId] = pTarget;
+        status                     = gFsciSuccess_c;
+    }
+
+    return status;
+}
+#endif /* gFsciBulkTransfer_c */
+
 /*! *********************************************************************************
  * \brief  This function simply echoes back the payload
  *
@@ -1206,11 +1589,11 @@ bool_t FSCI_ReadNbuVer(clientPacket_t *pData, uint32_t fsciInterface)
 }
 #endif /* #if defined(gPlatformHasNbu_d) && (gPlatformHasNbu_d == 1) */
 
-#if defined(gFSCI_MemAllocTest_Enabled_d) && (gFSCI_MemAllocTest_Enabled_d)
+#if defined(CONFIG_FWK_WORKQ_STATS) && (CONFIG_FWK_WORKQ_STATS > 0)
 /*! *********************************************************************************
- * \brief   Add possibility that for a number of times or a period of time a memory
- *          block will not be allocated for a specific location identified with a link
- *          register interval.
+ * \brief  This function sends the statistics of the system workqueue over the
+ *         serial interface. If the first byte of the request payload is 1, the
+ *         statistics are reset once read.
  *
  * \param[in] pData pointer to location of the received data
  * \param[in] fsciInterface the interface on which the packet was received
@@ -1218,35 +1601,262 @@ bool_t FSCI_ReadNbuVer(clientPacket_t *pData, uint32_t fsciInterface)
  * \return  TRUE in order to recycle the received message
  *
  ********************************************************************************** */
-bool_t FSCI_MemAllocTest(clientPacket_t *pData, uint32_t fsciInterface)
+bool_t FSCI_GetWorkQStats(clientPacket_t *pData, uint32_t fsciInterface)
 {
-    uint64_t systemTime;
-    uint8_t  coppyIndex = 0u;
-
-    /* Copy LRMinValue and LRMaxValue and enableNumberOfBuffers */
-    FLib_MemCpy(&mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex], pData->structured.payload, 9);
-    coppyIndex = coppyIndex + 9u;
+    bool_t            status;
+    clientPacket_t   *pPkt;
+    fwk_workq_stats_t stats;
+    bool_t            reset = FALSE;
+    uint32_t          runAvg;
+    uint8_t          *p;
+    uint32_t          size = sizeof(clientPacketHdr_t) + sizeof(clientPacketStatus_t) +
+                    (6u + FWK_WORKQ_STATS_LATENCY_BUCKETS) * sizeof(uint32_t) + 2u * sizeof(uint16_t) +
+                    gFsci_TailBytes_c;
+
+    if ((pData->structured.header.len > 0u) && (pData->structured.payload[0] == 1u))
+    {
+        reset = TRUE;
+    }
 
-    if (mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].enableNumberOfBuffers == TRUE)
+    /* Check if the received buffer is large enough to be reused */
+    if (MEM_BufferGetSize(pData) >= size)
     {
-        /* Coppy numberOfBuffersValue and enableTimeOfNoAllocation if enableNumberOfBuffers enabled */
-        FLib_MemCpy(&mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].numberOfBuffersValue,
-                    &pData->structured.payload[coppyIndex], 2u);
-        coppyIndex = coppyIndex + 2u;
+        pPkt = pData;
     }
     else
     {
-        /* Copy enableTimeOfNoAllocation if enableNumberOfBuffers is not enabled */
-        FLib_MemCpy(&mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].enableTimeOfNoAllocation,
-                    &pData->structured.payload[coppyIndex], 1);
-        coppyIndex = coppyIndex + 1;
+        pPkt = MEM_BufferAlloc(size);
     }
 
-    if (mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].enableTimeOfNoAllocation == TRUE)
+    if (pPkt == NULL)
     {
-        /* Copy timeOfNoAllocationValue if enableTimeOfNoAllocation enabled */
-        FLib_MemCpy(&mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].timeOfNoAllocationValue,
-                    &pData->structured.payload[coppyIndex], 4u);
+        FSCI_Error((uint8_t)gFsciOutOfMessages_c, fsciInterface);
+        (void)MEM_BufferFree(pData);
+        status = FALSE;
+    }
+    else
+    {
+        p = pPkt->structured.payload;
+
+        if (WORKQ_GetSysWorkQStats(&stats) != 0)
+        {
+            *p = (uint8_t)gFsciError_c;
+            p++;
+        }
+        else
+        {
+            if (reset == TRUE)
+            {
+                (void)WORKQ_ResetSysWorkQStats();
+            }
+
+            runAvg = (stats.processed > 0u) ? (uint32_t)(stats.runTotal / stats.processed) : 0u;
+            if (stats.processed == 0u)
+            {
+                stats.runMin = 0u;
+            }
+
+            *p = (uint8_t)gFsciSuccess_c;
+            p++;
+            FLib_MemCpy(p, &stats.processed, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+            FLib_MemCpy(p, &stats.resubmitted, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+            FLib_MemCpy(p, stats.latencyHist, sizeof(stats.latencyHist));
+            p += sizeof(stats.latencyHist);
+            FLib_MemCpy(p, &stats.latencyMax, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+            FLib_MemCpy(p, &stats.runMin, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+            FLib_MemCpy(p, &runAvg, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+            FLib_MemCpy(p, &stats.runMax, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+            FLib_MemCpy(p, &stats.depth, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            FLib_MemCpy(p, &stats.depthMax, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+        }
+
+        pPkt->structured.header.len = (uint8_t)(p - pPkt->structured.payload);
+
+        /* Check if the received buffer was reused. */
+        if (pPkt != pData)
+        {
+            /* A new buffer was allocated. Fill with aditional information */
+            pPkt->structured.header.opGroup = gFSCI_CnfOpcodeGroup_c;
+            pPkt->structured.header.opCode  = mFsciGetWorkQStats_c;
+            FSCI_transmitFormatedPacket(pPkt, fsciInterface);
+            (void)MEM_BufferFree(pData);
+            status = FALSE;
+        }
+        else
+        {
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+#endif /* CONFIG_FWK_WORKQ_STATS */
+
+#if defined(CONFIG_FWK_HEAP_STATS) && (CONFIG_FWK_HEAP_STATS > 0)
+/*! *********************************************************************************
+ * \brief  This function sends the statistics of the FreeRTOS heap over the
+ *         serial interface. If the first byte of the request payload is 1, the
+ *         statistics are reset once read.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ * \return  TRUE in order to recycle the received message
+ *
+ ********************************************************************************** */
+bool_t FSCI_GetHeapStats(clientPacket_t *pData, uint32_t fsciInterface)
+{
+    bool_t           status;
+    clientPacket_t  *pPkt;
+    fwk_heap_stats_t stats;
+    bool_t           reset = FALSE;
+    uint8_t          classes;
+    uint8_t         *p;
+    uint32_t         size;
+
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+    classes = (uint8_t)CONFIG_FWK_HEAP_SLAB_CLASSES;
+#else
+    classes = 0u;
+#endif
+    size = sizeof(clientPacketHdr_t) + sizeof(clientPacketStatus_t) + 9u * sizeof(uint32_t) + sizeof(uint8_t) +
+           (uint32_t)classes * 3u * sizeof(uint16_t) + gFsci_TailBytes_c;
+
+    if ((pData->structured.header.len > 0u) && (pData->structured.payload[0] == 1u))
+    {
+        reset = TRUE;
+    }
+
+    /* Check if the received buffer is large enough to be reused */
+    if (MEM_BufferGetSize(pData) >= size)
+    {
+        pPkt = pData;
+    }
+    else
+    {
+        pPkt = MEM_BufferAlloc(size);
+    }
+
+    if (pPkt == NULL)
+    {
+        FSCI_Error((uint8_t)gFsciOutOfMessages_c, fsciInterface);
+        (void)MEM_BufferFree(pData);
+        status = FALSE;
+    }
+    else
+    {
+        HEAP_GetStats(&stats);
+        if (reset == TRUE)
+        {
+            HEAP_ResetStats();
+        }
+
+        p  = pPkt->structured.payload;
+        *p = (uint8_t)gFsciSuccess_c;
+        p++;
+        FLib_MemCpy(p, &stats.freeBytes, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        FLib_MemCpy(p, &stats.minFreeBytes, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        FLib_MemCpy(p, &stats.largestFreeBlock, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        FLib_MemCpy(p, &stats.freeBlocks, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        FLib_MemCpy(p, &stats.usedBytes, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        FLib_MemCpy(p, &stats.peakUsedBytes, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        FLib_MemCpy(p, &stats.allocations, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        FLib_MemCpy(p, &stats.frees, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        FLib_MemCpy(p, &stats.failures, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        *p = classes;
+        p++;
+#if (CONFIG_FWK_HEAP_SLAB > 0)
+        for (uint8_t i = 0u; i < classes; i++)
+        {
+            FLib_MemCpy(p, &stats.classes[i].blockSize, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            FLib_MemCpy(p, &stats.classes[i].blocks, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            FLib_MemCpy(p, &stats.classes[i].cached, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+        }
+#endif
+
+        pPkt->structured.header.len = (uint8_t)(p - pPkt->structured.payload);
+
+        /* Check if the received buffer was reused. */
+        if (pPkt != pData)
+        {
+            /* A new buffer was allocated. Fill with aditional information */
+            pPkt->structured.header.opGroup = gFSCI_CnfOpcodeGroup_c;
+            pPkt->structured.header.opCode  = mFsciGetHeapStats_c;
+            FSCI_transmitFormatedPacket(pPkt, fsciInterface);
+            (void)MEM_BufferFree(pData);
+            status = FALSE;
+        }
+        else
+        {
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+#endif /* CONFIG_FWK_HEAP_STATS */
+
+#if defined(gFSCI_MemAllocTest_Enabled_d) && (gFSCI_MemAllocTest_Enabled_d)
+/*! *********************************************************************************
+ * \brief   Add possibility that for a number of times or a period of time a memory
+ *          block will not be allocated for a specific location identified with a link
+ *          register interval.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ * \return  TRUE in order to recycle the received message
+ *
+ ********************************************************************************** */
+bool_t FSCI_MemAllocTest(clientPacket_t *pData, uint32_t fsciInterface)
+{
+    uint64_t systemTime;
+    uint8_t  coppyIndex = 0u;
+
+    /* Copy LRMinValue and LRMaxValue and enableNumberOfBuffers */
+    FLib_MemCpy(&mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex], pData->structured.payload, 9);
+    coppyIndex = coppyIndex + 9u;
+
+    if (mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].enableNumberOfBuffers == TRUE)
+    {
+        /* Coppy numberOfBuffersValue and enableTimeOfNoAllocation if enableNumberOfBuffers enabled */
+        FLib_MemCpy(&mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].numberOfBuffersValue,
+                    &pData->structured.payload[coppyIndex], 2u);
+        coppyIndex = coppyIndex + 2u;
+    }
+    else
+    {
+        /* Copy enableTimeOfNoAllocation if enableNumberOfBuffers is not enabled */
+        FLib_MemCpy(&mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].enableTimeOfNoAllocation,
+                    &pData->structured.payload[coppyIndex], 1);
+        coppyIndex = coppyIndex + 1;
+    }
+
+    if (mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].enableTimeOfNoAllocation == TRUE)
+    {
+        /* Copy timeOfNoAllocationValue if enableTimeOfNoAllocation enabled */
+        FLib_MemCpy(&mFSCI_MemAllocBufferTest[mFSCI_MemAllocBufferTestIndex].timeOfNoAllocationValue,
+                    &pData->structured.payload[coppyIndex], 4u);
         coppyIndex = coppyIndex + 4u;
     }
 
@@ -1358,6 +1968,179 @@ mem_alloc_test_status_t FSCI_MemAllocTestCanAllocate(void *pCaller)
 }
 #endif /* gFSCI_MemAllocTest_Enabled_d */
 
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+/*! *********************************************************************************
+ * \brief   Sends the allocation tracker data over the serial interface. The first
+ *          request payload byte selects the summary, a page of the call sites, a
+ *          page of the live buffers, or resets the counters. For the pages, the next
+ *          two bytes give the index of the first entry. The call site addresses can
+ *          be used as link register interval by the MemAllocTest request.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ * \return  TRUE in order to recycle the received message
+ *
+ ********************************************************************************** */
+bool_t FSCI_MemAllocTrack(clientPacket_t *pData, uint32_t fsciInterface)
+{
+    bool_t                  status;
+    clientPacket_t         *pPkt;
+    fwk_mem_track_summary_t summary;
+    uint8_t                 type  = mFsciMemTrackSummary_c;
+    uint16_t                start = 0u;
+    uint16_t                total;
+    uint8_t                 count = 0u;
+    uint8_t                *p;
+    uint32_t                size = sizeof(clientPacketHdr_t) + gFsciMaxPayloadLen_c + gFsci_TailBytes_c;
+
+    if (pData->structured.header.len > 0u)
+    {
+        type = pData->structured.payload[0];
+    }
+    if (pData->structured.header.len >= 3u)
+    {
+        FLib_MemCpy(&start, &pData->structured.payload[1], sizeof(uint16_t));
+    }
+
+    /* Check if the received buffer is large enough to be reused */
+    if (MEM_BufferGetSize(pData) >= size)
+    {
+        pPkt = pData;
+    }
+    else
+    {
+        pPkt = MEM_BufferAlloc(size);
+    }
+
+    if (pPkt == NULL)
+    {
+        FSCI_Error((uint8_t)gFsciOutOfMessages_c, fsciInterface);
+        (void)MEM_BufferFree(pData);
+        status = FALSE;
+    }
+    else
+    {
+        MEM_TRACK_GetSummary(&summary);
+        p = pPkt->structured.payload;
+        p++; /* status */
+        *p = type;
+        p++;
+
+        if (type == mFsciMemTrackSummary_c)
+        {
+            FLib_MemCpy(p, &summary.live, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            FLib_MemCpy(p, &summary.peakLive, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            FLib_MemCpy(p, &summary.liveBytes, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+            FLib_MemCpy(p, &summary.peakLiveBytes, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+            FLib_MemCpy(p, &summary.sites, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            FLib_MemCpy(p, &summary.untracked, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            FLib_MemCpy(p, &summary.unknownFrees, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            FLib_MemCpy(p, &summary.sitesOverflow, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            pPkt->structured.payload[0] = (uint8_t)gFsciSuccess_c;
+        }
+        else if (type == mFsciMemTrackSites_c)
+        {
+            fwk_mem_track_site_t site;
+
+            total = summary.sites;
+            FLib_MemCpy(p, &total, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            p++; /* count */
+            while ((mFsciMemTrackHdrLen_c + ((uint32_t)count + 1u) * mFsciMemTrackSiteLen_c <= gFsciMaxPayloadLen_c) &&
+                   (MEM_TRACK_GetSites(&site, start + count, 1u) == 1u))
+            {
+                FLib_MemCpy(p, &site.caller, sizeof(uint32_t));
+                p += sizeof(uint32_t);
+                FLib_MemCpy(p, &site.allocs, sizeof(uint32_t));
+                p += sizeof(uint32_t);
+                FLib_MemCpy(p, &site.frees, sizeof(uint32_t));
+                p += sizeof(uint32_t);
+                FLib_MemCpy(p, &site.liveBytes, sizeof(uint32_t));
+                p += sizeof(uint32_t);
+                FLib_MemCpy(p, &site.failures, sizeof(uint16_t));
+                p += sizeof(uint16_t);
+                FLib_MemCpy(p, &site.blocked, sizeof(uint16_t));
+                p += sizeof(uint16_t);
+                FLib_MemCpy(p, &site.live, sizeof(uint16_t));
+                p += sizeof(uint16_t);
+                FLib_MemCpy(p, &site.peakLive, sizeof(uint16_t));
+                p += sizeof(uint16_t);
+                FLib_MemCpy(p, &site.maxSize, sizeof(uint16_t));
+                p += sizeof(uint16_t);
+                count++;
+            }
+            pPkt->structured.payload[4] = count;
+            pPkt->structured.payload[0] = (uint8_t)gFsciSuccess_c;
+        }
+        else if (type == mFsciMemTrackBuffers_c)
+        {
+            fwk_mem_track_buffer_t buffer;
+            uint32_t               now = FWK_MEM_TRACK_GET_TIME_MS();
+            uint32_t               value;
+
+            total = summary.live;
+            FLib_MemCpy(p, &total, sizeof(uint16_t));
+            p += sizeof(uint16_t);
+            p++; /* count */
+            while ((mFsciMemTrackHdrLen_c + ((uint32_t)count + 1u) * mFsciMemTrackBufferLen_c <= gFsciMaxPayloadLen_c) &&
+                   (MEM_TRACK_GetBuffers(&buffer, start + count, 1u) == 1u))
+            {
+                value = (uint32_t)(uintptr_t)buffer.buffer;
+                FLib_MemCpy(p, &value, sizeof(uint32_t));
+                p += sizeof(uint32_t);
+                FLib_MemCpy(p, &buffer.caller, sizeof(uint32_t));
+                p += sizeof(uint32_t);
+                FLib_MemCpy(p, &buffer.size, sizeof(uint16_t));
+                p += sizeof(uint16_t);
+                value = now - buffer.timestamp;
+                FLib_MemCpy(p, &value, sizeof(uint32_t));
+                p += sizeof(uint32_t);
+                count++;
+            }
+            pPkt->structured.payload[4] = count;
+            pPkt->structured.payload[0] = (uint8_t)gFsciSuccess_c;
+        }
+        else if (type == mFsciMemTrackReset_c)
+        {
+            MEM_TRACK_Reset();
+            pPkt->structured.payload[0] = (uint8_t)gFsciSuccess_c;
+        }
+        else
+        {
+            pPkt->structured.payload[0] = (uint8_t)gFsciError_c;
+        }
+
+        pPkt->structured.header.len = (fsciLen_t)(p - pPkt->structured.payload);
+
+        /* Check if the received buffer was reused. */
+        if (pPkt != pData)
+        {
+            /* A new buffer was allocated. Fill with aditional information */
+            pPkt->structured.header.opGroup = gFSCI_CnfOpcodeGroup_c;
+            pPkt->structured.header.opCode  = mFSCIMemAllocTrackReq_c;
+            FSCI_transmitFormatedPacket(pPkt, fsciInterface);
+            (void)MEM_BufferFree(pData);
+            status = FALSE;
+        }
+        else
+        {
+            status = TRUE;
+        }
+    }
+
+    return status;
+}
+#endif /* CONFIG_FWK_MEM_TRACK */
+
 /*! *********************************************************************************
  * \brief  This function handles the requests for the OTA OpCodes
  *
@@ -1400,4 +2183,241 @@ bool_t FSCI_EnableBootloaderFunc(clientPacket_t *pData, uint32_t fsciInterface)
     /* No longer support on these platform - Shall use now  PLATFORM_OtaNotifyNewImageReady() */
     return FALSE;
 }
+
+/************************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+************************************************************************************/
+#if gFsciBulkTransfer_c
+/*! *********************************************************************************
+ * \brief   Checks a bulk start request, opens the session and sends the confirm.
+ *          For device to host transfers the first window of data frames follows.
+ *
+ * \param[in] pData pointer to location of the received data
+ * \param[in] fsciInterface the interface on which the packet was received
+ * \param[in] write TRUE for host to device transfers
+ *
+ * \return  FALSE, the received message is reused for the confirm
+ *
+ ********************************************************************************** */
+static bool_t FSCI_BulkStart(clientPacket_t *pData, uint32_t fsciInterface, bool_t write)
+{
+    fsciBulkSession_t      *pSession = &mFsciBulkSession;
+    const fsciBulkTarget_t *pTarget  = NULL;
+    gFsciStatus_t           status   = gFsciSuccess_c;
+    uint16_t                chunk    = mFsciBulkChunkSize_c;
+    uint8_t                 targetId = 0U;
+    uint8_t                 window   = 0U;
+    uint32_t                address  = 0U;
+    uint32_t                size     = 0U;
+
+    if (pSession->pTarget != NULL)
+    {
+        FSCI_BulkClose(FALSE);
+    }
+
+    /* The fields are read only once the request is known to be complete */
+    if (pData->structured.header.len < mFsciBulkStartReqLen_c)
+    {
+        status = gFsciError_c;
+    }
+    else
+    {
+        targetId = pData->structured.payload[0];
+        FLib_MemCpy(&address, &pData->structured.payload[1], sizeof(address));
+        FLib_MemCpy(&size, &pData->structured.payload[5], sizeof(size));
+        window = pData->structured.payload[9];
+
+        if ((targetId >= gFsciBulkMaxTargets_c) || (mFsciBulkTargets[targetId] == NULL))
+        {
+            status = gFsciRequestIsDisabled_c;
+        }
+    }
+
+    if (status == gFsciSuccess_c)
+    {
+        pTarget = mFsciBulkTargets[targetId];
+        if (((write == TRUE) && (pTarget->pfWrite == NULL)) || ((write == FALSE) && (pTarget->pfRead == NULL)))
+        {
+            status = gFsciRequestIsDisabled_c;
+        }
+        else if (size == 0U)
+        {
+            status = gFsciError_c;
+        }
+        else if (pTarget->pfStart != NULL)
+        {
+            status = pTarget->pfStart(address, size, write);
+        }
+        else
+        {
+            /* MISRA rule 15.7 */
+        }
+    }
+
+    if (window == 0U)
+    {
+        window = (uint8_t)gFsciBulkWindow_c;
+    }
+
+    if (status == gFsciSuccess_c)
+    {
+        pSession->pTarget       = pTarget;
+        pSession->fsciInterface = fsciInterface;
+        pSession->address       = address;
+        pSession->remaining     = size;
+        pSession->size          = size;
+        pSession->crc           = 0xFFFFFFFFU;
+        pSession->seq           = 0U;
+        pSession->ackedSeq      = 0U;
+        pSession->window        = window;
+        pSession->write         = write;
+    }
+
+    pData->structured.header.opGroup = gFSCI_CnfOpcodeGroup_c;
+    pData->structured.header.len     = (fsciLen_t)(sizeof(clientPacketStatus_t) + sizeof(chunk) + sizeof(window));
+    pData->structured.payload[0]     = (uint8_t)status;
+    FLib_MemCpy(&pData->structured.payload[1], &chunk, sizeof(chunk));
+    pData->structured.payload[3] = window;
+    FSCI_transmitFormatedPacket(pData, fsciInterface);
+
+    FSCI_BulkPump();
+    return FALSE;
+}
+
+/*! *********************************************************************************
+ * \brief   Sends the data frames of a device to host transfer until the window is full.
+ *          Ends the transfer when all the data was sent or on error.
+ *
+ ********************************************************************************** */
+static void FSCI_BulkPump(void)
+{
+    fsciBulkSession_t *pSession = &mFsciBulkSession;
+    gFsciStatus_t      status   = gFsciSuccess_c;
+    clientPacket_t    *pPkt;
+    uint16_t           len;
+
+    if ((pSession->pTarget != NULL) && (pSession->write == FALSE))
+    {
+        while ((pSession->remaining != 0U) && ((uint16_t)(pSession->seq - pSession->ackedSeq) < pSession->window))
+        {
+            len  = (pSession->remaining < mFsciBulkChunkSize_c) ? (uint16_t)pSession->remaining : mFsciBulkChunkSize_c;
+            pPkt = MEM_BufferAlloc((uint32_t)sizeof(clientPacketHdr_t) + sizeof(uint16_t) + len + gFsci_TailBytes_c);
+            if (pPkt == NULL)
+            {
+                /* Retried on the next acknowledgement, unless none is expected */
+                if (pSession->seq == pSession->ackedSeq)
+                {
+                    status = gFsciOutOfMessages_c;
+                }
+                break;
+            }
+
+            status = pSession->pTarget->pfRead(pSession->address, &pPkt->structured.payload[sizeof(uint16_t)], len);
+            if (status != gFsciSuccess_c)
+            {
+                (void)MEM_BufferFree(pPkt);
+                break;
+            }
+
+            pPkt->structured.header.opGroup = gFSCI_CnfOpcodeGroup_c;
+            pPkt->structured.header.opCode  = mFsciBulkData_c;
+            pPkt->structured.header.len     = (fsciLen_t)(sizeof(uint16_t) + len);
+            FLib_MemCpy(pPkt->structured.payload, &pSession->seq, sizeof(uint16_t));
+            pSession->crc = FSCI_computeCrc32(pSession->crc, &pPkt->structured.payload[sizeof(uint16_t)], len);
+            FSCI_transmitFormatedPacket(pPkt, pSession->fsciInterface);
+
+            pSession->address += len;
+            pSession->remaining -= len;
+            pSession->seq++;
+        }
+
+        if ((status != gFsciSuccess_c) || (pSession->remaining == 0U))
+        {
+            FSCI_BulkSendEnd(status);
+            FSCI_BulkClose(status == gFsciSuccess_c);
+        }
+    }
+}
+
+/*! *********************************************************************************
+ * \brief   Sends a BulkEnd indication: status, transfer size and CRC-32 of the data
+ *          transferred so far.
+ *
+ * \param[in] status status of the transfer
+ *
+ ********************************************************************************** */
+static void FSCI_BulkSendEnd(gFsciStatus_t status)
+{
+    uint8_t  payload[mFsciBulkEndIndLen_c];
+    uint32_t crc = ~mFsciBulkSession.crc;
+
+    payload[0] = (uint8_t)status;
+    FLib_MemCpy(&payload[1], &mFsciBulkSession.size, sizeof(uint32_t));
+    FLib_MemCpy(&payload[1U + sizeof(uint32_t)], &crc, sizeof(uint32_t));
+    FSCI_transmitPayload(gFSCI_CnfOpcodeGroup_c, mFsciBulkEnd_c, payload, (uint16_t)sizeof(payload),
+                         mFsciBulkSession.fsciInterface);
+}
+
+/*! *********************************************************************************
+ * \brief   Closes the bulk transfer in progress.
+ *
+ * \param[in] commit FALSE if the transfer was cancelled or failed
+ *
+ ********************************************************************************** */
+static void FSCI_BulkClose(bool_t commit)
+{
+    const fsciBulkTarget_t *pTarget = mFsciBulkSession.pTarget;
+
+    mFsciBulkSession.pTarget = NULL;
+    if (pTarget->pfEnd != NULL)
+    {
+        pTarget->pfEnd(commit);
+    }
+}
+
+#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+/*! *********************************************************************************
+ * \brief   Memory target: the range must be in RAM, or in flash for reads.
+ *
+ ********************************************************************************** */
+static gFsciStatus_t FSCI_BulkMemoryStart(uint32_t address, uint32_t size, bool_t write)
+{
+    gFsciStatus_t status = gFsciError_c;
+    uint32_t      last   = address + size - 1U;
+
+    if (last < address)
+    {
+        /* Range wraps around the address space */
+    }
+    else if ((gPlatformRamStartAddress_c <= address) && (last <= gPlatformRamEndAddress_c))
+    {
+        status = gFsciSuccess_c;
+    }
+    else if ((write == FALSE) && (gPlatformFlashStartAddress_c <= address) && (last <= gPlatformFlashEndAddress_c))
+    {
+        status = gFsciSuccess_c;
+    }
+    else
+    {
+        /* MISRA rule 15.7 */
+    }
+
+    return status;
+}
+
+static gFsciStatus_t FSCI_BulkMemoryRead(uint32_t address, uint8_t *pBuf, uint16_t len)
+{
+    FLib_MemCpy(pBuf, (uint8_t *)address, len);
+    return gFsciSuccess_c;
+}
+
+static gFsciStatus_t FSCI_BulkMemoryWrite(uint32_t address, uint8_t *pBuf, uint16_t len)
+{
+    FLib_MemCpy((uint8_t *)address, pBuf, len);
+    return gFsciSuccess_c;
+}
+#endif /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
+#endif /* gFsciBulkTransfer_c */
 #endif /* gFsciIncluded_c */
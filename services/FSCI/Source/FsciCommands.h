@@ -79,6 +79,14 @@ enum
 
     mFsciLowLevelMemoryWriteBlock_c = 0x30,    /* Fsci-WriteRAMMemoryBlock.Request     */
     mFsciLowLevelMemoryReadBlock_c  = 0x31,    /* Fsci-ReadMemoryBlock.Request         */
+#if gFsciBulkTransfer_c
+    mFsciBulkReadStart_c  = 0x32, /* Fsci-BulkReadStart.Request             */
+    mFsciBulkData_c       = 0x33, /* Fsci-BulkData.Indication/Request       */
+    mFsciBulkAck_c        = 0x34, /* Fsci-BulkAck.Request/Indication        */
+    mFsciBulkEnd_c        = 0x35, /* Fsci-BulkEnd.Indication/Request        */
+    mFsciBulkWriteStart_c = 0x36, /* Fsci-BulkWriteStart.Request            */
+    mFsciBulkAbort_c      = 0x37, /* Fsci-BulkAbort.Request                 */
+#endif
     mFsciLowLevelPing_c             = 0x38,    /* Fsci-Ping.Request                    */
 
     mFsciMsgGetApsDeviceKeyPairSet_c   = 0x3B, /* Fsci-GetApsDeviceKeyPairSet         */
@@ -111,6 +119,8 @@ enum
     mFsciGetMcuId_c      = 0xB1,
     mFsciGetSwVersions_c = 0xB2,
     mFsciGetNbuVersion_c = 0xB3,
+    mFsciGetWorkQStats_c = 0xB4,
+    mFsciGetHeapStats_c  = 0xB5,
 
     mFsciMsgAddToAddressMapPermanent_c = 0xC0,
     mFsciMsgRemoveFromAddressMap_c     = 0xC1,
@@ -128,6 +138,9 @@ enum
 
 #if defined(gFSCI_MemAllocTest_Enabled_d) && (gFSCI_MemAllocTest_Enabled_d)
     mFSCIMemAllocTestReq_c = 0xFC, /* FSCI-MemAllocTest.Request.           */
+#endif
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+    mFSCIMemAllocTrackReq_c = 0xFB, /* FSCI-MemAllocTrack.Request.          */
 #endif
     mFsciMsgAck_c        = 0xFD,   /* Fsci acknowledgment.                 */
     mFsciMsgError_c      = 0xFE,   /* Fsci internal error.                 */
@@ -145,8 +158,7 @@ typedef PACKED_STRUCT gFsciErrorMsg_tag
 {
     clientPacketHdr_t    header;
     clientPacketStatus_t status;
-    uint8_t              checksum;
-    uint8_t              checksum2;
+    uint8_t              trailer[gFsci_TailBytes_c];
 }
 gFsciErrorMsg_t;
 
@@ -154,11 +166,18 @@ typedef PACKED_STRUCT gFsciAckMsg_tag
 {
     clientPacketHdr_t header;
     uint8_t           checksumPacketReceived;
-    uint8_t           checksum;
-    uint8_t           checksum2;
+    uint8_t           trailer[gFsci_TailBytes_c];
 }
 gFsciAckMsg_t;
 
+/* State of the request being serviced on one FSCI interface. Each interface owns its context,
+   so interfaces processed by different tasks do not interfere with each other. */
+typedef struct fsciIntfContext_tag
+{
+    volatile uint8_t handlerActive; /* A registered OpGroup handler runs for this interface */
+    uint8_t          errorReported; /* An error message was already sent for the current request */
+} fsciIntfContext_t;
+
 /*! *********************************************************************************
 *************************************************************************************
 * Public macros
@@ -184,7 +203,6 @@ gFsciAckMsg_t;
 * Public memory declarations
 *************************************************************************************
 ********************************************************************************** */
-extern uint8_t mFsciErrorReported;
 
 /*! *********************************************************************************
 *************************************************************************************
@@ -192,6 +210,7 @@ extern uint8_t mFsciErrorReported;
 *************************************************************************************
 ********************************************************************************** */
 extern gFsciOpGroup_t *FSCI_GetReqOpGroup(opGroup_t OG, uint8_t fsciInterface);
+fsciIntfContext_t     *FSCI_GetIntfContext(uint32_t fsciInterface);
 
 void fsciMsgHandler(clientPacket_t *pPkt, uint32_t fsciInterface);
 #if gFSCI_IncludeLpmCommands_c
@@ -202,6 +221,14 @@ bool_t FSCI_MsgModeSelectReqFunc(clientPacket_t *pData, uint32_t fsciInterface);
 bool_t FSCI_MsgGetModeReqFunc(clientPacket_t *pData, uint32_t fsciInterface);
 bool_t FSCI_WriteMemoryBlock(clientPacket_t *pData, uint32_t fsciInterface);
 bool_t FSCI_ReadMemoryBlock(clientPacket_t *pData, uint32_t fsciInterface);
+#if gFsciBulkTransfer_c
+bool_t FSCI_BulkReadStart(clientPacket_t *pData, uint32_t fsciInterface);
+bool_t FSCI_BulkWriteStart(clientPacket_t *pData, uint32_t fsciInterface);
+bool_t FSCI_BulkData(clientPacket_t *pData, uint32_t fsciInterface);
+bool_t FSCI_BulkAck(clientPacket_t *pData, uint32_t fsciInterface);
+bool_t FSCI_BulkEnd(clientPacket_t *pData, uint32_t fsciInterface);
+bool_t FSCI_BulkAbort(clientPacket_t *pData, uint32_t fsciInterface);
+#endif
 bool_t FSCI_Ping(clientPacket_t *pData, uint32_t fsciInterface);
 bool_t FSCI_MsgResetCPUReqFunc(clientPacket_t *pData, uint32_t fsciInterface);
 bool_t FSCI_GetNumberOfFreeBuffersFunc(clientPacket_t *pData, uint32_t fsciInterface);
@@ -218,9 +245,18 @@ bool_t FSCI_ReadUniqueId(clientPacket_t *pData, uint32_t fsciInterface);
 bool_t FSCI_ReadMCUId(clientPacket_t *pData, uint32_t fsciInterface);
 bool_t FSCI_ReadModVer(clientPacket_t *pData, uint32_t fsciInterface);
 bool_t FSCI_ReadNbuVer(clientPacket_t *pData, uint32_t fsciInterface);
+#if defined(CONFIG_FWK_WORKQ_STATS) && (CONFIG_FWK_WORKQ_STATS > 0)
+bool_t FSCI_GetWorkQStats(clientPacket_t *pData, uint32_t fsciInterface);
+#endif
+#if defined(CONFIG_FWK_HEAP_STATS) && (CONFIG_FWK_HEAP_STATS > 0)
+bool_t FSCI_GetHeapStats(clientPacket_t *pData, uint32_t fsciInterface);
+#endif
 bool_t FSCI_OtaSupportHandlerFunc(clientPacket_t *pData, uint32_t fsciInterface);
 bool_t FSCI_EnableBootloaderFunc(clientPacket_t *pData, uint32_t fsciInterface);
 #if defined(gFSCI_MemAllocTest_Enabled_d) && (gFSCI_MemAllocTest_Enabled_d)
 bool_t FSCI_MemAllocTest(clientPacket_t *pData, uint32_t fsciInterface);
 #endif
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+bool_t FSCI_MemAllocTrack(clientPacket_t *pData, uint32_t fsciInterface);
+#endif
 #endif /* _FSCI_COMMANDS_H_ */
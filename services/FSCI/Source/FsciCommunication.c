@@ -32,6 +32,10 @@
 #include "fsl_os_abstraction.h"
 #include <assert.h>
 
+#if defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+#include "fsl_adapter_rpmsg.h"
+#endif
+
 #if defined(gNvStorageIncluded_d) && (gNvStorageIncluded_d == 1)
 #include "NVM_Interface.h"
 #endif
@@ -40,6 +44,10 @@
 #include "fwk_platform_ble.h"
 #endif
 
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+#include "fwk_mem_track.h"
+#endif
+
 #if defined gFsciIncluded_c && (gFsciIncluded_c != 0)
 /************************************************************************************
 *************************************************************************************
@@ -62,6 +70,18 @@
 #define mFsciRxRestartTimeoutMs_c 50u /* milliseconds */
 #endif
 
+#if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
+#if (gFsciMaxInterfaces_c > 32)
+#error "The Fsci task uses one event flag per interface"
+#endif
+#if defined(gFsciTaskPerInterface_c) && (gFsciTaskPerInterface_c != 0) && \
+    (!defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0))
+#define mFsciTaskNb_c gFsciMaxInterfaces_c
+#else
+#define mFsciTaskNb_c 1U
+#endif
+#endif /* gFsciUseDedicatedTask_c */
+
 /************************************************************************************
 *************************************************************************************
 * Private prototypes
@@ -69,9 +89,20 @@
 ************************************************************************************/
 #if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
 static void FSCI_Task(osa_task_param_t argument);
+#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+static void FSCI_ProcessPendingPacket(uint32_t fsciInterface);
+#endif /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
 #endif
 
-fsci_packetStatus_t FSCI_checkPacket(clientPacket_t *pData, uint16_t bytes, uint8_t *pVIntf);
+fsci_packetStatus_t FSCI_checkPacket(clientPacket_t *pData, uint16_t bytes, uint8_t *pVIntf, uint8_t framing);
+#if defined gFsciCrcFraming_c && (gFsciCrcFraming_c != 0)
+static uint16_t FSCI_computeCrcTrailer(uint8_t        framing,
+                                       const uint8_t *pHdr,
+                                       uint16_t       hdrLen,
+                                       const uint8_t *pMsg,
+                                       uint16_t       msgLen,
+                                       uint8_t       *pTrailer);
+#endif /* gFsciCrcFraming_c */
 
 #if defined gFsciRxAckTimeoutUseTmr_c && (gFsciRxAckTimeoutUseTmr_c != 0)
 static void FSCI_RxAckExpireCb(void *param);
@@ -89,7 +120,24 @@ static void FSCI_CheckRxTimeoutPolling(void *param);
 #endif /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
 #endif
 
+#if defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+static hal_rpmsg_return_status_t FSCI_RpmsgRxCallback(void *param, uint8_t *data, uint32_t len);
+static void                      FSCI_RpmsgProcessRxBuffer(uint32_t fsciInterface, uint8_t *pData, uint32_t len);
+#if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
+static void FSCI_RpmsgProcessRxQueue(void);
+#endif
+#endif /* gFsciRpmsgSharedBuffers_c */
+
 static void FSCI_SendPacketToSerialManager(uint32_t fsciInterface, uint8_t *pPacket, uint16_t packetLen);
+#if !defined gFsciRxAck_c || (gFsciRxAck_c == 0)
+#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+static void FSCI_SerialManagerWriteNonBlocking(uint32_t fsciInterface, uint8_t *pPacket, uint16_t packetLen);
+#endif /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
+#endif /* !gFsciRxAck_c */
+#if defined gFsciTxAggregation_c && (gFsciTxAggregation_c != 0)
+static void FSCI_TxAggregationAppend(uint32_t fsciInterface, uint8_t *pPacket, uint16_t packetLen);
+static void FSCI_TxAggregationTimeoutCb(void *param);
+#endif /* gFsciTxAggregation_c */
 #if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
 inline static void FSCI_rxCallback(void                              *pData,
                                    serial_manager_callback_message_t *message,
@@ -100,8 +148,7 @@ inline static void FSCI_rxCallback(void                              *pData,
 * Private type definitions
 *************************************************************************************
 ************************************************************************************/
-#if (defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)) || \
-    (defined(gFsciOverRpmsg_c) && (gFsciOverRpmsg_c == 1))
+#if (defined(gFsciOverRpmsg_c) && (gFsciOverRpmsg_c == 1))
 typedef struct
 {
     clientPacket_t *pFsciPacketToProcess;
@@ -109,6 +156,16 @@ typedef struct
 } fsciClientPacketInfo_t;
 #endif
 
+#if defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+/* RPMsg RX buffer held by FSCI until the Fsci task takes it */
+typedef struct
+{
+    uint8_t *pData;
+    uint16_t len;
+    uint8_t  fsciInterface;
+} fsciRpmsgRxBuffer_t;
+#endif
+
 /************************************************************************************
 *************************************************************************************
 * Public memory declarations
@@ -153,23 +210,96 @@ opCode_t        gFsciHostWaitingOpCode  = 0;
 ************************************************************************************/
 static fsciComm_t mFsciCommData[gFsciMaxInterfaces_c];
 
-static uint8_t mFsciSrcInterface = mFsciInvalidInterface_c;
-
 #if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
-static OSA_TASK_DEFINE(FSCI_Task, gFsciTaskPriority_c, 1, gFsciTaskStackSize_c, FALSE);
-static OSA_TASK_HANDLE_DEFINE(gFsciTaskId);
+static OSA_TASK_DEFINE(FSCI_Task, gFsciTaskPriority_c, mFsciTaskNb_c, gFsciTaskStackSize_c, FALSE);
+static uint32_t mFsciTaskIds[mFsciTaskNb_c][((OSA_TASK_HANDLE_SIZE + sizeof(uint32_t) - 1U) / sizeof(uint32_t))];
 static OSA_EVENT_HANDLE_DEFINE(mFsciTaskEventId);
 #if (defined(gFsciOverRpmsg_c) && (gFsciOverRpmsg_c == 1))
 static messaging_t mFsciInputQueue;
-#else  /* (defined(gFsciOverRpmsg_c) && (gFsciOverRpmsg_c == 1)) */
-static fsciClientPacketInfo_t mFsciClientPacketInfo;
 #endif /* (defined(gFsciOverRpmsg_c) && (gFsciOverRpmsg_c == 1)) */
+#if defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+/* Single producer (RPMsg RX callback), single consumer (Fsci task) ring,
+   one slot is kept empty to tell a full ring from an empty one */
+static fsciRpmsgRxBuffer_t mFsciRpmsgRxQueue[gFsciRpmsgRxQueueLen_c + 1U];
+static volatile uint8_t    mFsciRpmsgRxHead;
+static volatile uint8_t    mFsciRpmsgRxTail;
+#endif /* gFsciRpmsgSharedBuffers_c */
 #else  /* gFsciUseDedicatedTask_c */
 #if (defined(gFsciOverRpmsg_c) && (gFsciOverRpmsg_c == 1))
 static fsciClientPacketInfo_t mFsciClientPacketInfo;
 #endif /* (defined(gFsciOverRpmsg_c) && (gFsciOverRpmsg_c == 1)) */
 #endif /* gFsciUseDedicatedTask_c */
 
+#if defined gFsciCrcFraming_c && (gFsciCrcFraming_c != 0)
+/* CRC-16/CCITT-FALSE (polynomial 0x1021) lookup table, one byte at a time */
+static const uint16_t mFsciCrc16Table[256] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U, 0x8108U, 0x9129U, 0xA14AU, 0xB16BU,
+    0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU, 0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+    0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU, 0x2462U, 0x3443U, 0x0420U, 0x1401U,
+    0x64E6U, 0x74C7U, 0x44A4U, 0x5485U, 0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+    0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U, 0xB75BU, 0xA77AU, 0x9719U, 0x8738U,
+    0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU, 0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+    0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU, 0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U,
+    0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U, 0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+    0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U, 0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU,
+    0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U, 0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+    0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U, 0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU,
+    0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU, 0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+    0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU, 0x02B1U, 0x1290U, 0x22F3U, 0x32D2U,
+    0x4235U, 0x5214U, 0x6277U, 0x7256U, 0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+    0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U, 0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U,
+    0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU, 0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+    0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU, 0x5844U, 0x4865U, 0x7806U, 0x6827U,
+    0x18C0U, 0x08E1U, 0x3882U, 0x28A3U, 0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+    0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U, 0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU,
+    0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U, 0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+    0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U, 0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U,
+    0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U,
+};
+
+/* CRC-32 (IEEE 802.3, reflected) lookup table, one byte at a time */
+static const uint32_t mFsciCrc32Table[256] = {
+    0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU, 0x076DC419U, 0x706AF48FU, 0xE963A535U, 0x9E6495A3U,
+    0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U, 0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U,
+    0x1DB71064U, 0x6AB020F2U, 0xF3B97148U, 0x84BE41DEU, 0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
+    0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU, 0x14015C4FU, 0x63066CD9U, 0xFA0F3D63U, 0x8D080DF5U,
+    0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U, 0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU,
+    0x35B5A8FAU, 0x42B2986CU, 0xDBBBC9D6U, 0xACBCF940U, 0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
+    0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U, 0x21B4F4B5U, 0x56B3C423U, 0xCFBA9599U, 0xB8BDA50FU,
+    0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U, 0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU,
+    0x76DC4190U, 0x01DB7106U, 0x98D220BCU, 0xEFD5102AU, 0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
+    0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U, 0x7F6A0DBBU, 0x086D3D2DU, 0x91646C97U, 0xE6635C01U,
+    0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU, 0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U,
+    0x65B0D9C6U, 0x12B7E950U, 0x8BBEB8EAU, 0xFCB9887CU, 0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
+    0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U, 0x4ADFA541U, 0x3DD895D7U, 0xA4D1C46DU, 0xD3D6F4FBU,
+    0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U, 0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U,
+    0x5005713CU, 0x270241AAU, 0xBE0B1010U, 0xC90C2086U, 0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
+    0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U, 0x59B33D17U, 0x2EB40D81U, 0xB7BD5C3BU, 0xC0BA6CADU,
+    0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU, 0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U,
+    0xE3630B12U, 0x94643B84U, 0x0D6D6A3EU, 0x7A6A5AA8U, 0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
+    0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU, 0xF762575DU, 0x806567CBU, 0x196C3671U, 0x6E6B06E7U,
+    0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU, 0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U,
+    0xD6D6A3E8U, 0xA1D1937EU, 0x38D8C2C4U, 0x4FDFF252U, 0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
+    0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U, 0xDF60EFC3U, 0xA867DF55U, 0x316E8EEFU, 0x4669BE79U,
+    0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U, 0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU,
+    0xC5BA3BBEU, 0xB2BD0B28U, 0x2BB45A92U, 0x5CB36A04U, 0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
+    0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU, 0x9C0906A9U, 0xEB0E363FU, 0x72076785U, 0x05005713U,
+    0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U, 0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U,
+    0x86D3D2D4U, 0xF1D4E242U, 0x68DDB3F8U, 0x1FDA836EU, 0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
+    0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU, 0x8F659EFFU, 0xF862AE69U, 0x616BFFD3U, 0x166CCF45U,
+    0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U, 0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU,
+    0xAED16A4AU, 0xD9D65ADCU, 0x40DF0B66U, 0x37D83BF0U, 0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
+    0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U, 0xBAD03605U, 0xCDD70693U, 0x54DE5729U, 0x23D967BFU,
+    0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U, 0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU,
+};
+#elif defined gFsciBulkTransfer_c && (gFsciBulkTransfer_c != 0)
+/* CRC-32 (IEEE 802.3, reflected) lookup table, one nibble at a time */
+static const uint32_t mFsciCrc32Table[16] = {
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+#endif /* gFsciCrcFraming_c */
+
 /************************************************************************************
 *************************************************************************************
 * Public functions
@@ -231,6 +361,8 @@ void FSCI_commInit(serial_handle_t *pSerCfg)
             serial_handle_t ser_h;
             ser_h = gFsciSerialInterfaces[i] = (serial_handle_t)pSerCfg[i];
 
+            mFsciCommData[i].srcInterface = mFsciInvalidInterface_c;
+
             /*open read handle*/
             (void)SerialManager_OpenReadHandle(ser_h, (serial_read_handle_t)gFsciSerialReadHandle[i]);
             (void)SerialManager_InstallRxCallback((serial_read_handle_t)gFsciSerialReadHandle[i], FSCI_rxCallback,
@@ -286,6 +418,22 @@ void FSCI_commInit(serial_handle_t *pSerCfg)
             mFsciCommData[i].rxOngoing = FALSE;
 #endif    /* gFsciRxTimeout_c */
 
+#if defined gFsciTxAggregation_c && (gFsciTxAggregation_c != 0)
+            mFsciCommData[i].txAggTmr = MEM_BufferAlloc(TIMER_HANDLE_SIZE);
+            if (mFsciCommData[i].txAggTmr == NULL)
+            {
+                ret = (int)kStatus_MemAllocError;
+                break;
+            }
+
+            if (kStatus_TimerSuccess != TM_Open(mFsciCommData[i].txAggTmr))
+            {
+                ret = kStatus_Fail;
+                break;
+            }
+            (void)TM_InstallCallback(mFsciCommData[i].txAggTmr, FSCI_TxAggregationTimeoutCb, (void *)i);
+#endif /* gFsciTxAggregation_c */
+
         } /* for */
         if (i != gFsciMaxInterfaces_c)
         {
@@ -293,14 +441,14 @@ void FSCI_commInit(serial_handle_t *pSerCfg)
             break;
         }
 #if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
-        mFsciClientPacketInfo.pFsciPacketToProcess = NULL;
-        mFsciClientPacketInfo.fsciInterface        = mFsciInvalidInterface_c;
-
-        /* Init Fsci task */
+        /* Init Fsci task(s), the task parameter is the interface serviced by the task */
         status = OSA_EventCreate((osa_event_handle_t)mFsciTaskEventId, TRUE);
         assert(KOSA_StatusSuccess == status);
-        status = OSA_TaskCreate((osa_task_handle_t)gFsciTaskId, OSA_TASK(FSCI_Task), NULL);
-        assert(KOSA_StatusSuccess == status);
+        for (i = 0; i < mFsciTaskNb_c; i++)
+        {
+            status = OSA_TaskCreate((osa_task_handle_t)mFsciTaskIds[i], OSA_TASK(FSCI_Task), (osa_task_param_t)i);
+            assert(KOSA_StatusSuccess == status);
+        }
         (void)status;
 #endif /* gFsciUseDedicatedTask_c */
         ret = kStatus_Success;
@@ -317,6 +465,10 @@ void FSCI_commInit(serial_handle_t *pSerCfg)
     for (uint32_t i = 0; i < gFsciMaxInterfaces_c; i++)
     {
         gFsciSerialInterfaces[i] = (serial_handle_t)pSerCfg[i];
+#if defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+        /* The interface handle is an RPMsg endpoint initialized by the application */
+        (void)HAL_RpmsgInstallRxCallback((hal_rpmsg_handle_t)pSerCfg[i], FSCI_RpmsgRxCallback, (void *)i);
+#endif
     }
 #if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
     osa_status_t status;
@@ -327,7 +479,7 @@ void FSCI_commInit(serial_handle_t *pSerCfg)
     /* Init Fsci task */
     status = OSA_EventCreate((osa_event_handle_t)mFsciTaskEventId, TRUE);
     assert(KOSA_StatusSuccess == status);
-    status = OSA_TaskCreate((osa_task_handle_t)gFsciTaskId, OSA_TASK(FSCI_Task), NULL);
+    status = OSA_TaskCreate((osa_task_handle_t)mFsciTaskIds[0], OSA_TASK(FSCI_Task), NULL);
     assert(KOSA_StatusSuccess == status);
     (void)status;
 #else  /* gFsciUseDedicatedTask_c */
@@ -341,31 +493,49 @@ void FSCI_commInit(serial_handle_t *pSerCfg)
  * \brief   The main task of the FSCI module, maily used to process a packet
  *          after it has been fully received
  *
- * \param[in] argument unused
+ * \param[in] argument the interface serviced by the task if gFsciTaskPerInterface_c
+ *                     is enabled, unused otherwise
  *
  ********************************************************************************** */
 #if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
 static void FSCI_Task(osa_task_param_t argument)
 {
     osa_event_flags_t mFsciTaskEventFlags = 0;
+#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+    uint32_t i;
+#if (mFsciTaskNb_c > 1U)
+    /* Only wait for the packets of the interface owned by this task */
+    osa_event_flags_t waitFlags = gFSCI_ClientPacketReadyEvent((uint32_t)argument);
+#else
+    osa_event_flags_t waitFlags = osaEventFlagsAll_c;
+#endif /* mFsciTaskNb_c > 1U */
+#endif /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
 
 #if USE_RTOS
     while (true)
 #endif
     {
+#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+        (void)OSA_EventWait((osa_event_handle_t)mFsciTaskEventId, waitFlags, FALSE, osaWaitForever_c,
+                            &mFsciTaskEventFlags);
+
+        /* Process the client packets ready on each interface */
+        for (i = 0; i < gFsciMaxInterfaces_c; i++)
+        {
+            if ((mFsciTaskEventFlags & gFSCI_ClientPacketReadyEvent(i)) != 0u)
+            {
+                FSCI_ProcessPendingPacket(i);
+            }
+        }
+#else  /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
         (void)OSA_EventWait((osa_event_handle_t)mFsciTaskEventId, osaEventFlagsAll_c, FALSE, osaWaitForever_c,
                             &mFsciTaskEventFlags);
 
         if (mFsciTaskEventFlags == (uint32_t)gFSCI_ClientPacketReady_c)
         {
-#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
-            /* a client packet is ready to be processed */
-            assert(mFsciClientPacketInfo.pFsciPacketToProcess != NULL);
-            assert(mFsciClientPacketInfo.fsciInterface != mFsciInvalidInterface_c);
-            /* Process the client packet */
-            (void)FSCI_ProcessRxPkt(mFsciClientPacketInfo.pFsciPacketToProcess, mFsciClientPacketInfo.fsciInterface);
-
-#else /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
+#if defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+            FSCI_RpmsgProcessRxQueue();
+#endif
             /* Check for all existing messages in queue */
             if (MSG_QueueGetHead(&mFsciInputQueue) != NULL)
             {
@@ -391,10 +561,31 @@ static void FSCI_Task(osa_task_param_t argument)
                 }
 #endif /* defined(SDK_OS_FREE_RTOS) || defined(FSL_RTOS_THREADX) */
             }
-#endif /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
         }
+#endif /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
+    }
+    (void)argument;
+}
+
+#if !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0)
+/*! *********************************************************************************
+ * \brief   Process the client packet received on an interface
+ *
+ * \param[in] fsciInterface the interface on which the packet was received
+ *
+ ********************************************************************************** */
+static void FSCI_ProcessPendingPacket(uint32_t fsciInterface)
+{
+    clientPacket_t *pPacket = mFsciCommData[fsciInterface].pPacketToProcess;
+
+    mFsciCommData[fsciInterface].pPacketToProcess = NULL;
+    assert(pPacket != NULL);
+    if (pPacket != NULL)
+    {
+        (void)FSCI_ProcessRxPkt(pPacket, fsciInterface);
     }
 }
+#endif /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
 #endif /* gFsciUseDedicatedTask_c */
 
 /*! *********************************************************************************
@@ -411,6 +602,7 @@ void FSCI_receivePacket(void *param)
     fsci_packetStatus_t status;
     uint8_t             virtualInterfaceId;
     uint8_t             c;
+    uint8_t             srcInterface;
 
 #if defined gFsciRxTimeout_c && (gFsciRxTimeout_c != 0)
     bool_t timerRestartEn = FALSE;
@@ -453,7 +645,8 @@ void FSCI_receivePacket(void *param)
 #endif
 
                 /* call the check packet function to see if we have a valid packet */
-                status = FSCI_checkPacket(pCommData->pPacketFromClient, pCommData->bytesReceived, &virtualInterfaceId);
+                status = FSCI_checkPacket(pCommData->pPacketFromClient, pCommData->bytesReceived, &virtualInterfaceId,
+                                          pCommData->framing);
 
                 if ((pCommData->bytesReceived == sizeof(clientPacketHdr_t)) && (status == PACKET_IS_TO_SHORT))
                 {
@@ -503,23 +696,24 @@ void FSCI_receivePacket(void *param)
 #endif /* gFsciRxAck_c */
                     {
 #if (gFsciMaxVirtualInterfaces_c > 0)
-                        mFsciSrcInterface = mFsciInvalidInterface_c;
+                        srcInterface = mFsciInvalidInterface_c;
 
                         for (c = 0; c < gFsciMaxInterfaces_c; c++)
                         {
                             if ((virtualInterfaceId == gFsciVirtualInterfaces[c]) &&
                                 (gFsciSerialInterfaces[(uint32_t)(uint32_t *)param] == gFsciSerialInterfaces[c]))
                             {
-                                mFsciSrcInterface = c;
+                                srcInterface = c;
                                 break;
                             }
                         }
 #else
-                        mFsciSrcInterface = (uint32_t)param;
+                        srcInterface = (uint8_t)(uint32_t)param;
 #endif /* gFsciMaxVirtualInterfaces_c > 0*/
+                        pCommData->srcInterface = srcInterface;
 
 #if defined gFsciTxAck_c && (gFsciTxAck_c != 0)
-                        FSCI_Ack(c, mFsciSrcInterface);
+                        FSCI_Ack(c, srcInterface);
 #endif
 #if defined gFsciHostSupport_c && (gFsciHostSupport_c != 0)
                         if (gFsciHostWaitingSyncRsp &&
@@ -535,18 +729,17 @@ void FSCI_receivePacket(void *param)
                         else
 #endif /* gFsciHostSupport_c */
                         {
-                            if (mFsciSrcInterface < gFsciMaxInterfaces_c)
+                            if (srcInterface < gFsciMaxInterfaces_c)
                             {
 #if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
-                                /* store client packet information */
-                                mFsciClientPacketInfo.pFsciPacketToProcess = pCommData->pPacketFromClient;
-                                mFsciClientPacketInfo.fsciInterface        = mFsciSrcInterface;
-                                /* schedule FSCI_Task by raising gFSCI_ClientPacketReady_c event
+                                /* store the client packet in the slot of the interface it was routed to */
+                                mFsciCommData[srcInterface].pPacketToProcess = pCommData->pPacketFromClient;
+                                /* schedule FSCI_Task by raising the interface gFSCI_ClientPacketReady_c event
                                    FSCI_Task will process the client packet */
                                 (void)OSA_EventSet((osa_event_handle_t)mFsciTaskEventId,
-                                                   (uint32_t)gFSCI_ClientPacketReady_c);
+                                                   gFSCI_ClientPacketReadyEvent(srcInterface));
 #else
-                                (void)FSCI_ProcessRxPkt(pCommData->pPacketFromClient, mFsciSrcInterface);
+                                (void)FSCI_ProcessRxPkt(pCommData->pPacketFromClient, srcInterface);
 #endif
                             }
                         }
@@ -651,7 +844,7 @@ void FSCI_receivePacket(void *param)
 #else /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
 void FSCI_receivePacket(void *param)
 {
-    mFsciSrcInterface = 0;
+    uint8_t srcInterface = 0;
 
 #if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
     /* store client packet information */
@@ -665,7 +858,7 @@ void FSCI_receivePacket(void *param)
     if (pMsgIn != NULL)
     {
         pMsgIn->pFsciPacketToProcess = (clientPacket_t *)param;
-        pMsgIn->fsciInterface        = mFsciSrcInterface;
+        pMsgIn->fsciInterface        = srcInterface;
 
         /* Put message in the queue */
         (void)MSG_QueueAddTail(&mFsciInputQueue, (void *)pMsgIn);
@@ -676,7 +869,7 @@ void FSCI_receivePacket(void *param)
     }
 #else
     mFsciClientPacketInfo.pFsciPacketToProcess = (clientPacket_t *)param;
-    mFsciClientPacketInfo.fsciInterface        = mFsciSrcInterface;
+    mFsciClientPacketInfo.fsciInterface        = srcInterface;
 
     (void)FSCI_ProcessRxPkt(mFsciClientPacketInfo.pFsciPacketToProcess, mFsciClientPacketInfo.fsciInterface);
 #endif
@@ -692,27 +885,13 @@ void FSCI_receivePacket(void *param)
 void FSCI_transmitFormatedPacket(clientPacket_t *pPkt, uint32_t fsciInterface)
 {
     uint32_t size;
-    uint8_t  virtInterface = FSCI_GetVirtualInterface(fsciInterface);
-    uint8_t  checksum;
 
     pPkt->structured.header.startMarker = gFSCI_StartMarker_c;
-    size = (uint32_t)sizeof(clientPacketHdr_t) + pPkt->structured.header.len + 1u /* CRC */;
+    size = (uint32_t)sizeof(clientPacketHdr_t) + pPkt->structured.header.len;
 
-    /* Compute Checksum */
-    checksum = FSCI_computeChecksum(pPkt->raw + 1, (uint16_t)(size - 2u));
-
-    pPkt->structured.payload[pPkt->structured.header.len] = checksum;
-
-    if (virtInterface != 0u)
-    {
-#if (gFsciMaxVirtualInterfaces_c > 0)
-        pPkt->structured.payload[pPkt->structured.header.len] += virtInterface;
-        pPkt->structured.payload[pPkt->structured.header.len + 1u] = checksum ^ (checksum + virtInterface);
-        size += sizeof(checksum);
-#else
-        (void)virtInterface;
-#endif
-    }
+    /* Append the Checksum or CRC */
+    size += FSCI_computeTrailer(pPkt->raw + 1, (uint16_t)(size - 1u), NULL, 0u, fsciInterface,
+                                &pPkt->structured.payload[pPkt->structured.header.len]);
 
     /* send message to Serial Manager */
     FSCI_SendPacketToSerialManager(fsciInterface, pPkt->raw, (uint16_t)size);
@@ -732,12 +911,9 @@ void FSCI_transmitPayload(uint8_t OG, uint8_t OC, const uint8_t *pMsg, uint16_t
 {
     uint8_t          *buffer_ptr = NULL;
     uint16_t          buffer_size, index;
-    uint8_t           checksum;
+    uint8_t           trailer[gFsci_TailBytes_c];
+    uint16_t          trailerLen;
     clientPacketHdr_t header;
-#if (gFsciMaxVirtualInterfaces_c > 0)
-    uint8_t checksum2;
-    uint8_t virtInterface = FSCI_GetVirtualInterface(fsciInterface);
-#endif
 
     assert(msgLen <= gFsciMaxPayloadLen_c);
     if (FALSE == gFsciTxDisable)
@@ -749,8 +925,13 @@ void FSCI_transmitPayload(uint8_t OG, uint8_t OC, const uint8_t *pMsg, uint16_t
         buffer_size = buffer_size * 2u;
 #endif
 
+#if defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+        /* Build the frame directly in the RPMsg shared memory */
+        buffer_ptr = HAL_RpmsgAllocTxBuffer((hal_rpmsg_handle_t)gFsciSerialInterfaces[fsciInterface], buffer_size);
+#else
         /* Allocate buffer */
         buffer_ptr = MEM_BufferAlloc(buffer_size);
+#endif
         if (NULL != buffer_ptr)
         {
             /* Message header */
@@ -760,29 +941,15 @@ void FSCI_transmitPayload(uint8_t OG, uint8_t OC, const uint8_t *pMsg, uint16_t
             header.len         = msgLen;
 
             /* Compute CRC for TX packet, on opcode group, opcode, payload length, and payload fields */
-            checksum = FSCI_computeChecksum((uint8_t *)&header + 1, sizeof(header) - 1u);
-            checksum ^= FSCI_computeChecksum(pMsg, msgLen);
-#if (gFsciMaxVirtualInterfaces_c > 0)
-            if (virtInterface != 0u)
-            {
-                checksum2 = checksum ^ (checksum + virtInterface);
-                checksum += virtInterface;
-            }
-#endif
+            trailerLen = FSCI_computeTrailer((uint8_t *)&header + 1, sizeof(header) - 1u, pMsg, msgLen, fsciInterface,
+                                             trailer);
 
             index = 0;
 #if gFsciUseEscapeSeq_c
             index += (uint16_t)FSCI_encodeEscapeSeq((const uint8_t *)&header, sizeof(header), &buffer_ptr[index]);
             index += (uint16_t)FSCI_encodeEscapeSeq(pMsg, msgLen, &buffer_ptr[index]);
             /* Store the Checksum*/
-            index += (uint16_t)FSCI_encodeEscapeSeq((const uint8_t *)&checksum, sizeof(checksum), &buffer_ptr[index]);
-#if (gFsciMaxVirtualInterfaces_c > 0)
-            if (virtInterface != 0u)
-            {
-                index +=
-                    (uint16_t)FSCI_encodeEscapeSeq((const uint8_t *)&checksum2, sizeof(checksum2), &buffer_ptr[index]);
-            }
-#endif /* gFsciMaxVirtualInterfaces_c */
+            index += (uint16_t)FSCI_encodeEscapeSeq(trailer, trailerLen, &buffer_ptr[index]);
             buffer_ptr[index++] = gFSCI_EndMarker_c;
 
 #else  /* gFsciUseEscapeSeq_c */
@@ -791,17 +958,14 @@ void FSCI_transmitPayload(uint8_t OG, uint8_t OC, const uint8_t *pMsg, uint16_t
             FLib_MemCpy(&buffer_ptr[index], pMsg, msgLen);
             index += msgLen;
             /* Store the Checksum */
-            buffer_ptr[index++] = checksum;
-#if (gFsciMaxVirtualInterfaces_c > 0)
-            if (virtInterface)
-            {
-                buffer_ptr[index++] = checksum2;
-            }
-#endif /* gFsciMaxVirtualInterfaces_c */
+            FLib_MemCpy(&buffer_ptr[index], trailer, trailerLen);
+            index += trailerLen;
 #endif /* gFsciUseEscapeSeq_c */
 
 #if (defined gFsciOverRpmsgBridge_c) && (gFsciOverRpmsgBridge_c == 1)
             (void)PLATFORM_SendHciMessage(buffer_ptr, index);
+#elif defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+            (void)HAL_RpmsgNoCopySend((hal_rpmsg_handle_t)gFsciSerialInterfaces[fsciInterface], buffer_ptr, index);
 #else
             /* send message to Serial Manager */
             FSCI_SendPacketToSerialManager(fsciInterface, buffer_ptr, index);
@@ -855,6 +1019,110 @@ uint8_t *FSCI_GetFormattedPacket(uint8_t OG, uint8_t OC, void *pMsg, uint16_t ms
     return pBuff;
 }
 
+#if defined gFsciCrcFraming_c && (gFsciCrcFraming_c != 0)
+/*! *********************************************************************************
+ * \brief  Selects the trailer of the frames sent and received on an interface
+ *
+ * \param[in] fsciInterface the FSCI interface
+ * \param[in] framing the frame trailer
+ *
+ * \return gFsciSuccess_c if the framing was applied, gFsciError_c otherwise
+ *
+ ********************************************************************************** */
+gFsciStatus_t FSCI_SetFramingMode(uint32_t fsciInterface, gFsciFraming_t framing)
+{
+    gFsciStatus_t status = gFsciError_c;
+
+    if (FSCI_IsFramingModeValid(fsciInterface, (uint8_t)framing))
+    {
+        mFsciCommData[fsciInterface].framing = (uint8_t)framing;
+        status                               = gFsciSuccess_c;
+    }
+
+    return status;
+}
+
+/*! *********************************************************************************
+ * \brief  Returns the trailer of the frames sent and received on an interface
+ *
+ * \param[in] fsciInterface the FSCI interface
+ *
+ * \return the framing of the interface
+ *
+ ********************************************************************************** */
+gFsciFraming_t FSCI_GetFramingMode(uint32_t fsciInterface)
+{
+    assert(fsciInterface < gFsciMaxInterfaces_c);
+    return (gFsciFraming_t)mFsciCommData[fsciInterface].framing;
+}
+
+/*! *********************************************************************************
+ * \brief  Checks if a framing can be used on an interface
+ *
+ * \param[in] fsciInterface the FSCI interface
+ * \param[in] framing the frame trailer
+ *
+ * \return TRUE if the framing can be used
+ *
+ ********************************************************************************** */
+bool_t FSCI_IsFramingModeValid(uint32_t fsciInterface, uint8_t framing)
+{
+    bool_t valid = FALSE;
+
+    if ((fsciInterface < gFsciMaxInterfaces_c) && (framing <= (uint8_t)gFsciFramingCrc32_c))
+    {
+        valid = TRUE;
+        if (framing != (uint8_t)gFsciFramingXor_c)
+        {
+#if defined(gFsciOverRpmsg_c) && (gFsciOverRpmsg_c == 1)
+            /* RPMSG messages are not framed by FSCI */
+            valid = FALSE;
+#else
+            /* The virtual interface Id is carried by the XOR checksums */
+            valid = (FSCI_GetVirtualInterface(fsciInterface) == 0u) ? TRUE : FALSE;
+#endif
+        }
+    }
+
+    return valid;
+}
+#endif /* gFsciCrcFraming_c */
+
+#if defined gFsciTxAggregation_c && (gFsciTxAggregation_c != 0)
+/*! *********************************************************************************
+ * \brief  Writes the frames held in the TX aggregation buffer of an interface
+ *
+ * \param[in] fsciInterface the interface whose aggregation buffer must be flushed
+ *
+ ********************************************************************************** */
+void FSCI_TxAggregationFlush(uint32_t fsciInterface)
+{
+    fsciComm_t *pCommData = &mFsciCommData[fsciInterface];
+    uint8_t    *pBuffer;
+    uint16_t    len;
+
+    /* Stop the timer first so that a frame appended meanwhile is written by this flush */
+    (void)TM_Stop(pCommData->txAggTmr);
+
+    OSA_InterruptDisable();
+    pBuffer              = pCommData->pTxAggBuf;
+    len                  = pCommData->txAggLen;
+    pCommData->pTxAggBuf = NULL;
+    pCommData->txAggLen  = 0U;
+    if (pCommData->txAggHolders != 0U)
+    {
+        /* The frames held by an append are written when it gives the buffer back */
+        pCommData->txAggFlushReq = TRUE;
+    }
+    OSA_InterruptEnable();
+
+    if (pBuffer != NULL)
+    {
+        FSCI_SerialManagerWriteNonBlocking(fsciInterface, pBuffer, len);
+    }
+}
+#endif /* gFsciTxAggregation_c */
+
 /************************************************************************************
 *************************************************************************************
 * Private functions
@@ -884,15 +1152,20 @@ uint8_t FSCI_GetVirtualInterface(uint32_t fsciInterface)
  * \param[in] pData The message containing the incoming data packet to be handled.
  * \param[in] bytes the number of bytes inside the buffer
  * \param[Out] pVIntf pointer to the location where the virtual interface Id will be stored
+ * \param[in] framing the gFsciFraming_t used on the interface
  *
  * \return the status of the packet
  *
  ********************************************************************************** */
-fsci_packetStatus_t FSCI_checkPacket(clientPacket_t *pData, uint16_t bytes, uint8_t *pVIntf)
+fsci_packetStatus_t FSCI_checkPacket(clientPacket_t *pData, uint16_t bytes, uint8_t *pVIntf, uint8_t framing)
 {
     uint8_t             checksum = 0;
     uint16_t            len;
     fsci_packetStatus_t status = FRAMING_ERROR;
+#if defined gFsciCrcFraming_c && (gFsciCrcFraming_c != 0)
+    uint8_t  crc[sizeof(uint32_t)];
+    uint16_t crcLen;
+#endif
 
     assert(pData);
     if (bytes < MIN_VALID_PACKET_LEN)
@@ -916,6 +1189,31 @@ fsci_packetStatus_t FSCI_checkPacket(clientPacket_t *pData, uint16_t bytes, uint
         {
             status = FRAMING_ERROR;
         }
+#if defined gFsciCrcFraming_c && (gFsciCrcFraming_c != 0)
+        else if (framing != (uint8_t)gFsciFramingXor_c)
+        {
+            *pVIntf = 0u;
+            crcLen  = (framing == (uint8_t)gFsciFramingCrc16_c) ? sizeof(uint16_t) : sizeof(uint32_t);
+
+            if (bytes < (len + sizeof(clientPacketHdr_t) + crcLen))
+            {
+                status = PACKET_IS_TO_SHORT;
+            }
+            else if (bytes == (len + sizeof(clientPacketHdr_t) + crcLen))
+            {
+                (void)FSCI_computeCrcTrailer(framing, pData->raw + 1, (uint16_t)(len + sizeof(clientPacketHdr_t) - 1u),
+                                             NULL, 0u, crc);
+                if (FLib_MemCmp(crc, &pData->structured.payload[len], crcLen))
+                {
+                    status = PACKET_IS_VALID;
+                }
+            }
+            else
+            {
+                /* FRAMING_ERROR */
+            }
+        }
+#endif /* gFsciCrcFraming_c */
         else
         {
             if (bytes < (len + sizeof(clientPacketHdr_t) + (uint16_t)sizeof(checksum)))
@@ -987,6 +1285,153 @@ uint8_t FSCI_computeChecksum(const void *pBuffer, uint16_t size)
     return checksum;
 }
 
+/*! *********************************************************************************
+ * \brief  Computes the trailer of a frame: the Checksum(s) or the CRC selected for the interface.
+ *         The frame is covered in two parts so that the header and the payload need not be contiguous.
+ *
+ * \param[in]  pHdr pointer to the frame, starting with the opcode group
+ * \param[in]  hdrLen length of the first part
+ * \param[in]  pMsg pointer to the second part, may be NULL if msgLen is 0
+ * \param[in]  msgLen length of the second part
+ * \param[in]  fsciInterface the interface on which the frame is sent
+ * \param[out] pTrailer location where the trailer is stored, up to gFsci_TailBytes_c bytes
+ *
+ * \return  the length of the trailer
+ *
+ ********************************************************************************** */
+uint16_t FSCI_computeTrailer(const uint8_t *pHdr,
+                             uint16_t       hdrLen,
+                             const uint8_t *pMsg,
+                             uint16_t       msgLen,
+                             uint32_t       fsciInterface,
+                             uint8_t       *pTrailer)
+{
+    uint16_t size = sizeof(uint8_t);
+    uint8_t  checksum;
+    uint8_t  virtInterface;
+
+#if defined gFsciCrcFraming_c && (gFsciCrcFraming_c != 0)
+    if (mFsciCommData[fsciInterface].framing != (uint8_t)gFsciFramingXor_c)
+    {
+        size = FSCI_computeCrcTrailer(mFsciCommData[fsciInterface].framing, pHdr, hdrLen, pMsg, msgLen, pTrailer);
+    }
+    else
+#endif /* gFsciCrcFraming_c */
+    {
+        checksum = FSCI_computeChecksum(pHdr, hdrLen);
+        checksum ^= FSCI_computeChecksum(pMsg, msgLen);
+        pTrailer[0] = checksum;
+
+        virtInterface = FSCI_GetVirtualInterface(fsciInterface);
+        if (virtInterface != 0u)
+        {
+#if (gFsciMaxVirtualInterfaces_c > 0)
+            pTrailer[0] += virtInterface;
+            pTrailer[1] = checksum ^ (checksum + virtInterface);
+            size += sizeof(checksum);
+#endif
+        }
+    }
+
+    return size;
+}
+
+#if (defined gFsciCrcFraming_c && (gFsciCrcFraming_c != 0)) || \
+    (defined gFsciBulkTransfer_c && (gFsciBulkTransfer_c != 0))
+/*! *********************************************************************************
+ * \brief  Updates a CRC-32 (IEEE 802.3) with a block of data.
+ *         Start with 0xFFFFFFFF and invert the result.
+ *
+ * \param[in]  crc current CRC value
+ * \param[in]  pBuffer pointer to the data
+ * \param[in]  size length of the data
+ *
+ * \return  the updated CRC value
+ *
+ ********************************************************************************** */
+uint32_t FSCI_computeCrc32(uint32_t crc, const void *pBuffer, uint32_t size)
+{
+    const uint8_t *pData = (const uint8_t *)pBuffer;
+
+    while (size-- != 0U)
+    {
+#if defined gFsciCrcFraming_c && (gFsciCrcFraming_c != 0)
+        crc = (crc >> 8) ^ mFsciCrc32Table[(crc ^ *pData++) & 0xFFU];
+#else
+        crc ^= *pData++;
+        crc = (crc >> 4) ^ mFsciCrc32Table[crc & 0xFU];
+        crc = (crc >> 4) ^ mFsciCrc32Table[crc & 0xFU];
+#endif
+    }
+    return crc;
+}
+#endif /* gFsciCrcFraming_c || gFsciBulkTransfer_c */
+
+#if defined gFsciCrcFraming_c && (gFsciCrcFraming_c != 0)
+/*! *********************************************************************************
+ * \brief  Updates a CRC-16/CCITT-FALSE with a block of data. Start with 0xFFFF.
+ *
+ * \param[in]  crc current CRC value
+ * \param[in]  pBuffer pointer to the data
+ * \param[in]  size length of the data
+ *
+ * \return  the updated CRC value
+ *
+ ********************************************************************************** */
+uint16_t FSCI_computeCrc16(uint16_t crc, const void *pBuffer, uint32_t size)
+{
+    const uint8_t *pData = (const uint8_t *)pBuffer;
+
+    while (size-- != 0U)
+    {
+        crc = (uint16_t)(crc << 8) ^ mFsciCrc16Table[((crc >> 8) ^ *pData++) & 0xFFU];
+    }
+    return crc;
+}
+
+/*! *********************************************************************************
+ * \brief  Computes the CRC trailer of a frame, stored little endian
+ *
+ * \param[in]  framing gFsciFramingCrc16_c or gFsciFramingCrc32_c
+ * \param[in]  pHdr pointer to the frame, starting with the opcode group
+ * \param[in]  hdrLen length of the first part
+ * \param[in]  pMsg pointer to the second part, may be NULL if msgLen is 0
+ * \param[in]  msgLen length of the second part
+ * \param[out] pTrailer location where the CRC is stored
+ *
+ * \return  the length of the CRC
+ *
+ ********************************************************************************** */
+static uint16_t FSCI_computeCrcTrailer(uint8_t        framing,
+                                       const uint8_t *pHdr,
+                                       uint16_t       hdrLen,
+                                       const uint8_t *pMsg,
+                                       uint16_t       msgLen,
+                                       uint8_t       *pTrailer)
+{
+    uint16_t size;
+    uint32_t crc;
+
+    if (framing == (uint8_t)gFsciFramingCrc16_c)
+    {
+        crc  = FSCI_computeCrc16(FSCI_computeCrc16(0xFFFFU, pHdr, hdrLen), pMsg, msgLen);
+        size = sizeof(uint16_t);
+    }
+    else
+    {
+        crc  = ~FSCI_computeCrc32(FSCI_computeCrc32(0xFFFFFFFFU, pHdr, hdrLen), pMsg, msgLen);
+        size = sizeof(uint32_t);
+    }
+
+    for (uint16_t i = 0U; i < size; i++)
+    {
+        pTrailer[i] = (uint8_t)(crc >> (8U * i));
+    }
+
+    return size;
+}
+#endif /* gFsciCrcFraming_c */
+
 /*! *********************************************************************************
  * \brief  This function performs the encoding of a message, using the Escape Sequence
  *
@@ -1165,9 +1610,144 @@ static void fsci_serial_manager_tx_callback(void                              *c
     FSCI_txCallback(tx->txBuffer);
     (void)MEM_BufferFree(tx);
 }
+
+/*! *********************************************************************************
+ * \brief  This function issues a non-blocking Serial Manager write, the packet is
+ *         freed once the transfer is complete
+ *
+ * \param[in]  fsciInterface fsci interface on which the packet is to be sent
+ * \param[in]  pPacket serial packet to be sent
+ * \param[in]  packetLen lenght of the serial packet in bytes
+ *
+ ********************************************************************************** */
+static void FSCI_SerialManagerWriteNonBlocking(uint32_t fsciInterface, uint8_t *pPacket, uint16_t packetLen)
+{
+    fsci_serial_manager_tx_t *tx = MEM_BufferAllocWithId(sizeof(fsci_serial_manager_tx_t), 0U);
+
+    if (NULL != tx)
+    {
+        tx->txBuffer = pPacket;
+
+        (void)SerialManager_OpenWriteHandle((serial_handle_t)gFsciSerialInterfaces[fsciInterface],
+                                            (serial_write_handle_t)tx->fsciSerialWriteHandle);
+        (void)SerialManager_InstallTxCallback((serial_write_handle_t)tx->fsciSerialWriteHandle,
+                                              (serial_manager_callback_t)fsci_serial_manager_tx_callback, tx);
+        if (kStatus_SerialManager_Success !=
+            SerialManager_WriteNonBlocking((serial_write_handle_t)tx->fsciSerialWriteHandle, tx->txBuffer, packetLen))
+        {
+            (void)MEM_BufferFree(pPacket);
+            (void)MEM_BufferFree(tx);
+        }
+    }
+    else
+    {
+        (void)MEM_BufferFree(pPacket);
+    }
+}
 #endif /* defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
 #endif /* !gFsciRxAck_c */
 
+#if defined gFsciTxAggregation_c && (gFsciTxAggregation_c != 0)
+/*! *********************************************************************************
+ * \brief  This function appends a FSCI packet to the TX aggregation buffer of an
+ *         interface. The buffer is written when the packet does not fit anymore or
+ *         when gFsciTxAggregationTimeoutMs_c expires, whichever comes first.
+ *
+ * \param[in]  fsciInterface fsci interface on which the packet is to be sent
+ * \param[in]  pPacket serial packet to be sent, freed by this function
+ * \param[in]  packetLen lenght of the serial packet in bytes
+ *
+ ********************************************************************************** */
+static void FSCI_TxAggregationAppend(uint32_t fsciInterface, uint8_t *pPacket, uint16_t packetLen)
+{
+    fsciComm_t *pCommData  = &mFsciCommData[fsciInterface];
+    uint8_t    *pAggBuf;
+    uint16_t    aggLen;
+    bool_t      startTimer = FALSE;
+
+    /* Take the pending frames, the allocation and the copy are done with the interrupts enabled */
+    OSA_InterruptDisable();
+    pAggBuf              = pCommData->pTxAggBuf;
+    aggLen               = pCommData->txAggLen;
+    pCommData->pTxAggBuf = NULL;
+    pCommData->txAggLen  = 0U;
+    pCommData->txAggHolders++;
+    OSA_InterruptEnable();
+
+    if ((pAggBuf != NULL) && (((uint32_t)aggLen + packetLen) > gFsciTxAggregationThreshold_c))
+    {
+        /* Not enough room left, the pending frames are written first to keep ordering */
+        FSCI_SerialManagerWriteNonBlocking(fsciInterface, pAggBuf, aggLen);
+        pAggBuf = NULL;
+        aggLen  = 0U;
+    }
+
+    if (packetLen < gFsciTxAggregationThreshold_c)
+    {
+        if (pAggBuf == NULL)
+        {
+            pAggBuf    = MEM_BufferAlloc(gFsciTxAggregationThreshold_c);
+            startTimer = TRUE;
+        }
+
+        if (pAggBuf != NULL)
+        {
+            FLib_MemCpy(&pAggBuf[aggLen], pPacket, packetLen);
+            aggLen += packetLen;
+            (void)MEM_BufferFree(pPacket);
+            pPacket = NULL;
+        }
+    }
+
+    /* Give the frames back, unless a flush was requested or another append started a new buffer meanwhile */
+    OSA_InterruptDisable();
+    pCommData->txAggHolders--;
+    if ((pAggBuf != NULL) && (pCommData->txAggFlushReq == FALSE) && (pCommData->pTxAggBuf == NULL))
+    {
+        pCommData->pTxAggBuf = pAggBuf;
+        pCommData->txAggLen  = aggLen;
+        pAggBuf              = NULL;
+    }
+    else
+    {
+        startTimer = FALSE;
+    }
+    if (pCommData->txAggHolders == 0U)
+    {
+        pCommData->txAggFlushReq = FALSE;
+    }
+    OSA_InterruptEnable();
+
+    if (pAggBuf != NULL)
+    {
+        /* These frames are older than the ones of the current buffer */
+        FSCI_SerialManagerWriteNonBlocking(fsciInterface, pAggBuf, aggLen);
+    }
+
+    if (pPacket != NULL)
+    {
+        /* Too large to be aggregated, or no buffer available */
+        FSCI_SerialManagerWriteNonBlocking(fsciInterface, pPacket, packetLen);
+    }
+
+    if (startTimer)
+    {
+        (void)TM_Start(pCommData->txAggTmr, kTimerModeSingleShot, gFsciTxAggregationTimeoutMs_c);
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  This function is the callback of the TX aggregation timer of a fsci interface
+ *
+ * \param[in]  param fsci interface whose aggregation buffer must be flushed
+ *
+ ********************************************************************************** */
+static void FSCI_TxAggregationTimeoutCb(void *param)
+{
+    FSCI_TxAggregationFlush((uint32_t)param);
+}
+#endif /* gFsciTxAggregation_c */
+
 /*! *********************************************************************************
  * \brief  This function is used to send a FSCI packet to the serial manager
  *
@@ -1199,7 +1779,7 @@ static void FSCI_SendPacketToSerialManager(uint32_t fsciInterface, uint8_t *pPac
 
         /* Allow the FSCI interface to receive ACK packet,
            if last packet was received on the same interface */
-        if (mFsciSrcInterface == fsciInterface)
+        if (pCommData->srcInterface == fsciInterface)
         {
             pCommData->pPacketFromClient = NULL;
         }
@@ -1255,6 +1835,10 @@ static void FSCI_SendPacketToSerialManager(uint32_t fsciInterface, uint8_t *pPac
 #if defined gFsciUseBlockingTx_c && (gFsciUseBlockingTx_c != 0)
     if (gFsciTxBlocking)
     {
+#if defined gFsciTxAggregation_c && (gFsciTxAggregation_c != 0)
+        /* Frames still held for aggregation must go out before this one */
+        FSCI_TxAggregationFlush(fsciInterface);
+#endif /* gFsciTxAggregation_c */
         (void)SerialManager_WriteBlocking((serial_write_handle_t)gFsciSerialWriteHandle[fsciInterface], pPacket,
                                           packetLen);
         (void)MEM_BufferFree(pPacket);
@@ -1262,41 +1846,146 @@ static void FSCI_SendPacketToSerialManager(uint32_t fsciInterface, uint8_t *pPac
     else
 #endif /* gFsciUseBlockingTx_c */
     {
-        fsci_serial_manager_tx_t *tx = MEM_BufferAllocWithId(sizeof(fsci_serial_manager_tx_t), 0U);
-
-        if (NULL != tx)
-        {
-            tx->txBuffer = pPacket;
-
-            (void)SerialManager_OpenWriteHandle((serial_handle_t)gFsciSerialInterfaces[fsciInterface],
-                                                (serial_write_handle_t)tx->fsciSerialWriteHandle);
-            (void)SerialManager_InstallTxCallback((serial_write_handle_t)tx->fsciSerialWriteHandle,
-                                                  (serial_manager_callback_t)fsci_serial_manager_tx_callback, tx);
-            if (kStatus_SerialManager_Success !=
-                SerialManager_WriteNonBlocking((serial_write_handle_t)tx->fsciSerialWriteHandle, tx->txBuffer,
-                                               packetLen))
-            {
-                (void)MEM_BufferFree(pPacket);
-                (void)MEM_BufferFree(tx);
-            }
-        }
-        else
-        {
-            (void)MEM_BufferFree(pPacket);
-        }
+#if defined gFsciTxAggregation_c && (gFsciTxAggregation_c != 0)
+        FSCI_TxAggregationAppend(fsciInterface, pPacket, packetLen);
+#else
+        FSCI_SerialManagerWriteNonBlocking(fsciInterface, pPacket, packetLen);
+#endif /* gFsciTxAggregation_c */
     }
 #endif /* gFsciRxAck_c */
 }
 #else  /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
 static void FSCI_SendPacketToSerialManager(uint32_t fsciInterface, uint8_t *pPacket, uint16_t packetLen)
 {
+    FSCI_RpmsgSend(fsciInterface, pPacket, packetLen, TRUE);
+}
+
+/*! *********************************************************************************
+ * \brief  Sends a formatted packet to the other core
+ *
+ * \param[in]  fsciInterface fsci interface on which the packet is to be sent
+ * \param[in]  pPacket packet to be sent
+ * \param[in]  packetLen lenght of the packet in bytes
+ * \param[in]  freePacket TRUE if pPacket is a MEM buffer to be freed once sent
+ *
+ ********************************************************************************** */
+void FSCI_RpmsgSend(uint32_t fsciInterface, uint8_t *pPacket, uint16_t packetLen, bool_t freePacket)
+{
+#if defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+    hal_rpmsg_handle_t handle = (hal_rpmsg_handle_t)gFsciSerialInterfaces[fsciInterface];
+    uint8_t           *pTxBuf = HAL_RpmsgAllocTxBuffer(handle, packetLen);
+
+    if (pTxBuf != NULL)
+    {
+        /* The packet was built by a handler in a MEM buffer or on the stack, it is copied once into the shared
+         * memory. Only FSCI_transmitPayload() builds its frames directly in the RPMsg TX buffer */
+        FLib_MemCpy(pTxBuf, pPacket, packetLen);
+        (void)HAL_RpmsgNoCopySend(handle, pTxBuf, packetLen);
+    }
+    if (freePacket)
+    {
+        (void)MEM_BufferFree(pPacket);
+    }
+#else
     union
     {
         void         *pVoid;
         pfFSCI_Send_t pfFSCI_Send;
     } fsciHandle;
     fsciHandle.pVoid = gFsciSerialInterfaces[fsciInterface];
-    fsciHandle.pfFSCI_Send(pPacket, packetLen, TRUE);
+    fsciHandle.pfFSCI_Send(pPacket, packetLen, freePacket);
+#endif /* gFsciRpmsgSharedBuffers_c */
+}
+
+#if defined(gFsciRpmsgSharedBuffers_c) && (gFsciRpmsgSharedBuffers_c == 1)
+/*! *********************************************************************************
+ * \brief  RPMsg RX callback of the FSCI endpoints. With the dedicated task, the RPMsg buffer
+ *         is held and queued without any allocation or copy in the RPMsg context.
+ *
+ * \param[in]  param the fsci interface
+ * \param[in]  data the received message, a formatted FSCI packet
+ * \param[in]  len the length of the message
+ *
+ * \return  kStatus_HAL_RL_HOLD if the buffer is kept by FSCI
+ *
+ ********************************************************************************** */
+static hal_rpmsg_return_status_t FSCI_RpmsgRxCallback(void *param, uint8_t *data, uint32_t len)
+{
+    hal_rpmsg_return_status_t ret = kStatus_HAL_RL_RELEASE;
+#if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
+    uint8_t head = mFsciRpmsgRxHead;
+    uint8_t next = (uint8_t)((head + 1U) % (gFsciRpmsgRxQueueLen_c + 1U));
+
+    /* When the queue is full the message is dropped and the buffer released */
+    if (next != mFsciRpmsgRxTail)
+    {
+        mFsciRpmsgRxQueue[head].pData         = data;
+        mFsciRpmsgRxQueue[head].len           = (uint16_t)len;
+        mFsciRpmsgRxQueue[head].fsciInterface = (uint8_t)(uint32_t)param;
+        mFsciRpmsgRxHead                      = next;
+        ret                                   = kStatus_HAL_RL_HOLD;
+        (void)OSA_EventSet((osa_event_handle_t)mFsciTaskEventId, (uint32_t)gFSCI_ClientPacketReady_c);
+    }
+#else
+    FSCI_RpmsgProcessRxBuffer((uint32_t)param, data, len);
+#endif
+    return ret;
+}
+
+#if defined(gFsciUseDedicatedTask_c) && (gFsciUseDedicatedTask_c == 1)
+/*! *********************************************************************************
+ * \brief  Processes the RPMsg buffers held by FSCI and releases them
+ *
+ ********************************************************************************** */
+static void FSCI_RpmsgProcessRxQueue(void)
+{
+    fsciRpmsgRxBuffer_t *pRxBuf;
+    uint8_t              tail = mFsciRpmsgRxTail;
+
+    while (tail != mFsciRpmsgRxHead)
+    {
+        pRxBuf = &mFsciRpmsgRxQueue[tail];
+        FSCI_RpmsgProcessRxBuffer(pRxBuf->fsciInterface, pRxBuf->pData, pRxBuf->len);
+        (void)HAL_RpmsgFreeRxBuffer((hal_rpmsg_handle_t)gFsciSerialInterfaces[pRxBuf->fsciInterface],
+                                    pRxBuf->pData);
+        tail             = (uint8_t)((tail + 1U) % (gFsciRpmsgRxQueueLen_c + 1U));
+        mFsciRpmsgRxTail = tail;
+    }
+}
+#endif /* gFsciUseDedicatedTask_c */
+
+/*! *********************************************************************************
+ * \brief  Hands a received RPMsg message to the FSCI handlers.
+ *         The handlers own the packet they receive: they free it with MEM_BufferFree(), may reuse
+ *         it for a larger confirm or queue it to another task. So it is copied to a MEM buffer,
+ *         this is the only copy on the RX path.
+ *
+ * \param[in]  fsciInterface the fsci interface
+ * \param[in]  pData the received message
+ * \param[in]  len the length of the message
+ *
+ ********************************************************************************** */
+static void FSCI_RpmsgProcessRxBuffer(uint32_t fsciInterface, uint8_t *pData, uint32_t len)
+{
+    clientPacket_t *pPacket = NULL;
+    uint32_t        size;
+
+    if (len >= sizeof(clientPacketHdr_t))
+    {
+        /* The buffer must also hold the trailer of the confirm built in place by the handlers */
+        size = sizeof(clientPacketHdr_t) + ((clientPacketHdr_t *)pData)->len + gFsci_TailBytes_c;
+        if ((len <= size) && (size <= sizeof(clientPacket_t)))
+        {
+            pPacket = MEM_BufferAlloc(size);
+        }
+    }
+
+    if (pPacket != NULL)
+    {
+        FLib_MemCpy(pPacket, pData, len);
+        (void)FSCI_ProcessRxPkt(pPacket, fsciInterface);
+    }
 }
+#endif /* gFsciRpmsgSharedBuffers_c */
 #endif /* !defined(gFsciOverRpmsg_c) || (gFsciOverRpmsg_c == 0) */
 #endif /* gFsciIncluded_c */
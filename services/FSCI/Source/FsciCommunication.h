@@ -34,6 +34,12 @@
 #define mFsciRxTimeoutUsePolling_c 0
 #endif
 
+/* TX aggregation relies on the Serial Manager non-blocking write path */
+#if (defined gFsciRxAck_c && (gFsciRxAck_c != 0)) || (defined gFsciOverRpmsg_c && (gFsciOverRpmsg_c != 0))
+#undef gFsciTxAggregation_c
+#define gFsciTxAggregation_c 0
+#endif
+
 /*! *********************************************************************************
 *************************************************************************************
 * Public type definitions
@@ -52,6 +58,11 @@ typedef struct fsciComm_tag
     clientPacket_t   *pPacketFromClient;
     clientPacketHdr_t pktHeader;
     uint16_t          bytesReceived;
+    uint8_t           srcInterface; /* Interface the last packet received on this link was routed to */
+    uint8_t           framing;      /* gFsciFraming_t used on this interface */
+#if gFsciUseDedicatedTask_c
+    clientPacket_t *volatile pPacketToProcess; /* Received packet waiting for the Fsci task */
+#endif
 #if gFsciHostSupport_c
     OSA_MUTEX_HANDLE_DEFINE(syncHostMutexId);
 #endif
@@ -72,6 +83,13 @@ typedef struct fsciComm_tag
 #endif
     bool_t rxOngoing;
 #endif
+#if gFsciTxAggregation_c
+    uint8_t       *pTxAggBuf;
+    uint16_t       txAggLen;
+    timer_handle_t txAggTmr;
+    uint8_t        txAggHolders;  /* number of appenders holding the aggregation buffer */
+    bool_t         txAggFlushReq; /* flush requested while the buffer was held */
+#endif
 } fsciComm_t;
 
 typedef enum
@@ -84,6 +102,9 @@ typedef enum
 {
     gFSCI_ClientPacketReady_c = (1 << 0),
 } fsciEventType_t;
+
+/* Each interface signals its received packets on its own event flag */
+#define gFSCI_ClientPacketReadyEvent(fsciInterface) ((uint32_t)gFSCI_ClientPacketReady_c << (fsciInterface))
 #endif
 
 typedef struct fsci_serial_manager_tx
@@ -122,6 +143,26 @@ uint8_t  FSCI_GetVirtualInterface(uint32_t fsciInterface);
 uint32_t FSCI_encodeEscapeSeq(const uint8_t *pDataIn, uint32_t len, uint8_t *pDataOut);
 void     FSCI_decodeEscapeSeq(uint8_t *pData, uint32_t len);
 uint8_t  FSCI_computeChecksum(const void *pBuffer, uint16_t size);
+uint16_t FSCI_computeTrailer(const uint8_t *pHdr,
+                             uint16_t       hdrLen,
+                             const uint8_t *pMsg,
+                             uint16_t       msgLen,
+                             uint32_t       fsciInterface,
+                             uint8_t       *pTrailer);
+#if gFsciCrcFraming_c || gFsciBulkTransfer_c
+uint32_t FSCI_computeCrc32(uint32_t crc, const void *pBuffer, uint32_t size);
+#endif
+#if gFsciCrcFraming_c
+uint16_t FSCI_computeCrc16(uint16_t crc, const void *pBuffer, uint32_t size);
+bool_t   FSCI_IsFramingModeValid(uint32_t fsciInterface, uint8_t framing);
+#endif
+
+#if gFsciTxAggregation_c
+void FSCI_TxAggregationFlush(uint32_t fsciInterface);
+#endif
+#if gFsciOverRpmsg_c
+void FSCI_RpmsgSend(uint32_t fsciInterface, uint8_t *pPacket, uint16_t packetLen, bool_t freePacket);
+#endif
 
 #if gFsciHostSupport_c
 void FSCI_HostSyncLock(uint32_t fsciInstance, opGroup_t OG, opCode_t OC);
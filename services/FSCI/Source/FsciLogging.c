@@ -24,12 +24,16 @@
 #include "fsl_component_mem_manager.h"
 #include "fsl_component_serial_manager.h"
 
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+#include "fwk_mem_track.h"
+#endif
+
 #include <assert.h>
 #include <stdio.h>
 #include <stdbool.h>
 #include <string.h>
 
-#if gFsciUseFmtLog_c
+#if gFsciUseFmtLog_c || gFsciUseBinLog_c
 #include <stdarg.h>
 #endif
 
@@ -43,11 +47,25 @@
 #define gFsciTextLogSize_c (gFsciMaxPayloadLen_c - sizeof(clientPacketHdr_t) - gFsciTimestampSize_c - 1)
 #define gFsciFileLogSize_c 220
 
+#if gFsciUseBinLog_c
+#define mFsciBinLogOpCode_c  0x02U
+#define mFsciBinLogMask_c    (gFsciBinLogBufferSize_c - 1U)
+#define mFsciBinLogHdrSize_c (sizeof(uint16_t)) /* number of dropped records */
+#endif
+
 /************************************************************************************
 *************************************************************************************
 * Private memory declarations
 *************************************************************************************
 ************************************************************************************/
+#if gFsciUseBinLog_c
+/* Log records: header word (format string ID | number of arguments) followed by the arguments.
+ * Indexes are free running, the buffer is written by FSCI_BinLogPush() and read by FSCI_BinLogFlush() */
+static uint32_t          mFsciBinLogBuf[gFsciBinLogBufferSize_c];
+static volatile uint32_t mFsciBinLogHead    = 0U;
+static volatile uint32_t mFsciBinLogTail    = 0U;
+static uint16_t          mFsciBinLogDropped = 0U;
+#endif
 
 /************************************************************************************
 *************************************************************************************
@@ -172,6 +190,115 @@ void FSCI_LogFormatedText(const char *fmt, ...)
 }
 #endif /* gFsciUseFmtLog_c */
 
+#if gFsciUseBinLog_c
+/*! *********************************************************************************
+ * \brief   Stores a binary log record in the log buffer. The record is dropped if the
+ *          buffer has not enough room left.
+ *
+ * \param[in] header - The format string ID ORed with the number of arguments.
+ * \param[in] ... - The arguments, as 32-bit words.
+ *
+ * \remarks Called by the FSCI_BinLog() macro
+ *
+ ********************************************************************************** */
+void FSCI_BinLogPush(uint32_t header, ...)
+{
+    uint32_t nbArgs = header & gFsciBinLogMaxArgs_c;
+    uint32_t head;
+    va_list  argp;
+
+    OSA_InterruptDisable();
+    head = mFsciBinLogHead;
+    if ((gFsciBinLogBufferSize_c - (head - mFsciBinLogTail)) <= nbArgs)
+    {
+        if (mFsciBinLogDropped < 0xFFFFU)
+        {
+            mFsciBinLogDropped++;
+        }
+    }
+    else
+    {
+        mFsciBinLogBuf[head & mFsciBinLogMask_c] = header;
+        head++;
+        va_start(argp, header);
+        while (nbArgs != 0U)
+        {
+            mFsciBinLogBuf[head & mFsciBinLogMask_c] = va_arg(argp, uint32_t);
+            head++;
+            nbArgs--;
+        }
+        va_end(argp);
+        mFsciBinLogHead = head;
+    }
+    OSA_InterruptEnable();
+}
+
+/*! *********************************************************************************
+ * \brief   Sends all binary log records stored so far to the host. Records are never
+ *          split between packets.
+ *
+ ********************************************************************************** */
+void FSCI_BinLogFlush(void)
+{
+    clientPacket_t *pFsciData;
+    uint32_t        tail = mFsciBinLogTail;
+    uint32_t        head;
+    uint32_t        nbWords;
+    uint16_t        length;
+    uint16_t        dropped;
+
+    while (gFsciTxDisable == FALSE)
+    {
+        head = mFsciBinLogHead;
+        if ((head == tail) && (mFsciBinLogDropped == 0U))
+        {
+            break;
+        }
+
+        pFsciData = MEM_BufferAlloc(sizeof(clientPacket_t));
+        if (NULL == pFsciData)
+        {
+            break;
+        }
+
+        /* Fill the message Header */
+        pFsciData->structured.header.opGroup = gFSCI_LoggingOpcodeGroup_c;
+        pFsciData->structured.header.opCode  = mFsciBinLogOpCode_c;
+
+        OSA_InterruptDisable();
+        dropped            = mFsciBinLogDropped;
+        mFsciBinLogDropped = 0U;
+        OSA_InterruptEnable();
+        FLib_MemCpy(pFsciData->structured.payload, &dropped, sizeof(dropped));
+        length = (uint16_t)mFsciBinLogHdrSize_c;
+
+        while (tail != head)
+        {
+            nbWords = (mFsciBinLogBuf[tail & mFsciBinLogMask_c] & gFsciBinLogMaxArgs_c) + 1U;
+            if ((length + nbWords * sizeof(uint32_t)) > gFsciMaxPayloadLen_c)
+            {
+                break;
+            }
+
+            while (nbWords != 0U)
+            {
+                FLib_MemCpy(&pFsciData->structured.payload[length], &mFsciBinLogBuf[tail & mFsciBinLogMask_c],
+                            sizeof(uint32_t));
+                length += (uint16_t)sizeof(uint32_t);
+                tail++;
+                nbWords--;
+            }
+        }
+
+        /* Release the space only once the records have been copied */
+        mFsciBinLogTail = tail;
+
+        pFsciData->structured.header.len = (fsciLen_t)length;
+        FSCI_transmitFormatedPacket(pFsciData, gFsciLoggingInterface_c);
+    }
+}
+#endif /* gFsciUseBinLog_c */
+
 /*! *********************************************************************************
  * \brief   Sends binary data to a specific file.
  *
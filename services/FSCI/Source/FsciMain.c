@@ -21,6 +21,7 @@
 #include "FsciCommands.h"
 #include "FsciCommunication.h"
 #include "fsl_component_mem_manager.h"
+#include <assert.h>
 
 #if gFsciIncluded_c
 /************************************************************************************
@@ -47,9 +48,9 @@ gFsciStatus_t FSCI_CallRegisteredFunc(opGroup_t opGroup, void *pData, uint32_t f
 * Private memory declarations
 *************************************************************************************
 ************************************************************************************/
-static uint8_t        mFsciSrcInterface = mFsciInvalidInterface_c;
-static gFsciOpGroup_t gReqOpGroupTable[gFsciMaxOpGroups_c];
-static uint8_t        gNumberOfOG = 0u;
+static fsciIntfContext_t mFsciIntfContext[gFsciMaxInterfaces_c];
+static gFsciOpGroup_t    gReqOpGroupTable[gFsciMaxOpGroups_c];
+static uint8_t           gNumberOfOG = 0u;
 
 /************************************************************************************
 *************************************************************************************
@@ -100,6 +101,20 @@ gFsciStatus_t FSCI_ProcessRxPkt(clientPacket_t *pPacket, uint32_t fsciInterface)
     }
     return status;
 }
+
+/*! *********************************************************************************
+ * \brief   Returns the context of the request being serviced on an FSCI interface
+ *
+ * \param[in] fsciInterface the FSCI interface
+ *
+ * \return pointer to the interface context
+ *
+ ********************************************************************************** */
+fsciIntfContext_t *FSCI_GetIntfContext(uint32_t fsciInterface)
+{
+    assert(fsciInterface < gFsciMaxInterfaces_c);
+    return &mFsciIntfContext[fsciInterface];
+}
 #endif
 
 /*! *********************************************************************************
@@ -120,9 +135,9 @@ gFsciStatus_t FSCI_Monitor(opGroup_t opGroup, void *pData, void *param, uint32_t
     gFsciOpGroup_t *p = NULL;
 
     /* Skip if the request originated in FSCI */
-    if (mFsciSrcInterface == fsciInterface)
+    if ((fsciInterface < gFsciMaxInterfaces_c) && (mFsciIntfContext[fsciInterface].handlerActive != 0u))
     {
-        mFsciSrcInterface = mFsciInvalidInterface_c;
+        mFsciIntfContext[fsciInterface].handlerActive = 0u;
     }
     else
     {
@@ -168,10 +183,11 @@ gFsciStatus_t FSCI_Monitor(opGroup_t opGroup, void *pData, void *param, uint32_t
  ********************************************************************************** */
 gFsciStatus_t FSCI_CallRegisteredFunc(opGroup_t opGroup, void *pData, uint32_t fsciInterface)
 {
-    gFsciOpGroup_t *pOGtable;
-    gFsciStatus_t   status = gFsciSuccess_c;
+    gFsciOpGroup_t    *pOGtable;
+    gFsciStatus_t      status = gFsciSuccess_c;
+    fsciIntfContext_t *pCtx   = FSCI_GetIntfContext(fsciInterface);
 
-    mFsciErrorReported = 0u;
+    pCtx->errorReported = 0u;
 
     /* Search for the OpGroup */
     pOGtable = FSCI_GetReqOpGroup(opGroup, (uint8_t)fsciInterface);
@@ -187,12 +203,12 @@ gFsciStatus_t FSCI_CallRegisteredFunc(opGroup_t opGroup, void *pData, uint32_t f
     else
     {
         /* Execute request */
-        mFsciSrcInterface = (uint8_t)fsciInterface;
+        pCtx->handlerActive = 1u;
         if (pOGtable->pfOpGroupHandler != NULL)
         {
             pOGtable->pfOpGroupHandler(pData, pOGtable->param, fsciInterface);
         }
-        mFsciSrcInterface = mFsciInvalidInterface_c;
+        pCtx->handlerActive = 0u;
     }
 
     return status;
@@ -0,0 +1,148 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file fsci_host.c
+ * \brief Host FSCI device, for benchmarks and tests on Linux.
+ *
+ * The FSCI module runs with the POSIX OSA port and the host serial manager on the master side of a pseudo terminal.
+ * The slave side is printed at startup, and can be passed to scripts/fsci_bench.py --port or to any FSCI host tool.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "FsciInterface.h"
+#include "FsciCommunication.h"
+#include "fsl_component_serial_manager.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#define FSCI_HOST_RING_BUFFER_SIZE 1024U
+
+/* the pty is a single serial port, its read handle can only be opened by one interface */
+_Static_assert(gFsciMaxInterfaces_c == 1, "the host FSCI device has a single interface");
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+static SERIAL_MANAGER_HANDLE_DEFINE(s_serialHandle);
+static uint8_t         s_ringBuffer[FSCI_HOST_RING_BUFFER_SIZE];
+static serial_handle_t s_fsciSerials[gFsciMaxInterfaces_c];
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+static int FSCI_HostOpenPty(void)
+{
+    int            fd = posix_openpt(O_RDWR | O_NOCTTY);
+    struct termios tio;
+
+    do
+    {
+        if (fd < 0)
+        {
+            break;
+        }
+
+        if ((grantpt(fd) != 0) || (unlockpt(fd) != 0) || (tcgetattr(fd, &tio) != 0))
+        {
+            (void)close(fd);
+            fd = -1;
+            break;
+        }
+
+        /* binary transfers, the FSCI frames must not be altered by the line discipline */
+        cfmakeraw(&tio);
+        (void)tcsetattr(fd, TCSANOW, &tio);
+    } while (false);
+
+    return fd;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+int main(int argc, char **argv)
+{
+    serial_manager_config_t config;
+    const char             *link = NULL;
+    int                     fd;
+    int                     opt;
+    bool                    usage = false;
+
+    while ((opt = getopt(argc, argv, "l:")) != -1)
+    {
+        if (opt == 'l')
+        {
+            link = optarg;
+        }
+        else
+        {
+            usage = true;
+        }
+    }
+
+    do
+    {
+        if (usage)
+        {
+            (void)fprintf(stderr, "usage: %s [-l symbolic link to the pty]\n", argv[0]);
+            break;
+        }
+
+        fd = FSCI_HostOpenPty();
+        if (fd < 0)
+        {
+            perror("pty");
+            break;
+        }
+
+        if (link != NULL)
+        {
+            (void)unlink(link);
+            if (symlink(ptsname(fd), link) != 0)
+            {
+                perror("symlink");
+                break;
+            }
+        }
+
+        config.ringBuffer     = s_ringBuffer;
+        config.ringBufferSize = sizeof(s_ringBuffer);
+        config.fd             = fd;
+        if (SerialManager_Init((serial_handle_t)s_serialHandle, &config) != kStatus_SerialManager_Success)
+        {
+            (void)fprintf(stderr, "serial manager initialization failed\n");
+            break;
+        }
+
+        s_fsciSerials[0] = (serial_handle_t)s_serialHandle;
+        FSCI_commInit(s_fsciSerials);
+
+        (void)printf("FSCI on %s\n", ptsname(fd));
+        (void)fflush(stdout);
+
+        for (;;)
+        {
+            (void)pause();
+        }
+    } while (false);
+
+    return EXIT_FAILURE;
+}
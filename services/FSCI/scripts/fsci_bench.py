@@ -0,0 +1,436 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 NXP
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# FSCI protocol benchmark.
+#
+# Sends Fsci-Ping requests (0xA3 0x38), which the device echoes back in the confirm, and
+# reports packets/s, bytes/s and the p50/p99 request-response latency for each payload size.
+#
+# The framing options must match the configuration the device was built with
+# (gFsciLenHas2Bytes_c, gFsciUseEscapeSeq_c, gFsciTxAck_c, gFsciRxAck_c, virtual interface Id).
+# The CRC framings are selected on the device with Get Mode and Mode Select before the run, and
+# the XOR checksum is selected again after it. The dedicated task or task per interface
+# configurations have no effect on the framing, run the benchmark once per device build to
+# compare them. With the dedicated task, the device holds one pending request per interface, so
+# --window above 1 loses requests.
+#
+# Usage:
+#     fsci_bench.py --port /dev/ttyACM0 [--baud 115200] [--sizes 0,16,64,128,240] [--count 1000]
+#     fsci_bench.py --loopback [--sweep]
+#
+# --port accepts any serial device, including a pty. Requires pyserial. services/FSCI/host builds
+# the FSCI module for Linux on a pty, to run the benchmark against the device code without hardware.
+# --loopback answers the requests from a Python responder thread over a socket pair. It needs no
+# hardware and no device build, it only checks the framing code of this script and measures the
+# host side of the protocol.
+#
+
+import argparse
+import binascii
+import itertools
+import math
+import socket
+import struct
+import sys
+import threading
+import time
+
+FSCI_START_MARKER = 0x02
+FSCI_END_MARKER = 0x03
+FSCI_ESCAPE_CHAR = 0x7F
+FSCI_REQ_OG = 0xA3
+FSCI_CNF_OG = 0xA4
+FSCI_PING_OC = 0x38
+FSCI_MODE_SELECT_OC = 0x00
+FSCI_GET_MODE_OC = 0x02
+FSCI_ACK_OC = 0xFD
+
+FRAMINGS = ("xor", "crc16", "crc32")
+
+
+def _crc16_entry(i):
+    crc = i << 8
+    for _ in range(8):
+        crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+    return crc & 0xFFFF
+
+
+CRC16_TABLE = [_crc16_entry(i) for i in range(256)]
+
+
+def crc16_ccitt_false(data):
+    crc = 0xFFFF
+    for b in data:
+        crc = ((crc << 8) & 0xFFFF) ^ CRC16_TABLE[(crc >> 8) ^ b]
+    return crc
+
+
+class Codec:
+    """FSCI frame encoder and stream decoder for one interface configuration."""
+
+    def __init__(self, len2=False, escape=False, framing="xor", vif=0):
+        if framing != "xor" and vif:
+            raise ValueError("the virtual interface Id is only carried by the XOR checksum")
+        self.len2 = len2
+        self.escape = escape
+        self.framing = framing
+        self.vif = vif
+        self.hdr_len = 5 if len2 else 4
+        self.tail_len = {"xor": 2 if vif else 1, "crc16": 2, "crc32": 4}[framing]
+        self.rx = bytearray()
+
+    def describe(self):
+        parts = [self.framing]
+        if self.len2:
+            parts.append("len2")
+        if self.escape:
+            parts.append("esc")
+        if self.vif:
+            parts.append("vif%d" % self.vif)
+        return "+".join(parts)
+
+    def trailer(self, body):
+        if self.framing == "crc16":
+            return struct.pack("<H", crc16_ccitt_false(body))
+        if self.framing == "crc32":
+            return struct.pack("<I", binascii.crc32(body) & 0xFFFFFFFF)
+        checksum = 0
+        for b in body:
+            checksum ^= b
+        if not self.vif:
+            return bytes([checksum])
+        first = (checksum + self.vif) & 0xFF
+        return bytes([first, checksum ^ first])
+
+    @staticmethod
+    def escape_bytes(data):
+        out = bytearray()
+        for b in data:
+            if b in (FSCI_START_MARKER, FSCI_END_MARKER, FSCI_ESCAPE_CHAR):
+                out += bytes([FSCI_ESCAPE_CHAR, b ^ FSCI_ESCAPE_CHAR])
+            else:
+                out.append(b)
+        return out
+
+    @staticmethod
+    def unescape_bytes(data):
+        out = bytearray()
+        it = iter(data)
+        for b in it:
+            if b == FSCI_ESCAPE_CHAR:
+                b = next(it, FSCI_ESCAPE_CHAR) ^ FSCI_ESCAPE_CHAR
+            out.append(b)
+        return out
+
+    def encode(self, og, oc, payload=b""):
+        length = struct.pack("<H", len(payload)) if self.len2 else bytes([len(payload)])
+        body = bytes([og, oc]) + length + bytes(payload)
+        if self.escape:
+            return bytes([FSCI_START_MARKER]) + self.escape_bytes(body + self.trailer(body)) + bytes([FSCI_END_MARKER])
+        return bytes([FSCI_START_MARKER]) + body + self.trailer(body)
+
+    def feed(self, data):
+        """Appends received bytes and returns the list of valid (og, oc, payload) frames."""
+        self.rx += data
+        if self.escape:
+            return self._feed_escaped()
+        frames = []
+        while True:
+            start = self.rx.find(FSCI_START_MARKER)
+            if start < 0:
+                self.rx.clear()
+                break
+            del self.rx[:start]
+            if len(self.rx) < self.hdr_len:
+                break
+            length = struct.unpack_from("<H", self.rx, 3)[0] if self.len2 else self.rx[3]
+            end = self.hdr_len + length
+            if len(self.rx) < end + self.tail_len:
+                break
+            frame = self._check(self.rx[1:end], self.rx[end : end + self.tail_len])
+            if frame is None:
+                # Resynchronize on the next start marker
+                del self.rx[:1]
+                continue
+            frames.append(frame)
+            del self.rx[: end + self.tail_len]
+        return frames
+
+    def _feed_escaped(self):
+        frames = []
+        while True:
+            end = self.rx.find(FSCI_END_MARKER)
+            if end < 0:
+                break
+            # The device also escapes the start marker of the frames it sends
+            raw = self.unescape_bytes(self.rx[:end])
+            del self.rx[: end + 1]
+            start = raw.find(FSCI_START_MARKER)
+            if start < 0 or len(raw) - start < self.hdr_len + self.tail_len:
+                continue
+            body = raw[start + 1 : len(raw) - self.tail_len]
+            length = struct.unpack_from("<H", body, 2)[0] if self.len2 else body[2]
+            if length != len(body) - (self.hdr_len - 1):
+                continue
+            frame = self._check(body, raw[len(raw) - self.tail_len :])
+            if frame is not None:
+                frames.append(frame)
+        return frames
+
+    def _check(self, body, tail):
+        if bytes(tail) != self.trailer(bytes(body)):
+            return None
+        return body[0], body[1], bytes(body[self.hdr_len - 1 :])
+
+
+class SocketTransport:
+    def __init__(self, sock):
+        self.sock = sock
+
+    def write(self, data):
+        self.sock.sendall(data)
+
+    def read(self, timeout):
+        self.sock.settimeout(timeout)
+        try:
+            return self.sock.recv(4096)
+        except socket.timeout:
+            return b""
+
+    def close(self):
+        self.sock.close()
+
+
+class SerialTransport:
+    def __init__(self, port, baud):
+        import serial
+
+        self.ser = serial.Serial(port, baud, timeout=0)
+        self.ser.reset_input_buffer()
+
+    def write(self, data):
+        self.ser.write(data)
+
+    def read(self, timeout):
+        self.ser.timeout = timeout
+        data = self.ser.read(1)
+        if data and self.ser.in_waiting:
+            data += self.ser.read(self.ser.in_waiting)
+        return data
+
+    def close(self):
+        self.ser.close()
+
+
+class LoopbackResponder(threading.Thread):
+    """Answers Fsci-Ping requests the way the device does, for benchmarks without hardware."""
+
+    def __init__(self, sock, codec, tx_ack, rx_ack):
+        super().__init__(daemon=True)
+        self.sock = sock
+        self.codec = codec
+        self.tx_ack = tx_ack
+        self.rx_ack = rx_ack
+
+    def run(self):
+        try:
+            self._serve()
+        except OSError:
+            pass
+        finally:
+            self.sock.close()
+
+    def _serve(self):
+        while True:
+            data = self.sock.recv(4096)
+            if not data:
+                return
+            out = bytearray()
+            for og, oc, payload in self.codec.feed(data):
+                if og == FSCI_CNF_OG and oc == FSCI_ACK_OC:
+                    continue
+                if self.tx_ack:
+                    out += self.codec.encode(FSCI_CNF_OG, FSCI_ACK_OC, b"\0")
+                if og == FSCI_REQ_OG and oc == FSCI_PING_OC:
+                    out += self.codec.encode(FSCI_CNF_OG, FSCI_PING_OC, payload)
+            if out:
+                self.sock.sendall(out)
+
+
+def transact(transport, codec, oc, payload, opts):
+    """Sends a FSCI utility request and returns the payload of its confirm."""
+    transport.write(codec.encode(FSCI_REQ_OG, oc, payload))
+    deadline = time.monotonic() + opts.timeout
+    while time.monotonic() < deadline:
+        for og, roc, data in codec.feed(transport.read(opts.timeout)):
+            if og == FSCI_CNF_OG and roc == FSCI_ACK_OC:
+                continue
+            if opts.rx_ack:
+                transport.write(codec.encode(FSCI_CNF_OG, FSCI_ACK_OC, b"\0"))
+            if og == FSCI_CNF_OG and roc == oc:
+                return data
+    raise RuntimeError("no confirm for the FSCI request 0x%02X" % oc)
+
+
+def select_framing(transport, current, framing, opts):
+    """Selects the frame trailer of the device interface, the requests use the current framing."""
+    mode = transact(transport, current, FSCI_GET_MODE_OC, b"", opts)
+    # status, TX blocking and the modes of the 9 legacy SAPs, then the framing on gFsciCrcFraming_c builds
+    if len(mode) < 12 or mode[0] != 0:
+        raise RuntimeError("the device does not support the CRC framing (gFsciCrcFraming_c)")
+    cnf = transact(transport, current, FSCI_MODE_SELECT_OC, mode[1:11] + bytes([FRAMINGS.index(framing)]), opts)
+    if not cnf or cnf[0] != 0:
+        raise RuntimeError("the device rejected the %s framing" % framing)
+
+
+def percentile(sorted_values, pct):
+    if not sorted_values:
+        return 0.0
+    # Nearest-rank percentile
+    rank = max(1, math.ceil(pct / 100.0 * len(sorted_values)))
+    return sorted_values[rank - 1]
+
+
+def run_size(transport, codec, size, opts):
+    """Runs opts.count pings of size bytes and returns the measurements."""
+    latencies = []
+    pending = []
+    acks = 0
+    lost = 0
+    sent = 0
+    seq = itertools.count()
+
+    def request():
+        payload = struct.pack("<H", next(seq) & 0xFFFF)[:size] + bytes(max(0, size - 2))
+        pending.append((payload, time.perf_counter()))
+        transport.write(codec.encode(FSCI_REQ_OG, FSCI_PING_OC, payload))
+
+    start = time.perf_counter()
+    while sent < opts.count or pending:
+        while sent < opts.count and len(pending) < opts.window:
+            request()
+            sent += 1
+        data = transport.read(opts.timeout)
+        if not data:
+            # The oldest request is considered lost
+            pending.pop(0)
+            lost += 1
+            continue
+        for og, oc, payload in codec.feed(data):
+            if og == FSCI_CNF_OG and oc == FSCI_ACK_OC:
+                acks += 1
+                continue
+            if opts.rx_ack:
+                transport.write(codec.encode(FSCI_CNF_OG, FSCI_ACK_OC, b"\0"))
+            if og != FSCI_CNF_OG or oc != FSCI_PING_OC:
+                continue
+            # Confirms are sent in order, drop the requests that were not answered
+            while pending and pending[0][0] != payload:
+                pending.pop(0)
+                lost += 1
+            if pending:
+                latencies.append(time.perf_counter() - pending.pop(0)[1])
+    elapsed = time.perf_counter() - start
+
+    if opts.tx_ack and acks < len(latencies):
+        print("warning: %d ACK(s) missing for %d confirm(s)" % (len(latencies) - acks, len(latencies)), file=sys.stderr)
+
+    latencies.sort()
+    done = len(latencies)
+    wire = len(codec.encode(FSCI_REQ_OG, FSCI_PING_OC, bytes(size))) * 2
+    return {
+        "config": codec.describe() + ("+txack" if opts.tx_ack else "") + ("+rxack" if opts.rx_ack else ""),
+        "size": size,
+        "done": done,
+        "lost": lost,
+        "pkt_s": done / elapsed if elapsed else 0.0,
+        "bytes_s": done * wire / elapsed if elapsed else 0.0,
+        "p50_us": percentile(latencies, 50) * 1e6,
+        "p99_us": percentile(latencies, 99) * 1e6,
+    }
+
+
+def print_results(results, csv):
+    columns = ("config", "size", "done", "lost", "pkt_s", "bytes_s", "p50_us", "p99_us")
+    if csv:
+        print(",".join(columns))
+        for r in results:
+            print(",".join(("%.1f" % r[c]) if isinstance(r[c], float) else str(r[c]) for c in columns))
+        return
+    print("%-28s %6s %7s %5s %10s %12s %10s %10s" % columns)
+    for r in results:
+        print(
+            "%-28s %6d %7d %5d %10.1f %12.1f %10.1f %10.1f"
+            % tuple(r[c] for c in columns)
+        )
+
+
+def loopback_configs(opts):
+    if not opts.sweep:
+        yield opts
+        return
+    for framing, escape, vif, tx_ack, rx_ack in itertools.product(
+        FRAMINGS, (False, True), (0, 1), (False, True), (False, True)
+    ):
+        if framing != "xor" and vif:
+            continue
+        cfg = argparse.Namespace(**vars(opts))
+        cfg.framing, cfg.escape, cfg.vif, cfg.tx_ack, cfg.rx_ack = framing, escape, vif, tx_ack, rx_ack
+        yield cfg
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark the FSCI protocol with Fsci-Ping requests")
+    target = parser.add_mutually_exclusive_group(required=True)
+    target.add_argument("--port", help="serial device or pty of the FSCI interface")
+    target.add_argument("--loopback", action="store_true", help="answer the requests from a host responder")
+    parser.add_argument("--baud", type=int, default=115200, help="baud rate of the serial device")
+    parser.add_argument("--sizes", default="0,16,64,128,240", help="comma separated payload sizes in bytes")
+    parser.add_argument("--count", type=int, default=1000, help="number of requests per payload size")
+    parser.add_argument("--window", type=int, default=1, help="number of requests in flight")
+    parser.add_argument("--timeout", type=float, default=1.0, help="response timeout in seconds")
+    parser.add_argument("--len2", action="store_true", help="FSCI length field on 2 bytes (gFsciLenHas2Bytes_c)")
+    parser.add_argument("--escape", action="store_true", help="escape sequences (gFsciUseEscapeSeq_c)")
+    parser.add_argument("--framing", choices=FRAMINGS, default="xor", help="frame trailer (gFsciCrcFraming_c)")
+    parser.add_argument("--vif", type=int, default=0, help="virtual interface Id")
+    parser.add_argument("--tx-ack", action="store_true", help="the device acknowledges each request (gFsciTxAck_c)")
+    parser.add_argument("--rx-ack", action="store_true", help="the device expects an ACK for each frame (gFsciRxAck_c)")
+    parser.add_argument("--sweep", action="store_true", help="with --loopback, run all the framing configurations")
+    parser.add_argument("--csv", action="store_true", help="print the results as CSV")
+    opts = parser.parse_args()
+
+    if opts.sweep and not opts.loopback:
+        parser.error("--sweep requires --loopback, the framing of a device is fixed at build time")
+    if opts.framing != "xor" and opts.vif:
+        parser.error("the virtual interface Id is only carried by the XOR checksum")
+    sizes = [int(s) for s in opts.sizes.split(",") if s]
+    if any(s < 0 or s > (0xFFFF if opts.len2 else 0xFF) for s in sizes):
+        parser.error("payload size out of range")
+
+    results = []
+    for cfg in loopback_configs(opts) if opts.loopback else [opts]:
+        codec = Codec(cfg.len2, cfg.escape, cfg.framing, cfg.vif)
+        if cfg.loopback:
+            host, device = socket.socketpair()
+            LoopbackResponder(device, Codec(cfg.len2, cfg.escape, cfg.framing, cfg.vif), cfg.tx_ack, cfg.rx_ack).start()
+            transport = SocketTransport(host)
+        else:
+            transport = SerialTransport(cfg.port, cfg.baud)
+        xor = Codec(cfg.len2, cfg.escape, "xor", cfg.vif)
+        try:
+            if not cfg.loopback and cfg.framing != "xor":
+                select_framing(transport, xor, cfg.framing, cfg)
+            for size in sizes:
+                results.append(run_size(transport, codec, size, cfg))
+            if not cfg.loopback and cfg.framing != "xor":
+                select_framing(transport, codec, "xor", cfg)
+        finally:
+            transport.close()
+
+    print_results(results, opts.csv)
+
+
+if __name__ == "__main__":
+    main()
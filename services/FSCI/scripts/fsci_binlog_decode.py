@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 NXP
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Decoder for the FSCI binary logging (gFsciUseBinLog_c).
+#
+# The device sends the address of the format string instead of the formatted text.
+# The format strings are read from the .fsci_binlog_fmt section of the application ELF file.
+#
+# Usage:
+#     fsci_binlog_decode.py app.elf capture.bin [--len2] [--framing xor|crc16|crc32]
+#
+# capture.bin is a raw capture of the FSCI logging interface. --framing gives the frame trailer
+# selected on the interface (gFsciCrcFraming_c), it must be the same for the whole capture.
+# Escape sequences (gFsciUseEscapeSeq_c) are not supported. Requires pyelftools.
+#
+
+import argparse
+import binascii
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+FSCI_START_MARKER = 0x02
+FSCI_LOGGING_OG = 0xB0
+FSCI_BINLOG_OC = 0x02
+BINLOG_MAX_ARGS = 7
+TRAILER_LEN = {"xor": 1, "crc16": 2, "crc32": 4}
+
+FMT_SPEC = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diouxXcsp%])")
+
+
+def crc16_ccitt_false(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+        crc &= 0xFFFF
+    return crc
+
+
+def trailer(framing, body):
+    if framing == "crc16":
+        return struct.pack("<H", crc16_ccitt_false(body))
+    if framing == "crc32":
+        return struct.pack("<I", binascii.crc32(body) & 0xFFFFFFFF)
+    checksum = 0
+    for b in body:
+        checksum ^= b
+    return bytes([checksum])
+
+
+class StringTable:
+    def __init__(self, elf_path):
+        self.sections = []
+        with open(elf_path, "rb") as f:
+            elf = ELFFile(f)
+            for sec in elf.iter_sections():
+                if sec["sh_type"] == "SHT_NOBITS" or sec["sh_size"] == 0:
+                    continue
+                self.sections.append((sec.name, sec["sh_addr"], sec.data()))
+        if not any(name == ".fsci_binlog_fmt" for name, _, _ in self.sections):
+            sys.exit("no .fsci_binlog_fmt section in the ELF file")
+
+    def string_at(self, addr, section=None):
+        for name, base, data in self.sections:
+            if section is not None and name != section:
+                continue
+            if base <= addr < base + len(data):
+                end = data.find(b"\0", addr - base)
+                return data[addr - base : end if end >= 0 else len(data)].decode("utf-8", "replace")
+        return None
+
+
+def format_record(strings, fmt, args):
+    args = list(args)
+
+    def convert(m):
+        flags, width, precision, _, conv = m.groups()
+        if conv == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        spec = "%" + (flags or "") + (width or "") + ("." + precision if precision else "")
+        if conv in "di":
+            value = struct.unpack("<i", struct.pack("<I", value))[0]
+            return (spec + "d") % value
+        if conv == "u":
+            return (spec + "d") % value
+        if conv == "p":
+            return "0x%08x" % value
+        if conv == "c":
+            return chr(value & 0xFF)
+        if conv == "s":
+            text = strings.string_at(value)
+            return (spec + "s") % (text if text is not None else "<0x%08x>" % value)
+        return (spec + conv) % value
+
+    return FMT_SPEC.sub(convert, fmt)
+
+
+def decode_payload(strings, payload):
+    (dropped,) = struct.unpack_from("<H", payload, 0)
+    if dropped:
+        print("*** %d log record(s) dropped ***" % dropped)
+    words = struct.unpack_from("<%dI" % ((len(payload) - 2) // 4), payload, 2)
+    i = 0
+    while i < len(words):
+        header = words[i]
+        nb_args = header & BINLOG_MAX_ARGS
+        fmt = strings.string_at(header & ~BINLOG_MAX_ARGS, ".fsci_binlog_fmt")
+        args = words[i + 1 : i + 1 + nb_args]
+        i += 1 + nb_args
+        if fmt is None:
+            print("<unknown format 0x%08x> %s" % (header, " ".join("0x%08x" % a for a in args)))
+        else:
+            sys.stdout.write(format_record(strings, fmt, args))
+
+
+def iter_frames(stream, len2, framing):
+    hdr_len = 5 if len2 else 4
+    tail_len = TRAILER_LEN[framing]
+    i = 0
+    while i + hdr_len <= len(stream):
+        if stream[i] != FSCI_START_MARKER:
+            i += 1
+            continue
+        og, oc = stream[i + 1], stream[i + 2]
+        length = struct.unpack_from("<H", stream, i + 3)[0] if len2 else stream[i + 3]
+        end = i + hdr_len + length
+        if end + tail_len > len(stream):
+            break
+        if trailer(framing, stream[i + 1 : end]) != stream[end : end + tail_len]:
+            i += 1
+            continue
+        yield og, oc, stream[i + hdr_len : end]
+        i = end + tail_len
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode FSCI binary log records")
+    parser.add_argument("elf", help="application ELF file")
+    parser.add_argument("capture", help="raw capture of the FSCI logging interface")
+    parser.add_argument("--len2", action="store_true", help="FSCI length field on 2 bytes (gFsciLenHas2Bytes_c)")
+    parser.add_argument("--framing", choices=sorted(TRAILER_LEN), default="xor", help="frame trailer of the interface")
+    opts = parser.parse_args()
+
+    strings = StringTable(opts.elf)
+    with open(opts.capture, "rb") as f:
+        stream = f.read()
+
+    for og, oc, payload in iter_frames(stream, opts.len2, opts.framing):
+        if og == FSCI_LOGGING_OG and oc == FSCI_BINLOG_OC:
+            decode_payload(strings, payload)
+
+
+if __name__ == "__main__":
+    main()
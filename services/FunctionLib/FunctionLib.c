@@ -28,6 +28,17 @@
 *************************************************************************************
 ********************************************************************************** */
 
+/* Buffers shorter than this are processed byte per byte, the alignment prologue would cost more than it saves */
+#define FLIB_WORD_THRESHOLD 16U
+
+/* Bytes processed per iteration of the unrolled loops, the compiler turns the 4 word accesses into LDM/STM */
+#define FLIB_UNROLL_BYTES (4U * sizeof(uint32_t))
+
+#define FLIB_IS_WORD_ALIGNED(p) ((((uintptr_t)(p)) & (sizeof(uint32_t) - 1U)) == 0U)
+
+/* Repeats a byte in the 4 bytes of a word */
+#define FLIB_WORD_PATTERN(val) ((uint32_t)(val)*0x01010101U)
+
 /*! *********************************************************************************
 *************************************************************************************
 * Private prototypes
@@ -82,11 +93,54 @@ void FLib_MemCpy(void *pDst, const void *pSrc, uint32_t cBytes)
 #if gUseToolchainMemFunc_d
     (void)memcpy(pDst, pSrc, cBytes);
 #else
+    uint8_t       *pDst8 = (uint8_t *)pDst;
+    const uint8_t *pSrc8 = (const uint8_t *)pSrc;
+
+    if (cBytes >= FLIB_WORD_THRESHOLD)
+    {
+        /* Align the destination, the source is read with unaligned loads if it can't be aligned too */
+        while (!FLIB_IS_WORD_ALIGNED(pDst8))
+        {
+            *pDst8++ = *pSrc8++;
+            cBytes--;
+        }
+
+        if (FLIB_IS_WORD_ALIGNED(pSrc8))
+        {
+            uint32_t       *pDst32 = (uint32_t *)(void *)pDst8;
+            const uint32_t *pSrc32 = (const uint32_t *)(const void *)pSrc8;
+
+            while (cBytes >= FLIB_UNROLL_BYTES)
+            {
+                uint32_t w0 = pSrc32[0];
+                uint32_t w1 = pSrc32[1];
+                uint32_t w2 = pSrc32[2];
+                uint32_t w3 = pSrc32[3];
+
+                pDst32[0] = w0;
+                pDst32[1] = w1;
+                pDst32[2] = w2;
+                pDst32[3] = w3;
+                pDst32 += 4;
+                pSrc32 += 4;
+                cBytes -= FLIB_UNROLL_BYTES;
+            }
+            pDst8 = (uint8_t *)pDst32;
+            pSrc8 = (const uint8_t *)pSrc32;
+        }
+
+        while (cBytes >= sizeof(uint32_t))
+        {
+            *(uint32_t *)(void *)pDst8 = __UNALIGNED_UINT32_READ(pSrc8);
+            pDst8 += sizeof(uint32_t);
+            pSrc8 += sizeof(uint32_t);
+            cBytes -= sizeof(uint32_t);
+        }
+    }
+
     while (cBytes != 0U)
     {
-        *((uint8_t *)pDst) = *((const uint8_t *)pSrc);
-        pDst               = ((uint8_t *)pDst) + 1;
-        pSrc               = ((const uint8_t *)pSrc) + 1;
+        *pDst8++ = *pSrc8++;
         cBytes--;
     }
 #endif
@@ -219,8 +273,8 @@ void FLib_MemCpyDir(void *pBuf1, void *pBuf2, bool_t dir, uint32_t n)
 /*! *********************************************************************************
  * \brief  The byte at index i from the source buffer is copied to index ((n-1) - i)
  *         in the destination buffer (and vice versa).
- *         If the length is a multiple of 4 and both destination and source pointers are aligned,
- *         an optimized version is executed.
+ *         The bytes are reversed a word at a time, whatever the length and the alignment
+ *         of the buffers. The destination may be the source buffer itself.
  *
  * \param[in, out]  pDst Pointer to the destination buffer.
  *
@@ -235,44 +289,45 @@ void FLib_MemCpyDir(void *pBuf1, void *pBuf2, bool_t dir, uint32_t n)
  ********************************************************************************** */
 void FLib_MemCpyReverseOrder(void *pDst, const void *pSrc, uint32_t cBytes)
 {
+    uint8_t       *pDst8 = (uint8_t *)pDst;
+    const uint8_t *pSrc8 = (const uint8_t *)pSrc;
+    uint32_t       lo    = 0U;
+    uint32_t       hi    = cBytes;
+
 #if gFLib_CheckBufferOverflow_d
     (void)MEM_BufferCheck(pDst, cBytes);
 #endif
-    if (cBytes != 0UL)
+
+    /* Swap a word from each end per iteration, both are read before writing so that pDst can be equal to pSrc.
+     * The accesses may be unaligned, HAL_BSWAP32 maps to the REV instruction. */
+    while ((hi - lo) >= (2U * sizeof(uint32_t)))
     {
-        uint32_t N_words = (cBytes / sizeof(uint32_t));
-        if ((N_words > 0u) && (cBytes == N_words * sizeof(uint32_t)))
-        {
-            uint32_t        tmp;
-            const uint32_t *s_st = (const uint32_t *)pSrc;
-            const uint32_t *s_nd = &s_st[N_words - 1U];
-            uint32_t       *d_st = (uint32_t *)pDst;
-            uint32_t       *d_nd = &d_st[N_words - 1U];
+        uint32_t head;
+        uint32_t tail;
+
+        hi -= sizeof(uint32_t);
+        head = __UNALIGNED_UINT32_READ(&pSrc8[lo]);
+        tail = __UNALIGNED_UINT32_READ(&pSrc8[hi]);
+        __UNALIGNED_UINT32_WRITE(&pDst8[lo], HAL_BSWAP32(tail));
+        __UNALIGNED_UINT32_WRITE(&pDst8[hi], HAL_BSWAP32(head));
+        lo += sizeof(uint32_t);
+    }
 
-            for (uint32_t i = N_words / 2u; i > 0u; i--)
-            {
-                tmp     = HAL_BSWAP32(*s_nd--);
-                *d_nd-- = HAL_BSWAP32(*s_st++);
-                *d_st++ = tmp;
-            }
-            if ((N_words & 1u) == 1u) /* nb of words is odd */
-            {
-                /* There is a remaining word to be reversed */
-                tmp     = HAL_BSWAP32(*s_nd--);
-                *d_st++ = tmp;
-            }
-        }
-        else
-        {
-            pDst = (uint8_t *)pDst + (uint32_t)(cBytes - 1UL);
-            while (cBytes != 0UL)
-            {
-                *((uint8_t *)pDst) = *((const uint8_t *)pSrc);
-                pDst               = (uint8_t *)pDst - 1U;
-                pSrc               = (const uint8_t *)pSrc + 1U;
-                cBytes--;
-            }
-        }
+    /* Less than 8 bytes remain in the middle */
+    while ((hi - lo) > 1U)
+    {
+        uint8_t tmp;
+
+        hi--;
+        tmp       = pSrc8[lo];
+        pDst8[lo] = pSrc8[hi];
+        pDst8[hi] = tmp;
+        lo++;
+    }
+
+    if (hi != lo)
+    {
+        pDst8[lo] = pSrc8[lo];
     }
 }
 
@@ -307,16 +362,42 @@ bool_t FLib_MemCmp(const void *pData1, /* IN: First memory block to compare */
         status = FALSE;
     }
 #else
+    const uint8_t *pByte1 = (const uint8_t *)pData1;
+    const uint8_t *pByte2 = (const uint8_t *)pData2;
+
+    if (cBytes >= FLIB_WORD_THRESHOLD)
+    {
+        while (!FLIB_IS_WORD_ALIGNED(pByte1) && (*pByte1 == *pByte2))
+        {
+            pByte1++;
+            pByte2++;
+            cBytes--;
+        }
+
+        /* The first buffer is aligned unless a difference was found, the second one is read with unaligned loads */
+        if (FLIB_IS_WORD_ALIGNED(pByte1))
+        {
+            while ((cBytes >= sizeof(uint32_t)) &&
+                   (*(const uint32_t *)(const void *)pByte1 == __UNALIGNED_UINT32_READ(pByte2)))
+            {
+                pByte1 += sizeof(uint32_t);
+                pByte2 += sizeof(uint32_t);
+                cBytes -= sizeof(uint32_t);
+            }
+        }
+    }
+
+    /* Remaining bytes, or the word holding the difference */
     while (cBytes != 0UL)
     {
-        if (*((const uint8_t *)pData1) != *((const uint8_t *)pData2))
+        if (*pByte1 != *pByte2)
         {
             status = FALSE;
             break;
         }
 
-        pData2 = (const uint8_t *)pData2 + 1U;
-        pData1 = (const uint8_t *)pData1 + 1U;
+        pByte1++;
+        pByte2++;
         cBytes--;
     }
 #endif
@@ -341,17 +422,39 @@ bool_t FLib_MemCmp(const void *pData1, /* IN: First memory block to compare */
  ********************************************************************************** */
 bool_t FLib_MemCmpToVal(const void *pAddr, uint8_t val, uint32_t len)
 {
-    bool_t ret = TRUE;
-    while (len != 0UL)
+    bool_t         ret   = TRUE;
+    const uint8_t *pByte = (const uint8_t *)pAddr;
+
+    if (len >= FLIB_WORD_THRESHOLD)
     {
-        len--;
+        uint32_t pattern = FLIB_WORD_PATTERN(val);
+
+        while (!FLIB_IS_WORD_ALIGNED(pByte) && (*pByte == val))
+        {
+            pByte++;
+            len--;
+        }
 
-        if (((const uint8_t *)pAddr)[len] != val)
+        if (FLIB_IS_WORD_ALIGNED(pByte))
+        {
+            while ((len >= sizeof(uint32_t)) && (*(const uint32_t *)(const void *)pByte == pattern))
+            {
+                pByte += sizeof(uint32_t);
+                len -= sizeof(uint32_t);
+            }
+        }
+    }
+
+    while (len != 0UL)
+    {
+        if (*pByte != val)
         {
             /*once compare context isn't equal, return*/
             ret = FALSE;
             break;
         }
+        pByte++;
+        len--;
     }
 
     return ret;
@@ -379,9 +482,41 @@ void FLib_MemSet(void *pData, uint8_t value, uint32_t cBytes)
 #if gUseToolchainMemFunc_d
     (void)memset(pData, (int)value, cBytes);
 #else
+    uint8_t *pByte = (uint8_t *)pData;
+
+    if (cBytes >= FLIB_WORD_THRESHOLD)
+    {
+        uint32_t  pattern = FLIB_WORD_PATTERN(value);
+        uint32_t *pWord;
+
+        while (!FLIB_IS_WORD_ALIGNED(pByte))
+        {
+            *pByte++ = value;
+            cBytes--;
+        }
+
+        pWord = (uint32_t *)(void *)pByte;
+        while (cBytes >= FLIB_UNROLL_BYTES)
+        {
+            pWord[0] = pattern;
+            pWord[1] = pattern;
+            pWord[2] = pattern;
+            pWord[3] = pattern;
+            pWord += 4;
+            cBytes -= FLIB_UNROLL_BYTES;
+        }
+        while (cBytes >= sizeof(uint32_t))
+        {
+            *pWord++ = pattern;
+            cBytes -= sizeof(uint32_t);
+        }
+        pByte = (uint8_t *)pWord;
+    }
+
     while (cBytes != 0UL)
     {
-        ((uint8_t *)pData)[--cBytes] = value;
+        *pByte++ = value;
+        cBytes--;
     }
 #endif
 }
@@ -567,50 +702,9 @@ uint32_t FLib_StrLen(const char *str)
  * \param[in]  cBytes  Number of bytes to copy
  *
  * \remarks
- *       If the size is a multiple of 4 bytes, the operation is done word by word.
- *       Assumes that pBuf is word aligned.
+ *       The operation is done word by word, the buffer doesn't need to be aligned.
  ********************************************************************************** */
 void FLib_ReverseByteOrderInPlace(void *buf, uint32_t cBytes)
 {
-    if (cBytes != 0UL)
-    {
-        uint32_t i;
-        uint32_t N_words = (cBytes / sizeof(uint32_t));
-        if ((N_words > 0u) && (cBytes == N_words * sizeof(uint32_t)))
-        {
-            /* cBytes is a multiple of sizeof(uint32_t) */
-            uint32_t  tmpU32;
-            uint32_t *p_st = (uint32_t *)buf;
-            uint32_t *p_nd = &p_st[N_words - 1u];
-            i              = N_words / 2u;
-            while (i > 0u)
-            {
-                tmpU32 = HAL_BSWAP32(*p_nd);
-                *p_nd  = HAL_BSWAP32(*p_st);
-                *p_st  = tmpU32;
-                p_nd--;
-                p_st++;
-                i--;
-            }
-            if ((N_words & 1u) != 0u)
-            {
-                tmpU32 = HAL_BSWAP32(*p_nd);
-                *p_st  = tmpU32;
-            }
-        }
-        else
-        {
-            uint8_t  tmpU8;
-            uint8_t *st    = buf;
-            uint8_t *l_end = &st[cBytes - 1u];
-            i              = cBytes / 2u;
-            while (i > 0u)
-            {
-                tmpU8    = *l_end;
-                *l_end-- = *st;
-                *st++    = tmpU8;
-                i--;
-            }
-        }
-    }
+    FLib_MemCpyReverseOrder(buf, buf, cBytes);
 }
@@ -106,7 +106,7 @@ void FLib_MemCpyDir(void *pBuf1, void *pBuf2, bool_t dir, uint32_t n);
  * \brief  Copy bytes. The byte at index i from the source buffer is copied to index
  *         ((n-1) - i) in the destination buffer (and vice versa).
  *
- * \param[out] pDst    Pointer to destination memory block
+ * \param[out] pDst    Pointer to destination memory block, can be equal to pSrc
  * \param[in]  pSrc    Pointer to source memory block
  * \param[in]  cBytes  Number of bytes to copy
  ********************************************************************************** */
@@ -252,8 +252,7 @@ uint32_t FLib_StrLen(const char *str);
  * \param[in]  cBytes  Number of bytes to copy
  *
  * \remarks
- *       If the size is a multiple of 4 bytes, the operation is done word by word.
- *       Assumes that pBuf is word aligned.
+ *       The operation is done word by word, the buffer doesn't need to be aligned.
  ********************************************************************************** */
 void FLib_ReverseByteOrderInPlace(void *buf, uint32_t cBytes);
 
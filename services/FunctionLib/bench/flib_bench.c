@@ -0,0 +1,338 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file flib_bench.c
+ * \brief Micro-benchmark of the FunctionLib memory primitives against the toolchain functions.
+ *
+ * The same file builds on the target, where FLIB_BENCH_Run() is called by the application, and on the host with
+ * services/FunctionLib/host/CMakeLists.txt, where FLIB_BENCH_MAIN adds a main() function.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <string.h>
+
+#include "EmbeddedTypes.h"
+#include "FunctionLib.h"
+#include "flib_bench.h"
+
+#ifndef FLIB_BENCH_PRINTF
+#include <stdio.h>
+#define FLIB_BENCH_PRINTF printf
+#endif
+
+#if !defined(FLIB_BENCH_GET_TIME)
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+#include "fsl_device_registers.h"
+#if !defined(DWT_CTRL_CYCCNTENA_Msk)
+#error No DWT cycle counter on this core, define FLIB_BENCH_GET_TIME
+#endif
+#define FLIB_BENCH_TIME_UNIT  "cycles"
+#define FLIB_BENCH_GET_TIME() (DWT->CYCCNT)
+#else
+#include <time.h>
+#define FLIB_BENCH_TIME_UNIT  "ns"
+#define FLIB_BENCH_GET_TIME() flib_bench_host_time()
+#endif
+#endif
+
+#ifndef FLIB_BENCH_TIME_UNIT
+#define FLIB_BENCH_TIME_UNIT "ticks"
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#define FLIB_BENCH_MAX_SIZE   1024U
+#define FLIB_BENCH_VERIFY_MAX 72U
+
+/* -------------------------------------------------------------------------- */
+/*                               Private types                                */
+/* -------------------------------------------------------------------------- */
+
+/* All the primitives are called through the same signature so that the call cost is the same for both sides */
+typedef uint32_t (*flib_bench_fn_t)(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+
+typedef struct
+{
+    const char     *name;
+    const char     *refName;
+    flib_bench_fn_t flib;
+    flib_bench_fn_t ref;
+} flib_bench_case_t;
+
+/* -------------------------------------------------------------------------- */
+/*                              Private prototypes                            */
+/* -------------------------------------------------------------------------- */
+
+static uint32_t flib_memcpy(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t tc_memcpy(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t flib_memset(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t tc_memset(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t flib_memcmp(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t tc_memcmp(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t flib_memcmptoval(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t ref_memcmptoval(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t flib_reverse(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t ref_reverse(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t flib_reverse_inplace(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+static uint32_t ref_reverse_inplace(uint8_t *pDst, const uint8_t *pSrc, uint32_t size);
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+/* the byte loop references stand for the previous FunctionLib implementations, the toolchain has no equivalent */
+static const flib_bench_case_t s_cases[] = {
+    {"FLib_MemCpy", "memcpy", flib_memcpy, tc_memcpy},
+    {"FLib_MemSet", "memset", flib_memset, tc_memset},
+    {"FLib_MemCmp", "memcmp", flib_memcmp, tc_memcmp},
+    {"FLib_MemCmpToVal", "byte loop", flib_memcmptoval, ref_memcmptoval},
+    {"FLib_MemCpyReverseOrder", "byte loop", flib_reverse, ref_reverse},
+    {"FLib_ReverseByteOrderInPlace", "byte loop", flib_reverse_inplace, ref_reverse_inplace},
+};
+
+static const uint32_t s_sizes[] = {4U, 16U, 32U, 64U, 256U, FLIB_BENCH_MAX_SIZE};
+
+/* a few extra bytes for the misaligned accesses */
+static uint32_t s_src[(FLIB_BENCH_MAX_SIZE / sizeof(uint32_t)) + 2U];
+static uint32_t s_dst[(FLIB_BENCH_MAX_SIZE / sizeof(uint32_t)) + 2U];
+static uint32_t s_ref[(FLIB_BENCH_MAX_SIZE / sizeof(uint32_t)) + 2U];
+
+/* results are accumulated here so that the calls are not removed */
+static volatile uint32_t s_sink;
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+#if !defined(__ARM_ARCH_PROFILE) || (__ARM_ARCH_PROFILE != 'M')
+static uint32_t flib_bench_host_time(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec);
+}
+#endif
+
+static uint32_t flib_memcpy(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    FLib_MemCpy(pDst, pSrc, size);
+    return 0U;
+}
+
+static uint32_t tc_memcpy(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    (void)memcpy(pDst, pSrc, size);
+    return 0U;
+}
+
+static uint32_t flib_memset(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    FLib_MemSet(pDst, 0xA5U, size);
+    return 0U;
+}
+
+static uint32_t tc_memset(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    (void)memset(pDst, 0xA5, size);
+    return 0U;
+}
+
+static uint32_t flib_memcmp(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    return (uint32_t)FLib_MemCmp(pDst, pSrc, size);
+}
+
+static uint32_t tc_memcmp(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    return (memcmp(pDst, pSrc, size) == 0) ? 1U : 0U;
+}
+
+static uint32_t flib_memcmptoval(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    return (uint32_t)FLib_MemCmpToVal(pSrc, 0xFFU, size);
+}
+
+static uint32_t ref_memcmptoval(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    uint32_t ret = 1U;
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        if (pSrc[i] != 0xFFU)
+        {
+            ret = 0U;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+static uint32_t flib_reverse(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    FLib_MemCpyReverseOrder(pDst, pSrc, size);
+    return 0U;
+}
+
+static uint32_t ref_reverse(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        pDst[size - 1U - i] = pSrc[i];
+    }
+    return 0U;
+}
+
+static uint32_t flib_reverse_inplace(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    FLib_ReverseByteOrderInPlace(pDst, size);
+    return 0U;
+}
+
+static uint32_t ref_reverse_inplace(uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    for (uint32_t i = 0U; i < (size / 2U); i++)
+    {
+        uint8_t tmp = pDst[i];
+
+        pDst[i]             = pDst[size - 1U - i];
+        pDst[size - 1U - i] = tmp;
+    }
+    return 0U;
+}
+
+static void flib_bench_fill(void)
+{
+    uint8_t *pSrc = (uint8_t *)s_src;
+
+    for (uint32_t i = 0U; i < sizeof(s_src); i++)
+    {
+        pSrc[i] = (uint8_t)((i * 7U) + 1U);
+    }
+    (void)memcpy(s_dst, s_src, sizeof(s_dst));
+}
+
+/* Calls both sides on the same data and compares the results and the destination buffers */
+static int flib_bench_verify(void)
+{
+    int ret = 0;
+
+    for (uint32_t c = 0U; c < (sizeof(s_cases) / sizeof(s_cases[0])); c++)
+    {
+        for (uint32_t size = 0U; size <= FLIB_BENCH_VERIFY_MAX; size++)
+        {
+            for (uint32_t offset = 0U; offset < (sizeof(uint32_t) * sizeof(uint32_t)); offset++)
+            {
+                uint32_t srcOffset = offset % sizeof(uint32_t);
+                uint32_t dstOffset = offset / sizeof(uint32_t);
+                uint8_t *pSrc      = (uint8_t *)s_src + srcOffset;
+                uint32_t r1;
+                uint32_t r2;
+
+                flib_bench_fill();
+                /* one different byte at the end for the compare functions */
+                if ((size != 0U) && ((c == 2U) || (c == 3U)))
+                {
+                    (void)memset(pSrc, 0xFF, size);
+                    (void)memcpy((uint8_t *)s_dst + dstOffset, pSrc, size);
+                    pSrc[size - 1U] = (uint8_t)((offset & 1U) == 0U ? 0xFEU : 0xFFU);
+                }
+                (void)memcpy(s_ref, s_dst, sizeof(s_ref));
+
+                r1 = s_cases[c].flib((uint8_t *)s_dst + dstOffset, pSrc, size);
+                r2 = s_cases[c].ref((uint8_t *)s_ref + dstOffset, pSrc, size);
+                if ((r1 != r2) || (memcmp(s_dst, s_ref, sizeof(s_dst)) != 0))
+                {
+                    FLIB_BENCH_PRINTF("verify: %s failed, size %u, src offset %u, dst offset %u\r\n", s_cases[c].name,
+                                      (unsigned int)size, (unsigned int)srcOffset, (unsigned int)dstOffset);
+                    ret = -1;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+static uint32_t flib_bench_measure(flib_bench_fn_t fn, uint8_t *pDst, const uint8_t *pSrc, uint32_t size)
+{
+    uint32_t start;
+    uint32_t sink = 0U;
+
+    start = FLIB_BENCH_GET_TIME();
+    for (uint32_t i = 0U; i < FLIB_BENCH_ITERATIONS; i++)
+    {
+        sink += fn(pDst, pSrc, size);
+    }
+    start = FLIB_BENCH_GET_TIME() - start;
+    s_sink += sink;
+
+    return start;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+int FLIB_BENCH_Run(void)
+{
+    int ret;
+
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M') && defined(DWT_CTRL_CYCCNTENA_Msk)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    ret = flib_bench_verify();
+    FLIB_BENCH_PRINTF("verify: %s\r\n", (ret == 0) ? "ok" : "FAILED");
+
+    FLIB_BENCH_PRINTF("%-30s %6s %6s %12s %12s\r\n", "function", "size", "align", "FunctionLib", "reference");
+    for (uint32_t c = 0U; c < (sizeof(s_cases) / sizeof(s_cases[0])); c++)
+    {
+        for (uint32_t s = 0U; s < (sizeof(s_sizes) / sizeof(s_sizes[0])); s++)
+        {
+            /* aligned source, then source misaligned by one byte */
+            for (uint32_t offset = 0U; offset < 2U; offset++)
+            {
+                uint8_t *pSrc = (uint8_t *)s_src + offset;
+                uint32_t flib;
+                uint32_t ref;
+
+                flib_bench_fill();
+                if ((c == 2U) || (c == 3U))
+                {
+                    /* worst case of the compare functions, the buffers are equal */
+                    (void)memset(pSrc, 0xFF, s_sizes[s]);
+                    (void)memset(s_dst, 0xFF, sizeof(s_dst));
+                }
+
+                flib = flib_bench_measure(s_cases[c].flib, (uint8_t *)s_dst, pSrc, s_sizes[s]);
+                ref  = flib_bench_measure(s_cases[c].ref, (uint8_t *)s_dst, pSrc, s_sizes[s]);
+                FLIB_BENCH_PRINTF("%-30s %6u %6s %12u %12u %s/call (reference: %s)\r\n", s_cases[c].name,
+                                  (unsigned int)s_sizes[s], (offset == 0U) ? "word" : "byte",
+                                  (unsigned int)(flib / FLIB_BENCH_ITERATIONS),
+                                  (unsigned int)(ref / FLIB_BENCH_ITERATIONS), FLIB_BENCH_TIME_UNIT,
+                                  s_cases[c].refName);
+            }
+        }
+    }
+
+    return ret;
+}
+
+#if defined(FLIB_BENCH_MAIN)
+int main(void)
+{
+    return (FLIB_BENCH_Run() == 0) ? 0 : 1;
+}
+#endif
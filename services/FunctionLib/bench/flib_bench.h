@@ -0,0 +1,39 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file flib_bench.h
+ * \brief Micro-benchmark of the FunctionLib memory primitives against the toolchain functions.
+ *
+ */
+
+#ifndef _FLIB_BENCH_H_
+#define _FLIB_BENCH_H_
+
+/* -------------------------------------------------------------------------- */
+/*                                Public macros                               */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Number of calls measured for each function, size and alignment
+ */
+#ifndef FLIB_BENCH_ITERATIONS
+#define FLIB_BENCH_ITERATIONS 1000U
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Checks the FunctionLib primitives against reference implementations, then prints the average duration of a
+ *        call for each function, size and source alignment, with the toolchain or byte loop reference next to it.
+ *
+ * On Cortex-M targets the durations are in cycles of the DWT counter, on the host in ns. The results are printed with
+ * FLIB_BENCH_PRINTF, printf by default.
+ *
+ * \return 0 if the FunctionLib results match the references, -1 otherwise.
+ */
+int FLIB_BENCH_Run(void);
+
+#endif /* _FLIB_BENCH_H_ */
@@ -1066,6 +1066,65 @@ extern void NvShutdown(void);
  ********************************************************************************* */
 extern void NvCompletePendingOperations(void);
 
+/*! *********************************************************************************
+ * \brief Reads the raw content of the NV storage (both virtual pages) for diagnostics.
+ *
+ * \param[in] offset offset from the start of the first virtual page
+ * \param[out] pBuf destination buffer
+ * \param[in] size number of bytes to read
+ *
+ * \return gNVM_OK_c: if the operation completes successfully\n
+ *         gNVM_ModuleNotInitialized_c: if the NVM module is not initialized\n
+ *         gNVM_PointerOutOfRange_c: if the range is outside of the NV storage\n
+ *         gNVM_EccFault_c: if an ECC fault was detected
+ ********************************************************************************* */
+extern NVM_Status_t NvRawStorageRead(uint32_t offset, uint8_t *pBuf, uint32_t size);
+
+/*! *********************************************************************************
+ * \brief Starts overwriting the NV storage with a raw image.
+ *
+ * \details Pending operations are completed and both virtual pages are erased.
+ *          The module rejects all the requests until NvRawStorageRestoreEnd() is called.
+ *
+ * \return gNVM_OK_c: if the operation completes successfully\n
+ *         gNVM_ModuleNotInitialized_c: if the NVM module is not initialized\n
+ *         gNVM_SectorEraseFail_c: if the storage could not be erased
+ ********************************************************************************* */
+extern NVM_Status_t NvRawStorageRestoreStart(void);
+
+/*! *********************************************************************************
+ * \brief Programs a chunk of the raw image.
+ *
+ * \details Chunks must not overlap and all but the last one must be a multiple of the
+ *          flash program size.
+ *
+ * \param[in] offset offset from the start of the first virtual page
+ * \param[in] pBuf data to be programmed
+ * \param[in] size number of bytes to program
+ *
+ * \return gNVM_OK_c: if the operation completes successfully\n
+ *         gNVM_Error_c: if no restore is in progress\n
+ *         gNVM_PointerOutOfRange_c: if the range is outside of the NV storage\n
+ *         gNVM_RecordWriteError_c: if the flash could not be programmed
+ ********************************************************************************* */
+extern NVM_Status_t NvRawStorageRestoreWrite(uint32_t offset, uint8_t *pBuf, uint32_t size);
+
+/*! *********************************************************************************
+ * \brief Ends a raw image restore and reinitializes the module from the storage.
+ *
+ * \details On commit the mirrored datasets are reloaded in RAM from the new image.
+ *          Otherwise the storage is formatted and the datasets held in RAM are saved again:
+ *          all the mirrored datasets and the unmirrored elements loaded in RAM. The unmirrored
+ *          elements that were only in flash are lost.
+ *
+ * \param[in] commit TRUE if the whole image was written and verified
+ *
+ * \return gNVM_OK_c: if the operation completes successfully\n
+ *         gNVM_Error_c: if no restore is in progress\n
+ *         other status returned by the module initialization or the save of the datasets
+ ********************************************************************************* */
+extern NVM_Status_t NvRawStorageRestoreEnd(bool_t commit);
+
 /*! *********************************************************************************
  *  \brief Reads a flash entry so that the application can handle dynamic entries.
  *
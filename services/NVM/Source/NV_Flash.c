@@ -12,6 +12,7 @@
 #include "EmbeddedTypes.h"
 #include "NV_Flash.h"
 #include "fsl_adapter_flash.h"
+#include "fwk_blank_check.h"
 #include "FunctionLib.h"
 #include "fsl_os_abstraction.h"
 
@@ -22,6 +23,10 @@
 
 #if gUnmirroredFeatureSet_d
 #include "fsl_component_mem_manager.h"
+
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+#include "fwk_mem_track.h"
+#endif
 #endif
 
 #if ((defined(gNvmEnableFSCIMonitoring_c)) && (gNvmEnableFSCIMonitoring_c > 0U))
@@ -903,6 +908,12 @@ NVM_STATIC NVM_ErasePageCmdStatus_t mNvErasePgCmdStatus;
  */
 NVM_STATIC bool_t mNvFlashConfigInitialised = FALSE;
 
+/*
+ * Name: mNvRawRestoreActive
+ * Description: set while a raw storage image is being written, see NvRawStorageRestoreStart()
+ */
+NVM_STATIC bool_t mNvRawRestoreActive = FALSE;
+
 #if (defined gNvSalvageFromEccFault_d) && (gNvSalvageFromEccFault_d > 0)
 NVM_STATIC NVM_EccFaultNotifyCb_t nv_fault_report_cb = NULL;
 #endif
@@ -2091,10 +2102,8 @@ NVM_STATIC int __NvIdle(void)
                                            (uint32_t)((uint8_t *)NV_STORAGE_SECTOR_SIZE));
 
                 /* blank check */
-                if (kStatus_HAL_Flash_Success == HAL_FlashVerifyErase(mNvErasePgCmdStatus.NvSectorAddress,
-                                                                      (uint32_t)NV_STORAGE_SECTOR_SIZE,
-                                                                      kHAL_Flash_MarginValueNormal))
-
+                if (BLANK_CHECK_InternalFlash(mNvErasePgCmdStatus.NvSectorAddress, (uint32_t)NV_STORAGE_SECTOR_SIZE,
+                                              kHAL_Flash_MarginValueNormal))
                 {
                     mNvErasePgCmdStatus.NvSectorAddress += (uint32_t)((uint8_t *)NV_STORAGE_SECTOR_SIZE);
                     ret = TRUE;
@@ -3353,13 +3362,13 @@ NVM_STATIC void NvPostFwUpdateMaintenance(void)
             if (top_count == gPageCounterMaxValue_c)
             {
                 /* we read 0xffffffffU from the flash: it either means that it is blank / erased or written with
-                 * 0xffffffff . HAL_FlashVerifyErase does not make the difference!
+                 * 0xffffffff . the verify erase command does not make the difference!
                  */
                 bool_t erase_req = FALSE;
                 if (!page_props->has_ecc_faults)
                 {
-                    if (HAL_FlashVerifyErase(page_props->NvRawSectorStartAddress, page_props->NvTotalPageSize,
-                                             kHAL_Flash_MarginValueNormal) == kStatus_HAL_Flash_Success)
+                    if (BLANK_CHECK_InternalFlash(page_props->NvRawSectorStartAddress, page_props->NvTotalPageSize,
+                                                  kHAL_Flash_MarginValueNormal))
                     {
                         continue;
                     }
@@ -3666,9 +3675,8 @@ NVM_STATIC NVM_Status_t NvVirtualPageBlankCheck(NVM_VirtualPageID_t pageID)
     else
     {
         /* blank check */
-        if (kStatus_HAL_Flash_Success != HAL_FlashVerifyErase(mNvVirtualPageProperty[pageID].NvRawSectorStartAddress,
-                                                              mNvVirtualPageProperty[pageID].NvTotalPageSize,
-                                                              kHAL_Flash_MarginValueNormal))
+        if (!BLANK_CHECK_InternalFlash(mNvVirtualPageProperty[pageID].NvRawSectorStartAddress,
+                                       mNvVirtualPageProperty[pageID].NvTotalPageSize, kHAL_Flash_MarginValueNormal))
         {
             status = gNVM_PageIsNotBlank_c;
         }
@@ -3905,7 +3913,7 @@ NVM_STATIC bool_t NvIsMemoryAreaAvailable(uint32_t address, uint32_t len)
             else
             {
                 /* blank check */
-                if (kStatus_HAL_Flash_Success != HAL_FlashVerifyErase(address, len, kHAL_Flash_MarginValueNormal))
+                if (!BLANK_CHECK_InternalFlash(address, len, kHAL_Flash_MarginValueNormal))
                 {
                     status = FALSE;
                 }
@@ -6979,6 +6987,7 @@ void NvModuleDeInit(void)
     mNvErasePgCmdStatus.NvSectorAddress = 0U;
 
     mNvFlashConfigInitialised = FALSE;
+    mNvRawRestoreActive       = FALSE;
 
 #if gNvFragmentation_Enabled_d
     FLib_MemSet((void *)&maNvRecordsCpyOffsets[0], 0U, sizeof(maNvRecordsCpyOffsets));
@@ -7673,6 +7682,205 @@ void NvCompletePendingOperations(void)
 #endif
 }
 
+/******************************************************************************
+ * Name: NvRawStorageRead
+ * Description: Reads the raw content of the NV storage (both virtual pages),
+ *              regardless of the records layout. Used for diagnostic snapshots.
+ * Parameter(s): [IN] offset - offset from the start of the first virtual page
+ *               [OUT] pBuf - destination buffer
+ *               [IN] size - number of bytes to read
+ * Return: gNVM_OK_c - if operation completed successfully
+ *         gNVM_ModuleNotInitialized_c - if the NVM module is not initialised
+ *         gNVM_NullPointer_c - if a NULL pointer is provided
+ *         gNVM_PointerOutOfRange_c - if the range is outside of the NV storage
+ *         gNVM_EccFault_c - if an ECC fault was detected while reading
+ *****************************************************************************/
+NVM_Status_t NvRawStorageRead(uint32_t offset, uint8_t *pBuf, uint32_t size)
+{
+#if gNvStorageIncluded_d
+    NVM_Status_t status;
+    uint32_t     storageStart = mNvVirtualPageProperty[gFirstVirtualPage_c].NvRawSectorStartAddress;
+    uint32_t     storageSize  = mNvVirtualPageProperty[gSecondVirtualPage_c].NvRawSectorEndAddress + 1U - storageStart;
+
+    if (!mNvModuleInitialized)
+    {
+        status = gNVM_ModuleNotInitialized_c;
+    }
+    else if (NULL == pBuf)
+    {
+        status = gNVM_NullPointer_c;
+    }
+    else if ((offset > storageSize) || (size > (storageSize - offset)))
+    {
+        status = gNVM_PointerOutOfRange_c;
+    }
+    else
+    {
+        (void)OSA_MutexLock(mNVMMutexId, osaWaitForever_c);
+        status = NV_FlashRead(storageStart + offset, pBuf, size, TRUE);
+        (void)OSA_MutexUnlock(mNVMMutexId);
+    }
+    return status;
+#else
+    (void)offset;
+    (void)pBuf;
+    (void)size;
+    return gNVM_Error_c;
+#endif
+}
+
+/******************************************************************************
+ * Name: NvRawStorageRestoreStart
+ * Description: Prepares the NV storage to be overwritten by a raw image.
+ *              Pending operations are completed, then both virtual pages are
+ *              erased. Until NvRawStorageRestoreEnd() is called, the module
+ *              behaves as not initialised and rejects all the requests.
+ * Parameter(s): -
+ * Return: gNVM_OK_c - if operation completed successfully
+ *         gNVM_ModuleNotInitialized_c - if the NVM module is not initialised
+ *         gNVM_SectorEraseFail_c - if a virtual page could not be erased
+ *****************************************************************************/
+NVM_Status_t NvRawStorageRestoreStart(void)
+{
+#if gNvStorageIncluded_d
+    NVM_Status_t status = gNVM_OK_c;
+
+    if (!mNvModuleInitialized)
+    {
+        status = gNVM_ModuleNotInitialized_c;
+    }
+    else
+    {
+        (void)OSA_MutexLock(mNVMMutexId, osaWaitForever_c);
+        __NvShutdown();
+        mNvModuleInitialized = FALSE;
+        mNvRawRestoreActive  = TRUE;
+        for (uint8_t pageID = (uint8_t)gFirstVirtualPage_c; pageID < gVirtualPageNb_c; pageID++)
+        {
+            status = NvEraseVirtualPage((NVM_VirtualPageID_t)pageID);
+            if (gNVM_OK_c != status)
+            {
+                break;
+            }
+        }
+        (void)OSA_MutexUnlock(mNVMMutexId);
+    }
+    return status;
+#else
+    return gNVM_Error_c;
+#endif
+}
+
+/******************************************************************************
+ * Name: NvRawStorageRestoreWrite
+ * Description: Programs a chunk of the raw image started with
+ *              NvRawStorageRestoreStart(). Chunks must not overlap and all but
+ *              the last one must be a multiple of the flash program size.
+ * Parameter(s): [IN] offset - offset from the start of the first virtual page
+ *               [IN] pBuf - data to be programmed
+ *               [IN] size - number of bytes to program
+ * Return: gNVM_OK_c - if operation completed successfully
+ *         gNVM_Error_c - if no restore is in progress
+ *         gNVM_NullPointer_c - if a NULL pointer is provided
+ *         gNVM_PointerOutOfRange_c - if the range is outside of the NV storage
+ *         gNVM_RecordWriteError_c - if the flash could not be programmed
+ *****************************************************************************/
+NVM_Status_t NvRawStorageRestoreWrite(uint32_t offset, uint8_t *pBuf, uint32_t size)
+{
+#if gNvStorageIncluded_d
+    NVM_Status_t status;
+    uint32_t     storageStart = mNvVirtualPageProperty[gFirstVirtualPage_c].NvRawSectorStartAddress;
+    uint32_t     storageSize  = mNvVirtualPageProperty[gSecondVirtualPage_c].NvRawSectorEndAddress + 1U - storageStart;
+
+    if (!mNvRawRestoreActive)
+    {
+        status = gNVM_Error_c;
+    }
+    else if (NULL == pBuf)
+    {
+        status = gNVM_NullPointer_c;
+    }
+    else if ((offset > storageSize) || (size > (storageSize - offset)))
+    {
+        status = gNVM_PointerOutOfRange_c;
+    }
+    else
+    {
+        (void)OSA_MutexLock(mNVMMutexId, osaWaitForever_c);
+        status = NV_FlashProgramUnaligned(storageStart + offset, size, pBuf, FALSE);
+        (void)OSA_MutexUnlock(mNVMMutexId);
+    }
+    return status;
+#else
+    (void)offset;
+    (void)pBuf;
+    (void)size;
+    return gNVM_Error_c;
+#endif
+}
+
+/******************************************************************************
+ * Name: NvRawStorageRestoreEnd
+ * Description: Ends a raw image restore and reinitialises the module from the
+ *              new storage content. The mirrored datasets are reloaded in RAM.
+ *              If the restore is cancelled, the storage is erased again,
+ *              formatted, and every dataset held in RAM is saved back: all the
+ *              mirrored datasets and the unmirrored elements loaded in RAM.
+ *              Unmirrored elements that were only in flash are lost.
+ * Parameter(s): [IN] commit - TRUE if the whole image was written and verified
+ * Return: gNVM_OK_c - if operation completed successfully
+ *         gNVM_Error_c - if no restore is in progress
+ *         other status returned by the module initialisation or the datasets save
+ *****************************************************************************/
+NVM_Status_t NvRawStorageRestoreEnd(bool_t commit)
+{
+#if gNvStorageIncluded_d
+    NVM_Status_t status = gNVM_OK_c;
+
+    if (!mNvRawRestoreActive)
+    {
+        status = gNVM_Error_c;
+    }
+    else
+    {
+        (void)OSA_MutexLock(mNVMMutexId, osaWaitForever_c);
+        if (!commit)
+        {
+            for (uint8_t pageID = (uint8_t)gFirstVirtualPage_c; pageID < gVirtualPageNb_c; pageID++)
+            {
+                (void)NvEraseVirtualPage((NVM_VirtualPageID_t)pageID);
+            }
+        }
+        /* Scan the storage again to find the active page of the new image */
+        mNvFlashConfigInitialised = FALSE;
+        status                    = __NvModuleInit(FALSE);
+        mNvRawRestoreActive       = FALSE;
+
+        if ((gNVM_OK_c == status) && !commit)
+        {
+            /* The format only wrote the NV table, the RAM content was not changed by the restore */
+            status = __NvAtomicSave();
+        }
+        else if ((gNVM_OK_c == status) && commit)
+        {
+            for (uint16_t idx = 0U; idx < mNVM_DataTableNbEntries; idx++)
+            {
+                if ((pNVM_DataTable[idx].DataEntryType == (uint16_t)gNVM_MirroredInRam_c) &&
+                    (pNVM_DataTable[idx].DataEntryID != gNvInvalidDataEntry_c))
+                {
+                    (void)__NvRestoreDataSet(pNVM_DataTable[idx].pData, TRUE);
+                }
+            }
+        }
+        (void)OSA_MutexUnlock(mNVMMutexId);
+    }
+    return status;
+#else
+    (void)commit;
+    return gNVM_Error_c;
+#endif
+}
+
 /******************************************************************************
  * Name: NvRegisterEccFaultNotificationCb
  * Description: Register fault notification callback.
@@ -28,11 +28,21 @@
 #include "FsciInterface.h"
 #include "NV_FsciCommands.h"
 
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+#include "fwk_mem_track.h"
+#endif
+
 /******************************************************************************
 *******************************************************************************
 * Private functions prototype
 ******************************************************************************
 ******************************************************************************/
+#if gNvmEnableFSCIRequests_c && gFsciBulkTransfer_c
+static gFsciStatus_t NV_FsciBulkStart(uint32_t address, uint32_t size, bool_t write);
+static gFsciStatus_t NV_FsciBulkRead(uint32_t address, uint8_t *pBuf, uint16_t len);
+static gFsciStatus_t NV_FsciBulkWrite(uint32_t address, uint8_t *pBuf, uint16_t len);
+static void          NV_FsciBulkEnd(bool_t commit);
+#endif
 
 /*****************************************************************************
 *****************************************************************************
@@ -43,6 +53,17 @@
 bool_t nvmMonitorOn = FALSE;
 #endif
 
+#if gNvmEnableFSCIRequests_c && gFsciBulkTransfer_c
+/* Raw NV storage access through the FSCI bulk transfer commands: snapshot and image restore */
+static const fsciBulkTarget_t mNvFsciBulkTarget = {
+    .pfStart = NV_FsciBulkStart,
+    .pfRead  = NV_FsciBulkRead,
+    .pfWrite = NV_FsciBulkWrite,
+    .pfEnd   = NV_FsciBulkEnd,
+};
+static bool_t mNvFsciBulkRestore = FALSE;
+#endif
+
 /*****************************************************************************
 *****************************************************************************
 * Public functions
@@ -59,6 +80,9 @@ bool_t nvmMonitorOn = FALSE;
 void NV_RegisterToFSCI(void)
 {
     FSCI_RegisterOpGroup(gNV_FsciReqOG_d, gFsciMonitorMode_c, NV_FsciMsgHandler, NULL, gNvmDefaultFsciInterface_c);
+#if gFsciBulkTransfer_c
+    (void)FSCI_BulkRegisterTarget(gFsciBulkTargetNvm_c, &mNvFsciBulkTarget);
+#endif
 }
 
 void NV_FsciMsgHandler(void *pData, void *param, uint32_t fsciInterface)
@@ -360,6 +384,87 @@ bool_t FSCI_MsgNVRestoreReq(void *pData, uint32_t fsciInterface)
     ((clientPacket_t *)pData)->structured.payload[0] = status;
     return TRUE;
 }
+
+#if gFsciBulkTransfer_c
+/******************************************************************************
+Name: NV_FsciBulkStart
+Description: Bulk transfer target start. Reads may cover any part of the two
+             virtual pages. Writes must provide a full storage image, which is
+             erased before the first chunk is received.
+In:
+address - offset in the NV storage
+size - number of bytes to transfer
+write - TRUE to restore an image
+Out:
+gFsciSuccess_c if the transfer can start
+******************************************************************************/
+static gFsciStatus_t NV_FsciBulkStart(uint32_t address, uint32_t size, bool_t write)
+{
+    gFsciStatus_t status = gFsciError_c;
+    uint32_t      storageSize;
+
+    /* The storage is made of two virtual pages */
+    NvGetPagesSize(&storageSize);
+    storageSize *= 2U;
+
+    if (write)
+    {
+        if ((address == 0U) && (size == storageSize))
+        {
+            if (gNVM_OK_c == NvRawStorageRestoreStart())
+            {
+                mNvFsciBulkRestore = TRUE;
+                status             = gFsciSuccess_c;
+            }
+            else
+            {
+                (void)NvRawStorageRestoreEnd(FALSE);
+            }
+        }
+    }
+    else if ((address < storageSize) && (size <= (storageSize - address)))
+    {
+        /* Flush the queued saves so that the snapshot matches the RAM content */
+        NvCompletePendingOperations();
+        status = gFsciSuccess_c;
+    }
+
+    return status;
+}
+
+/******************************************************************************
+Name: NV_FsciBulkRead
+Description: Bulk transfer target read, copies raw NV storage content.
+******************************************************************************/
+static gFsciStatus_t NV_FsciBulkRead(uint32_t address, uint8_t *pBuf, uint16_t len)
+{
+    return (gNVM_OK_c == NvRawStorageRead(address, pBuf, len)) ? gFsciSuccess_c : gFsciError_c;
+}
+
+/******************************************************************************
+Name: NV_FsciBulkWrite
+Description: Bulk transfer target write, programs a chunk of the image.
+******************************************************************************/
+static gFsciStatus_t NV_FsciBulkWrite(uint32_t address, uint8_t *pBuf, uint16_t len)
+{
+    return (gNVM_OK_c == NvRawStorageRestoreWrite(address, pBuf, len)) ? gFsciSuccess_c : gFsciError_c;
+}
+
+/******************************************************************************
+Name: NV_FsciBulkEnd
+Description: Bulk transfer target end. A restored image is used only if it was
+             fully received with a valid CRC, otherwise the storage is formatted
+             with the current RAM content.
+******************************************************************************/
+static void NV_FsciBulkEnd(bool_t commit)
+{
+    if (mNvFsciBulkRestore)
+    {
+        mNvFsciBulkRestore = FALSE;
+        (void)NvRawStorageRestoreEnd(commit);
+    }
+}
+#endif /* gFsciBulkTransfer_c */
 #endif
 
 #if gNvmEnableFSCIMonitoring_c
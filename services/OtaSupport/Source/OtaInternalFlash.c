@@ -11,6 +11,7 @@
 #include "FunctionLib.h"
 #include "OtaPrivate.h"
 #include "fsl_adapter_flash.h"
+#include "fwk_blank_check.h"
 #include "fwk_platform_ota.h"
 #include <stdbool.h>
 
@@ -386,6 +387,7 @@ static uint8_t InternalFlash_isBusy(void)
 
 /*! *********************************************************************************
  * \brief  Erase sector identified by its number in OTA partition.
+ *         The erase is skipped if the sector is blank at the user margin.
  *
  * \return    kStatus_OTA_Flash_Success if operation successful,
               kStatus_OTA_Flash_Error  otherwise.
@@ -394,10 +396,16 @@ static uint8_t InternalFlash_isBusy(void)
 static ota_flash_status_t InternalFlash_EraseBlockBySectorNumber(uint32_t blk_nb)
 {
     ota_flash_status_t status = kStatus_OTA_Flash_Error;
-    hal_flash_status_t st;
+    hal_flash_status_t st     = kStatus_HAL_Flash_Success;
+    uint32_t           sector_addr;
     assert(blk_nb < (ota_internal_partition->size / ota_internal_partition->sector_size));
-    st = HAL_FlashEraseSector(PHYS_ADDR(blk_nb * ota_internal_partition->sector_size),
-                              ota_internal_partition->sector_size);
+    sector_addr = PHYS_ADDR(blk_nb * ota_internal_partition->sector_size);
+    /* A verify erase is much shorter than a sector erase and saves an erase cycle of the flash. The user margin
+     * also detects the partially erased or weakly programmed cells that still read as blank at the normal level */
+    if (!BLANK_CHECK_InternalFlash(sector_addr, ota_internal_partition->sector_size, kHAL_Flash_MarginValueUser))
+    {
+        st = HAL_FlashEraseSector(sector_addr, ota_internal_partition->sector_size);
+    }
     if (kStatus_HAL_Flash_Success == st)
     {
         /* mark each erased sector as such in the erase bit map */
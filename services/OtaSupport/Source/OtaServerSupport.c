@@ -15,6 +15,10 @@
 #include "FunctionLib.h"
 #include "fsl_component_mem_manager.h"
 
+#if defined(CONFIG_FWK_MEM_TRACK) && (CONFIG_FWK_MEM_TRACK > 0)
+#include "fwk_mem_track.h"
+#endif
+
 #include "OtaSupport.h"
 
 #if 0
@@ -28,6 +28,40 @@
 *************************************************************************************
 ********************************************************************************** */
 
+/*! Number of words of the bitsliced AES-128 key schedule, 8 per round key */
+#define SW_AES128_CT_SKEY_WORDS 88U
+
+/*! Key schedule of the constant time AES-128, see sw_aes128_ct_set_key() */
+typedef struct sw_aes128_ct_ctx_tag
+{
+    uint32_t skey[SW_AES128_CT_SKEY_WORDS];
+} sw_aes128_ct_ctx_t;
+
+/*! Number of precomputed odd multiples P, 3P, ... 15P of the signed window multiplication */
+#define SW_ECP256_WINDOW_POINTS 8U
+
+/*! Number of signed window digits of a scalar, the comb uses the first 64 */
+#define SW_ECP256_DIGITS 65U
+
+/*! P-256 point in projective coordinates (X:Y:Z), the coordinates in Montgomery form */
+typedef struct sw_ecp256_point_tag
+{
+    uint32_t x[SEC_ECP256_COORDINATE_WLEN];
+    uint32_t y[SEC_ECP256_COORDINATE_WLEN];
+    uint32_t z[SEC_ECP256_COORDINATE_WLEN];
+} sw_ecp256_point_t;
+
+/*! State of a P-256 scalar multiplication, see sw_ecp256_mul_base_start() and sw_ecp256_mul_start() */
+typedef struct sw_ecp256_mul_ctx_tag
+{
+    sw_ecp256_point_t acc;                            /* accumulator */
+    sw_ecp256_point_t table[SW_ECP256_WINDOW_POINTS]; /* odd multiples of the point, unused by the comb */
+    int8_t            digits[SW_ECP256_DIGITS];       /* signed window digits, or comb digits of the scalar */
+    uint8_t           remaining;                      /* iterations left, 4 bits of window or 8 bits of comb */
+    uint8_t           fixedBase;                      /* TRUE for the comb on G */
+    uint8_t           negate;                         /* the scalar was even, the result is negated */
+} sw_ecp256_mul_ctx_t;
+
 /************************************************************************************
 *************************************************************************************
 * Public prototypes
@@ -46,6 +80,11 @@ void sw_sha1_hash_n(uint8_t *msg_data, int32_t num_blks, uint32_t *sha1_state);
 void sw_sha256_initialize_output(uint32_t *sha256_state);
 void sw_sha256_hash_n(const uint8_t *msg_data, int32_t num_blks, uint32_t *sha256_state);
 
+/* SHA256 in-tree unrolled implementation (SecLib_sha256.c), same state format as the library */
+
+void sw_sha256_unrolled_initialize_output(uint32_t *sha256_state);
+void sw_sha256_unrolled_hash_n(const uint8_t *msg_data, int32_t num_blks, uint32_t *sha256_state);
+
 /* AES128 */
 void    CCM_CreateA0(uint8_t *pData, const uint8_t *nonce, uint8_t size);
 void    sw_Aes128(const uint8_t *pData, const uint8_t *pKey, uint8_t enc, uint8_t *pReturnData);
@@ -61,9 +100,43 @@ uint8_t sw_AES128_CCM(const uint8_t *pInput,
                       uint8_t        macSize,
                       uint32_t       flags);
 
+/* AES128 constant time SW implementation, SecLib_aes_ct.c, built with gSecLibAesCtEnable_d.
+ * The functions process two blocks at once when the mode allows it, the counter and IV are updated for the next
+ * call. The context is only read, it can be shared by several tasks. */
+void sw_aes128_ct_set_key(sw_aes128_ct_ctx_t *pCtx, const uint8_t *pKey);
+void sw_aes128_ct_ecb_encrypt(const sw_aes128_ct_ctx_t *pCtx,
+                              const uint8_t            *pInput,
+                              uint8_t                  *pOutput,
+                              uint32_t                  numBlocks);
+void sw_aes128_ct_ecb_decrypt(const sw_aes128_ct_ctx_t *pCtx,
+                              const uint8_t            *pInput,
+                              uint8_t                  *pOutput,
+                              uint32_t                  numBlocks);
+void sw_aes128_ct_cbc_encrypt(
+    const sw_aes128_ct_ctx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput, uint32_t numBlocks, uint8_t *pIv);
+void sw_aes128_ct_cbc_decrypt(
+    const sw_aes128_ct_ctx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput, uint32_t numBlocks, uint8_t *pIv);
+/* CBC-MAC chaining: pMac := E(pMac ^ block) for each block */
+void sw_aes128_ct_cbc_mac(const sw_aes128_ct_ctx_t *pCtx, const uint8_t *pInput, uint32_t numBlocks, uint8_t *pMac);
+/* Any length, the counter is incremented once per block, a partial last block included */
+void sw_aes128_ct_ctr(
+    const sw_aes128_ct_ctx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput, uint32_t inputLen, uint8_t *pCounter);
+
 /* EC_P_256 */
 extern const uint32_t gEcP256_MultiplicationBufferSize_c;
 
+/* EC_P_256 constant time in-tree scalar multiplication, SecLib_ecp256_comb.c, built with gSecLibEcp256CombEnable_d.
+ * Scalars and coordinates are little endian, as the ECDH_P256 functions. A multiplication is started, stepped until
+ * sw_ecp256_mul_step() returns true, numBits scalar bits at a time, and finished, which erases the context. Points are
+ * the 32 bytes x followed by the 32 bytes y. */
+secEcp256Status_t sw_ecp256_mul_base_start(sw_ecp256_mul_ctx_t *pCtx, const uint8_t pScalar[SEC_ECP256_SCALAR_LEN]);
+secEcp256Status_t sw_ecp256_mul_start(sw_ecp256_mul_ctx_t *pCtx,
+                                      const uint8_t       *pPointXY,
+                                      const uint8_t        pScalar[SEC_ECP256_SCALAR_LEN]);
+bool              sw_ecp256_mul_step(sw_ecp256_mul_ctx_t *pCtx, uint32_t numBits);
+secEcp256Status_t sw_ecp256_mul_finish(sw_ecp256_mul_ctx_t *pCtx, uint8_t pOutXY[2U * SEC_ECP256_COORDINATE_LEN]);
+bool              sw_ecp256_scalar_valid(const uint8_t pScalar[SEC_ECP256_SCALAR_LEN]);
+
 /* SW RNG */
 uint32_t SecLib_set_rng_seed(uint32_t seed);
 uint32_t SecLib_get_random(void);
@@ -173,6 +173,10 @@ static fwk_work_t seed_needed_work = {
 };
 #endif
 
+/* The seed request work was rejected while the system workqueue was drained, it is submitted again by the next
+ * RNG_GetPseudoRandomData() call */
+static bool_t seed_request_dropped = FALSE;
+
 /*! *********************************************************************************
 *************************************************************************************
 * Public functions
@@ -384,7 +388,7 @@ int RNG_GetPseudoRandomData(uint8_t *pOut, uint8_t outBytes, uint8_t *pSeed)
                 rng_ctx.mPRNG_Requests = 1U;
             }
 
-            if (rng_ctx.mPRNG_Requests == gRngMaxRequests_d)
+            if ((rng_ctx.mPRNG_Requests == gRngMaxRequests_d) || (seed_request_dropped == TRUE))
             {
                 if (RNG_NotifyReseedNeeded() < 0)
                 {
@@ -610,7 +614,13 @@ int RNG_NotifyReseedNeeded(void)
         rng_ctx.needReseed = TRUE;
 #if !defined(gPlatformIsNbu_d)
         /* On MCU, submit a seed request to work queue  */
-        status = WORKQ_Submit(&seed_needed_work);
+        status               = WORKQ_Submit(&seed_needed_work);
+        seed_request_dropped = (status == -EBUSY) ? TRUE : FALSE;
+        if (seed_request_dropped == TRUE)
+        {
+            /* retried later, needReseed stays set */
+            status = 0;
+        }
         if (status < 0)
         {
             break;
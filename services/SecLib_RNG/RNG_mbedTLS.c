@@ -93,6 +93,10 @@ static fwk_work_t seed_needed_work = {
 };
 #endif
 
+/* The seed request work was rejected while the system workqueue was drained, it is submitted again by the next
+ * RNG_GetPseudoRandomData() call */
+static bool_t seed_request_dropped = FALSE;
+
 /*! *********************************************************************************
 *************************************************************************************
 * Public prototypes
@@ -299,7 +303,7 @@ int RNG_GetPseudoRandomData(uint8_t *pOut, uint8_t outBytes, uint8_t *pSeed)
         }
         else
         {
-            if (rng_ctx.mPRNG_Requests == gRngMaxRequests_d)
+            if ((rng_ctx.mPRNG_Requests == gRngMaxRequests_d) || (seed_request_dropped == TRUE))
             {
                 if (RNG_NotifyReseedNeeded() < 0)
                 {
@@ -464,7 +468,13 @@ int RNG_NotifyReseedNeeded(void)
     rng_ctx.mNeedReseed = TRUE;
 
 #if !defined(gPlatformIsNbu_d)
-    status = WORKQ_Submit(&seed_needed_work);
+    status               = WORKQ_Submit(&seed_needed_work);
+    seed_request_dropped = (status == -EBUSY) ? TRUE : FALSE;
+    if (seed_request_dropped == TRUE)
+    {
+        /* retried later, mNeedReseed stays set */
+        status = 0;
+    }
 #endif
     return status;
 }
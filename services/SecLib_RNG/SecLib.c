@@ -21,6 +21,7 @@
 #include "fsl_os_abstraction.h"
 #include "fsl_component_mem_manager.h"
 #include "CryptoLibSW.h"
+#include "RNG_Interface.h"
 
 /* header file to be included after fsl_device_registers.h as it potentially overwrites some feature MACROs
     (FSL_FEATURE_SOC_LTC_COUNT) */
@@ -108,6 +109,42 @@ extern osa_status_t SecLibMutexUnlock(void);
     }
 #endif
 
+/* The in-tree constant time AES-128 replaces the software library when there is no AES hardware */
+#if (defined(gSecLibAesCtEnable_d) && (gSecLibAesCtEnable_d > 0)) &&                   \
+    !(defined(FSL_FEATURE_SOC_MMCAU_COUNT) && (FSL_FEATURE_SOC_MMCAU_COUNT > 0)) && \
+    !(defined(FSL_FEATURE_SOC_LTC_COUNT) && (FSL_FEATURE_SOC_LTC_COUNT > 0)) && !defined(FSL_FEATURE_SOC_AES_HW)
+#define SECLIB_AES_CT 1
+#else
+#define SECLIB_AES_CT 0
+#endif
+
+/* The chained modes and the single block operations cannot fill the two bitsliced lanes, they keep sw_Aes128() of
+ * the library unless gSecLibAesCtSerialEnable_d also requests the constant time AES-128 for them */
+#if SECLIB_AES_CT && (defined(gSecLibAesCtSerialEnable_d) && (gSecLibAesCtSerialEnable_d > 0))
+#define SECLIB_AES_CT_SERIAL 1
+#else
+#define SECLIB_AES_CT_SERIAL 0
+#endif
+
+/* The in-tree unrolled SHA-256 replaces the software library when there is no MMCAU */
+#if (defined(gSecLibSha256UnrolledEnable_d) && (gSecLibSha256UnrolledEnable_d > 0)) && \
+    !(defined(FSL_FEATURE_SOC_MMCAU_COUNT) && (FSL_FEATURE_SOC_MMCAU_COUNT > 0))
+#define SECLIB_SHA256_UNROLLED 1
+#else
+#define SECLIB_SHA256_UNROLLED 0
+#endif
+
+/* The in-tree P-256 comb and signed window multiplications replace the software library without DSP extension */
+#if (defined(gSecLibEcp256CombEnable_d) && (gSecLibEcp256CombEnable_d > 0)) && \
+    !(defined(gSecLibUseDspExtension_d) && (gSecLibUseDspExtension_d == 1))
+#define SECLIB_ECP256_COMB 1
+#else
+#define SECLIB_ECP256_COMB 0
+#endif
+
+/* Random private keys drawn before giving up, a draw is rejected with a probability below 2^-32 */
+#define SECLIB_ECP256_KEY_ATTEMPTS 4U
+
 #define AES_BLOCK_ALIGN_MASK (0x0000000fUL)
 /* Compute number of whole AES block bytes */
 #define AES_WHOLE_BLOCK_BYTES(_LEN_) ((uint32_t)(_LEN_) & ~AES_BLOCK_ALIGN_MASK)
@@ -181,9 +218,30 @@ typedef struct sha256Context_tag
 typedef struct HMAC_SHA256_context_tag
 {
     sha256Context_t shaCtx;
-    uint8_t         pad[SHA256_BLOCK_SIZE];
+    uint32_t        outerHash[SHA256_HASH_SIZE / sizeof(uint32_t)]; /* SHA256 state after the o_key_pad */
 } HMAC_SHA256_context_t;
 
+/*! State of an HMAC-SHA256 key context, see HMAC_SHA256_KeyCtxInit() */
+typedef struct secHmacSha256KeyState_tag
+{
+    uint32_t innerHash[SHA256_HASH_SIZE / sizeof(uint32_t)]; /* SHA256 state after the i_key_pad */
+    uint32_t outerHash[SHA256_HASH_SIZE / sizeof(uint32_t)]; /* SHA256 state after the o_key_pad */
+} secHmacSha256KeyState_t;
+
+/*! State of an AES-128 key context, see AES_128_KeyCtxInit() */
+typedef struct secAesKeyState_tag
+{
+#if (defined(FSL_FEATURE_SOC_MMCAU_COUNT) && (FSL_FEATURE_SOC_MMCAU_COUNT > 0))
+    uint8_t keyExpansion[44 * 4]; /* first member, the MMCAU needs it word aligned */
+#endif
+#if SECLIB_AES_CT
+    sw_aes128_ct_ctx_t ctKey;
+#endif
+    uint8_t key[AES_128_KEY_BYTE_LEN];
+    uint8_t cmacK1[AES_BLOCK_SIZE];
+    uint8_t cmacK2[AES_BLOCK_SIZE];
+} secAesKeyState_t;
+
 /************************************************************************************
 *************************************************************************************
 * Private memory declarations
@@ -223,18 +281,61 @@ static const ecp256KeyPair_t mBleDebugKeyPair = {
 
 static void SHA1_hash_n(uint8_t *pData, uint32_t nBlk, uint32_t *pHash);
 static void SHA256_hash_n(const uint8_t *pData, uint32_t nBlk, uint32_t *pHash);
+static void HMAC_SHA256_PadStates(const uint8_t *pKey, uint32_t keyLen, uint32_t *pInnerHash, uint32_t *pOuterHash);
+static void HMAC_SHA256_StartStates(HMAC_SHA256_context_t *pContext,
+                                    const uint32_t        *pInnerHash,
+                                    const uint32_t        *pOuterHash);
+#if SECLIB_ECP256_COMB
+static secResultType_t ECP256_CombPrivateKey(ecdhPrivateKey_t *pOutPrivateKey);
+static secResultType_t ECP256_CombComplete(sw_ecp256_mul_ctx_t *pCtx, ecdhPoint_t *pOutPoint);
+static secResultType_t ECP256_CombStartSeg(computeDhKeyParam_t *pDhKeyData, bool_t fixedBase);
+#endif
+#if (SECLIB_AES_CT_SERIAL == 0)
 static void AES_128_CMAC_Generate_Subkey(const uint8_t *key, uint8_t *K1, uint8_t *K2);
-static void SecLib_LeftShiftOneBit(uint8_t *input, uint8_t *output);
+#endif
+static void AES_128_CMAC_Derive_Subkey(const uint8_t *L, uint8_t *K1, uint8_t *K2);
+static void AES_128_KeyStateEncrypt(const secAesKeyState_t *pState, const uint8_t *pInput, uint8_t *pOutput);
+static void SecLib_LeftShiftOneBit(const uint8_t *input, uint8_t *output);
 static void SecLib_Xor128(const uint8_t *a, const uint8_t *b, uint8_t *out);
 
 static uint8_t SecLib_Padding(const uint8_t *lastb, uint8_t pad_block[AES_BLOCK_SIZE], uint8_t length);
 static uint8_t SecLib_DePadding(const uint8_t pad_block[AES_BLOCK_SIZE]);
 
-#if (defined(FSL_FEATURE_SOC_LTC_COUNT) && (FSL_FEATURE_SOC_LTC_COUNT == 1U))
+#if (defined(FSL_FEATURE_SOC_LTC_COUNT) && (FSL_FEATURE_SOC_LTC_COUNT == 1U)) || SECLIB_AES_CT
 #else
 static void AES_128_IncrementCounter(uint8_t *ctr);
 #endif
 
+#if SECLIB_AES_CT_SERIAL
+static void AES_128_CtCmacSubkeys(const sw_aes128_ct_ctx_t *pCtx, uint8_t *K1, uint8_t *K2);
+static void AES_128_CtCmac(const sw_aes128_ct_ctx_t *pCtx,
+                           const uint8_t            *K1,
+                           const uint8_t            *K2,
+                           const uint8_t            *pInput,
+                           uint32_t                  inputLen,
+                           uint8_t                  *pMac);
+static void AES_128_CtOmac(const sw_aes128_ct_ctx_t *pCtx,
+                           const uint8_t            *K1,
+                           const uint8_t            *K2,
+                           uint8_t                   tweak,
+                           const uint8_t            *pInput,
+                           uint32_t                  inputLen,
+                           uint8_t                  *pMac);
+#endif
+#if SECLIB_AES_CT
+static uint8_t AES_128_CtCcm(const secAesKeyCtx_t *pKeyCtx,
+                             const uint8_t        *pInput,
+                             uint16_t              inputLen,
+                             const uint8_t        *pAuthData,
+                             uint16_t              authDataLen,
+                             const uint8_t        *pNonce,
+                             uint8_t               nonceSize,
+                             uint8_t              *pOutput,
+                             uint8_t              *pCbcMac,
+                             uint8_t               macSize,
+                             uint32_t              flags);
+#endif
+
 #ifdef FSL_FEATURE_SOC_AES_HW
 static void AES_128_ECB_Enc_HW(AES_param_t *ECB_p);
 static void AES_128_ECB_Dec_HW(AES_param_t *ECB_p);
@@ -479,6 +580,13 @@ void AES_128_Encrypt(const uint8_t *pInput, const uint8_t *pKey, uint8_t *pOutpu
         __enable_irq();
     } while (hw_ase_status_flag == HW_AES_Previous_Enc_on_going);
 
+#elif SECLIB_AES_CT_SERIAL
+    sw_aes128_ct_ctx_t ctCtx;
+
+    sw_aes128_ct_set_key(&ctCtx, pKey);
+    sw_aes128_ct_ecb_encrypt(&ctCtx, pInput, pOutput, 1U);
+    FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
+
 #else
     sw_Aes128(pInput, pKey, 1, pOutput);
 #endif
@@ -571,6 +679,12 @@ void AES_128_Decrypt(const uint8_t *pInput, const uint8_t *pKey, uint8_t *pOutpu
     } while (hw_ase_status_flag == HW_AES_Previous_Enc_on_going);
 
     SECLIB_MUTEX_UNLOCK();
+#elif SECLIB_AES_CT_SERIAL
+    sw_aes128_ct_ctx_t ctCtx;
+
+    sw_aes128_ct_set_key(&ctCtx, pKey);
+    sw_aes128_ct_ecb_decrypt(&ctCtx, pInput, pOutput, 1U);
+    FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
 #else
     sw_Aes128(pInput, pKey, 0, pOutput);
 #endif
@@ -611,6 +725,22 @@ void AES_128_ECB_Encrypt(const uint8_t *pInput, uint32_t inputLen, const uint8_t
     AES_128_ECB_Enc_HW(&pAES);
     SECLIB_MUTEX_UNLOCK();
 #endif /* USE_TASK_FOR_HW_AES */
+#elif SECLIB_AES_CT
+    sw_aes128_ct_ctx_t ctCtx;
+    uint8_t            tempBuff[AES_BLOCK_SIZE] = {0};
+    uint32_t           wholeLen                 = AES_WHOLE_BLOCK_BYTES(inputLen);
+
+    sw_aes128_ct_set_key(&ctCtx, pKey);
+    sw_aes128_ct_ecb_encrypt(&ctCtx, pInput, pOutput, wholeLen / AES_BLOCK_SIZE);
+
+    /* A partial last block is padded with zeros and the output truncated */
+    if (wholeLen != inputLen)
+    {
+        FLib_MemCpy(tempBuff, &pInput[wholeLen], inputLen - wholeLen);
+        sw_aes128_ct_ecb_encrypt(&ctCtx, tempBuff, tempBuff, 1U);
+        FLib_MemCpy(&pOutput[wholeLen], tempBuff, inputLen - wholeLen);
+    }
+    FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
 #else  /* SW AES */
     uint8_t tempBuffIn[AES_BLOCK_SIZE]  = {0};
     uint8_t tempBuffOut[AES_BLOCK_SIZE] = {0};
@@ -705,6 +835,12 @@ void AES_128_ECB_Block_Encrypt(const uint8_t *pInput, uint32_t numBlocks, const
     SECLIB_MUTEX_UNLOCK();
 #endif /* USE_TASK_FOR_HW_AES */
 
+#elif SECLIB_AES_CT
+    sw_aes128_ct_ctx_t ctCtx;
+
+    sw_aes128_ct_set_key(&ctCtx, pKey);
+    sw_aes128_ct_ecb_encrypt(&ctCtx, pInput, pOutput, numBlocks);
+    FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
 #else  /* SW AES */
     while (numBlocks > 0u)
     {
@@ -805,6 +941,12 @@ secResultType_t AES_128_CBC_Encrypt(
         /* Note that inputLen is greater than or equal to AES_BLOCK_SIZE, otherwise would have exited
            with gSecBadArgument_c, so difference cannot be negative */
         FLib_MemCpy(pInitVector, &pOutput[inputLen - AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+#elif SECLIB_AES_CT_SERIAL
+        sw_aes128_ct_ctx_t ctCtx;
+
+        sw_aes128_ct_set_key(&ctCtx, pKey);
+        sw_aes128_ct_cbc_encrypt(&ctCtx, pInput, pOutput, inputLen / AES_BLOCK_SIZE, pInitVector);
+        FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
 #else
         uint8_t tempBuffIn[AES_BLOCK_SIZE] = {0};
 
@@ -878,6 +1020,12 @@ secResultType_t AES_128_CBC_Decrypt(
         /* Note that inputLen is greater than or equal to AES_BLOCK_SIZE, otherwise would have exited
            with gSecBadArgument_c, so difference cannot be negative */
         FLib_MemCpy(pInitVector, &pInput[inputLen - AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+#elif SECLIB_AES_CT
+        sw_aes128_ct_ctx_t ctCtx;
+
+        sw_aes128_ct_set_key(&ctCtx, pKey);
+        sw_aes128_ct_cbc_decrypt(&ctCtx, pInput, pOutput, inputLen / AES_BLOCK_SIZE, pInitVector);
+        FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
 #else
         uint8_t temp[AES_BLOCK_SIZE] = {0u};
 
@@ -1056,6 +1204,19 @@ void AES_128_CTR(const uint8_t *pInput, uint32_t inputLen, uint8_t *pCounter, co
                              (void *)NULL);
     SECLIB_MUTEX_UNLOCK();
 
+#elif SECLIB_AES_CT
+    sw_aes128_ct_ctx_t ctCtx;
+    uint8_t            tempBuff[AES_BLOCK_SIZE] = {0};
+
+    sw_aes128_ct_set_key(&ctCtx, pKey);
+    sw_aes128_ct_ctr(&ctCtx, pInput, pOutput, inputLen, pCounter);
+    if (inputLen == 0U)
+    {
+        /* An empty message still consumes a counter value, like with the block loop below */
+        sw_aes128_ct_ctr(&ctCtx, tempBuff, tempBuff, 1U, pCounter);
+    }
+    FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
+
 #else
     uint8_t tempBuffIn[AES_BLOCK_SIZE] = {0};
     uint8_t encrCtr[AES_BLOCK_SIZE]    = {0};
@@ -1204,6 +1365,17 @@ void AES_128_CMAC(const uint8_t *pInput, const uint32_t inputLen, const uint8_t
     SECLIB_MUTEX_UNLOCK();
 #endif /* USE_TASK_FOR_HW_AES */
 
+#elif SECLIB_AES_CT_SERIAL
+    sw_aes128_ct_ctx_t ctCtx;
+    uint8_t            K1[AES_BLOCK_SIZE];
+    uint8_t            K2[AES_BLOCK_SIZE];
+
+    sw_aes128_ct_set_key(&ctCtx, pKey);
+    AES_128_CtCmacSubkeys(&ctCtx, K1, K2);
+    FLib_MemSet(pOutput, 0U, AES_BLOCK_SIZE);
+    AES_128_CtCmac(&ctCtx, K1, K2, pInput, inputLen, pOutput);
+    FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
+
 #else  /* SW AES */
 
     uint8_t X[16];
@@ -1290,7 +1462,9 @@ void AES_128_CMAC(const uint8_t *pInput, const uint32_t inputLen, const uint8_t
 void AES_128_CMAC_LsbFirstInput(const uint8_t *pInput, uint32_t inputLen, const uint8_t *pKey, uint8_t *pOutput)
 {
     uint8_t X[16];
+#if (SECLIB_AES_CT_SERIAL == 0)
     uint8_t Y[16];
+#endif
     uint8_t M_last[16]        = {0};
     uint8_t padded[16]        = {0};
     uint8_t reversedBlock[16] = {0};
@@ -1303,7 +1477,14 @@ void AES_128_CMAC_LsbFirstInput(const uint8_t *pInput, uint32_t inputLen, const
     uint8_t  flag;
     uint8_t  residual_len;
 
+#if SECLIB_AES_CT_SERIAL
+    sw_aes128_ct_ctx_t ctCtx;
+
+    sw_aes128_ct_set_key(&ctCtx, pKey);
+    AES_128_CtCmacSubkeys(&ctCtx, K1, K2);
+#else
     AES_128_CMAC_Generate_Subkey(pKey, K1, K2);
+#endif
 
     n            = (uint16_t)(((inputLen + (AES_BLOCK_SIZE - 1u))) / AES_BLOCK_SIZE); /* n is number of rounds */
     residual_len = (uint8_t)AES_PARTIAL_BLOCK_BYTES(inputLen);
@@ -1346,12 +1527,21 @@ void AES_128_CMAC_LsbFirstInput(const uint8_t *pInput, uint32_t inputLen, const
     for (i = 0u; i < (uint32_t)n - 1u; i++)
     {
         FLib_MemCpyReverseOrder(reversedBlock, &pInput[inputLen - AES_BLOCK_SIZE * (i + 1u)], AES_BLOCK_SIZE);
+#if SECLIB_AES_CT_SERIAL
+        sw_aes128_ct_cbc_mac(&ctCtx, reversedBlock, 1U, X); /* X := AES-128(KEY, Mi (+) X) */
+#else
         SecLib_Xor128(X, reversedBlock, Y); /* Y := Mi (+) X  */
         AES_128_Encrypt(Y, pKey, X);        /* X := AES-128(KEY, Y) */
+#endif
     }
 
+#if SECLIB_AES_CT_SERIAL
+    sw_aes128_ct_cbc_mac(&ctCtx, M_last, 1U, X);
+    FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
+#else
     SecLib_Xor128(X, M_last, Y);
     AES_128_Encrypt(Y, pKey, X);
+#endif
 
     for (i = 0u; i < 16u; i++)
     {
@@ -1434,14 +1624,39 @@ secResultType_t AES_128_EAX_Encrypt(const uint8_t *pInput,
                                     uint8_t       *pOutput,
                                     uint8_t       *pTag)
 {
-    uint8_t        *buf;
-    uint32_t        buf_len;
     uint8_t         nonce_mac[AES_BLOCK_SIZE] = {0};
     uint8_t         hdr_mac[AES_BLOCK_SIZE]   = {0};
     uint8_t         data_mac[AES_BLOCK_SIZE]  = {0};
     uint8_t         tempBuff[AES_BLOCK_SIZE]  = {0};
     uint32_t        i;
-    secResultType_t status = gSecAllocError_c;
+    secResultType_t status;
+#if SECLIB_AES_CT_SERIAL
+    sw_aes128_ct_ctx_t ctCtx;
+    uint8_t            K1[AES_BLOCK_SIZE];
+    uint8_t            K2[AES_BLOCK_SIZE];
+
+    /* Each OMAC is chained from its tweak block, the parts are not copied after it */
+    sw_aes128_ct_set_key(&ctCtx, pKey);
+    AES_128_CtCmacSubkeys(&ctCtx, K1, K2);
+    AES_128_CtOmac(&ctCtx, K1, K2, 0U, pNonce, nonceLen, nonce_mac);
+    AES_128_CtOmac(&ctCtx, K1, K2, 1U, pHeader, headerLen, hdr_mac);
+
+    /* keep the original value of nonce_mac, because the CTR mode will increment it */
+    FLib_MemCpy(tempBuff, nonce_mac, nonceLen);
+    sw_aes128_ct_ctr(&ctCtx, pInput, pOutput, inputLen, tempBuff);
+    AES_128_CtOmac(&ctCtx, K1, K2, 2U, pOutput, inputLen, data_mac);
+    FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
+
+    for (i = 0u; i < AES_BLOCK_SIZE; i++)
+    {
+        pTag[i] = nonce_mac[i] ^ data_mac[i] ^ hdr_mac[i];
+    }
+    status = gSecSuccess_c;
+#else
+    uint8_t *buf;
+    uint32_t buf_len;
+
+    status = gSecAllocError_c;
 
     if (nonceLen > inputLen)
     {
@@ -1490,6 +1705,7 @@ secResultType_t AES_128_EAX_Encrypt(const uint8_t *pInput,
         (void)MEM_BufferFree(buf);
         status = gSecSuccess_c;
     }
+#endif /* SECLIB_AES_CT_SERIAL */
     return status;
 }
 
@@ -1515,23 +1731,53 @@ secResultType_t AES_128_EAX_Encrypt(const uint8_t *pInput,
  * \param[out]  pTag Pointer to the location to store the 128-bit tag.
  *
  ********************************************************************************** */
-secResultType_t AES_128_EAX_Decrypt(uint8_t *pInput,
-                                    uint32_t inputLen,
-                                    uint8_t *pNonce,
-                                    uint32_t nonceLen,
-                                    uint8_t *pHeader,
-                                    uint8_t  headerLen,
-                                    uint8_t *pKey,
-                                    uint8_t *pOutput,
-                                    uint8_t *pTag)
+secResultType_t AES_128_EAX_Decrypt(const uint8_t *pInput,
+                                    uint32_t       inputLen,
+                                    const uint8_t *pNonce,
+                                    uint32_t       nonceLen,
+                                    const uint8_t *pHeader,
+                                    uint8_t        headerLen,
+                                    const uint8_t *pKey,
+                                    uint8_t       *pOutput,
+                                    uint8_t       *pTag)
 {
-    uint8_t        *buf;
-    uint32_t        buf_len;
     uint8_t         nonce_mac[AES_BLOCK_SIZE] = {0};
     uint8_t         hdr_mac[AES_BLOCK_SIZE]   = {0};
     uint8_t         data_mac[AES_BLOCK_SIZE]  = {0};
-    secResultType_t status                    = gSecAllocError_c;
+    secResultType_t status;
     uint32_t        i;
+#if SECLIB_AES_CT_SERIAL
+    sw_aes128_ct_ctx_t ctCtx;
+    uint8_t            K1[AES_BLOCK_SIZE];
+    uint8_t            K2[AES_BLOCK_SIZE];
+
+    sw_aes128_ct_set_key(&ctCtx, pKey);
+    AES_128_CtCmacSubkeys(&ctCtx, K1, K2);
+    AES_128_CtOmac(&ctCtx, K1, K2, 0U, pNonce, nonceLen, nonce_mac);
+    AES_128_CtOmac(&ctCtx, K1, K2, 1U, pHeader, headerLen, hdr_mac);
+    AES_128_CtOmac(&ctCtx, K1, K2, 2U, pInput, inputLen, data_mac);
+
+    status = gSecSuccess_c;
+
+    for (i = 0u; i < AES_BLOCK_SIZE; i++)
+    {
+        if (pTag[i] != (nonce_mac[i] ^ data_mac[i] ^ hdr_mac[i]))
+        {
+            status = gSecError_c;
+            break;
+        }
+    }
+
+    if (gSecSuccess_c == status)
+    {
+        sw_aes128_ct_ctr(&ctCtx, pInput, pOutput, inputLen, nonce_mac);
+    }
+    FLib_MemSet(&ctCtx, 0U, sizeof(ctCtx));
+#else
+    uint8_t *buf;
+    uint32_t buf_len;
+
+    status = gSecAllocError_c;
 
     if (nonceLen > inputLen)
     {
@@ -1585,6 +1831,7 @@ secResultType_t AES_128_EAX_Decrypt(uint8_t *pInput,
             AES_128_CTR(pInput, inputLen, nonce_mac, pKey, pOutput);
         }
     }
+#endif /* SECLIB_AES_CT_SERIAL */
 
     return status;
 }
@@ -1635,6 +1882,10 @@ uint8_t AES_128_CCM(const uint8_t *pInput,
                     uint32_t       flags)
 {
     uint8_t status;
+#if SECLIB_AES_CT
+    secAesKeyState_t keyState;
+    secAesKeyCtx_t   keyCtx = {.pState = &keyState};
+#endif
 
     SECLIB_MUTEX_LOCK();
 
@@ -1652,6 +1903,13 @@ uint8_t AES_128_CCM(const uint8_t *pInput,
                                                  (uint32_t)macSize));
     }
 
+#elif SECLIB_AES_CT
+    /* Key context on the stack, the CTR blocks use the key schedule and the CBC-MAC blocks the raw key */
+    FLib_MemCpy(keyState.key, pKey, AES_128_KEY_BYTE_LEN);
+    sw_aes128_ct_set_key(&keyState.ctKey, pKey);
+    status = AES_128_CtCcm(&keyCtx, pInput, inputLen, pAuthData, authDataLen, pNonce, nonceSize, pOutput, pCbcMac,
+                           macSize, flags);
+    FLib_MemSet(&keyState, 0U, sizeof(keyState));
 #else
     status = sw_AES128_CCM(pInput, inputLen, pAuthData, authDataLen, pNonce, nonceSize, pKey, pOutput, pCbcMac, macSize,
                            flags);
@@ -1662,6 +1920,276 @@ uint8_t AES_128_CCM(const uint8_t *pInput,
     return status;
 }
 
+/*! *********************************************************************************
+ * \brief  This function sets up an AES-128 key context.
+ *
+ * \param[out]  pCtx  Pointer to the key context to set up.
+ *
+ * \param[in]  pKey  Pointer to the location of the 128-bit key.
+ *
+ * \return : gSecSuccess_c if no error,
+ *           gSecBadArgument_c in case of bad arguments,
+ *           gSecAllocError_c if the context state can't be allocated.
+ *
+ * \remarks The key is copied and the CMAC subkeys are computed once. With the MMCAU and with gSecLibAesCtEnable_d the
+ *          key expansion is also kept, the other SW variants and the single block operations without
+ *          gSecLibAesCtSerialEnable_d take the key on each block operation.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_KeyCtxInit(secAesKeyCtx_t *pCtx, const uint8_t *pKey)
+{
+    secResultType_t   result = gSecBadArgument_c;
+    secAesKeyState_t *pState;
+
+    do
+    {
+        if ((pCtx == NULL) || (pKey == NULL))
+        {
+            break;
+        }
+        pCtx->pState = NULL;
+
+        pState = (secAesKeyState_t *)MEM_BufferAlloc(sizeof(secAesKeyState_t));
+        if (pState == NULL)
+        {
+            result = gSecAllocError_c;
+            break;
+        }
+
+        FLib_MemCpy(pState->key, pKey, AES_128_KEY_BYTE_LEN);
+#if (defined(FSL_FEATURE_SOC_MMCAU_COUNT) && (FSL_FEATURE_SOC_MMCAU_COUNT > 0))
+        SECLIB_MUTEX_LOCK();
+        mmcau_aes_set_key(pState->key, AES128, pState->keyExpansion);
+        SECLIB_MUTEX_UNLOCK();
+#endif
+#if SECLIB_AES_CT
+        sw_aes128_ct_set_key(&pState->ctKey, pState->key);
+#endif
+#if SECLIB_AES_CT_SERIAL
+        AES_128_CtCmacSubkeys(&pState->ctKey, pState->cmacK1, pState->cmacK2);
+#else
+        AES_128_CMAC_Generate_Subkey(pState->key, pState->cmacK1, pState->cmacK2);
+#endif
+
+        pCtx->pState = pState;
+        result       = gSecSuccess_c;
+    } while (false);
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function releases an AES-128 key context. The key material is erased.
+ *
+ * \param[in, out]  pCtx  Pointer to the key context.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxDestroy(secAesKeyCtx_t *pCtx)
+{
+    if ((pCtx != NULL) && (pCtx->pState != NULL))
+    {
+        FLib_MemSet(pCtx->pState, 0U, sizeof(secAesKeyState_t));
+        (void)MEM_BufferFree(pCtx->pState);
+        pCtx->pState = NULL;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128 encryption on a 16-byte block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the 16-byte plain text block.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput)
+{
+    AES_128_KeyStateEncrypt((const secAesKeyState_t *)pCtx->pState, pInput, pOutput);
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-ECB encryption on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes, must be a multiple of 16 bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEcbEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    const secAesKeyState_t *pState = (const secAesKeyState_t *)pCtx->pState;
+
+#ifdef FSL_FEATURE_SOC_AES_HW /* HW AES */
+    AES_128_ECB_Encrypt(pInput, inputLen, pState->key, pOutput);
+#elif SECLIB_AES_CT
+    uint8_t  tempBuff[AES_BLOCK_SIZE] = {0U};
+    uint32_t wholeLen                 = AES_WHOLE_BLOCK_BYTES(inputLen);
+
+    sw_aes128_ct_ecb_encrypt(&pState->ctKey, pInput, pOutput, wholeLen / AES_BLOCK_SIZE);
+
+    /* A partial last block is truncated, as done by AES_128_ECB_Encrypt() */
+    if (wholeLen != inputLen)
+    {
+        FLib_MemCpy(tempBuff, &pInput[wholeLen], inputLen - wholeLen);
+        sw_aes128_ct_ecb_encrypt(&pState->ctKey, tempBuff, tempBuff, 1U);
+        FLib_MemCpy(&pOutput[wholeLen], tempBuff, inputLen - wholeLen);
+    }
+#else
+    uint8_t tempBuffIn[AES_BLOCK_SIZE] = {0U};
+    uint8_t tempBuffOut[AES_BLOCK_SIZE];
+
+    while (inputLen >= AES_BLOCK_SIZE)
+    {
+        AES_128_KeyStateEncrypt(pState, pInput, pOutput);
+        pInput += AES_BLOCK_SIZE;
+        pOutput += AES_BLOCK_SIZE;
+        inputLen -= AES_BLOCK_SIZE;
+    }
+
+    /* A partial last block is truncated, as done by AES_128_ECB_Encrypt() */
+    if (inputLen != 0U)
+    {
+        FLib_MemCpy(tempBuffIn, pInput, inputLen);
+        AES_128_KeyStateEncrypt(pState, tempBuffIn, tempBuffOut);
+        FLib_MemCpy(pOutput, tempBuffOut, inputLen);
+    }
+#endif /* FSL_FEATURE_SOC_AES_HW */
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CTR encryption or decryption on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes.
+ *
+ * \param[in, out]  pCounter Pointer to the location of the 128-bit counter.
+ *
+ * \param[out]  pOutput Pointer to the location to store the output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCtr(
+    const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pCounter, uint8_t *pOutput)
+{
+    const secAesKeyState_t *pState = (const secAesKeyState_t *)pCtx->pState;
+
+#if (defined(FSL_FEATURE_SOC_LTC_COUNT) && (FSL_FEATURE_SOC_LTC_COUNT > 0)) || defined(FSL_FEATURE_SOC_AES_HW)
+    AES_128_CTR(pInput, inputLen, pCounter, pState->key, pOutput);
+#elif SECLIB_AES_CT
+    sw_aes128_ct_ctr(&pState->ctKey, pInput, pOutput, inputLen, pCounter);
+#else
+    uint8_t encrCtr[AES_BLOCK_SIZE];
+    uint8_t blockLen;
+
+    while (inputLen != 0U)
+    {
+        blockLen = (inputLen > AES_BLOCK_SIZE) ? (uint8_t)AES_BLOCK_SIZE : (uint8_t)inputLen;
+
+        AES_128_KeyStateEncrypt(pState, pCounter, encrCtr);
+        SecLib_XorN(encrCtr, pInput, blockLen);
+        FLib_MemCpy(pOutput, encrCtr, blockLen);
+        AES_128_IncrementCounter(pCounter);
+
+        pInput += blockLen;
+        pOutput += blockLen;
+        inputLen -= blockLen;
+    }
+#endif
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CMAC on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message, MSB first.
+ *
+ * \param[in]  inputLen Length of the input message in bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte authentication code.
+ *
+ * \remarks The subkeys computed by AES_128_KeyCtxInit() are reused, this saves one block encryption per call.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCmac(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    const secAesKeyState_t *pState = (const secAesKeyState_t *)pCtx->pState;
+
+#ifdef FSL_FEATURE_SOC_AES_HW /* HW AES */
+    AES_128_CMAC(pInput, inputLen, pState->key, pOutput);
+#elif SECLIB_AES_CT_SERIAL
+    FLib_MemSet(pOutput, 0U, AES_BLOCK_SIZE);
+    AES_128_CtCmac(&pState->ctKey, pState->cmacK1, pState->cmacK2, pInput, inputLen, pOutput);
+#else
+    uint8_t X[AES_BLOCK_SIZE] = {0U};
+    uint8_t Y[AES_BLOCK_SIZE];
+    uint8_t M_last[AES_BLOCK_SIZE];
+
+    /* All the blocks but the last one: X := AES-128(KEY, Mi (+) X) */
+    while (inputLen > AES_BLOCK_SIZE)
+    {
+        SecLib_Xor128(X, pInput, Y);
+        AES_128_KeyStateEncrypt(pState, Y, X);
+        pInput += AES_BLOCK_SIZE;
+        inputLen -= AES_BLOCK_SIZE;
+    }
+
+    /* The last block is xored with K1 if complete, padded and xored with K2 otherwise */
+    if (inputLen == AES_BLOCK_SIZE)
+    {
+        SecLib_Xor128(pInput, pState->cmacK1, M_last);
+    }
+    else
+    {
+        (void)SecLib_Padding(pInput, Y, (uint8_t)inputLen);
+        SecLib_Xor128(Y, pState->cmacK2, M_last);
+    }
+
+    SecLib_Xor128(X, M_last, Y);
+    AES_128_KeyStateEncrypt(pState, Y, pOutput);
+#endif /* FSL_FEATURE_SOC_AES_HW */
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CCM on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \remarks The other parameters are the ones of AES_128_CCM(). The LTC and the software library take the raw key,
+ *          with gSecLibAesCtEnable_d the CCM stream runs on the key context.
+ *
+ ********************************************************************************** */
+uint8_t AES_128_KeyCtxCcm(const secAesKeyCtx_t *pCtx,
+                          const uint8_t        *pInput,
+                          uint16_t              inputLen,
+                          const uint8_t        *pAuthData,
+                          uint16_t              authDataLen,
+                          const uint8_t        *pNonce,
+                          uint8_t               nonceSize,
+                          uint8_t              *pOutput,
+                          uint8_t              *pCbcMac,
+                          uint8_t               macSize,
+                          uint32_t              flags)
+{
+#if SECLIB_AES_CT
+    return AES_128_CtCcm(pCtx, pInput, inputLen, pAuthData, authDataLen, pNonce, nonceSize, pOutput, pCbcMac, macSize,
+                         flags);
+#else
+    const secAesKeyState_t *pState = (const secAesKeyState_t *)pCtx->pState;
+
+    return AES_128_CCM(pInput, inputLen, pAuthData, authDataLen, pNonce, nonceSize, pState->key, pOutput, pCbcMac,
+                       macSize, flags);
+#endif
+}
+
 /*! *********************************************************************************
  * \brief  This function calculates XOR of individual byte pairs in two uint8_t arrays.
  *         pDst[i] := pDst[i] ^ pSrc[i] for i=0 to n-1
@@ -1915,6 +2443,8 @@ void SHA256_Init(void *pContext)
     (void)mmcau_sha256_initialize_output((const unsigned int *)context->hash);
     SECLIB_MUTEX_UNLOCK();
 
+#elif SECLIB_SHA256_UNROLLED
+    sw_sha256_unrolled_initialize_output(context->hash);
 #else
     sw_sha256_initialize_output(context->hash);
 #endif
@@ -2070,36 +2600,12 @@ void HMAC_SHA256_FreeCtx(void *pContext)
  ********************************************************************************** */
 void HMAC_SHA256_Init(void *pContext, const uint8_t *pKey, uint32_t keyLen)
 {
-    uint8_t                i;
-    HMAC_SHA256_context_t *context                               = (HMAC_SHA256_context_t *)pContext;
-    uint8_t                sha256HashKeyBuffer[SHA256_HASH_SIZE] = {0};
-
-    if (keyLen > SHA256_BLOCK_SIZE)
-    {
-        SHA256_Hash(pKey, keyLen, sha256HashKeyBuffer);
-        pKey   = sha256HashKeyBuffer;
-        keyLen = SHA256_HASH_SIZE;
-    }
-
-    /* Create i_pad */
-    for (i = 0u; i < keyLen; i++)
-    {
-        context->pad[i] = pKey[i] ^ gHmacIpad_c;
-    }
-
-    for (i = (uint8_t)(keyLen & 0xffu); i < SHA256_BLOCK_SIZE; i++)
-    {
-        context->pad[i] = gHmacIpad_c;
-    }
-    /* start hashing of the i_key_pad */
-    SHA256_Init(&context->shaCtx);
-    SHA256_HashUpdate(&context->shaCtx, context->pad, SHA256_BLOCK_SIZE);
+    HMAC_SHA256_context_t  *context = (HMAC_SHA256_context_t *)pContext;
+    secHmacSha256KeyState_t state;
 
-    /* create o_pad by xor-ing pad[i] with 0x36 ^ 0x5C: */
-    for (i = 0u; i < SHA256_BLOCK_SIZE; i++)
-    {
-        context->pad[i] ^= (gHmacIpad_c ^ gHmacOpad_c);
-    }
+    HMAC_SHA256_PadStates(pKey, keyLen, state.innerHash, state.outerHash);
+    HMAC_SHA256_StartStates(context, state.innerHash, state.outerHash);
+    FLib_MemSet(&state, 0u, sizeof(state));
 }
 
 /*! *********************************************************************************
@@ -2134,9 +2640,10 @@ void HMAC_SHA256_Finish(void *pContext, uint8_t *pOutput)
 
     /* finalize the hash of the i_key_pad and message */
     SHA256_HashFinish(&context->shaCtx, hash1);
-    /* perform hash of the o_key_pad and hash1 */
-    SHA256_Init(&context->shaCtx);
-    SHA256_HashUpdate(&context->shaCtx, context->pad, SHA256_BLOCK_SIZE);
+    /* perform hash of hash1, continuing from the o_key_pad state */
+    FLib_MemCpy(context->shaCtx.hash, context->outerHash, SHA256_HASH_SIZE);
+    context->shaCtx.totalBytes = SHA256_BLOCK_SIZE;
+    context->shaCtx.bytes      = 0u;
     SHA256_HashUpdate(&context->shaCtx, hash1, SHA256_HASH_SIZE);
     SHA256_HashFinish(&context->shaCtx, pOutput);
 }
@@ -2162,16 +2669,112 @@ void HMAC_SHA256(const uint8_t *pKey, uint32_t keyLen, const uint8_t *pData, uin
     HMAC_SHA256_Finish(&context, pOutput);
 }
 
-#if (defined(mDbgRevertKeys_d) && (mDbgRevertKeys_d > 0))
-static ecdhPublicKey_t  mReversedPublicKey;
-static ecdhPrivateKey_t mReversedPrivateKey;
-#endif /* mDbgRevertKeys_d */
-
-/* ECDH Sample Data Bluetooth specification V5.0 :
-7.1.2.1 P-256 Data Set 1
-Private A: 3f49f6d4 a3c55f38 74c9b3e3 d2103f50 4aff607b eb40b799 5899b8a6 cd3c1abd
-Private B: 55188b3d 32f6bb9a 900afcfb eed4e72a 59cb9ac2 f19d7cfb 6b4fdd49 f47fc5fd
-Public A(x): 20b003d2 f297be2c 5e2c83a7 e9f9a5b9 eff49111 acf4fddb cc030148 0e359de6
+/*! *********************************************************************************
+ * \brief  This function sets up an HMAC-SHA256 key context.
+ *
+ * \param [out]   pCtx        Pointer to the key context to set up.
+ * \param [in]    pKey        Pointer to the HMAC key
+ * \param [in]    keyLen      Length of the HMAC key in bytes
+ *
+ * \return : gSecSuccess_c if no error,
+ *           gSecBadArgument_c in case of bad arguments,
+ *           gSecAllocError_c if the context state can't be allocated.
+ *
+ * \remarks Only the SHA256 states after the i_key_pad and o_key_pad blocks are kept, not the key.
+ *
+ ********************************************************************************** */
+secResultType_t HMAC_SHA256_KeyCtxInit(secHmacSha256KeyCtx_t *pCtx, const uint8_t *pKey, uint32_t keyLen)
+{
+    secResultType_t          result = gSecBadArgument_c;
+    secHmacSha256KeyState_t *pState;
+
+    do
+    {
+        if ((pCtx == NULL) || ((pKey == NULL) && (keyLen > 0u)))
+        {
+            break;
+        }
+        pCtx->pState = NULL;
+
+        pState = (secHmacSha256KeyState_t *)MEM_BufferAlloc(sizeof(secHmacSha256KeyState_t));
+        if (pState == NULL)
+        {
+            result = gSecAllocError_c;
+            break;
+        }
+
+        HMAC_SHA256_PadStates(pKey, keyLen, pState->innerHash, pState->outerHash);
+
+        pCtx->pState = pState;
+        result       = gSecSuccess_c;
+    } while (false);
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function releases an HMAC-SHA256 key context. The key material is erased.
+ *
+ * \param [in, out]  pCtx     Pointer to the key context.
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxDestroy(secHmacSha256KeyCtx_t *pCtx)
+{
+    if ((pCtx != NULL) && (pCtx->pState != NULL))
+    {
+        FLib_MemSet(pCtx->pState, 0U, sizeof(secHmacSha256KeyState_t));
+        (void)MEM_BufferFree(pCtx->pState);
+        pCtx->pState = NULL;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  This function initializes an HMAC SHA256 context from a key context, without any SHA256 compression.
+ *
+ * \param [in]    pCtx        Pointer to the key context set up by HMAC_SHA256_KeyCtxInit().
+ * \param [out]   pContext    Pointer to the HMAC SHA256 context data
+ *                            Allocated using HMAC_SHA256_AllocCtx()
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxStart(const secHmacSha256KeyCtx_t *pCtx, void *pContext)
+{
+    const secHmacSha256KeyState_t *pState = (const secHmacSha256KeyState_t *)pCtx->pState;
+
+    HMAC_SHA256_StartStates((HMAC_SHA256_context_t *)pContext, pState->innerHash, pState->outerHash);
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs all HMAC SHA256 steps on multiple bytes with a key context.
+ *         The final HMAC value is stored at the provided output location.
+ *
+ * \param [in]       pCtx        Pointer to the key context set up by HMAC_SHA256_KeyCtxInit().
+ * \param [in]       pData       Pointer to the input data
+ * \param [in]       numBytes    Number of bytes to perform HMAC on
+ * \param [in,out]   pOutput     Pointer to the output location
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxCompute(const secHmacSha256KeyCtx_t *pCtx,
+                               const uint8_t               *pData,
+                               uint32_t                     numBytes,
+                               uint8_t                     *pOutput)
+{
+    HMAC_SHA256_context_t context;
+
+    HMAC_SHA256_KeyCtxStart(pCtx, &context);
+    HMAC_SHA256_Update(&context, pData, numBytes);
+    HMAC_SHA256_Finish(&context, pOutput);
+}
+
+#if (defined(mDbgRevertKeys_d) && (mDbgRevertKeys_d > 0))
+static ecdhPublicKey_t  mReversedPublicKey;
+static ecdhPrivateKey_t mReversedPrivateKey;
+#endif /* mDbgRevertKeys_d */
+
+/* ECDH Sample Data Bluetooth specification V5.0 :
+7.1.2.1 P-256 Data Set 1
+Private A: 3f49f6d4 a3c55f38 74c9b3e3 d2103f50 4aff607b eb40b799 5899b8a6 cd3c1abd
+Private B: 55188b3d 32f6bb9a 900afcfb eed4e72a 59cb9ac2 f19d7cfb 6b4fdd49 f47fc5fd
+Public A(x): 20b003d2 f297be2c 5e2c83a7 e9f9a5b9 eff49111 acf4fddb cc030148 0e359de6
 Public A(y): dc809c49 652aeb6d 63329abf 5a52155c 766345c2 8fed3024 741c8ed0 1589d28b
 Public B(x): 1ea1f0f0 1faf1d96 09592284 f19e4c00 47b58afd 8615a69f 559077b2 2faaa190
 Public B(y): 4c55f33e 429dad37 7356703a 9ab85160 472d1130 e28e3676 5f89aff9 15b1214a
@@ -2197,7 +2800,24 @@ secResultType_t ECDH_P256_GenerateKeys(ecdhPublicKey_t *pOutPublicKey, ecdhPriva
     secResultType_t result;
 
 #if (gSecLibUseBleDebugKeys_d == 0)
-#if !(defined gSecLibUseDspExtension_d && (gSecLibUseDspExtension_d == 1))
+#if SECLIB_ECP256_COMB
+    sw_ecp256_mul_ctx_t *pCtx = (sw_ecp256_mul_ctx_t *)MEM_BufferAlloc(sizeof(sw_ecp256_mul_ctx_t));
+    if (NULL == pCtx)
+    {
+        result = gSecAllocError_c;
+    }
+    else
+    {
+        result = ECP256_CombPrivateKey(pOutPrivateKey);
+        if (gSecSuccess_c == result)
+        {
+            /* The fixed base G: public key = comb multiplication of the private key */
+            (void)sw_ecp256_mul_base_start(pCtx, pOutPrivateKey->raw_8bit);
+            result = ECP256_CombComplete(pCtx, pOutPublicKey);
+        }
+        (void)MEM_BufferFree(pCtx);
+    }
+#elif !(defined gSecLibUseDspExtension_d && (gSecLibUseDspExtension_d == 1))
     void *pMultiplicationBuffer = MEM_BufferAlloc(gEcP256_MultiplicationBufferSize_c);
     if (NULL == pMultiplicationBuffer)
     {
@@ -2276,6 +2896,13 @@ secResultType_t ECDH_P256_GenerateKeysSeg(computeDhKeyParam_t *pDhKeyData)
     }
     else
     {
+#if SECLIB_ECP256_COMB
+        result = ECP256_CombPrivateKey(&pDhKeyData->privateKey);
+        if (gSecSuccess_c == result)
+        {
+            result = ECP256_CombStartSeg(pDhKeyData, TRUE);
+        }
+#else
         void *pMultiplicationBuffer = MEM_BufferAlloc(gEcP256_MultiplicationBufferSize_c);
 
         if (NULL == pMultiplicationBuffer)
@@ -2294,6 +2921,7 @@ secResultType_t ECDH_P256_GenerateKeysSeg(computeDhKeyParam_t *pDhKeyData)
                 result = gSecResultPending_c;
             }
         }
+#endif /* SECLIB_ECP256_COMB */
     }
     return result;
 }
@@ -2395,7 +3023,9 @@ secResultType_t ECDH_P256_ComputeDhKey(const ecdhPrivateKey_t *pPrivateKey,
                                        const bool_t            keepBlobDhKey)
 {
     secResultType_t result = gSecSuccess_c;
+#if (SECLIB_ECP256_COMB == 0)
     secEcdhStatus_t ecdhStatus;
+#endif
     do
     {
         if (!ECP256_LePointValid(pPeerPublicKey))
@@ -2403,7 +3033,30 @@ secResultType_t ECDH_P256_ComputeDhKey(const ecdhPrivateKey_t *pPrivateKey,
             result = gSecInvalidPublicKey_c;
             break;
         }
-#if !(defined gSecLibUseDspExtension_d && (gSecLibUseDspExtension_d == 1))
+#if SECLIB_ECP256_COMB
+        sw_ecp256_mul_ctx_t *pCtx = (sw_ecp256_mul_ctx_t *)MEM_BufferAlloc(sizeof(sw_ecp256_mul_ctx_t));
+        if (NULL == pCtx)
+        {
+            result = gSecAllocError_c;
+            break;
+        }
+
+        /* Signed window multiplication of the peer public key, which is checked again */
+        switch (sw_ecp256_mul_start(pCtx, pPeerPublicKey->raw, pPrivateKey->raw_8bit))
+        {
+            case gSecEcp256Success_c:
+                result = ECP256_CombComplete(pCtx, pOutDhKey);
+                break;
+            case gSecEcp256InvalidPoint_c:
+                result = gSecInvalidPublicKey_c;
+                break;
+            default:
+                result = gSecError_c;
+                break;
+        }
+        (void)MEM_BufferFree(pCtx);
+
+#elif !(defined gSecLibUseDspExtension_d && (gSecLibUseDspExtension_d == 1))
 
         void *pMultiplicationBuffer = MEM_BufferAlloc(gEcP256_MultiplicationBufferSize_c);
         if (NULL == pMultiplicationBuffer)
@@ -2577,6 +3230,9 @@ secResultType_t ECDH_P256_ComputeDhKeySeg(computeDhKeyParam_t *pDhKeyData)
     }
     else
     {
+#if SECLIB_ECP256_COMB
+        result = ECP256_CombStartSeg(pDhKeyData, FALSE);
+#else
         secEcdhStatus_t ecdhStatus;
 
         void *pMultiplicationBuffer = MEM_BufferAlloc(gEcP256_MultiplicationBufferSize_c);
@@ -2601,6 +3257,7 @@ secResultType_t ECDH_P256_ComputeDhKeySeg(computeDhKeyParam_t *pDhKeyData)
                 result = gSecResultPending_c;
             }
         }
+#endif /* SECLIB_ECP256_COMB */
     }
     return result;
 }
@@ -2620,8 +3277,24 @@ secResultType_t ECDH_P256_ComputeDhKeySeg(computeDhKeyParam_t *pDhKeyData)
  ************************************************************************************/
 bool_t SecLib_HandleMultiplyStep(computeDhKeyParam_t *pData)
 {
-    bool_t  result = FALSE;
-    uint8_t steps  = ((255U + 1U) / gSecLibEcStepsAtATime);
+    bool_t result = FALSE;
+#if SECLIB_ECP256_COMB
+    sw_ecp256_mul_ctx_t *pCtx = (sw_ecp256_mul_ctx_t *)pData->pWorkBuffer;
+
+    /* The last step also completes the multiplication */
+    if (!sw_ecp256_mul_step(pCtx, gSecLibEcStepsAtATime))
+    {
+        pData->procStep++;
+    }
+    else
+    {
+        pData->result = (uint8_t)ECP256_CombComplete(pCtx, &pData->outPoint);
+        (void)MEM_BufferFree(pCtx);
+        pData->pWorkBuffer = NULL;
+        result             = TRUE;
+    }
+#else
+    uint8_t steps = ((255U + 1U) / gSecLibEcStepsAtATime);
 
     /* Intermediate step */
     if (pData->procStep < steps)
@@ -2650,6 +3323,7 @@ bool_t SecLib_HandleMultiplyStep(computeDhKeyParam_t *pData)
 
         result = TRUE;
     }
+#endif /* SECLIB_ECP256_COMB */
     return result;
 }
 
@@ -2837,11 +3511,185 @@ static void SHA256_hash_n(const uint8_t *pData, uint32_t nBlk, uint32_t *pHash)
     SECLIB_MUTEX_LOCK();
     mmcau_sha256_hash_n(pData, nBlk, (unsigned int *)pHash);
     SECLIB_MUTEX_UNLOCK();
+#elif SECLIB_SHA256_UNROLLED
+    sw_sha256_unrolled_hash_n(pData, (int32_t)nBlk, pHash);
 #else
     sw_sha256_hash_n(pData, (int32_t)nBlk, pHash);
 #endif
 }
 
+/*! *********************************************************************************
+ * \brief  This function computes the SHA256 states after the HMAC i_key_pad and o_key_pad blocks.
+ *
+ * \param [in]    pKey        Pointer to the HMAC key
+ * \param [in]    keyLen      Length of the HMAC key in bytes
+ * \param [out]   pInnerHash  SHA256 state after the i_key_pad block
+ * \param [out]   pOuterHash  SHA256 state after the o_key_pad block
+ *
+ ********************************************************************************** */
+static void HMAC_SHA256_PadStates(const uint8_t *pKey, uint32_t keyLen, uint32_t *pInnerHash, uint32_t *pOuterHash)
+{
+    uint32_t        i;
+    sha256Context_t shaCtx;
+    uint8_t         pad[SHA256_BLOCK_SIZE];
+    uint8_t         sha256HashKeyBuffer[SHA256_HASH_SIZE] = {0};
+
+    if (keyLen > SHA256_BLOCK_SIZE)
+    {
+        SHA256_Hash(pKey, keyLen, sha256HashKeyBuffer);
+        pKey   = sha256HashKeyBuffer;
+        keyLen = SHA256_HASH_SIZE;
+    }
+
+    /* Create i_pad */
+    for (i = 0u; i < keyLen; i++)
+    {
+        pad[i] = pKey[i] ^ gHmacIpad_c;
+    }
+    for (i = keyLen; i < SHA256_BLOCK_SIZE; i++)
+    {
+        pad[i] = gHmacIpad_c;
+    }
+    SHA256_Init(&shaCtx);
+    SHA256_hash_n(pad, 1u, shaCtx.hash);
+    FLib_MemCpy(pInnerHash, shaCtx.hash, SHA256_HASH_SIZE);
+
+    /* create o_pad by xor-ing pad[i] with 0x36 ^ 0x5C: */
+    for (i = 0u; i < SHA256_BLOCK_SIZE; i++)
+    {
+        pad[i] ^= (gHmacIpad_c ^ gHmacOpad_c);
+    }
+    SHA256_Init(&shaCtx);
+    SHA256_hash_n(pad, 1u, shaCtx.hash);
+    FLib_MemCpy(pOuterHash, shaCtx.hash, SHA256_HASH_SIZE);
+
+    /* Erase the key material */
+    FLib_MemSet(pad, 0u, sizeof(pad));
+    FLib_MemSet(sha256HashKeyBuffer, 0u, sizeof(sha256HashKeyBuffer));
+    FLib_MemSet(&shaCtx, 0u, sizeof(shaCtx));
+}
+
+/*! *********************************************************************************
+ * \brief  This function starts an HMAC SHA256 context from the i_key_pad and o_key_pad states: the inner hash
+ *         continues after one block and the outer one is kept for HMAC_SHA256_Finish().
+ *
+ * \param [out]   pContext    Pointer to the HMAC SHA256 context data
+ * \param [in]    pInnerHash  SHA256 state after the i_key_pad block
+ * \param [in]    pOuterHash  SHA256 state after the o_key_pad block
+ *
+ ********************************************************************************** */
+static void HMAC_SHA256_StartStates(HMAC_SHA256_context_t *pContext,
+                                    const uint32_t        *pInnerHash,
+                                    const uint32_t        *pOuterHash)
+{
+    FLib_MemCpy(pContext->shaCtx.hash, pInnerHash, SHA256_HASH_SIZE);
+    FLib_MemCpy(pContext->outerHash, pOuterHash, SHA256_HASH_SIZE);
+    pContext->shaCtx.totalBytes = SHA256_BLOCK_SIZE;
+    pContext->shaCtx.bytes      = 0u;
+}
+
+#if SECLIB_ECP256_COMB
+/*! *********************************************************************************
+ * \brief  This function draws a P-256 private key from the RNG, rejecting the values out of [1, n - 1].
+ *
+ * \param [out]   pOutPrivateKey  Private key, little endian
+ *
+ * \return gSecSuccess_c or gSecError_c if the RNG fails
+ *
+ ********************************************************************************** */
+static secResultType_t ECP256_CombPrivateKey(ecdhPrivateKey_t *pOutPrivateKey)
+{
+    secResultType_t result = gSecError_c;
+
+    for (uint32_t attempt = 0U; attempt < SECLIB_ECP256_KEY_ATTEMPTS; attempt++)
+    {
+        if ((RNG_GetPseudoRandomData(pOutPrivateKey->raw_8bit, SEC_ECP256_SCALAR_LEN, NULL) ==
+             (int)SEC_ECP256_SCALAR_LEN) &&
+            sw_ecp256_scalar_valid(pOutPrivateKey->raw_8bit))
+        {
+            result = gSecSuccess_c;
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function runs the remaining steps of a P-256 multiplication and writes the resulting point.
+ *
+ * \param [in]    pCtx        Multiplication context, erased on return
+ * \param [out]   pOutPoint   Resulting point, little endian coordinates
+ *
+ * \return gSecSuccess_c or gSecError_c
+ *
+ ********************************************************************************** */
+static secResultType_t ECP256_CombComplete(sw_ecp256_mul_ctx_t *pCtx, ecdhPoint_t *pOutPoint)
+{
+    secResultType_t result = gSecError_c;
+
+    while (!sw_ecp256_mul_step(pCtx, SEC_ECP256_COORDINATE_BITLEN))
+    {
+    }
+    if (sw_ecp256_mul_finish(pCtx, pOutPoint->raw) == gSecEcp256Success_c)
+    {
+        result = gSecSuccess_c;
+    }
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function starts a segmented P-256 multiplication, continued by SecLib_HandleMultiplyStep().
+ *
+ * \param [in, out]  pDhKeyData  Private key and, for ECDH, peer public key. The context is kept in pWorkBuffer.
+ * \param [in]       fixedBase   TRUE for the public key of the private key, FALSE for the ECDH shared point
+ *
+ * \return gSecResultPending_c or error
+ *
+ ********************************************************************************** */
+static secResultType_t ECP256_CombStartSeg(computeDhKeyParam_t *pDhKeyData, bool_t fixedBase)
+{
+    secResultType_t      result = gSecError_c;
+    secEcp256Status_t    status;
+    sw_ecp256_mul_ctx_t *pCtx = (sw_ecp256_mul_ctx_t *)MEM_BufferAlloc(sizeof(sw_ecp256_mul_ctx_t));
+
+    do
+    {
+        if (NULL == pCtx)
+        {
+            result = gSecAllocError_c;
+            break;
+        }
+
+        if (fixedBase)
+        {
+            status = sw_ecp256_mul_base_start(pCtx, pDhKeyData->privateKey.raw_8bit);
+        }
+        else
+        {
+            status = sw_ecp256_mul_start(pCtx, pDhKeyData->peerPublicKey.raw, pDhKeyData->privateKey.raw_8bit);
+        }
+        if (status != gSecEcp256Success_c)
+        {
+            if (status == gSecEcp256InvalidPoint_c)
+            {
+                result = gSecInvalidPublicKey_c;
+            }
+            (void)MEM_BufferFree(pCtx);
+            break;
+        }
+
+        pDhKeyData->pWorkBuffer = pCtx;
+        pDhKeyData->procStep    = 0U;
+        SecLib_ExecMultiplicationCb(pDhKeyData);
+        result = gSecResultPending_c;
+    } while (false);
+
+    return result;
+}
+#endif /* SECLIB_ECP256_COMB */
+
 #if (defined FSL_FEATURE_SOC_AES_HW && (FSL_FEATURE_SOC_AES_HW > 0))
 /*! *********************************************************************************
  * \brief  This function performs hardware AES-128 ECB encryption
@@ -3197,7 +4045,7 @@ static void SecLib_Xor128(const uint8_t *a, const uint8_t *b, uint8_t *out)
 *************************************************************************************
 ********************************************************************************** */
 
-#if (!defined(FSL_FEATURE_SOC_LTC_COUNT) || (FSL_FEATURE_SOC_LTC_COUNT == 0))
+#if (!defined(FSL_FEATURE_SOC_LTC_COUNT) || (FSL_FEATURE_SOC_LTC_COUNT == 0)) && (SECLIB_AES_CT == 0)
 /*! *********************************************************************************
  * \brief  Increments the value of a given counter vector.
  *
@@ -3230,8 +4078,9 @@ static void AES_128_IncrementCounter(uint8_t *ctr)
         ctr[i] = tempCtr.u8[AES_BLOCK_SIZE - i - 1];
     }
 }
-#endif /* !(FSL_FEATURE_SOC_LTC_COUNT) */
+#endif /* !(FSL_FEATURE_SOC_LTC_COUNT) && !(SECLIB_AES_CT) */
 
+#if (SECLIB_AES_CT_SERIAL == 0)
 /*! *********************************************************************************
  * \brief  Generates the two subkeys that correspond to an AES key
  *
@@ -3246,11 +4095,8 @@ static void AES_128_IncrementCounter(uint8_t *ctr)
  ********************************************************************************** */
 static void AES_128_CMAC_Generate_Subkey(const uint8_t *key, uint8_t *K1, uint8_t *K2)
 {
-    uint8_t  const_Rb[16] = {0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-                             0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x87u};
     uint8_t  L[16];
     uint8_t  Z[16];
-    uint8_t  tmp[16] = {0};
     uint32_t i;
 
     for (i = 0u; i < 16u; i++)
@@ -3259,6 +4105,25 @@ static void AES_128_CMAC_Generate_Subkey(const uint8_t *key, uint8_t *K1, uint8_
     }
 
     AES_128_Encrypt(Z, key, L);
+    AES_128_CMAC_Derive_Subkey(L, K1, K2);
+}
+#endif /* SECLIB_AES_CT_SERIAL */
+
+/*! *********************************************************************************
+ * \brief  Derives the two CMAC subkeys from L, the encryption of the zero block
+ *
+ * \param [in]    L          AES-128(KEY, 0).
+ *
+ * \param [out]   K1         First subkey.
+ *
+ * \param [out]   K2         Second subkey.
+ *
+ ********************************************************************************** */
+static void AES_128_CMAC_Derive_Subkey(const uint8_t *L, uint8_t *K1, uint8_t *K2)
+{
+    uint8_t const_Rb[16] = {0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+                            0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x87u};
+    uint8_t tmp[16]      = {0};
 
     if ((L[0] & 0x80u) == 0u)
     {
@@ -3283,6 +4148,194 @@ static void AES_128_CMAC_Generate_Subkey(const uint8_t *key, uint8_t *K1, uint8_
     }
 }
 
+/*! *********************************************************************************
+ * \brief  Encrypts a 16-byte block with the state of an AES-128 key context
+ *
+ * \param [in]    pState     State set up by AES_128_KeyCtxInit().
+ *
+ * \param [in]    pInput     Plain text block.
+ *
+ * \param [out]   pOutput    Ciphered block.
+ *
+ ********************************************************************************** */
+static void AES_128_KeyStateEncrypt(const secAesKeyState_t *pState, const uint8_t *pInput, uint8_t *pOutput)
+{
+#if (defined(FSL_FEATURE_SOC_MMCAU_COUNT) && (FSL_FEATURE_SOC_MMCAU_COUNT > 0))
+    mmcauAesContext_t *pCtx = &mmcauAesCtx;
+    uint8_t           *pIn  = (uint8_t *)pInput;
+    uint8_t           *pOut = pOutput;
+
+    SECLIB_MUTEX_LOCK();
+
+    /* The key expansion is done by AES_128_KeyCtxInit(), only the data may need to be realigned */
+    if (((uint32_t)pInput & 0x00000003u) != 0U)
+    {
+        FLib_MemCpy(pCtx->alignedIn, pInput, AES_BLOCK_SIZE);
+        pIn = pCtx->alignedIn;
+    }
+    if (((uint32_t)pOutput & 0x00000003u) != 0U)
+    {
+        pOut = pCtx->alignedOut;
+    }
+
+    mmcau_aes_encrypt(pIn, pState->keyExpansion, AES128_ROUNDS, pOut);
+
+    if (pOut == pCtx->alignedOut)
+    {
+        FLib_MemCpy(pOutput, pCtx->alignedOut, AES_BLOCK_SIZE);
+    }
+
+    SECLIB_MUTEX_UNLOCK();
+#elif SECLIB_AES_CT_SERIAL
+    sw_aes128_ct_ecb_encrypt(&pState->ctKey, pInput, pOutput, 1U);
+#else
+    AES_128_Encrypt(pInput, pState->key, pOutput);
+#endif
+}
+
+#if SECLIB_AES_CT_SERIAL
+/*! *********************************************************************************
+ * \brief  Computes the two CMAC subkeys with a constant time AES-128 key schedule
+ *
+ * \param [in]    pCtx       Key schedule.
+ *
+ * \param [out]   K1         First subkey.
+ *
+ * \param [out]   K2         Second subkey.
+ *
+ ********************************************************************************** */
+static void AES_128_CtCmacSubkeys(const sw_aes128_ct_ctx_t *pCtx, uint8_t *K1, uint8_t *K2)
+{
+    uint8_t L[AES_BLOCK_SIZE] = {0U};
+
+    sw_aes128_ct_ecb_encrypt(pCtx, L, L, 1U);
+    AES_128_CMAC_Derive_Subkey(L, K1, K2);
+}
+
+/*! *********************************************************************************
+ * \brief  Continues an AES-128-CMAC computation up to the last block
+ *
+ * \param [in]    pCtx       Key schedule.
+ *
+ * \param [in]    K1, K2     CMAC subkeys.
+ *
+ * \param [in]    pInput     Input message, MSB first.
+ *
+ * \param [in]    inputLen   Length of the input message in bytes.
+ *
+ * \param [in,out] pMac      Chaining value on input, zero for a plain CMAC. Authentication code on output.
+ *
+ ********************************************************************************** */
+static void AES_128_CtCmac(const sw_aes128_ct_ctx_t *pCtx,
+                           const uint8_t            *K1,
+                           const uint8_t            *K2,
+                           const uint8_t            *pInput,
+                           uint32_t                  inputLen,
+                           uint8_t                  *pMac)
+{
+    uint8_t  M_last[AES_BLOCK_SIZE];
+    uint32_t numBlocks = (inputLen == 0U) ? 0U : ((inputLen - 1U) / AES_BLOCK_SIZE);
+    uint32_t lastLen   = inputLen - (numBlocks * AES_BLOCK_SIZE);
+
+    /* All the blocks but the last one are chained straight from the input */
+    sw_aes128_ct_cbc_mac(pCtx, pInput, numBlocks, pMac);
+    pInput += numBlocks * AES_BLOCK_SIZE;
+
+    /* The last block is xored with K1 if complete, padded and xored with K2 otherwise */
+    if (lastLen == AES_BLOCK_SIZE)
+    {
+        SecLib_Xor128(pInput, K1, M_last);
+    }
+    else
+    {
+        (void)SecLib_Padding(pInput, M_last, (uint8_t)lastLen);
+        SecLib_XorN(M_last, K2, AES_BLOCK_SIZE);
+    }
+    sw_aes128_ct_cbc_mac(pCtx, M_last, 1U, pMac);
+}
+
+/*! *********************************************************************************
+ * \brief  Computes the OMAC of EAX, that is the CMAC of the tweak block [t]_16 followed by the input
+ *
+ * \param [in]    pCtx       Key schedule.
+ *
+ * \param [in]    K1, K2     CMAC subkeys.
+ *
+ * \param [in]    tweak      0 for the nonce, 1 for the header, 2 for the cipher text.
+ *
+ * \param [in]    pInput     Input message.
+ *
+ * \param [in]    inputLen   Length of the input message in bytes.
+ *
+ * \param [out]   pMac       Authentication code.
+ *
+ ********************************************************************************** */
+static void AES_128_CtOmac(const sw_aes128_ct_ctx_t *pCtx,
+                           const uint8_t            *K1,
+                           const uint8_t            *K2,
+                           uint8_t                   tweak,
+                           const uint8_t            *pInput,
+                           uint32_t                  inputLen,
+                           uint8_t                  *pMac)
+{
+    uint8_t tweakBlock[AES_BLOCK_SIZE] = {0U};
+
+    tweakBlock[AES_BLOCK_SIZE - 1U] = tweak;
+    FLib_MemSet(pMac, 0U, AES_BLOCK_SIZE);
+
+    if (inputLen == 0U)
+    {
+        /* The tweak block is the last block */
+        AES_128_CtCmac(pCtx, K1, K2, tweakBlock, AES_BLOCK_SIZE, pMac);
+    }
+    else
+    {
+        sw_aes128_ct_cbc_mac(pCtx, tweakBlock, 1U, pMac);
+        AES_128_CtCmac(pCtx, K1, K2, pInput, inputLen, pMac);
+    }
+}
+#endif /* SECLIB_AES_CT_SERIAL */
+
+#if SECLIB_AES_CT
+/*! *********************************************************************************
+ * \brief  Performs AES-128-CCM with the CCM stream of SecLib_aes_stream.c, which runs on the key context. The
+ *         parameters are the ones of AES_128_KeyCtxCcm().
+ *
+ * \return 0 if no error, the secResultType_t error otherwise. The plaintext is erased if the MAC doesn't match.
+ *
+ ********************************************************************************** */
+static uint8_t AES_128_CtCcm(const secAesKeyCtx_t *pKeyCtx,
+                             const uint8_t        *pInput,
+                             uint16_t              inputLen,
+                             const uint8_t        *pAuthData,
+                             uint16_t              authDataLen,
+                             const uint8_t        *pNonce,
+                             uint8_t               nonceSize,
+                             uint8_t              *pOutput,
+                             uint8_t              *pCbcMac,
+                             uint8_t               macSize,
+                             uint32_t              flags)
+{
+    secAesCcmCtx_t  ccmCtx;
+    secResultType_t result;
+
+    result = AES_128_CcmInit(&ccmCtx, pKeyCtx, pNonce, nonceSize, authDataLen, inputLen, macSize, flags);
+    if (result == gSecSuccess_c)
+    {
+        (void)AES_128_CcmUpdateAuthData(&ccmCtx, pAuthData, authDataLen);
+        (void)AES_128_CcmUpdate(&ccmCtx, pInput, inputLen, pOutput);
+        result = AES_128_CcmFinish(&ccmCtx, pCbcMac);
+
+        if ((result != gSecSuccess_c) && ((flags & gSecLib_CCM_Decrypt_c) != 0U))
+        {
+            FLib_MemSet(pOutput, 0U, inputLen);
+        }
+    }
+
+    return (uint8_t)result;
+}
+#endif /* SECLIB_AES_CT */
+
 /*! *********************************************************************************
  * \brief    Shifts a given vector to the left with one bit.
  *
@@ -3293,7 +4346,7 @@ static void AES_128_CMAC_Generate_Subkey(const uint8_t *key, uint8_t *K1, uint8_
  * \remarks   This is public open source code! Terms of use must be checked before use!
  *
  ********************************************************************************** */
-static void SecLib_LeftShiftOneBit(uint8_t *input, uint8_t *output)
+static void SecLib_LeftShiftOneBit(const uint8_t *input, uint8_t *output)
 {
     int32_t i;
     uint8_t overflow = 0u;
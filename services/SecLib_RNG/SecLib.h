@@ -91,6 +91,29 @@
 #define gSecLibUseBleDebugKeys_d 0
 #endif
 
+/*! Use the in-tree constant time AES-128 (SecLib_aes_ct.c) instead of the software library in the SW port without
+ *  AES hardware */
+#ifndef gSecLibAesCtEnable_d
+#define gSecLibAesCtEnable_d 0
+#endif
+
+/*! With gSecLibAesCtEnable_d, also use the constant time AES-128 for the single block operations, CBC encryption,
+ *  CMAC and EAX, which are slower with it than with the software library */
+#ifndef gSecLibAesCtSerialEnable_d
+#define gSecLibAesCtSerialEnable_d 0
+#endif
+
+/*! Use the in-tree unrolled SHA-256 (SecLib_sha256.c) instead of the software library in the SW port without MMCAU */
+#ifndef gSecLibSha256UnrolledEnable_d
+#define gSecLibSha256UnrolledEnable_d 0
+#endif
+
+/*! Use the in-tree constant time P-256 multiplications (SecLib_ecp256_comb.c), a fixed-base comb for the key generation
+ *  and a signed window for ECDH, instead of the software library in the SW port without DSP extension */
+#ifndef gSecLibEcp256CombEnable_d
+#define gSecLibEcp256CombEnable_d 0
+#endif
+
 /*! Number of bytes in an S200 blob */
 #define gSecLibElkeBlobSize_c 40U
 
@@ -138,6 +161,67 @@ typedef enum
     gSecLtkElkeBlob_c = 2u  /*<! Input key type is LTK Blob type (when S200 is present) */
 } secInputKeyType_t;
 
+/*! AES-128 key context: the key schedule, or the key object of the crypto hardware, is set up once by
+ *  AES_128_KeyCtxInit() and reused by the AES_128_KeyCtx operations until AES_128_KeyCtxDestroy() */
+typedef struct
+{
+    void *pState; /*<! Backend state allocated from the memory manager, NULL when not initialized */
+} secAesKeyCtx_t;
+
+/*! CBC-MAC state of the AES-128 streaming contexts */
+typedef struct
+{
+    tuAES_Block mac;    /*<! Chaining value */
+    tuAES_Block buffer; /*<! Bytes of the block not processed yet */
+    uint8_t     bytes;  /*<! Number of bytes in buffer */
+} secAesMacState_t;
+
+/*! CTR state of the AES-128 streaming contexts */
+typedef struct
+{
+    tuAES_Block counter;   /*<! Counter of the next keystream block */
+    tuAES_Block keystream; /*<! Keystream block of the last partial block */
+    uint8_t     used;      /*<! Number of keystream bytes already used, AES_BLOCK_SIZE when none is left */
+} secAesCtrState_t;
+
+/*! AES-128-CMAC streaming context, see AES_128_CmacInit() */
+typedef struct
+{
+    const secAesKeyCtx_t *pKeyCtx; /*<! Key context, it must not be destroyed before the stream is finished */
+    secAesMacState_t      mac;
+} secAesCmacCtx_t;
+
+/*! AES-128-CCM streaming context, see AES_128_CcmInit() */
+typedef struct
+{
+    const secAesKeyCtx_t *pKeyCtx; /*<! Key context, it must not be destroyed before the stream is finished */
+    secAesMacState_t      mac;
+    secAesCtrState_t      ctr;
+    tuAES_Block           tagMask;      /*<! Encrypted first counter block, masks the MAC */
+    uint32_t              authDataLeft; /*<! Bytes of additional authentication data still expected */
+    uint32_t              inputLeft;    /*<! Bytes of message still expected */
+    uint8_t               macSize;
+    uint8_t               decrypt;
+} secAesCcmCtx_t;
+
+/*! AES-128-EAX streaming context, see AES_128_EaxInit() */
+typedef struct
+{
+    const secAesKeyCtx_t *pKeyCtx; /*<! Key context, it must not be destroyed before the stream is finished */
+    secAesMacState_t      headerMac; /*<! OMAC of the header */
+    secAesMacState_t      dataMac;   /*<! OMAC of the ciphertext */
+    secAesCtrState_t      ctr;
+    tuAES_Block           nonceMac; /*<! OMAC of the nonce */
+    uint8_t               decrypt;
+} secAesEaxCtx_t;
+
+/*! HMAC-SHA256 key context: the key pads are prepared once by HMAC_SHA256_KeyCtxInit() and reused by
+ *  HMAC_SHA256_KeyCtxStart() and HMAC_SHA256_KeyCtxCompute() until HMAC_SHA256_KeyCtxDestroy() */
+typedef struct
+{
+    void *pState; /*<! Backend state allocated from the memory manager, NULL when not initialized */
+} secHmacSha256KeyCtx_t;
+
 /************************************************************************************
 *************************************************************************************
 * Public functions
@@ -508,6 +592,300 @@ uint8_t AES_128_CCM(const uint8_t *pInput,
                     uint8_t        macSize,
                     uint32_t       flags);
 
+/*! *********************************************************************************
+ * \brief  This function sets up an AES-128 key context. The key schedule, or the key object of the crypto hardware,
+ *         is prepared once and reused by all the AES_128_KeyCtx operations, instead of once per call with the
+ *         functions taking the raw key.
+ *
+ * \param[out]  pCtx  Pointer to the key context to set up.
+ *
+ * \param[in]  pKey  Pointer to the location of the 128-bit key. The key is not referenced after the call.
+ *
+ * \return : gSecSuccess_c if no error,
+ *           gSecBadArgument_c in case of bad arguments,
+ *           gSecAllocError_c if the backend state can't be allocated,
+ *           gSecError_c in case of internal error.
+ *
+ * \remarks The context must be released with AES_128_KeyCtxDestroy(). With the secure subsystem the key object lives
+ *          in the key store of the crypto hardware, the contexts must be set up again after SecLib_DeInit().
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_KeyCtxInit(secAesKeyCtx_t *pCtx, const uint8_t *pKey);
+
+/*! *********************************************************************************
+ * \brief  This function releases an AES-128 key context. The key material is erased.
+ *
+ * \param[in, out]  pCtx  Pointer to the key context, pState is NULL on exit. Nothing is done if it's not set up.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxDestroy(secAesKeyCtx_t *pCtx);
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128 encryption on a 16-byte block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the 16-byte plain text block.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput);
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-ECB encryption on a message block with a key context.
+ *         This function only accepts input lengths which are multiple of 16 bytes (AES 128 block size).
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEcbEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput);
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CTR encryption or decryption on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes, it doesn't need to be a multiple of 16 bytes.
+ *
+ * \param[in, out]  pCounter Pointer to the location of the 128-bit counter. On exit the counter is incremented once
+ *                  per block, the last partial block included.
+ *
+ * \param[out]  pOutput Pointer to the location to store the output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCtr(
+    const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pCounter, uint8_t *pOutput);
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CMAC on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message. The input data must be provided MSB first.
+ *
+ * \param[in]  inputLen Length of the input message in bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte authentication code, generated MSB first.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCmac(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput);
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CCM on a message block with a key context. The parameters are the ones of
+ *         AES_128_CCM(), the key context replaces the key.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \return      uint8_t     0 if encryption/decryption was successful, error status otherwise.
+ *
+ * \remarks At decryption, MIC fail is also signalled by returning a non-zero value.
+ *
+ ********************************************************************************** */
+uint8_t AES_128_KeyCtxCcm(const secAesKeyCtx_t *pCtx,
+                          const uint8_t        *pInput,
+                          uint16_t              inputLen,
+                          const uint8_t        *pAuthData,
+                          uint16_t              authDataLen,
+                          const uint8_t        *pNonce,
+                          uint8_t               nonceSize,
+                          uint8_t              *pOutput,
+                          uint8_t              *pCbcMac,
+                          uint8_t               macSize,
+                          uint32_t              flags);
+
+/*! *********************************************************************************
+ * \brief  This function starts an AES-128-CMAC computation on a message given in several parts.
+ *
+ * \param[out]  pCtx  Pointer to the CMAC context, it can be on the stack.
+ *
+ * \param[in]  pKeyCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \return gSecSuccess_c if no error, gSecBadArgument_c in case of bad arguments.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CmacInit(secAesCmacCtx_t *pCtx, const secAesKeyCtx_t *pKeyCtx);
+
+/*! *********************************************************************************
+ * \brief  This function adds a part of the message to an AES-128-CMAC computation.
+ *
+ * \param[in, out]  pCtx  Pointer to the CMAC context set up by AES_128_CmacInit().
+ *
+ * \param[in]  pInput  Pointer to the part of the message, MSB first. It can be of any length.
+ *
+ * \param[in]  inputLen  Length of the part in bytes.
+ *
+ ********************************************************************************** */
+void AES_128_CmacUpdate(secAesCmacCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen);
+
+/*! *********************************************************************************
+ * \brief  This function finishes an AES-128-CMAC computation. The context is erased.
+ *
+ * \param[in, out]  pCtx  Pointer to the CMAC context.
+ *
+ * \param[out]  pOutput  Pointer to the location to store the 16-byte authentication code, generated MSB first.
+ *
+ * \remarks The result is the one of AES_128_CMAC() on the whole message.
+ *
+ ********************************************************************************** */
+void AES_128_CmacFinish(secAesCmacCtx_t *pCtx, uint8_t *pOutput);
+
+/*! *********************************************************************************
+ * \brief  This function starts an AES-128-CCM encryption or decryption of a message given in several parts.
+ *
+ * \param[out]  pCtx  Pointer to the CCM context, it can be on the stack.
+ *
+ * \param[in]  pKeyCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pNonce  Pointer to the nonce.
+ *
+ * \param[in]  nonceSize  The size of the nonce (7-13).
+ *
+ * \param[in]  authDataLen  Total length of the additional authentication data.
+ *
+ * \param[in]  inputLen  Total length of the message, without the MAC when decrypting.
+ *
+ * \param[in]  macSize  The size of the MAC (4, 6, 8, 10, 12, 14 or 16), or 0 for the CCM* encryption without MAC.
+ *
+ * \param[in]  flags  gSecLib_CCM_Encrypt_c or gSecLib_CCM_Decrypt_c.
+ *
+ * \return gSecSuccess_c if no error, gSecBadArgument_c in case of bad arguments.
+ *
+ * \remarks CCM puts the lengths in the first block, so they are needed before the data. The additional
+ *          authentication data is given first with AES_128_CcmUpdateAuthData(), then the message with
+ *          AES_128_CcmUpdate(), in parts of any length.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CcmInit(secAesCcmCtx_t       *pCtx,
+                                const secAesKeyCtx_t *pKeyCtx,
+                                const uint8_t        *pNonce,
+                                uint8_t               nonceSize,
+                                uint32_t              authDataLen,
+                                uint32_t              inputLen,
+                                uint8_t               macSize,
+                                uint32_t              flags);
+
+/*! *********************************************************************************
+ * \brief  This function adds a part of the additional authentication data to an AES-128-CCM operation.
+ *
+ * \param[in, out]  pCtx  Pointer to the CCM context set up by AES_128_CcmInit().
+ *
+ * \param[in]  pAuthData  Pointer to the part of the additional authentication data.
+ *
+ * \param[in]  authDataLen  Length of the part in bytes.
+ *
+ * \return gSecSuccess_c if no error, gSecBadArgument_c if more data is given than announced to AES_128_CcmInit().
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CcmUpdateAuthData(secAesCcmCtx_t *pCtx, const uint8_t *pAuthData, uint32_t authDataLen);
+
+/*! *********************************************************************************
+ * \brief  This function encrypts or decrypts a part of the message of an AES-128-CCM operation.
+ *
+ * \param[in, out]  pCtx  Pointer to the CCM context set up by AES_128_CcmInit().
+ *
+ * \param[in]  pInput  Pointer to the part of the plaintext when encrypting, of the ciphertext when decrypting.
+ *
+ * \param[in]  inputLen  Length of the part in bytes.
+ *
+ * \param[out]  pOutput  Pointer to the location to store the output, it can be pInput.
+ *
+ * \return gSecSuccess_c if no error,
+ *          gSecBadArgument_c if more data is given than announced to AES_128_CcmInit(),
+ *          gSecError_c if the additional authentication data isn't complete.
+ *
+ * \remarks When decrypting, the plaintext must not be used before AES_128_CcmFinish() has checked the MAC.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CcmUpdate(secAesCcmCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput);
+
+/*! *********************************************************************************
+ * \brief  This function finishes an AES-128-CCM operation. The context is erased.
+ *
+ * \param[in, out]  pCtx  Pointer to the CCM context.
+ *
+ * \param[in, out]  pCbcMac  Pointer to the location to store the MAC when encrypting, to the received MAC when
+ *                           decrypting.
+ *
+ * \return gSecSuccess_c if no error,
+ *          gSecError_c if the received MAC doesn't match or if less data was given than announced.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CcmFinish(secAesCcmCtx_t *pCtx, uint8_t *pCbcMac);
+
+#if gSecLibAesEaxEnable_d
+/*! *********************************************************************************
+ * \brief  This function starts an AES-128-EAX encryption or decryption of a message given in several parts.
+ *
+ * \param[out]  pCtx  Pointer to the EAX context, it can be on the stack.
+ *
+ * \param[in]  pKeyCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pNonce  Pointer to the nonce.
+ *
+ * \param[in]  nonceLen  Nonce length in bytes.
+ *
+ * \param[in]  flags  gSecLib_CCM_Encrypt_c or gSecLib_CCM_Decrypt_c.
+ *
+ * \return gSecSuccess_c if no error, gSecBadArgument_c in case of bad arguments.
+ *
+ * \remarks The header, with AES_128_EaxUpdateHeader(), and the message, with AES_128_EaxUpdate(), can be given in
+ *          parts of any length, in any order.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_EaxInit(
+    secAesEaxCtx_t *pCtx, const secAesKeyCtx_t *pKeyCtx, const uint8_t *pNonce, uint32_t nonceLen, uint32_t flags);
+
+/*! *********************************************************************************
+ * \brief  This function adds a part of the header to an AES-128-EAX operation.
+ *
+ * \param[in, out]  pCtx  Pointer to the EAX context set up by AES_128_EaxInit().
+ *
+ * \param[in]  pHeader  Pointer to the part of the header.
+ *
+ * \param[in]  headerLen  Length of the part in bytes.
+ *
+ ********************************************************************************** */
+void AES_128_EaxUpdateHeader(secAesEaxCtx_t *pCtx, const uint8_t *pHeader, uint32_t headerLen);
+
+/*! *********************************************************************************
+ * \brief  This function encrypts or decrypts a part of the message of an AES-128-EAX operation.
+ *
+ * \param[in, out]  pCtx  Pointer to the EAX context set up by AES_128_EaxInit().
+ *
+ * \param[in]  pInput  Pointer to the part of the plaintext when encrypting, of the ciphertext when decrypting.
+ *
+ * \param[in]  inputLen  Length of the part in bytes.
+ *
+ * \param[out]  pOutput  Pointer to the location to store the output, it can be pInput.
+ *
+ * \remarks When decrypting, the plaintext must not be used before AES_128_EaxFinish() has checked the tag.
+ *
+ ********************************************************************************** */
+void AES_128_EaxUpdate(secAesEaxCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput);
+
+/*! *********************************************************************************
+ * \brief  This function finishes an AES-128-EAX operation. The context is erased.
+ *
+ * \param[in, out]  pCtx  Pointer to the EAX context.
+ *
+ * \param[in, out]  pTag  Pointer to the location to store the 128-bit tag when encrypting, to the received tag when
+ *                        decrypting.
+ *
+ * \return gSecSuccess_c if no error, gSecError_c if the received tag doesn't match.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_EaxFinish(secAesEaxCtx_t *pCtx, uint8_t *pTag);
+#endif /* gSecLibAesEaxEnable_d */
+
 #if !defined(gSecLibUsePsa_d) || (gSecLibUsePsa_d == 0)
 #if gSecLibSha1Enable_d
 /*! *********************************************************************************
@@ -703,6 +1081,57 @@ void HMAC_SHA256_Update(void *pContext, const uint8_t *pData, uint32_t numBytes)
  *
  ********************************************************************************** */
 void HMAC_SHA256_Finish(void *pContext, uint8_t *pOutput);
+
+/*! *********************************************************************************
+ * \brief  This function sets up an HMAC-SHA256 key context. With the SW port the SHA256 states after the inner and
+ *         outer key pads are computed once, so that an HMAC of a message shorter than 56 bytes costs two SHA256
+ *         block compressions instead of four, as in the PBKDF2 iterations.
+ *
+ * \param [out]   pCtx        Pointer to the key context to set up.
+ * \param [in]    pKey        Pointer to the HMAC key. The key is not referenced after the call.
+ * \param [in]    keyLen      Length of the HMAC key in bytes
+ *
+ * \return gSecSuccess_c if no error,
+ *         gSecBadArgument_c in case of bad arguments,
+ *         gSecAllocError_c if the backend state can't be allocated.
+ *
+ * \remarks The context must be released with HMAC_SHA256_KeyCtxDestroy().
+ *
+ ********************************************************************************** */
+secResultType_t HMAC_SHA256_KeyCtxInit(secHmacSha256KeyCtx_t *pCtx, const uint8_t *pKey, uint32_t keyLen);
+
+/*! *********************************************************************************
+ * \brief  This function releases an HMAC-SHA256 key context. The key material is erased.
+ *
+ * \param [in, out]  pCtx     Pointer to the key context, pState is NULL on exit. Nothing is done if it's not set up.
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxDestroy(secHmacSha256KeyCtx_t *pCtx);
+
+/*! *********************************************************************************
+ * \brief  This function initializes an HMAC SHA256 context from a key context, as HMAC_SHA256_Init() does with
+ *         the key. The message is then given with HMAC_SHA256_Update() and HMAC_SHA256_Finish().
+ *
+ * \param [in]    pCtx        Pointer to the key context set up by HMAC_SHA256_KeyCtxInit().
+ * \param [out]   pContext    Pointer to the HMAC SHA256 context data
+ *                            Allocated using HMAC_SHA256_AllocCtx()
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxStart(const secHmacSha256KeyCtx_t *pCtx, void *pContext);
+
+/*! *********************************************************************************
+ * \brief  This function performs all HMAC SHA256 steps on a message with a key context.
+ *
+ * \param [in]    pCtx        Pointer to the key context set up by HMAC_SHA256_KeyCtxInit().
+ * \param [in]    pData       Pointer to the input data
+ * \param [in]    numBytes    Number of bytes to perform HMAC on
+ * \param [out]   pOutput     Pointer to the output location
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxCompute(const secHmacSha256KeyCtx_t *pCtx,
+                               const uint8_t               *pData,
+                               uint32_t                     numBytes,
+                               uint8_t                     *pOutput);
 #endif
 
 /*! *********************************************************************************
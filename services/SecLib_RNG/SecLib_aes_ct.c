@@ -0,0 +1,634 @@
+/*! *********************************************************************************
+ * Copyright 2025 NXP
+ *
+ * \file
+ *
+ * This is the source file of the constant time software AES-128 used by the SW SecLib port when
+ * gSecLibAesCtEnable_d is set.
+ *
+ * The cipher is bitsliced: two blocks are processed at once as eight 32-bit words, word i holding the bit i of the
+ * 32 bytes. In a word, the bits 8*r to 8*r+7 hold the row r of the state, the bits 2*c and 2*c+1 of a row its
+ * column c for the first and the second block. SubBytes is a Boolean circuit, ShiftRows and MixColumns are shifts
+ * and rotations, so there is no memory access and no branch depending on the key or the data.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ ********************************************************************************** */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "FunctionLib.h"
+#include "SecLib.h"
+#include "CryptoLibSW.h"
+
+#if (defined(gSecLibAesCtEnable_d) && (gSecLibAesCtEnable_d > 0))
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+********************************************************************************** */
+
+#define AES_CT_ROUNDS 10U
+
+/* Number of words of a bitsliced state or round key */
+#define AES_CT_WORDS 8U
+
+/* Exchanges the bits selected by (mask << shift) in a with the bits selected by mask in b */
+#define AES_CT_SWAP_BITS(a, b, mask, shift)                                          \
+    do                                                                               \
+    {                                                                                \
+        uint32_t aes_ct_t = ((((a) >> (shift)) ^ (b)) & (mask));                     \
+        (b) ^= aes_ct_t;                                                             \
+        (a) ^= (aes_ct_t << (shift));                                                \
+    } while (false)
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+********************************************************************************** */
+
+static inline uint32_t aes_ct_load32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void aes_ct_store32(uint8_t *p, uint32_t x)
+{
+    p[0] = (uint8_t)x;
+    p[1] = (uint8_t)(x >> 8);
+    p[2] = (uint8_t)(x >> 16);
+    p[3] = (uint8_t)(x >> 24);
+}
+
+static inline uint32_t aes_ct_rotr(uint32_t x, uint32_t n)
+{
+    return (x >> n) | (x << (32U - n));
+}
+
+/*! Transposes the eight words, per byte lane: bit b of word i goes to bit i of word b. It is its own inverse. */
+static void aes_ct_ortho(uint32_t q[AES_CT_WORDS])
+{
+    AES_CT_SWAP_BITS(q[0], q[1], 0x55555555U, 1U);
+    AES_CT_SWAP_BITS(q[2], q[3], 0x55555555U, 1U);
+    AES_CT_SWAP_BITS(q[4], q[5], 0x55555555U, 1U);
+    AES_CT_SWAP_BITS(q[6], q[7], 0x55555555U, 1U);
+
+    AES_CT_SWAP_BITS(q[0], q[2], 0x33333333U, 2U);
+    AES_CT_SWAP_BITS(q[1], q[3], 0x33333333U, 2U);
+    AES_CT_SWAP_BITS(q[4], q[6], 0x33333333U, 2U);
+    AES_CT_SWAP_BITS(q[5], q[7], 0x33333333U, 2U);
+
+    AES_CT_SWAP_BITS(q[0], q[4], 0x0F0F0F0FU, 4U);
+    AES_CT_SWAP_BITS(q[1], q[5], 0x0F0F0F0FU, 4U);
+    AES_CT_SWAP_BITS(q[2], q[6], 0x0F0F0F0FU, 4U);
+    AES_CT_SWAP_BITS(q[3], q[7], 0x0F0F0F0FU, 4U);
+}
+
+/*! Loads two blocks, the second one may be the first one again, and transposes them */
+static void aes_ct_load_blocks(uint32_t q[AES_CT_WORDS], const uint8_t *pBlock0, const uint8_t *pBlock1)
+{
+    for (uint32_t c = 0U; c < 4U; c++)
+    {
+        q[2U * c]      = aes_ct_load32(&pBlock0[4U * c]);
+        q[2U * c + 1U] = aes_ct_load32(&pBlock1[4U * c]);
+    }
+    aes_ct_ortho(q);
+}
+
+/*! Transposes back and stores two blocks, pBlock1 may be NULL when only the first block is needed */
+static void aes_ct_store_blocks(uint32_t q[AES_CT_WORDS], uint8_t *pBlock0, uint8_t *pBlock1)
+{
+    aes_ct_ortho(q);
+    for (uint32_t c = 0U; c < 4U; c++)
+    {
+        aes_ct_store32(&pBlock0[4U * c], q[2U * c]);
+        if (pBlock1 != NULL)
+        {
+            aes_ct_store32(&pBlock1[4U * c], q[2U * c + 1U]);
+        }
+    }
+}
+
+/*! SubBytes on the 32 bytes. This is the 113 gates circuit of J. Boyar and R. Peralta, "A small depth-16 circuit
+ *  for the AES S-box", 2011. x0 is the most significant bit. */
+static void aes_ct_sbox(uint32_t q[AES_CT_WORDS])
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19, y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29, t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49, t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* Top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9  = x0 ^ x3;
+    y8  = x0 ^ x5;
+    t0  = x1 ^ x2;
+    y1  = t0 ^ x7;
+    y4  = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2  = y1 ^ x0;
+    y5  = y1 ^ x6;
+    y3  = y5 ^ y8;
+    t1  = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6  = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7  = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* Inversion in GF(2^4) then GF(2^8) */
+    t2  = y12 & y15;
+    t3  = y3 & y6;
+    t4  = t3 ^ t2;
+    t5  = y4 & x7;
+    t6  = t5 ^ t2;
+    t7  = y13 & y16;
+    t8  = y5 & y1;
+    t9  = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0  = t44 & y15;
+    z1  = t37 & y6;
+    z2  = t33 & x7;
+    z3  = t43 & y16;
+    z4  = t40 & y1;
+    z5  = t29 & y7;
+    z6  = t42 & y11;
+    z7  = t45 & y17;
+    z8  = t41 & y10;
+    z9  = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* Bottom linear transformation, the affine constant is in the complements */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    t67 = t64 ^ t65;
+
+    q[7] = t59 ^ t63;
+    q[1] = t56 ^ ~t62;
+    q[0] = t48 ^ ~t60;
+    q[4] = t53 ^ t66;
+    q[3] = t51 ^ t66;
+    q[2] = t47 ^ t65;
+    q[6] = t64 ^ ~q[4];
+    q[5] = t55 ^ ~t67;
+}
+
+/*! Inverse of the affine transformation of the S-box: b[i] ^= b[i+2] ^ b[i+5] ^ b[i+7] ^ 0x05[i] */
+static void aes_ct_inv_affine(uint32_t q[AES_CT_WORDS])
+{
+    uint32_t b[AES_CT_WORDS];
+
+    for (uint32_t i = 0U; i < AES_CT_WORDS; i++)
+    {
+        b[i] = q[i];
+    }
+    for (uint32_t i = 0U; i < AES_CT_WORDS; i++)
+    {
+        q[i] = b[(i + 2U) & 7U] ^ b[(i + 5U) & 7U] ^ b[(i + 7U) & 7U];
+    }
+    q[0] = ~q[0];
+    q[2] = ~q[2];
+}
+
+/*! InvSubBytes: S^-1(x) = A^-1(S(A^-1(x))), A being the affine transformation of the S-box */
+static void aes_ct_inv_sbox(uint32_t q[AES_CT_WORDS])
+{
+    aes_ct_inv_affine(q);
+    aes_ct_sbox(q);
+    aes_ct_inv_affine(q);
+}
+
+static void aes_ct_add_round_key(uint32_t q[AES_CT_WORDS], const uint32_t *pRoundKey)
+{
+    for (uint32_t i = 0U; i < AES_CT_WORDS; i++)
+    {
+        q[i] ^= pRoundKey[i];
+    }
+}
+
+/*! ShiftRows: the row r is rotated by r columns, that is 2*r bits in its byte */
+static void aes_ct_shift_rows(uint32_t q[AES_CT_WORDS])
+{
+    for (uint32_t i = 0U; i < AES_CT_WORDS; i++)
+    {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000FFU) | ((x & 0x0000FC00U) >> 2) | ((x & 0x00000300U) << 6) | ((x & 0x00F00000U) >> 4) |
+               ((x & 0x000F0000U) << 4) | ((x & 0xC0000000U) >> 6) | ((x & 0x3F000000U) << 2);
+    }
+}
+
+static void aes_ct_inv_shift_rows(uint32_t q[AES_CT_WORDS])
+{
+    for (uint32_t i = 0U; i < AES_CT_WORDS; i++)
+    {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000FFU) | ((x & 0x00003F00U) << 2) | ((x & 0x0000C000U) >> 6) | ((x & 0x00F00000U) >> 4) |
+               ((x & 0x000F0000U) << 4) | ((x & 0x03000000U) << 6) | ((x & 0xFC000000U) >> 2);
+    }
+}
+
+/*! MixColumns: out[r] = 2.(a[r] ^ a[r+1]) ^ a[r+1] ^ a[r+2] ^ a[r+3]. Rotating a word right by 8 bits aligns the row
+ *  r+1 on the row r, the multiplication by 2 moves the bits to the next word and reduces by x^8 + x^4 + x^3 + x + 1. */
+static void aes_ct_mix_columns(uint32_t q[AES_CT_WORDS])
+{
+    uint32_t r[AES_CT_WORDS];
+    uint32_t s[AES_CT_WORDS];
+
+    for (uint32_t i = 0U; i < AES_CT_WORDS; i++)
+    {
+        r[i] = aes_ct_rotr(q[i], 8U);
+        s[i] = q[i] ^ r[i];
+    }
+
+    q[0] = s[7] ^ r[0] ^ aes_ct_rotr(s[0], 16U);
+    q[1] = s[0] ^ s[7] ^ r[1] ^ aes_ct_rotr(s[1], 16U);
+    q[2] = s[1] ^ r[2] ^ aes_ct_rotr(s[2], 16U);
+    q[3] = s[2] ^ s[7] ^ r[3] ^ aes_ct_rotr(s[3], 16U);
+    q[4] = s[3] ^ s[7] ^ r[4] ^ aes_ct_rotr(s[4], 16U);
+    q[5] = s[4] ^ r[5] ^ aes_ct_rotr(s[5], 16U);
+    q[6] = s[5] ^ r[6] ^ aes_ct_rotr(s[6], 16U);
+    q[7] = s[6] ^ r[7] ^ aes_ct_rotr(s[7], 16U);
+}
+
+/*! InvMixColumns is MixColumns after a multiplication by the polynomial {04}x^2 + {05}:
+ *  out[r] = a[r] ^ 4.(a[r] ^ a[r+2]) */
+static void aes_ct_inv_mix_columns(uint32_t q[AES_CT_WORDS])
+{
+    uint32_t s[AES_CT_WORDS];
+
+    for (uint32_t i = 0U; i < AES_CT_WORDS; i++)
+    {
+        s[i] = q[i] ^ aes_ct_rotr(q[i], 16U);
+    }
+
+    q[0] ^= s[6];
+    q[1] ^= s[6] ^ s[7];
+    q[2] ^= s[0] ^ s[7];
+    q[3] ^= s[1] ^ s[6];
+    q[4] ^= s[2] ^ s[6] ^ s[7];
+    q[5] ^= s[3] ^ s[7];
+    q[6] ^= s[4];
+    q[7] ^= s[5];
+
+    aes_ct_mix_columns(q);
+}
+
+static void aes_ct_encrypt(const sw_aes128_ct_ctx_t *pCtx, uint32_t q[AES_CT_WORDS])
+{
+    const uint32_t *pRoundKey = pCtx->skey;
+
+    aes_ct_add_round_key(q, pRoundKey);
+    for (uint32_t round = 1U; round < AES_CT_ROUNDS; round++)
+    {
+        pRoundKey += AES_CT_WORDS;
+        aes_ct_sbox(q);
+        aes_ct_shift_rows(q);
+        aes_ct_mix_columns(q);
+        aes_ct_add_round_key(q, pRoundKey);
+    }
+    aes_ct_sbox(q);
+    aes_ct_shift_rows(q);
+    aes_ct_add_round_key(q, pRoundKey + AES_CT_WORDS);
+}
+
+static void aes_ct_decrypt(const sw_aes128_ct_ctx_t *pCtx, uint32_t q[AES_CT_WORDS])
+{
+    const uint32_t *pRoundKey = &pCtx->skey[AES_CT_ROUNDS * AES_CT_WORDS];
+
+    aes_ct_add_round_key(q, pRoundKey);
+    for (uint32_t round = 1U; round < AES_CT_ROUNDS; round++)
+    {
+        pRoundKey -= AES_CT_WORDS;
+        aes_ct_inv_shift_rows(q);
+        aes_ct_inv_sbox(q);
+        aes_ct_add_round_key(q, pRoundKey);
+        aes_ct_inv_mix_columns(q);
+    }
+    aes_ct_inv_shift_rows(q);
+    aes_ct_inv_sbox(q);
+    aes_ct_add_round_key(q, pRoundKey - AES_CT_WORDS);
+}
+
+/*! SubWord of the key schedule, with the bitsliced S-box */
+static uint32_t aes_ct_sub_word(uint32_t x)
+{
+    uint32_t q[AES_CT_WORDS] = {0U};
+
+    q[0] = x;
+    aes_ct_ortho(q);
+    aes_ct_sbox(q);
+    aes_ct_ortho(q);
+
+    return q[0];
+}
+
+/*! Increments a 128-bit big endian counter, without a branch on its value */
+static void aes_ct_increment_counter(uint8_t *pCounter)
+{
+    uint32_t carry = 1U;
+
+    for (uint32_t i = AES_BLOCK_SIZE; i > 0U; i--)
+    {
+        carry += pCounter[i - 1U];
+        pCounter[i - 1U] = (uint8_t)carry;
+        carry >>= 8;
+    }
+}
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+
+void sw_aes128_ct_set_key(sw_aes128_ct_ctx_t *pCtx, const uint8_t *pKey)
+{
+    uint32_t w[4U * (AES_CT_ROUNDS + 1U)];
+    uint32_t rcon = 0x01U;
+
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        w[i] = aes_ct_load32(&pKey[4U * i]);
+    }
+    for (uint32_t i = 4U; i < 4U * (AES_CT_ROUNDS + 1U); i++)
+    {
+        uint32_t tmp = w[i - 1U];
+
+        if ((i & 3U) == 0U)
+        {
+            /* Words are little endian, RotWord is a right rotation */
+            tmp  = aes_ct_sub_word(aes_ct_rotr(tmp, 8U)) ^ rcon;
+            rcon = (rcon << 1) ^ ((rcon >> 7) * 0x11BU);
+        }
+        w[i] = w[i - 4U] ^ tmp;
+    }
+
+    /* Round keys are bitsliced once, with the same key in both blocks */
+    for (uint32_t round = 0U; round <= AES_CT_ROUNDS; round++)
+    {
+        uint32_t *pRoundKey = &pCtx->skey[round * AES_CT_WORDS];
+
+        for (uint32_t c = 0U; c < 4U; c++)
+        {
+            pRoundKey[2U * c]      = w[4U * round + c];
+            pRoundKey[2U * c + 1U] = w[4U * round + c];
+        }
+        aes_ct_ortho(pRoundKey);
+    }
+
+    FLib_MemSet(w, 0U, sizeof(w));
+}
+
+void sw_aes128_ct_ecb_encrypt(const sw_aes128_ct_ctx_t *pCtx,
+                              const uint8_t            *pInput,
+                              uint8_t                  *pOutput,
+                              uint32_t                  numBlocks)
+{
+    uint32_t q[AES_CT_WORDS];
+
+    while (numBlocks >= 2U)
+    {
+        aes_ct_load_blocks(q, pInput, &pInput[AES_BLOCK_SIZE]);
+        aes_ct_encrypt(pCtx, q);
+        aes_ct_store_blocks(q, pOutput, &pOutput[AES_BLOCK_SIZE]);
+        pInput += 2U * AES_BLOCK_SIZE;
+        pOutput += 2U * AES_BLOCK_SIZE;
+        numBlocks -= 2U;
+    }
+    if (numBlocks != 0U)
+    {
+        aes_ct_load_blocks(q, pInput, pInput);
+        aes_ct_encrypt(pCtx, q);
+        aes_ct_store_blocks(q, pOutput, NULL);
+    }
+}
+
+void sw_aes128_ct_ecb_decrypt(const sw_aes128_ct_ctx_t *pCtx,
+                              const uint8_t            *pInput,
+                              uint8_t                  *pOutput,
+                              uint32_t                  numBlocks)
+{
+    uint32_t q[AES_CT_WORDS];
+
+    while (numBlocks >= 2U)
+    {
+        aes_ct_load_blocks(q, pInput, &pInput[AES_BLOCK_SIZE]);
+        aes_ct_decrypt(pCtx, q);
+        aes_ct_store_blocks(q, pOutput, &pOutput[AES_BLOCK_SIZE]);
+        pInput += 2U * AES_BLOCK_SIZE;
+        pOutput += 2U * AES_BLOCK_SIZE;
+        numBlocks -= 2U;
+    }
+    if (numBlocks != 0U)
+    {
+        aes_ct_load_blocks(q, pInput, pInput);
+        aes_ct_decrypt(pCtx, q);
+        aes_ct_store_blocks(q, pOutput, NULL);
+    }
+}
+
+void sw_aes128_ct_cbc_encrypt(
+    const sw_aes128_ct_ctx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput, uint32_t numBlocks, uint8_t *pIv)
+{
+    uint32_t q[AES_CT_WORDS];
+    uint8_t  chain[AES_BLOCK_SIZE];
+
+    FLib_MemCpy(chain, pIv, AES_BLOCK_SIZE);
+    while (numBlocks != 0U)
+    {
+        /* Each block depends on the previous one, the second half of the state is unused */
+        for (uint32_t i = 0U; i < AES_BLOCK_SIZE; i++)
+        {
+            chain[i] ^= pInput[i];
+        }
+        aes_ct_load_blocks(q, chain, chain);
+        aes_ct_encrypt(pCtx, q);
+        aes_ct_store_blocks(q, chain, NULL);
+        FLib_MemCpy(pOutput, chain, AES_BLOCK_SIZE);
+        pInput += AES_BLOCK_SIZE;
+        pOutput += AES_BLOCK_SIZE;
+        numBlocks--;
+    }
+    FLib_MemCpy(pIv, chain, AES_BLOCK_SIZE);
+}
+
+void sw_aes128_ct_cbc_decrypt(
+    const sw_aes128_ct_ctx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput, uint32_t numBlocks, uint8_t *pIv)
+{
+    uint32_t q[AES_CT_WORDS];
+    uint8_t  plain[2U * AES_BLOCK_SIZE];
+    uint8_t  chain[AES_BLOCK_SIZE];
+    uint32_t blocks;
+
+    FLib_MemCpy(chain, pIv, AES_BLOCK_SIZE);
+    while (numBlocks != 0U)
+    {
+        /* Two blocks are deciphered at once, the output may overwrite the input */
+        blocks = (numBlocks >= 2U) ? 2U : 1U;
+        aes_ct_load_blocks(q, pInput, &pInput[(blocks - 1U) * AES_BLOCK_SIZE]);
+        aes_ct_decrypt(pCtx, q);
+        aes_ct_store_blocks(q, plain, &plain[AES_BLOCK_SIZE]);
+        for (uint32_t i = 0U; i < AES_BLOCK_SIZE; i++)
+        {
+            plain[i] ^= chain[i];
+        }
+        if (blocks == 2U)
+        {
+            for (uint32_t i = 0U; i < AES_BLOCK_SIZE; i++)
+            {
+                plain[AES_BLOCK_SIZE + i] ^= pInput[i];
+            }
+        }
+        FLib_MemCpy(chain, &pInput[(blocks - 1U) * AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+        FLib_MemCpy(pOutput, plain, blocks * AES_BLOCK_SIZE);
+        pInput += blocks * AES_BLOCK_SIZE;
+        pOutput += blocks * AES_BLOCK_SIZE;
+        numBlocks -= blocks;
+    }
+    FLib_MemCpy(pIv, chain, AES_BLOCK_SIZE);
+    FLib_MemSet(plain, 0U, sizeof(plain));
+}
+
+void sw_aes128_ct_cbc_mac(const sw_aes128_ct_ctx_t *pCtx, const uint8_t *pInput, uint32_t numBlocks, uint8_t *pMac)
+{
+    uint32_t q[AES_CT_WORDS];
+
+    while (numBlocks != 0U)
+    {
+        for (uint32_t i = 0U; i < AES_BLOCK_SIZE; i++)
+        {
+            pMac[i] ^= pInput[i];
+        }
+        aes_ct_load_blocks(q, pMac, pMac);
+        aes_ct_encrypt(pCtx, q);
+        aes_ct_store_blocks(q, pMac, NULL);
+        pInput += AES_BLOCK_SIZE;
+        numBlocks--;
+    }
+}
+
+void sw_aes128_ct_ctr(
+    const sw_aes128_ct_ctx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput, uint32_t inputLen, uint8_t *pCounter)
+{
+    uint32_t q[AES_CT_WORDS];
+    uint8_t  counter1[AES_BLOCK_SIZE];
+    uint8_t  keyStream[2U * AES_BLOCK_SIZE];
+    uint32_t len;
+
+    while (inputLen != 0U)
+    {
+        /* The key stream of the counter and the next one is computed at once */
+        FLib_MemCpy(counter1, pCounter, AES_BLOCK_SIZE);
+        aes_ct_increment_counter(counter1);
+        aes_ct_load_blocks(q, pCounter, counter1);
+        aes_ct_encrypt(pCtx, q);
+        aes_ct_store_blocks(q, keyStream, &keyStream[AES_BLOCK_SIZE]);
+
+        len = (inputLen > sizeof(keyStream)) ? (uint32_t)sizeof(keyStream) : inputLen;
+        for (uint32_t i = 0U; i < len; i++)
+        {
+            pOutput[i] = pInput[i] ^ keyStream[i];
+        }
+
+        /* One counter value per block, a partial last block included */
+        FLib_MemCpy(pCounter, counter1, AES_BLOCK_SIZE);
+        if (len > AES_BLOCK_SIZE)
+        {
+            aes_ct_increment_counter(pCounter);
+        }
+        pInput += len;
+        pOutput += len;
+        inputLen -= len;
+    }
+    FLib_MemSet(keyStream, 0U, sizeof(keyStream));
+}
+
+#endif /* gSecLibAesCtEnable_d */
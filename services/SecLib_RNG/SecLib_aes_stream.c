@@ -0,0 +1,687 @@
+/*! *********************************************************************************
+ * Copyright 2025 NXP
+ *
+ * \file
+ *
+ * This is the source file for the AES-128 CMAC, CCM and EAX streaming contexts: the message is given in parts of any
+ * length with init, update and finish functions. They are built on the AES_128_KeyCtx functions, so they run on all
+ * the SecLib ports and use the key prepared once by AES_128_KeyCtxInit().
+ * References:
+ * NIST SP 800-38B, CMAC mode for authentication.
+ * NIST SP 800-38C, CCM mode for authentication and confidentiality, and IEEE 802.15.4 annex B for CCM*.
+ * The EAX mode of operation, M. Bellare, P. Rogaway, D. Wagner, 2004.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ ********************************************************************************** */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "SecLib.h"
+#include "FunctionLib.h"
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+********************************************************************************** */
+#define AES_STREAM_CCM_NONCE_MIN 7U
+#define AES_STREAM_CCM_NONCE_MAX 13U
+
+/* CCM first block flags: Adata, M' = (M - 2) / 2 and L' = L - 1 */
+#define AES_STREAM_CCM_ADATA_FLAG  0x40U
+#define AES_STREAM_CCM_MAC_SHIFT   3U
+#define AES_STREAM_CCM_LONG_ADATA  0xFF00U /* from this length the additional data length is coded on 6 bytes */
+#define AES_STREAM_CMAC_RB         0x87U
+#define AES_STREAM_EAX_TWEAK_NONCE 0U
+#define AES_STREAM_EAX_TWEAK_HDR   1U
+#define AES_STREAM_EAX_TWEAK_DATA  2U
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private prototypes
+*************************************************************************************
+********************************************************************************** */
+static void AES_128_StreamXor(uint8_t *pDst, const uint8_t *pSrc, uint32_t len);
+static void AES_128_StreamMacBlock(const secAesKeyCtx_t *pKeyCtx, secAesMacState_t *pMac, const uint8_t *pBlock);
+static void AES_128_StreamMacUpdate(const secAesKeyCtx_t *pKeyCtx,
+                                    secAesMacState_t     *pMac,
+                                    const uint8_t        *pData,
+                                    uint32_t              dataLen,
+                                    bool_t                keepLast);
+static void AES_128_StreamMacPad(const secAesKeyCtx_t *pKeyCtx, secAesMacState_t *pMac);
+static void AES_128_StreamCmacFinish(const secAesKeyCtx_t *pKeyCtx, secAesMacState_t *pMac, uint8_t *pOutput);
+static void AES_128_StreamDouble(uint8_t *pBlock);
+static void AES_128_StreamIncrementCounter(uint8_t *pCounter);
+static void AES_128_StreamCtr(const secAesKeyCtx_t *pKeyCtx,
+                              secAesCtrState_t     *pCtr,
+                              const uint8_t        *pInput,
+                              uint32_t              inputLen,
+                              uint8_t              *pOutput);
+#if gSecLibAesEaxEnable_d
+static void AES_128_StreamOmacInit(secAesMacState_t *pMac, uint8_t tweak);
+#endif
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+
+/*! *********************************************************************************
+ * \brief  This function starts an AES-128-CMAC computation on a message given in several parts.
+ *
+ * \param[out]  pCtx  Pointer to the CMAC context.
+ *
+ * \param[in]  pKeyCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \return gSecSuccess_c if no error, gSecBadArgument_c in case of bad arguments.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CmacInit(secAesCmacCtx_t *pCtx, const secAesKeyCtx_t *pKeyCtx)
+{
+    secResultType_t result = gSecBadArgument_c;
+
+    if ((pCtx != NULL) && (pKeyCtx != NULL) && (pKeyCtx->pState != NULL))
+    {
+        FLib_MemSet(pCtx, 0U, sizeof(secAesCmacCtx_t));
+        pCtx->pKeyCtx = pKeyCtx;
+        result        = gSecSuccess_c;
+    }
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function adds a part of the message to an AES-128-CMAC computation.
+ *
+ * \param[in, out]  pCtx  Pointer to the CMAC context set up by AES_128_CmacInit().
+ *
+ * \param[in]  pInput  Pointer to the part of the message.
+ *
+ * \param[in]  inputLen  Length of the part in bytes.
+ *
+ ********************************************************************************** */
+void AES_128_CmacUpdate(secAesCmacCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen)
+{
+    /* The last block is xored with a subkey, it's kept until the finish */
+    AES_128_StreamMacUpdate(pCtx->pKeyCtx, &pCtx->mac, pInput, inputLen, TRUE);
+}
+
+/*! *********************************************************************************
+ * \brief  This function finishes an AES-128-CMAC computation. The context is erased.
+ *
+ * \param[in, out]  pCtx  Pointer to the CMAC context.
+ *
+ * \param[out]  pOutput  Pointer to the location to store the 16-byte authentication code.
+ *
+ ********************************************************************************** */
+void AES_128_CmacFinish(secAesCmacCtx_t *pCtx, uint8_t *pOutput)
+{
+    AES_128_StreamCmacFinish(pCtx->pKeyCtx, &pCtx->mac, pOutput);
+    FLib_MemSet(pCtx, 0U, sizeof(secAesCmacCtx_t));
+}
+
+/*! *********************************************************************************
+ * \brief  This function starts an AES-128-CCM encryption or decryption of a message given in several parts.
+ *
+ * \param[out]  pCtx  Pointer to the CCM context.
+ *
+ * \param[in]  pKeyCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pNonce  Pointer to the nonce.
+ *
+ * \param[in]  nonceSize  The size of the nonce (7-13).
+ *
+ * \param[in]  authDataLen  Total length of the additional authentication data.
+ *
+ * \param[in]  inputLen  Total length of the message.
+ *
+ * \param[in]  macSize  The size of the MAC, 0 for CCM* without MAC.
+ *
+ * \param[in]  flags  gSecLib_CCM_Encrypt_c or gSecLib_CCM_Decrypt_c.
+ *
+ * \return gSecSuccess_c if no error, gSecBadArgument_c in case of bad arguments.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CcmInit(secAesCcmCtx_t       *pCtx,
+                                const secAesKeyCtx_t *pKeyCtx,
+                                const uint8_t        *pNonce,
+                                uint8_t               nonceSize,
+                                uint32_t              authDataLen,
+                                uint32_t              inputLen,
+                                uint8_t               macSize,
+                                uint32_t              flags)
+{
+    secResultType_t result = gSecBadArgument_c;
+    tuAES_Block     block;
+    uint32_t        lengthSize;
+    uint32_t        length;
+
+    do
+    {
+        if ((pCtx == NULL) || (pKeyCtx == NULL) || (pKeyCtx->pState == NULL) || (pNonce == NULL))
+        {
+            break;
+        }
+        if ((nonceSize < AES_STREAM_CCM_NONCE_MIN) || (nonceSize > AES_STREAM_CCM_NONCE_MAX))
+        {
+            break;
+        }
+        if ((macSize > AES_BLOCK_SIZE) || ((macSize & 1U) != 0U) || (macSize == 2U))
+        {
+            break;
+        }
+        /* The message length must fit in the 15 - nonceSize bytes of the length field */
+        lengthSize = AES_BLOCK_SIZE - 1U - (uint32_t)nonceSize;
+        if ((lengthSize < sizeof(uint32_t)) && ((inputLen >> (8U * lengthSize)) != 0U))
+        {
+            break;
+        }
+
+        FLib_MemSet(pCtx, 0U, sizeof(secAesCcmCtx_t));
+        pCtx->pKeyCtx      = pKeyCtx;
+        pCtx->authDataLeft = authDataLen;
+        pCtx->inputLeft    = inputLen;
+        pCtx->macSize      = macSize;
+        pCtx->decrypt      = ((flags & gSecLib_CCM_Decrypt_c) != 0U) ? 1U : 0U;
+
+        /* B0 = flags | nonce | message length, the CBC-MAC starts with E(B0) */
+        FLib_MemSet(block.au8, 0U, AES_BLOCK_SIZE);
+        block.au8[0] = (uint8_t)(lengthSize - 1U);
+        if (macSize != 0U)
+        {
+            block.au8[0] |= (uint8_t)(((macSize - 2U) / 2U) << AES_STREAM_CCM_MAC_SHIFT);
+        }
+        if (authDataLen != 0U)
+        {
+            block.au8[0] |= (uint8_t)AES_STREAM_CCM_ADATA_FLAG;
+        }
+        FLib_MemCpy(&block.au8[1], pNonce, nonceSize);
+        length = inputLen;
+        for (uint32_t i = AES_BLOCK_SIZE - 1U; length != 0U; i--)
+        {
+            block.au8[i] = (uint8_t)(length & 0xFFU);
+            length >>= 8;
+        }
+        AES_128_KeyCtxEncrypt(pKeyCtx, block.au8, pCtx->mac.mac.au8);
+
+        /* A0 = L' | nonce | 0, E(A0) masks the MAC and the message is encrypted from A1 */
+        FLib_MemSet(&block.au8[1U + nonceSize], 0U, lengthSize);
+        block.au8[0] = (uint8_t)(lengthSize - 1U);
+        AES_128_KeyCtxEncrypt(pKeyCtx, block.au8, pCtx->tagMask.au8);
+        block.au8[AES_BLOCK_SIZE - 1U] = 1U;
+        FLib_MemCpy(pCtx->ctr.counter.au8, block.au8, AES_BLOCK_SIZE);
+        pCtx->ctr.used = (uint8_t)AES_BLOCK_SIZE;
+
+        /* The additional data is prefixed by its length */
+        if (authDataLen >= AES_STREAM_CCM_LONG_ADATA)
+        {
+            pCtx->mac.buffer.au8[0] = 0xFFU;
+            pCtx->mac.buffer.au8[1] = 0xFEU;
+            pCtx->mac.buffer.au8[2] = (uint8_t)(authDataLen >> 24);
+            pCtx->mac.buffer.au8[3] = (uint8_t)(authDataLen >> 16);
+            pCtx->mac.buffer.au8[4] = (uint8_t)(authDataLen >> 8);
+            pCtx->mac.buffer.au8[5] = (uint8_t)authDataLen;
+            pCtx->mac.bytes         = 6U;
+        }
+        else if (authDataLen != 0U)
+        {
+            pCtx->mac.buffer.au8[0] = (uint8_t)(authDataLen >> 8);
+            pCtx->mac.buffer.au8[1] = (uint8_t)authDataLen;
+            pCtx->mac.bytes         = 2U;
+        }
+        else
+        {
+            /* no additional data */
+        }
+
+        result = gSecSuccess_c;
+    } while (false);
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function adds a part of the additional authentication data to an AES-128-CCM operation.
+ *
+ * \param[in, out]  pCtx  Pointer to the CCM context set up by AES_128_CcmInit().
+ *
+ * \param[in]  pAuthData  Pointer to the part of the additional authentication data.
+ *
+ * \param[in]  authDataLen  Length of the part in bytes.
+ *
+ * \return gSecSuccess_c if no error, gSecBadArgument_c if more data is given than announced.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CcmUpdateAuthData(secAesCcmCtx_t *pCtx, const uint8_t *pAuthData, uint32_t authDataLen)
+{
+    secResultType_t result = gSecBadArgument_c;
+
+    if (authDataLen <= pCtx->authDataLeft)
+    {
+        AES_128_StreamMacUpdate(pCtx->pKeyCtx, &pCtx->mac, pAuthData, authDataLen, FALSE);
+        pCtx->authDataLeft -= authDataLen;
+
+        /* The additional data ends on a block boundary, padded with zeroes */
+        if (pCtx->authDataLeft == 0U)
+        {
+            AES_128_StreamMacPad(pCtx->pKeyCtx, &pCtx->mac);
+        }
+        result = gSecSuccess_c;
+    }
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function encrypts or decrypts a part of the message of an AES-128-CCM operation.
+ *
+ * \param[in, out]  pCtx  Pointer to the CCM context set up by AES_128_CcmInit().
+ *
+ * \param[in]  pInput  Pointer to the part of the input.
+ *
+ * \param[in]  inputLen  Length of the part in bytes.
+ *
+ * \param[out]  pOutput  Pointer to the location to store the output, it can be pInput.
+ *
+ * \return gSecSuccess_c if no error, gSecBadArgument_c if more data is given than announced, gSecError_c if the
+ *         additional authentication data isn't complete.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CcmUpdate(secAesCcmCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    secResultType_t result = gSecSuccess_c;
+
+    if (pCtx->authDataLeft != 0U)
+    {
+        result = gSecError_c;
+    }
+    else if (inputLen > pCtx->inputLeft)
+    {
+        result = gSecBadArgument_c;
+    }
+    else if (pCtx->decrypt == 0U)
+    {
+        /* The MAC is computed on the plaintext, before it's overwritten when encrypting in place */
+        AES_128_StreamMacUpdate(pCtx->pKeyCtx, &pCtx->mac, pInput, inputLen, FALSE);
+        AES_128_StreamCtr(pCtx->pKeyCtx, &pCtx->ctr, pInput, inputLen, pOutput);
+    }
+    else
+    {
+        AES_128_StreamCtr(pCtx->pKeyCtx, &pCtx->ctr, pInput, inputLen, pOutput);
+        AES_128_StreamMacUpdate(pCtx->pKeyCtx, &pCtx->mac, pOutput, inputLen, FALSE);
+    }
+
+    if (result == gSecSuccess_c)
+    {
+        pCtx->inputLeft -= inputLen;
+    }
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function finishes an AES-128-CCM operation. The context is erased.
+ *
+ * \param[in, out]  pCtx  Pointer to the CCM context.
+ *
+ * \param[in, out]  pCbcMac  Pointer to the location to store the MAC when encrypting, to the received MAC when
+ *                           decrypting.
+ *
+ * \return gSecSuccess_c if no error, gSecError_c if the received MAC doesn't match or if data is missing.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_CcmFinish(secAesCcmCtx_t *pCtx, uint8_t *pCbcMac)
+{
+    secResultType_t result = gSecError_c;
+    uint8_t         diff   = 0U;
+
+    if ((pCtx->authDataLeft == 0U) && (pCtx->inputLeft == 0U))
+    {
+        AES_128_StreamMacPad(pCtx->pKeyCtx, &pCtx->mac);
+        AES_128_StreamXor(pCtx->mac.mac.au8, pCtx->tagMask.au8, AES_BLOCK_SIZE);
+
+        if (pCtx->decrypt == 0U)
+        {
+            FLib_MemCpy(pCbcMac, pCtx->mac.mac.au8, pCtx->macSize);
+        }
+        else
+        {
+            /* Constant time comparison */
+            for (uint32_t i = 0U; i < pCtx->macSize; i++)
+            {
+                diff |= (uint8_t)(pCbcMac[i] ^ pCtx->mac.mac.au8[i]);
+            }
+        }
+
+        if (diff == 0U)
+        {
+            result = gSecSuccess_c;
+        }
+    }
+
+    FLib_MemSet(pCtx, 0U, sizeof(secAesCcmCtx_t));
+
+    return result;
+}
+
+#if gSecLibAesEaxEnable_d
+/*! *********************************************************************************
+ * \brief  This function starts an AES-128-EAX encryption or decryption of a message given in several parts.
+ *
+ * \param[out]  pCtx  Pointer to the EAX context.
+ *
+ * \param[in]  pKeyCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pNonce  Pointer to the nonce.
+ *
+ * \param[in]  nonceLen  Nonce length in bytes.
+ *
+ * \param[in]  flags  gSecLib_CCM_Encrypt_c or gSecLib_CCM_Decrypt_c.
+ *
+ * \return gSecSuccess_c if no error, gSecBadArgument_c in case of bad arguments.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_EaxInit(
+    secAesEaxCtx_t *pCtx, const secAesKeyCtx_t *pKeyCtx, const uint8_t *pNonce, uint32_t nonceLen, uint32_t flags)
+{
+    secResultType_t result = gSecBadArgument_c;
+
+    if ((pCtx != NULL) && (pKeyCtx != NULL) && (pKeyCtx->pState != NULL) && ((pNonce != NULL) || (nonceLen == 0U)))
+    {
+        FLib_MemSet(pCtx, 0U, sizeof(secAesEaxCtx_t));
+        pCtx->pKeyCtx = pKeyCtx;
+        pCtx->decrypt = ((flags & gSecLib_CCM_Decrypt_c) != 0U) ? 1U : 0U;
+
+        /* N' = OMAC0(nonce), it's also the initial counter. The data MAC state is used as scratch. */
+        AES_128_StreamOmacInit(&pCtx->dataMac, AES_STREAM_EAX_TWEAK_NONCE);
+        AES_128_StreamMacUpdate(pKeyCtx, &pCtx->dataMac, pNonce, nonceLen, TRUE);
+        AES_128_StreamCmacFinish(pKeyCtx, &pCtx->dataMac, pCtx->nonceMac.au8);
+        FLib_MemCpy(pCtx->ctr.counter.au8, pCtx->nonceMac.au8, AES_BLOCK_SIZE);
+        pCtx->ctr.used = (uint8_t)AES_BLOCK_SIZE;
+
+        AES_128_StreamOmacInit(&pCtx->headerMac, AES_STREAM_EAX_TWEAK_HDR);
+        AES_128_StreamOmacInit(&pCtx->dataMac, AES_STREAM_EAX_TWEAK_DATA);
+        result = gSecSuccess_c;
+    }
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function adds a part of the header to an AES-128-EAX operation.
+ *
+ * \param[in, out]  pCtx  Pointer to the EAX context set up by AES_128_EaxInit().
+ *
+ * \param[in]  pHeader  Pointer to the part of the header.
+ *
+ * \param[in]  headerLen  Length of the part in bytes.
+ *
+ ********************************************************************************** */
+void AES_128_EaxUpdateHeader(secAesEaxCtx_t *pCtx, const uint8_t *pHeader, uint32_t headerLen)
+{
+    AES_128_StreamMacUpdate(pCtx->pKeyCtx, &pCtx->headerMac, pHeader, headerLen, TRUE);
+}
+
+/*! *********************************************************************************
+ * \brief  This function encrypts or decrypts a part of the message of an AES-128-EAX operation.
+ *
+ * \param[in, out]  pCtx  Pointer to the EAX context set up by AES_128_EaxInit().
+ *
+ * \param[in]  pInput  Pointer to the part of the input.
+ *
+ * \param[in]  inputLen  Length of the part in bytes.
+ *
+ * \param[out]  pOutput  Pointer to the location to store the output, it can be pInput.
+ *
+ ********************************************************************************** */
+void AES_128_EaxUpdate(secAesEaxCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    /* The MAC is computed on the ciphertext */
+    if (pCtx->decrypt == 0U)
+    {
+        AES_128_StreamCtr(pCtx->pKeyCtx, &pCtx->ctr, pInput, inputLen, pOutput);
+        AES_128_StreamMacUpdate(pCtx->pKeyCtx, &pCtx->dataMac, pOutput, inputLen, TRUE);
+    }
+    else
+    {
+        AES_128_StreamMacUpdate(pCtx->pKeyCtx, &pCtx->dataMac, pInput, inputLen, TRUE);
+        AES_128_StreamCtr(pCtx->pKeyCtx, &pCtx->ctr, pInput, inputLen, pOutput);
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  This function finishes an AES-128-EAX operation. The context is erased.
+ *
+ * \param[in, out]  pCtx  Pointer to the EAX context.
+ *
+ * \param[in, out]  pTag  Pointer to the location to store the tag when encrypting, to the received tag when
+ *                        decrypting.
+ *
+ * \return gSecSuccess_c if no error, gSecError_c if the received tag doesn't match.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_EaxFinish(secAesEaxCtx_t *pCtx, uint8_t *pTag)
+{
+    secResultType_t result = gSecSuccess_c;
+    tuAES_Block     mac;
+    uint8_t         diff = 0U;
+
+    /* tag = N' ^ H' ^ C' */
+    AES_128_StreamCmacFinish(pCtx->pKeyCtx, &pCtx->headerMac, mac.au8);
+    AES_128_StreamXor(pCtx->nonceMac.au8, mac.au8, AES_BLOCK_SIZE);
+    AES_128_StreamCmacFinish(pCtx->pKeyCtx, &pCtx->dataMac, mac.au8);
+    AES_128_StreamXor(pCtx->nonceMac.au8, mac.au8, AES_BLOCK_SIZE);
+
+    if (pCtx->decrypt == 0U)
+    {
+        FLib_MemCpy(pTag, pCtx->nonceMac.au8, AES_BLOCK_SIZE);
+    }
+    else
+    {
+        /* Constant time comparison */
+        for (uint32_t i = 0U; i < AES_BLOCK_SIZE; i++)
+        {
+            diff |= (uint8_t)(pTag[i] ^ pCtx->nonceMac.au8[i]);
+        }
+        if (diff != 0U)
+        {
+            result = gSecError_c;
+        }
+    }
+
+    FLib_MemSet(mac.au8, 0U, AES_BLOCK_SIZE);
+    FLib_MemSet(pCtx, 0U, sizeof(secAesEaxCtx_t));
+
+    return result;
+}
+#endif /* gSecLibAesEaxEnable_d */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+********************************************************************************** */
+
+/* pDst[i] ^= pSrc[i] */
+static void AES_128_StreamXor(uint8_t *pDst, const uint8_t *pSrc, uint32_t len)
+{
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        pDst[i] ^= pSrc[i];
+    }
+}
+
+/* mac := E(mac ^ block) */
+static void AES_128_StreamMacBlock(const secAesKeyCtx_t *pKeyCtx, secAesMacState_t *pMac, const uint8_t *pBlock)
+{
+    AES_128_StreamXor(pMac->mac.au8, pBlock, AES_BLOCK_SIZE);
+    AES_128_KeyCtxEncrypt(pKeyCtx, pMac->mac.au8, pMac->mac.au8);
+}
+
+/*! *********************************************************************************
+ * \brief  Adds data to a CBC-MAC. The whole blocks of the input are processed in place, only the bytes of an
+ *         incomplete block are buffered.
+ *
+ * \param[in]  keepLast  TRUE for CMAC: a complete block is only processed when more data follows, the last one
+ *                       is processed by AES_128_StreamCmacFinish().
+ *
+ ********************************************************************************** */
+static void AES_128_StreamMacUpdate(const secAesKeyCtx_t *pKeyCtx,
+                                    secAesMacState_t     *pMac,
+                                    const uint8_t        *pData,
+                                    uint32_t              dataLen,
+                                    bool_t                keepLast)
+{
+    uint32_t len;
+
+    while (dataLen != 0U)
+    {
+        /* More data follows, the buffered block isn't the last one */
+        if (pMac->bytes == AES_BLOCK_SIZE)
+        {
+            AES_128_StreamMacBlock(pKeyCtx, pMac, pMac->buffer.au8);
+            pMac->bytes = 0U;
+        }
+
+        if ((pMac->bytes == 0U) && (dataLen > AES_BLOCK_SIZE))
+        {
+            AES_128_StreamMacBlock(pKeyCtx, pMac, pData);
+            len = AES_BLOCK_SIZE;
+        }
+        else
+        {
+            len = MIN((uint32_t)AES_BLOCK_SIZE - pMac->bytes, dataLen);
+            FLib_MemCpy(&pMac->buffer.au8[pMac->bytes], pData, len);
+            pMac->bytes += (uint8_t)len;
+        }
+
+        pData += len;
+        dataLen -= len;
+    }
+
+    if ((keepLast == FALSE) && (pMac->bytes == AES_BLOCK_SIZE))
+    {
+        AES_128_StreamMacBlock(pKeyCtx, pMac, pMac->buffer.au8);
+        pMac->bytes = 0U;
+    }
+}
+
+/* Processes the buffered bytes padded with zeroes, as done by CCM at the end of the additional data and message */
+static void AES_128_StreamMacPad(const secAesKeyCtx_t *pKeyCtx, secAesMacState_t *pMac)
+{
+    if (pMac->bytes != 0U)
+    {
+        FLib_MemSet(&pMac->buffer.au8[pMac->bytes], 0U, (uint32_t)AES_BLOCK_SIZE - pMac->bytes);
+        AES_128_StreamMacBlock(pKeyCtx, pMac, pMac->buffer.au8);
+        pMac->bytes = 0U;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  Processes the last CMAC block: xored with K1 if complete, padded and xored with K2 otherwise. The
+ *         subkeys are derived from L = E(0).
+ *
+ ********************************************************************************** */
+static void AES_128_StreamCmacFinish(const secAesKeyCtx_t *pKeyCtx, secAesMacState_t *pMac, uint8_t *pOutput)
+{
+    tuAES_Block subkey = {.au32 = {0U}};
+
+    AES_128_KeyCtxEncrypt(pKeyCtx, subkey.au8, subkey.au8);
+    AES_128_StreamDouble(subkey.au8);
+
+    if (pMac->bytes != AES_BLOCK_SIZE)
+    {
+        pMac->buffer.au8[pMac->bytes] = 0x80U;
+        FLib_MemSet(&pMac->buffer.au8[pMac->bytes + 1U], 0U, (uint32_t)AES_BLOCK_SIZE - 1U - pMac->bytes);
+        AES_128_StreamDouble(subkey.au8);
+    }
+
+    AES_128_StreamXor(pMac->buffer.au8, subkey.au8, AES_BLOCK_SIZE);
+    AES_128_StreamXor(pMac->mac.au8, pMac->buffer.au8, AES_BLOCK_SIZE);
+    AES_128_KeyCtxEncrypt(pKeyCtx, pMac->mac.au8, pOutput);
+
+    FLib_MemSet(subkey.au8, 0U, AES_BLOCK_SIZE);
+}
+
+/* Multiplication by x in GF(2^128), without branch on the secret subkey */
+static void AES_128_StreamDouble(uint8_t *pBlock)
+{
+    uint8_t carry = (uint8_t)(0U - (uint8_t)(pBlock[0] >> 7));
+
+    for (uint32_t i = 0U; i < (AES_BLOCK_SIZE - 1U); i++)
+    {
+        pBlock[i] = (uint8_t)((pBlock[i] << 1) | (pBlock[i + 1U] >> 7));
+    }
+    pBlock[AES_BLOCK_SIZE - 1U] = (uint8_t)((pBlock[AES_BLOCK_SIZE - 1U] << 1) ^ (carry & AES_STREAM_CMAC_RB));
+}
+
+/* 128-bit big endian increment, as done by AES_128_KeyCtxCtr() */
+static void AES_128_StreamIncrementCounter(uint8_t *pCounter)
+{
+    uint32_t carry = 1U;
+
+    for (uint32_t i = AES_BLOCK_SIZE; i > 0U; i--)
+    {
+        carry += pCounter[i - 1U];
+        pCounter[i - 1U] = (uint8_t)carry;
+        carry >>= 8;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  CTR encryption continuing a previous call: the keystream left from a partial block is used first, then
+ *         the whole blocks go to AES_128_KeyCtxCtr() in one call, and the keystream of a last partial block is
+ *         kept for the next call.
+ *
+ ********************************************************************************** */
+static void AES_128_StreamCtr(const secAesKeyCtx_t *pKeyCtx,
+                              secAesCtrState_t     *pCtr,
+                              const uint8_t        *pInput,
+                              uint32_t              inputLen,
+                              uint8_t              *pOutput)
+{
+    uint32_t len = MIN((uint32_t)AES_BLOCK_SIZE - pCtr->used, inputLen);
+
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        pOutput[i] = pInput[i] ^ pCtr->keystream.au8[pCtr->used + i];
+    }
+    pCtr->used += (uint8_t)len;
+    pInput += len;
+    pOutput += len;
+    inputLen -= len;
+
+    len = inputLen & ~((uint32_t)AES_BLOCK_SIZE - 1U);
+    if (len != 0U)
+    {
+        AES_128_KeyCtxCtr(pKeyCtx, pInput, len, pCtr->counter.au8, pOutput);
+        pInput += len;
+        pOutput += len;
+        inputLen -= len;
+    }
+
+    if (inputLen != 0U)
+    {
+        AES_128_KeyCtxEncrypt(pKeyCtx, pCtr->counter.au8, pCtr->keystream.au8);
+        AES_128_StreamIncrementCounter(pCtr->counter.au8);
+        for (uint32_t i = 0U; i < inputLen; i++)
+        {
+            pOutput[i] = pInput[i] ^ pCtr->keystream.au8[i];
+        }
+        pCtr->used = (uint8_t)inputLen;
+    }
+}
+
+#if gSecLibAesEaxEnable_d
+/* OMAC^t(M) = CMAC([t]_128 | M), the tweak block is buffered as the first block of the message */
+static void AES_128_StreamOmacInit(secAesMacState_t *pMac, uint8_t tweak)
+{
+    FLib_MemSet(pMac, 0U, sizeof(secAesMacState_t));
+    pMac->buffer.au8[AES_BLOCK_SIZE - 1U] = tweak;
+    pMac->bytes                           = (uint8_t)AES_BLOCK_SIZE;
+}
+#endif
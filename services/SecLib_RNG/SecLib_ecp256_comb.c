@@ -0,0 +1,859 @@
+/*! *********************************************************************************
+ * Copyright 2025 NXP
+ *
+ * \file
+ *
+ * This is the source file of the constant time P-256 scalar multiplications used by the SW SecLib port when
+ * gSecLibEcp256CombEnable_d is set.
+ *
+ * The field elements are eight 32-bit words in Montgomery form and the points are projective, added and doubled
+ * with the complete formulas of Renes, Costello and Batina (a = -3), so that there is no special case for the point
+ * at infinity or for the doubling.
+ *
+ * Key generation multiplies the fixed generator G with a comb: the scalar bits are read in 32 columns of 8 bits, bit
+ * c of each scalar word, and two tables of 15 affine points in flash give the sum of the 4 lower and of the 4 upper
+ * teeth. This is 31 doublings and 64 additions instead of 256 doublings.
+ *
+ * A variable point is multiplied with a regular signed window of 4 bits: the scalar, made odd, is recoded into 65
+ * odd digits between -15 and 15, so that each window costs one addition of a precomputed odd multiple of the point.
+ * This is the width 4 NAF without its zero digits, which would reveal the scalar through the timing.
+ *
+ * All table lookups read all the entries and there is no branch on the scalar or on the coordinates.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ ********************************************************************************** */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "FunctionLib.h"
+#include "SecLib.h"
+#include "CryptoLibSW.h"
+
+#if (defined(gSecLibEcp256CombEnable_d) && (gSecLibEcp256CombEnable_d > 0))
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+********************************************************************************** */
+
+#define P256_WORDS SEC_ECP256_COORDINATE_WLEN
+
+/* Comb on G: 2 tables of 4 teeth, 32 bits apart */
+#define P256_COMB_TABLES  2U
+#define P256_COMB_TEETH   4U
+#define P256_COMB_POINTS  15U /* (1 << P256_COMB_TEETH) - 1, the digit 0 is the point at infinity */
+#define P256_COMB_COLUMNS 32U
+#define P256_COMB_BITS    (P256_COMB_TABLES * P256_COMB_TEETH)
+
+/* Signed window on a variable point */
+#define P256_WINDOW_BITS 4U
+#define P256_WINDOWS     (SW_ECP256_DIGITS - 1U)
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private type definitions
+*************************************************************************************
+********************************************************************************** */
+
+/*! P-256 point in affine coordinates, Montgomery form */
+typedef struct p256_affine_tag
+{
+    uint32_t x[P256_WORDS];
+    uint32_t y[P256_WORDS];
+} p256_affine_t;
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private memory declarations
+*************************************************************************************
+********************************************************************************** */
+
+/* Little endian words */
+static const uint32_t mP256P[P256_WORDS] = {0xffffffffU, 0xffffffffU, 0xffffffffU, 0x00000000U,
+                                            0x00000000U, 0x00000000U, 0x00000001U, 0xffffffffU};
+
+static const uint32_t mP256N[P256_WORDS] = {0xfc632551U, 0xf3b9cac2U, 0xa7179e84U, 0xbce6faadU,
+                                            0xffffffffU, 0xffffffffU, 0x00000000U, 0xffffffffU};
+
+/* Montgomery form of 1: 2^256 mod p */
+static const uint32_t mP256One[P256_WORDS] = {0x00000001U, 0x00000000U, 0x00000000U, 0xffffffffU,
+                                              0xffffffffU, 0xffffffffU, 0xfffffffeU, 0x00000000U};
+
+/* 2^512 mod p, converts to the Montgomery form */
+static const uint32_t mP256R2[P256_WORDS] = {0x00000003U, 0x00000000U, 0xffffffffU, 0xfffffffbU,
+                                             0xfffffffeU, 0xffffffffU, 0xfffffffdU, 0x00000004U};
+
+/* Montgomery form of the curve coefficient b */
+static const uint32_t mP256B[P256_WORDS] = {0x29c4bddfU, 0xd89cdf62U, 0x78843090U, 0xacf005cdU,
+                                            0xf7212ed6U, 0xe5a220abU, 0x04874834U, 0xdc30061dU};
+
+/* Comb tables, in flash: entry u - 1 of table t is the sum of the points 2^(32 * (4 * t + i)) * G
+ * for the bits i set in u */
+static const p256_affine_t mP256CombTable[P256_COMB_TABLES][P256_COMB_POINTS] = {
+    {
+        {{0x18a9143cU, 0x79e730d4U, 0x5fedb601U, 0x75ba95fcU,
+          0x77622510U, 0x79fb732bU, 0xa53755c6U, 0x18905f76U},
+         {0xce95560aU, 0xddf25357U, 0xba19e45cU, 0x8b4ab8e4U,
+          0xdd21f325U, 0xd2e88688U, 0x25885d85U, 0x8571ff18U}},
+        {{0x4147519aU, 0x20288602U, 0x26b372f0U, 0xd0981eacU,
+          0xa785ebc8U, 0xa9d4a7caU, 0xdbdf58e9U, 0xd953c50dU},
+         {0xfd590f8fU, 0x9d6361ccU, 0x44e6c917U, 0x72e9626bU,
+          0x22eb64cfU, 0x7fd96110U, 0x9eb288f3U, 0x863ebb7eU}},
+        {{0x5cdb6485U, 0x7856b623U, 0x2f0a2f97U, 0x808f0ea2U,
+          0x4f7e300bU, 0x3e68d954U, 0xb5ff80a0U, 0x00076055U},
+         {0x838d2010U, 0x7634eb9bU, 0x3243708aU, 0x54014fbbU,
+          0x842a6606U, 0xe0e47d39U, 0x34373ee0U, 0x83087761U}},
+        {{0x16a0d2bbU, 0x4f922fc5U, 0x1a623499U, 0x0d5cc16cU,
+          0x57c62c8bU, 0x9241cf3aU, 0xfd1b667fU, 0x2f5e6961U},
+         {0xf5a01797U, 0x5c15c70bU, 0x60956192U, 0x3d20b44dU,
+          0x071fdb52U, 0x04911b37U, 0x8d6f0f7bU, 0xf648f916U}},
+        {{0xe137bbbcU, 0x9e566847U, 0x8a6a0becU, 0xe434469eU,
+          0x79d73463U, 0xb1c42761U, 0x133d0015U, 0x5abe0285U},
+         {0xc04c7dabU, 0x92aa837cU, 0x43260c07U, 0x573d9f4cU,
+          0x78e6cc37U, 0x0c931562U, 0x6b6f7383U, 0x94bb725bU}},
+        {{0x720f141cU, 0xbbf9b48fU, 0x2df5bc74U, 0x6199b3cdU,
+          0x411045c4U, 0xdc3f6129U, 0x2f7dc4efU, 0xcdd6bbcbU},
+         {0xeaf436fdU, 0xcca6700bU, 0xb99326beU, 0x6f647f6dU,
+          0x014f2522U, 0x0c0fa792U, 0x4bdae5f6U, 0xa361bebdU}},
+        {{0x597c13c7U, 0x28aa2558U, 0x50b7c3e1U, 0xc38d635fU,
+          0xf3c09d1dU, 0x07039aecU, 0xc4b5292cU, 0xba12ca09U},
+         {0x59f91dfdU, 0x9e408fa4U, 0xceea07fbU, 0x3af43b66U,
+          0x9d780b29U, 0x1eceb089U, 0x701fef4bU, 0x53ebb99dU}},
+        {{0xb0e63d34U, 0x4fe7ee31U, 0xa9e54fabU, 0xf4600572U,
+          0xd5e7b5a4U, 0xc0493334U, 0x06d54831U, 0x8589fb92U},
+         {0x6583553aU, 0xaa70f5ccU, 0xe25649e5U, 0x0879094aU,
+          0x10044652U, 0xcc904507U, 0x02541c4fU, 0xebb0696dU}},
+        {{0xac1647c5U, 0x4616ca15U, 0xc4cf5799U, 0xb8127d47U,
+          0x764dfbacU, 0xdc666aa3U, 0xd1b27da3U, 0xeb2820cbU},
+         {0x6a87e008U, 0x9406f8d8U, 0x922378f3U, 0xd87dfa9dU,
+          0x80ccecb2U, 0x56ed2e42U, 0x55a7da1dU, 0x1f28289bU}},
+        {{0x3b89da99U, 0xabbaa0c0U, 0xb8284022U, 0xa6f2d79eU,
+          0xb81c05e8U, 0x27847862U, 0x05e54d63U, 0x337a4b59U},
+         {0x21f7794aU, 0x3c67500dU, 0x7d6d7f61U, 0x207005b7U,
+          0x04cfd6e8U, 0x0a5a3781U, 0xf4c2fbd6U, 0x0d65e0d5U}},
+        {{0xb5275d38U, 0xd9d09bbeU, 0x0be0a358U, 0x4268a745U,
+          0x973eb265U, 0xf0762ff4U, 0x52f4a232U, 0xc23da242U},
+         {0x0b94520cU, 0x5da1b84fU, 0xb05bd78eU, 0x09666763U,
+          0x94d29ea1U, 0x3a4dcb86U, 0xc790cff1U, 0x19de3b8cU}},
+        {{0x26c5fe04U, 0x183a716cU, 0x3bba1bdbU, 0x3b28de0bU,
+          0xa4cb712cU, 0x7432c586U, 0x91fccbfdU, 0xe34dcbd4U},
+         {0xaaa58403U, 0xb408d46bU, 0x82e97a53U, 0x9a697486U,
+          0x36aaa8afU, 0x9e390127U, 0x7b4e0f7fU, 0xe7641f44U}},
+        {{0xdf64ba59U, 0x7d753941U, 0x0b0242fcU, 0xd33f10ecU,
+          0xa1581859U, 0x4f06dfc6U, 0x052a57bfU, 0x4a12df57U},
+         {0x9439dbd0U, 0xbfa6338fU, 0xbde53e1fU, 0xd3c24bd4U,
+          0x21f1b314U, 0xfd5e4ffaU, 0xbb5bea46U, 0x6af5aa93U}},
+        {{0x10c91999U, 0xda10b699U, 0x2a580491U, 0x0a24b440U,
+          0xb8cc2090U, 0x3e0094b4U, 0x66a44013U, 0x5fe3475aU},
+         {0xf93e7b4bU, 0xb0f8cabdU, 0x7c23f91aU, 0x292b501aU,
+          0xcd1e6263U, 0x42e889aeU, 0xecfea916U, 0xb544e308U}},
+        {{0x16ddfdceU, 0x6478c6e9U, 0xf89179e6U, 0x2c329166U,
+          0x4d4e67e1U, 0x4e8d6e76U, 0xa6b0c20bU, 0xe0b6b2bdU},
+         {0xbb7efb57U, 0x0d312df2U, 0x790c4007U, 0x1aac0ddeU,
+          0x679bc944U, 0xf90336adU, 0x25a63774U, 0x71c023deU}},
+    },
+    {
+        {{0xbfe20925U, 0x62a8c244U, 0x8fdce867U, 0x91c19ac3U,
+          0xdd387063U, 0x5a96a5d5U, 0x21d324f6U, 0x61d587d4U},
+         {0xa37173eaU, 0xe87673a2U, 0x53778b65U, 0x23848008U,
+          0x05bab43eU, 0x10f8441eU, 0x4621efbeU, 0xfa11fe12U}},
+        {{0x6d3549cfU, 0xd433e50fU, 0xfacd665eU, 0x6f33696fU,
+          0xce11fcb4U, 0x695bfdacU, 0xaf7c9860U, 0x810ee252U},
+         {0x7159bb2cU, 0x65450fe1U, 0x758b357bU, 0xf7dfbebeU,
+          0xd69fea72U, 0x2b057e74U, 0x92731745U, 0xd485717aU}},
+        {{0xfc9877eeU, 0xd11d47dcU, 0x801d0002U, 0xc8b36210U,
+          0x54c260b6U, 0xd002c117U, 0x6962f046U, 0x04c17cd8U},
+         {0xb0daddf5U, 0x6d9bd094U, 0x24ce55c0U, 0xbea23575U,
+          0x72da03b5U, 0x663356e6U, 0xfed97474U, 0xf7ba4de9U}},
+        {{0xf4f8b16aU, 0x56f8410eU, 0xc47b266aU, 0x97241afeU,
+          0x6d9c87c1U, 0x0a406b8eU, 0xcd42ab1bU, 0x803f3e02U},
+         {0x04dbec69U, 0x7f0309a8U, 0x3bbad05fU, 0xa83b85f7U,
+          0xad8e197fU, 0xc6097273U, 0x5067adc1U, 0xc097440eU}},
+        {{0x80ec21feU, 0x5fe14bfeU, 0xc255be82U, 0xf6ce116aU,
+          0x2f4a5d67U, 0x98bc5a07U, 0xdb7e63afU, 0xfad27148U},
+         {0x29ab05b3U, 0x90c0b6acU, 0x4e251ae6U, 0x37a9a83cU,
+          0xc2aade7dU, 0x0a7dc875U, 0x9f0e1a84U, 0x77387de3U}},
+        {{0x927dafc6U, 0x84a9521dU, 0x5c09cd19U, 0x52c1fb69U,
+          0xf9366ddeU, 0x9d9581a0U, 0xa16d7e64U, 0x9abe210bU},
+         {0x48915220U, 0x480af84aU, 0x4dd816c6U, 0xfa73176aU,
+          0x1681ca5aU, 0xc7d53987U, 0x87f344b0U, 0x7881c257U}},
+        {{0x05058880U, 0xd75a3e65U, 0x643943f2U, 0x7da365efU,
+          0xfab24925U, 0x4147861cU, 0xfdb808ffU, 0xc5c4bdb0U},
+         {0xb272b56bU, 0x73513e34U, 0x11b9043aU, 0xc8327e95U,
+          0xf8844969U, 0xfd8ce37dU, 0x46c2b6b5U, 0x2d56db94U}},
+        {{0x35d0b34aU, 0xe3417bc0U, 0x8327c0a7U, 0x440b386bU,
+          0xac0362d1U, 0x8fb7262dU, 0xe0cdf943U, 0x2c41114cU},
+         {0xad95a0b1U, 0x2ba5cef1U, 0x67d54362U, 0xc09b37a8U,
+          0x01e486c9U, 0x26d6cdd2U, 0x42ff9297U, 0x20477abfU}},
+        {{0xa7bf9b7cU, 0xf4f80824U, 0x3fbe30d0U, 0x365d2320U,
+          0x97cf9ce3U, 0xbfbe5320U, 0xb3055526U, 0xe3604700U},
+         {0x6cc6c2c7U, 0x4dcb9911U, 0xba4cbee6U, 0x72683708U,
+          0x637ad9ecU, 0xdcded434U, 0xa3dee15fU, 0x6542d677U}},
+        {{0x15339848U, 0x231c210eU, 0x70778c8dU, 0xe87a28e8U,
+          0x6956e170U, 0x9d1de661U, 0x2bb09c0bU, 0x4ac3c938U},
+         {0x6998987dU, 0x19be0551U, 0xae09f4d6U, 0x8b2376c4U,
+          0x1a3f933dU, 0x1de0b765U, 0xe39705f4U, 0x380d94c7U}},
+        {{0xa16bd00aU, 0xeb54ea74U, 0xf5c0bcc1U, 0xd839e9adU,
+          0x1f9bfc06U, 0x092bb7f1U, 0x1163dc4eU, 0x318f97b3U},
+         {0xc30d7138U, 0xecc0c5beU, 0xabc30220U, 0x44e8df23U,
+          0xb0223606U, 0x2bb7972fU, 0x9a84ff4dU, 0xfa41faa1U}},
+        {{0xf67d04c3U, 0x2e80937cU, 0x89eeb811U, 0x1e312be2U,
+          0x92594d60U, 0x56b5d887U, 0x187fbd3dU, 0x0224da14U},
+         {0x0c5fe36fU, 0x87abb863U, 0x4ef51f5fU, 0x580f3c60U,
+          0xb3b429ecU, 0x964fb1bfU, 0x42bfff33U, 0x60838ef0U}},
+        {{0x20c26defU, 0xf0f58f66U, 0x582b2d1eU, 0x025585eaU,
+          0x01ce3881U, 0xfbe7d79bU, 0x303f1730U, 0x28ccea01U},
+         {0x79644ba5U, 0xd1dabcd1U, 0x06fff0b8U, 0x1fc643e8U,
+          0x66b3e17bU, 0xa60a76fcU, 0xa1d013bfU, 0xc18baf48U}},
+        {{0xaddb7d07U, 0x396ef794U, 0x24455500U, 0x0b4fc742U,
+          0xc78aa3ceU, 0xfaff8eacU, 0xe8d4d97dU, 0x14e9ada5U},
+         {0x2f7079e2U, 0xdaa480a1U, 0xe4b0800eU, 0x45baa3cdU,
+          0x7838157dU, 0x01765e2dU, 0x8e9d9ae8U, 0xa0ad4fabU}},
+        {{0x0bfc8ff3U, 0xc9a1dc0eU, 0xe936f42fU, 0x14efd82bU,
+          0xcca381efU, 0x67016f7cU, 0xed8aee96U, 0x1432c1caU},
+         {0x70b23c26U, 0xec684829U, 0x0735b273U, 0xa64fe873U,
+          0xeaef0f5aU, 0xe389f6e5U, 0x5ac8d2c6U, 0xcaef480bU}},
+    },
+};
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+********************************************************************************** */
+
+/* All ones when a == b, 0 otherwise */
+static inline uint32_t p256_ct_eq(uint32_t a, uint32_t b)
+{
+    uint32_t x = a ^ b;
+
+    return ((x | (0U - x)) >> 31) - 1U;
+}
+
+static inline uint32_t p256_load32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void p256_store32(uint8_t *p, uint32_t x)
+{
+    p[0] = (uint8_t)x;
+    p[1] = (uint8_t)(x >> 8);
+    p[2] = (uint8_t)(x >> 16);
+    p[3] = (uint8_t)(x >> 24);
+}
+
+static void p256_load(uint32_t r[P256_WORDS], const uint8_t *pIn)
+{
+    for (uint32_t i = 0U; i < P256_WORDS; i++)
+    {
+        r[i] = p256_load32(&pIn[4U * i]);
+    }
+}
+
+static void p256_store(uint8_t *pOut, const uint32_t a[P256_WORDS])
+{
+    for (uint32_t i = 0U; i < P256_WORDS; i++)
+    {
+        p256_store32(&pOut[4U * i], a[i]);
+    }
+}
+
+/* r = mask ? a : r, mask is 0 or all ones */
+static void p256_fe_select(uint32_t r[P256_WORDS], const uint32_t a[P256_WORDS], uint32_t mask)
+{
+    for (uint32_t i = 0U; i < P256_WORDS; i++)
+    {
+        r[i] ^= (r[i] ^ a[i]) & mask;
+    }
+}
+
+/* r = a + b, returns the carry */
+static uint32_t p256_add_words(uint32_t r[P256_WORDS], const uint32_t a[P256_WORDS], const uint32_t b[P256_WORDS])
+{
+    uint64_t acc = 0U;
+
+    for (uint32_t i = 0U; i < P256_WORDS; i++)
+    {
+        acc  = (uint64_t)a[i] + b[i] + (acc >> 32);
+        r[i] = (uint32_t)acc;
+    }
+
+    return (uint32_t)(acc >> 32);
+}
+
+/* r = a - b, returns the borrow */
+static uint32_t p256_sub_words(uint32_t r[P256_WORDS], const uint32_t a[P256_WORDS], const uint32_t b[P256_WORDS])
+{
+    uint64_t diff;
+    uint32_t borrow = 0U;
+
+    for (uint32_t i = 0U; i < P256_WORDS; i++)
+    {
+        diff   = (uint64_t)a[i] - b[i] - borrow;
+        r[i]   = (uint32_t)diff;
+        borrow = (uint32_t)(diff >> 32) & 1U;
+    }
+
+    return borrow;
+}
+
+static bool p256_is_zero(const uint32_t a[P256_WORDS])
+{
+    uint32_t acc = 0U;
+
+    for (uint32_t i = 0U; i < P256_WORDS; i++)
+    {
+        acc |= a[i];
+    }
+
+    return (acc == 0U);
+}
+
+/* r = a + b mod p */
+static void p256_fe_add(uint32_t r[P256_WORDS], const uint32_t a[P256_WORDS], const uint32_t b[P256_WORDS])
+{
+    uint32_t sum[P256_WORDS];
+    uint32_t reduced[P256_WORDS];
+    uint32_t carry  = p256_add_words(sum, a, b);
+    uint32_t borrow = p256_sub_words(reduced, sum, mP256P);
+
+    /* The sum is kept when it is below p, without carry */
+    FLib_MemCpy(r, reduced, sizeof(reduced));
+    p256_fe_select(r, sum, 0U - (borrow & (carry ^ 1U)));
+}
+
+/* r = a - b mod p */
+static void p256_fe_sub(uint32_t r[P256_WORDS], const uint32_t a[P256_WORDS], const uint32_t b[P256_WORDS])
+{
+    uint32_t corr[P256_WORDS];
+    uint32_t mask = 0U - p256_sub_words(r, a, b);
+
+    for (uint32_t i = 0U; i < P256_WORDS; i++)
+    {
+        corr[i] = mP256P[i] & mask;
+    }
+    (void)p256_add_words(r, r, corr);
+}
+
+/* r = a * b / 2^256 mod p, Montgomery multiplication with interleaved reduction. -1/p mod 2^32 is 1. */
+static void p256_fe_mul(uint32_t r[P256_WORDS], const uint32_t a[P256_WORDS], const uint32_t b[P256_WORDS])
+{
+    uint32_t t[P256_WORDS + 2U] = {0U};
+    uint32_t reduced[P256_WORDS];
+    uint32_t borrow;
+    uint64_t acc;
+    uint32_t m;
+
+    for (uint32_t i = 0U; i < P256_WORDS; i++)
+    {
+        acc = 0U;
+        for (uint32_t j = 0U; j < P256_WORDS; j++)
+        {
+            acc  = (uint64_t)a[j] * b[i] + t[j] + (acc >> 32);
+            t[j] = (uint32_t)acc;
+        }
+        acc                = (uint64_t)t[P256_WORDS] + (acc >> 32);
+        t[P256_WORDS]      = (uint32_t)acc;
+        t[P256_WORDS + 1U] = (uint32_t)(acc >> 32);
+
+        m   = t[0];
+        acc = (uint64_t)m * mP256P[0] + t[0];
+        for (uint32_t j = 1U; j < P256_WORDS; j++)
+        {
+            acc      = (uint64_t)m * mP256P[j] + t[j] + (acc >> 32);
+            t[j - 1U] = (uint32_t)acc;
+        }
+        acc                = (uint64_t)t[P256_WORDS] + (acc >> 32);
+        t[P256_WORDS - 1U] = (uint32_t)acc;
+        t[P256_WORDS]      = t[P256_WORDS + 1U] + (uint32_t)(acc >> 32);
+    }
+
+    /* t < 2p, p is subtracted when t >= p */
+    borrow = p256_sub_words(reduced, t, mP256P);
+    FLib_MemCpy(r, reduced, sizeof(reduced));
+    p256_fe_select(r, t, 0U - (borrow & (t[P256_WORDS] ^ 1U)));
+}
+
+/* r = a^(2^n) */
+static void p256_fe_sqr_n(uint32_t r[P256_WORDS], const uint32_t a[P256_WORDS], uint32_t n)
+{
+    p256_fe_mul(r, a, a);
+    for (uint32_t i = 1U; i < n; i++)
+    {
+        p256_fe_mul(r, r, r);
+    }
+}
+
+/* r = 1 / a = a^(p - 2), the exponent is public */
+static void p256_fe_inv(uint32_t r[P256_WORDS], const uint32_t a[P256_WORDS])
+{
+    uint32_t x2[P256_WORDS];
+    uint32_t x3[P256_WORDS];
+    uint32_t x15[P256_WORDS];
+    uint32_t x30[P256_WORDS];
+    uint32_t x32[P256_WORDS];
+    uint32_t t[P256_WORDS];
+
+    /* xk = a^(2^k - 1) */
+    p256_fe_sqr_n(t, a, 1U);
+    p256_fe_mul(x2, t, a);
+    p256_fe_sqr_n(t, x2, 1U);
+    p256_fe_mul(x3, t, a);
+    p256_fe_sqr_n(t, x3, 3U);
+    p256_fe_mul(t, t, x3); /* x6 */
+    p256_fe_sqr_n(x15, t, 6U);
+    p256_fe_mul(x15, x15, t); /* x12 */
+    p256_fe_sqr_n(x15, x15, 3U);
+    p256_fe_mul(x15, x15, x3);
+    p256_fe_sqr_n(x30, x15, 15U);
+    p256_fe_mul(x30, x30, x15);
+    p256_fe_sqr_n(x32, x30, 2U);
+    p256_fe_mul(x32, x32, x2);
+
+    /* p - 2 = ffffffff 00000001 00000000 00000000 00000000 ffffffff ffffffff fffffffd */
+    p256_fe_sqr_n(t, x32, 32U);
+    p256_fe_mul(t, t, a);
+    p256_fe_sqr_n(t, t, 128U);
+    p256_fe_mul(t, t, x32);
+    p256_fe_sqr_n(t, t, 32U);
+    p256_fe_mul(t, t, x32);
+    p256_fe_sqr_n(t, t, 30U);
+    p256_fe_mul(t, t, x30);
+    p256_fe_sqr_n(t, t, 2U);
+    p256_fe_mul(r, t, a);
+}
+
+/* r = a + b, complete addition (Renes, Costello, Batina, algorithm 4), r may be a or b */
+static void p256_point_add(sw_ecp256_point_t *r, const sw_ecp256_point_t *a, const sw_ecp256_point_t *b)
+{
+    uint32_t t0[P256_WORDS], t1[P256_WORDS], t2[P256_WORDS], t3[P256_WORDS], t4[P256_WORDS];
+    uint32_t x3[P256_WORDS], y3[P256_WORDS], z3[P256_WORDS];
+
+    p256_fe_mul(t0, a->x, b->x);
+    p256_fe_mul(t1, a->y, b->y);
+    p256_fe_mul(t2, a->z, b->z);
+    p256_fe_add(t3, a->x, a->y);
+    p256_fe_add(t4, b->x, b->y);
+    p256_fe_mul(t3, t3, t4);
+    p256_fe_add(t4, t0, t1);
+    p256_fe_sub(t3, t3, t4);
+    p256_fe_add(t4, a->y, a->z);
+    p256_fe_add(x3, b->y, b->z);
+    p256_fe_mul(t4, t4, x3);
+    p256_fe_add(x3, t1, t2);
+    p256_fe_sub(t4, t4, x3);
+    p256_fe_add(x3, a->x, a->z);
+    p256_fe_add(y3, b->x, b->z);
+    p256_fe_mul(x3, x3, y3);
+    p256_fe_add(y3, t0, t2);
+    p256_fe_sub(y3, x3, y3);
+    p256_fe_mul(z3, mP256B, t2);
+    p256_fe_sub(x3, y3, z3);
+    p256_fe_add(z3, x3, x3);
+    p256_fe_add(x3, x3, z3);
+    p256_fe_sub(z3, t1, x3);
+    p256_fe_add(x3, t1, x3);
+    p256_fe_mul(y3, mP256B, y3);
+    p256_fe_add(t1, t2, t2);
+    p256_fe_add(t2, t1, t2);
+    p256_fe_sub(y3, y3, t2);
+    p256_fe_sub(y3, y3, t0);
+    p256_fe_add(t1, y3, y3);
+    p256_fe_add(y3, t1, y3);
+    p256_fe_add(t1, t0, t0);
+    p256_fe_add(t0, t1, t0);
+    p256_fe_sub(t0, t0, t2);
+    p256_fe_mul(t1, t4, y3);
+    p256_fe_mul(t2, t0, y3);
+    p256_fe_mul(y3, x3, z3);
+    p256_fe_add(y3, y3, t2);
+    p256_fe_mul(x3, t3, x3);
+    p256_fe_sub(x3, x3, t1);
+    p256_fe_mul(z3, t4, z3);
+    p256_fe_mul(t1, t3, t0);
+    p256_fe_add(z3, z3, t1);
+
+    FLib_MemCpy(r->x, x3, sizeof(x3));
+    FLib_MemCpy(r->y, y3, sizeof(y3));
+    FLib_MemCpy(r->z, z3, sizeof(z3));
+}
+
+/* r = a + b with b affine and not the point at infinity (Renes, Costello, Batina, algorithm 5), r may be a */
+static void p256_point_add_affine(sw_ecp256_point_t *r, const sw_ecp256_point_t *a, const p256_affine_t *b)
+{
+    uint32_t t0[P256_WORDS], t1[P256_WORDS], t2[P256_WORDS], t3[P256_WORDS], t4[P256_WORDS];
+    uint32_t x3[P256_WORDS], y3[P256_WORDS], z3[P256_WORDS];
+
+    p256_fe_mul(t0, a->x, b->x);
+    p256_fe_mul(t1, a->y, b->y);
+    p256_fe_add(t3, b->x, b->y);
+    p256_fe_add(t4, a->x, a->y);
+    p256_fe_mul(t3, t3, t4);
+    p256_fe_add(t4, t0, t1);
+    p256_fe_sub(t3, t3, t4);
+    p256_fe_mul(t4, b->y, a->z);
+    p256_fe_add(t4, t4, a->y);
+    p256_fe_mul(y3, b->x, a->z);
+    p256_fe_add(y3, y3, a->x);
+    p256_fe_mul(z3, mP256B, a->z);
+    p256_fe_sub(x3, y3, z3);
+    p256_fe_add(z3, x3, x3);
+    p256_fe_add(x3, x3, z3);
+    p256_fe_sub(z3, t1, x3);
+    p256_fe_add(x3, t1, x3);
+    p256_fe_mul(y3, mP256B, y3);
+    p256_fe_add(t1, a->z, a->z);
+    p256_fe_add(t2, t1, a->z);
+    p256_fe_sub(y3, y3, t2);
+    p256_fe_sub(y3, y3, t0);
+    p256_fe_add(t1, y3, y3);
+    p256_fe_add(y3, t1, y3);
+    p256_fe_add(t1, t0, t0);
+    p256_fe_add(t0, t1, t0);
+    p256_fe_sub(t0, t0, t2);
+    p256_fe_mul(t1, t4, y3);
+    p256_fe_mul(t2, t0, y3);
+    p256_fe_mul(y3, x3, z3);
+    p256_fe_add(y3, y3, t2);
+    p256_fe_mul(x3, t3, x3);
+    p256_fe_sub(x3, x3, t1);
+    p256_fe_mul(z3, t4, z3);
+    p256_fe_mul(t1, t3, t0);
+    p256_fe_add(z3, z3, t1);
+
+    FLib_MemCpy(r->x, x3, sizeof(x3));
+    FLib_MemCpy(r->y, y3, sizeof(y3));
+    FLib_MemCpy(r->z, z3, sizeof(z3));
+}
+
+/* r = 2 * a (Renes, Costello, Batina, algorithm 6), r may be a */
+static void p256_point_double(sw_ecp256_point_t *r, const sw_ecp256_point_t *a)
+{
+    uint32_t t0[P256_WORDS], t1[P256_WORDS], t2[P256_WORDS], t3[P256_WORDS];
+    uint32_t x3[P256_WORDS], y3[P256_WORDS], z3[P256_WORDS];
+
+    p256_fe_mul(t0, a->x, a->x);
+    p256_fe_mul(t1, a->y, a->y);
+    p256_fe_mul(t2, a->z, a->z);
+    p256_fe_mul(t3, a->x, a->y);
+    p256_fe_add(t3, t3, t3);
+    p256_fe_mul(z3, a->x, a->z);
+    p256_fe_add(z3, z3, z3);
+    p256_fe_mul(y3, mP256B, t2);
+    p256_fe_sub(y3, y3, z3);
+    p256_fe_add(x3, y3, y3);
+    p256_fe_add(y3, x3, y3);
+    p256_fe_sub(x3, t1, y3);
+    p256_fe_add(y3, t1, y3);
+    p256_fe_mul(y3, x3, y3);
+    p256_fe_mul(x3, x3, t3);
+    p256_fe_add(t3, t2, t2);
+    p256_fe_add(t2, t2, t3);
+    p256_fe_mul(z3, mP256B, z3);
+    p256_fe_sub(z3, z3, t2);
+    p256_fe_sub(z3, z3, t0);
+    p256_fe_add(t3, z3, z3);
+    p256_fe_add(z3, z3, t3);
+    p256_fe_add(t3, t0, t0);
+    p256_fe_add(t0, t3, t0);
+    p256_fe_sub(t0, t0, t2);
+    p256_fe_mul(t0, t0, z3);
+    p256_fe_add(y3, y3, t0);
+    p256_fe_mul(t0, a->y, a->z);
+    p256_fe_add(t0, t0, t0);
+    p256_fe_mul(z3, t0, z3);
+    p256_fe_sub(x3, x3, z3);
+    p256_fe_mul(z3, t0, t1);
+    p256_fe_add(z3, z3, z3);
+    p256_fe_add(z3, z3, z3);
+
+    FLib_MemCpy(r->x, x3, sizeof(x3));
+    FLib_MemCpy(r->y, y3, sizeof(y3));
+    FLib_MemCpy(r->z, z3, sizeof(z3));
+}
+
+/* acc = acc + digit-th entry of the comb table, unchanged for the digit 0 */
+static void p256_comb_add(sw_ecp256_point_t *pAcc, const p256_affine_t *pTable, uint32_t digit)
+{
+    p256_affine_t     entry = {{0U}, {0U}};
+    sw_ecp256_point_t sum;
+    uint32_t          mask;
+
+    for (uint32_t j = 0U; j < P256_COMB_POINTS; j++)
+    {
+        mask = p256_ct_eq(digit, j + 1U);
+        for (uint32_t i = 0U; i < P256_WORDS; i++)
+        {
+            entry.x[i] |= pTable[j].x[i] & mask;
+            entry.y[i] |= pTable[j].y[i] & mask;
+        }
+    }
+
+    /* With the digit 0 the sum is computed on (0, 0) and dropped */
+    p256_point_add_affine(&sum, pAcc, &entry);
+    mask = ~p256_ct_eq(digit, 0U);
+    p256_fe_select(pAcc->x, sum.x, mask);
+    p256_fe_select(pAcc->y, sum.y, mask);
+    p256_fe_select(pAcc->z, sum.z, mask);
+}
+
+/* One comb column: acc = 2 * acc + T0[digit0] + T1[digit1] */
+static void p256_comb_iteration(sw_ecp256_mul_ctx_t *pCtx)
+{
+    uint32_t column = (uint32_t)pCtx->remaining - 1U;
+
+    if (column != (P256_COMB_COLUMNS - 1U))
+    {
+        p256_point_double(&pCtx->acc, &pCtx->acc);
+    }
+    p256_comb_add(&pCtx->acc, mP256CombTable[0], (uint32_t)(uint8_t)pCtx->digits[2U * column]);
+    p256_comb_add(&pCtx->acc, mP256CombTable[1], (uint32_t)(uint8_t)pCtx->digits[2U * column + 1U]);
+    pCtx->remaining--;
+}
+
+/* One signed window: acc = 16 * acc + digit * P */
+static void p256_window_iteration(sw_ecp256_mul_ctx_t *pCtx)
+{
+    sw_ecp256_point_t entry;
+    uint32_t          negY[P256_WORDS];
+    uint32_t          digit = (uint32_t)(int32_t)pCtx->digits[pCtx->remaining - 1U];
+    uint32_t          sign  = digit >> 31;
+    uint32_t          index = (((digit ^ (0U - sign)) + sign) >> 1); /* (|digit| - 1) / 2, |digit| is odd */
+    uint32_t          mask;
+
+    for (uint32_t i = 0U; i < P256_WINDOW_BITS; i++)
+    {
+        p256_point_double(&pCtx->acc, &pCtx->acc);
+    }
+
+    FLib_MemSet(&entry, 0U, sizeof(entry));
+    for (uint32_t j = 0U; j < SW_ECP256_WINDOW_POINTS; j++)
+    {
+        mask = p256_ct_eq(index, j);
+        for (uint32_t i = 0U; i < P256_WORDS; i++)
+        {
+            entry.x[i] |= pCtx->table[j].x[i] & mask;
+            entry.y[i] |= pCtx->table[j].y[i] & mask;
+            entry.z[i] |= pCtx->table[j].z[i] & mask;
+        }
+    }
+    /* y is never 0 on P-256, p - y is reduced */
+    (void)p256_sub_words(negY, mP256P, entry.y);
+    p256_fe_select(entry.y, negY, 0U - sign);
+
+    p256_point_add(&pCtx->acc, &pCtx->acc, &entry);
+    pCtx->remaining--;
+}
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+
+bool sw_ecp256_scalar_valid(const uint8_t pScalar[SEC_ECP256_SCALAR_LEN])
+{
+    uint32_t k[P256_WORDS];
+    uint32_t diff[P256_WORDS];
+    bool     valid;
+
+    p256_load(k, pScalar);
+    /* 0 < k < n */
+    valid = (p256_sub_words(diff, k, mP256N) == 1U) && !p256_is_zero(k);
+    FLib_MemSet(k, 0U, sizeof(k));
+    FLib_MemSet(diff, 0U, sizeof(diff));
+
+    return valid;
+}
+
+secEcp256Status_t sw_ecp256_mul_base_start(sw_ecp256_mul_ctx_t *pCtx, const uint8_t pScalar[SEC_ECP256_SCALAR_LEN])
+{
+    secEcp256Status_t status = gSecEcp256InvalidScalar_c;
+    uint32_t          k[P256_WORDS];
+    uint32_t          low;
+    uint32_t          high;
+
+    do
+    {
+        if (!sw_ecp256_scalar_valid(pScalar))
+        {
+            break;
+        }
+        FLib_MemSet(pCtx, 0U, sizeof(*pCtx));
+        p256_load(k, pScalar);
+
+        /* The comb digits of column c are the bits c of the words 0 to 3 and 4 to 7 */
+        for (uint32_t c = 0U; c < P256_COMB_COLUMNS; c++)
+        {
+            low  = 0U;
+            high = 0U;
+            for (uint32_t i = 0U; i < P256_COMB_TEETH; i++)
+            {
+                low |= ((k[i] >> c) & 1U) << i;
+                high |= ((k[i + P256_COMB_TEETH] >> c) & 1U) << i;
+            }
+            pCtx->digits[2U * c]      = (int8_t)low;
+            pCtx->digits[2U * c + 1U] = (int8_t)high;
+        }
+        FLib_MemSet(k, 0U, sizeof(k));
+
+        /* The accumulator starts at the point at infinity (0 : 1 : 0) */
+        FLib_MemCpy(pCtx->acc.y, mP256One, sizeof(mP256One));
+        pCtx->remaining = (uint8_t)P256_COMB_COLUMNS;
+        pCtx->fixedBase = TRUE;
+        status          = gSecEcp256Success_c;
+    } while (false);
+
+    return status;
+}
+
+secEcp256Status_t sw_ecp256_mul_start(sw_ecp256_mul_ctx_t *pCtx,
+                                      const uint8_t       *pPointXY,
+                                      const uint8_t        pScalar[SEC_ECP256_SCALAR_LEN])
+{
+    secEcp256Status_t status = gSecEcp256InvalidScalar_c;
+    uint32_t          k[P256_WORDS + 1U];
+    uint32_t          negK[P256_WORDS];
+    uint32_t          lhs[P256_WORDS];
+    uint32_t          rhs[P256_WORDS];
+    uint32_t          t[P256_WORDS];
+    sw_ecp256_point_t twice;
+    uint32_t          bit;
+    uint32_t          window;
+
+    do
+    {
+        if (!sw_ecp256_scalar_valid(pScalar))
+        {
+            break;
+        }
+        FLib_MemSet(pCtx, 0U, sizeof(*pCtx));
+
+        /* The coordinates must be below p and y^2 = x^3 - 3x + b */
+        p256_load(lhs, pPointXY);
+        p256_load(rhs, &pPointXY[SEC_ECP256_COORDINATE_LEN]);
+        if ((p256_sub_words(t, lhs, mP256P) == 0U) || (p256_sub_words(t, rhs, mP256P) == 0U))
+        {
+            status = gSecEcp256InvalidPoint_c;
+            break;
+        }
+        p256_fe_mul(pCtx->table[0].x, lhs, mP256R2);
+        p256_fe_mul(pCtx->table[0].y, rhs, mP256R2);
+        FLib_MemCpy(pCtx->table[0].z, mP256One, sizeof(mP256One));
+
+        p256_fe_mul(lhs, pCtx->table[0].y, pCtx->table[0].y);
+        p256_fe_mul(rhs, pCtx->table[0].x, pCtx->table[0].x);
+        p256_fe_mul(rhs, rhs, pCtx->table[0].x);
+        p256_fe_add(t, pCtx->table[0].x, pCtx->table[0].x);
+        p256_fe_add(t, t, pCtx->table[0].x);
+        p256_fe_sub(rhs, rhs, t);
+        p256_fe_add(rhs, rhs, mP256B);
+        if (FLib_MemCmp(lhs, rhs, sizeof(lhs)) == FALSE)
+        {
+            status = gSecEcp256InvalidPoint_c;
+            break;
+        }
+
+        /* An even scalar is replaced by n - k, which is odd, and the result is negated */
+        p256_load(k, pScalar);
+        k[P256_WORDS] = 0U;
+        bit           = k[0] & 1U;
+        (void)p256_sub_words(negK, mP256N, k);
+        p256_fe_select(k, negK, bit - 1U);
+        pCtx->negate = (uint8_t)(bit ^ 1U);
+
+        /* Regular recoding of the odd scalar: digit i is (bits 4i to 4i+4, with the bit 4i set) - 16 */
+        for (uint32_t i = 0U; i < P256_WINDOWS; i++)
+        {
+            bit    = P256_WINDOW_BITS * i;
+            window = (uint32_t)((((uint64_t)k[bit / 32U + 1U] << 32) | k[bit / 32U]) >> (bit % 32U)) & 0x1FU;
+            pCtx->digits[i] = (int8_t)(int32_t)((window | 1U) - 16U);
+        }
+        pCtx->digits[P256_WINDOWS] = 1;
+        FLib_MemSet(k, 0U, sizeof(k));
+        FLib_MemSet(negK, 0U, sizeof(negK));
+
+        /* Odd multiples P, 3P, ... 15P */
+        p256_point_double(&twice, &pCtx->table[0]);
+        for (uint32_t j = 1U; j < SW_ECP256_WINDOW_POINTS; j++)
+        {
+            p256_point_add(&pCtx->table[j], &pCtx->table[j - 1U], &twice);
+        }
+
+        /* The top digit is 1 */
+        FLib_MemCpy(&pCtx->acc, &pCtx->table[0], sizeof(pCtx->acc));
+        pCtx->remaining = (uint8_t)P256_WINDOWS;
+        pCtx->fixedBase = FALSE;
+        status          = gSecEcp256Success_c;
+    } while (false);
+
+    return status;
+}
+
+bool sw_ecp256_mul_step(sw_ecp256_mul_ctx_t *pCtx, uint32_t numBits)
+{
+    uint32_t iterations = numBits / ((pCtx->fixedBase != FALSE) ? P256_COMB_BITS : P256_WINDOW_BITS);
+
+    if (iterations == 0U)
+    {
+        iterations = 1U;
+    }
+    while ((iterations > 0U) && (pCtx->remaining > 0U))
+    {
+        if (pCtx->fixedBase != FALSE)
+        {
+            p256_comb_iteration(pCtx);
+        }
+        else
+        {
+            p256_window_iteration(pCtx);
+        }
+        iterations--;
+    }
+
+    return (pCtx->remaining == 0U);
+}
+
+secEcp256Status_t sw_ecp256_mul_finish(sw_ecp256_mul_ctx_t *pCtx, uint8_t pOutXY[2U * SEC_ECP256_COORDINATE_LEN])
+{
+    secEcp256Status_t status = gSecEcp256NeutralPoint_c;
+    uint32_t          zInv[P256_WORDS];
+    uint32_t          coord[P256_WORDS];
+    const uint32_t    one[P256_WORDS] = {1U, 0U, 0U, 0U, 0U, 0U, 0U, 0U};
+
+    do
+    {
+        if (pCtx->remaining != 0U)
+        {
+            status = gSecEcp256InvalidState_c;
+            break;
+        }
+        if (p256_is_zero(pCtx->acc.z))
+        {
+            break;
+        }
+
+        (void)p256_sub_words(coord, mP256P, pCtx->acc.y);
+        p256_fe_select(pCtx->acc.y, coord, 0U - (uint32_t)pCtx->negate);
+
+        p256_fe_inv(zInv, pCtx->acc.z);
+        p256_fe_mul(coord, pCtx->acc.x, zInv);
+        p256_fe_mul(coord, coord, one);
+        p256_store(pOutXY, coord);
+        p256_fe_mul(coord, pCtx->acc.y, zInv);
+        p256_fe_mul(coord, coord, one);
+        p256_store(&pOutXY[SEC_ECP256_COORDINATE_LEN], coord);
+        status = gSecEcp256Success_c;
+    } while (false);
+
+    FLib_MemSet(pCtx, 0U, sizeof(*pCtx));
+
+    return status;
+}
+
+#endif /* gSecLibEcp256CombEnable_d */
@@ -87,6 +87,21 @@ extern osa_status_t SecLibMutexUnlock(void);
 *************************************************************************************
 ********************************************************************************** */
 
+/*! State of an AES-128 key context, see AES_128_KeyCtxInit() */
+typedef struct secAesKeyState_tag
+{
+    mbedtls_aes_context      aesCtx; /* encryption key schedule, for ECB and CTR */
+    mbedtls_ccm_context      ccmCtx;
+    mbedtls_cipher_context_t cmacCtx; /* keyed once, reset before each MAC */
+} secAesKeyState_t;
+
+/*! State of an HMAC-SHA256 key context, see HMAC_SHA256_KeyCtxInit() */
+typedef struct secHmacSha256KeyState_tag
+{
+    uint8_t  key[SHA256_BLOCK_SIZE];
+    uint32_t keyLen;
+} secHmacSha256KeyState_t;
+
 /************************************************************************************
 *************************************************************************************
 * Private memory declarations
@@ -1095,6 +1110,280 @@ uint8_t AES_128_CCM(const uint8_t *pInput,
     }
 }
 
+/*! *********************************************************************************
+ * \brief  This function sets up an AES-128 key context.
+ *
+ * \param[out]  pCtx  Pointer to the key context to set up.
+ *
+ * \param[in]  pKey  Pointer to the location of the 128-bit key.
+ *
+ * \return : gSecSuccess_c if no error,
+ *           gSecBadArgument_c in case of bad arguments,
+ *           gSecAllocError_c if the context state can't be allocated,
+ *           gSecError_c in case of internal error.
+ *
+ * \remarks The AES key schedule, the CCM context and the keyed CMAC context are set up once.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_KeyCtxInit(secAesKeyCtx_t *pCtx, const uint8_t *pKey)
+{
+    secResultType_t   result = gSecBadArgument_c;
+    secAesKeyState_t *pState = NULL;
+
+    do
+    {
+        if ((pCtx == NULL) || (pKey == NULL))
+        {
+            break;
+        }
+        pCtx->pState = NULL;
+
+        pState = (secAesKeyState_t *)MEM_BufferAlloc(sizeof(secAesKeyState_t));
+        if (pState == NULL)
+        {
+            result = gSecAllocError_c;
+            break;
+        }
+        mbedtls_aes_init(&pState->aesCtx);
+        mbedtls_ccm_init(&pState->ccmCtx);
+        mbedtls_cipher_init(&pState->cmacCtx);
+
+        result = gSecError_c;
+        if (mbedtls_aes_setkey_enc(&pState->aesCtx, pKey, AES_128_KEY_BITS) != 0)
+        {
+            break;
+        }
+        if (mbedtls_ccm_setkey(&pState->ccmCtx, MBEDTLS_CIPHER_ID_AES, pKey, AES_128_KEY_BITS) != 0)
+        {
+            break;
+        }
+        if (mbedtls_cipher_setup(&pState->cmacCtx, mbedtls_cipher_info_from_type(MBEDTLS_CIPHER_AES_128_ECB)) != 0)
+        {
+            break;
+        }
+        if (mbedtls_cipher_cmac_starts(&pState->cmacCtx, pKey, AES_128_KEY_BITS) != 0)
+        {
+            break;
+        }
+
+        pCtx->pState = pState;
+        result       = gSecSuccess_c;
+    } while (false);
+
+    if ((result != gSecSuccess_c) && (pState != NULL))
+    {
+        mbedtls_aes_free(&pState->aesCtx);
+        mbedtls_ccm_free(&pState->ccmCtx);
+        mbedtls_cipher_free(&pState->cmacCtx);
+        (void)MEM_BufferFree(pState);
+    }
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function releases an AES-128 key context. The key material is erased.
+ *
+ * \param[in, out]  pCtx  Pointer to the key context.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxDestroy(secAesKeyCtx_t *pCtx)
+{
+    secAesKeyState_t *pState;
+
+    if ((pCtx != NULL) && (pCtx->pState != NULL))
+    {
+        pState = (secAesKeyState_t *)pCtx->pState;
+
+        /* the mbedTLS free functions zeroize the contexts */
+        mbedtls_aes_free(&pState->aesCtx);
+        mbedtls_ccm_free(&pState->ccmCtx);
+        mbedtls_cipher_free(&pState->cmacCtx);
+        (void)MEM_BufferFree(pState);
+        pCtx->pState = NULL;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128 encryption on a 16-byte block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the 16-byte plain text block.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput)
+{
+    secAesKeyState_t *pState = (secAesKeyState_t *)pCtx->pState;
+    int               result;
+
+    SECLIB_MUTEX_LOCK();
+
+    result = mbedtls_aes_crypt_ecb(&pState->aesCtx, MBEDTLS_AES_ENCRYPT, pInput, pOutput);
+    if (result != 0)
+    {
+        assert(0);
+    }
+
+    SECLIB_MUTEX_UNLOCK();
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-ECB encryption on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes, must be a multiple of 16 bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEcbEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    secAesKeyState_t *pState = (secAesKeyState_t *)pCtx->pState;
+    int               result;
+
+    /* If the input length is not a multiple of AES 128 block size return */
+    if ((inputLen == 0U) || ((inputLen % AES_128_BLOCK_SIZE) != 0U))
+    {
+        return;
+    }
+
+    SECLIB_MUTEX_LOCK();
+
+    while (inputLen != 0U)
+    {
+        result = mbedtls_aes_crypt_ecb(&pState->aesCtx, MBEDTLS_AES_ENCRYPT, pInput, pOutput);
+        if (result != 0)
+        {
+            assert(0);
+        }
+        pInput += AES_128_BLOCK_SIZE;
+        pOutput += AES_128_BLOCK_SIZE;
+        inputLen -= AES_128_BLOCK_SIZE;
+    }
+
+    SECLIB_MUTEX_UNLOCK();
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CTR encryption or decryption on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes.
+ *
+ * \param[in, out]  pCounter Pointer to the location of the 128-bit counter.
+ *
+ * \param[out]  pOutput Pointer to the location to store the output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCtr(
+    const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pCounter, uint8_t *pOutput)
+{
+    secAesKeyState_t *pState                        = (secAesKeyState_t *)pCtx->pState;
+    size_t            ctrOffset                     = 0U;
+    uint8_t           streamBlk[AES_128_BLOCK_SIZE] = {0U};
+    int               result;
+
+    SECLIB_MUTEX_LOCK();
+
+    /* mbedTLS increments the counter for the last partial block too */
+    result = mbedtls_aes_crypt_ctr(&pState->aesCtx, inputLen, &ctrOffset, pCounter, streamBlk, pInput, pOutput);
+    if (result != 0)
+    {
+        assert(0);
+    }
+
+    SECLIB_MUTEX_UNLOCK();
+
+    FLib_MemSet(streamBlk, 0U, sizeof(streamBlk));
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CMAC on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message, MSB first.
+ *
+ * \param[in]  inputLen Length of the input message in bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte authentication code.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCmac(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    secAesKeyState_t *pState = (secAesKeyState_t *)pCtx->pState;
+    int               result;
+
+    /* The CMAC context is shared by all the users of the key context */
+    SECLIB_MUTEX_LOCK();
+
+    result = mbedtls_cipher_cmac_reset(&pState->cmacCtx);
+    if (result == 0)
+    {
+        result = mbedtls_cipher_cmac_update(&pState->cmacCtx, pInput, inputLen);
+    }
+    if (result == 0)
+    {
+        result = mbedtls_cipher_cmac_finish(&pState->cmacCtx, pOutput);
+    }
+    if (result != 0)
+    {
+        assert(0);
+    }
+
+    SECLIB_MUTEX_UNLOCK();
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CCM on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \remarks The other parameters are the ones of AES_128_CCM().
+ *
+ ********************************************************************************** */
+uint8_t AES_128_KeyCtxCcm(const secAesKeyCtx_t *pCtx,
+                          const uint8_t        *pInput,
+                          uint16_t              inputLen,
+                          const uint8_t        *pAuthData,
+                          uint16_t              authDataLen,
+                          const uint8_t        *pNonce,
+                          uint8_t               nonceSize,
+                          uint8_t              *pOutput,
+                          uint8_t              *pCbcMac,
+                          uint8_t               macSize,
+                          uint32_t              flags)
+{
+    secAesKeyState_t *pState = (secAesKeyState_t *)pCtx->pState;
+    int32_t           status;
+
+    SECLIB_MUTEX_LOCK();
+
+    if ((flags & gSecLib_CCM_Decrypt_c) != 0U)
+    {
+        status = mbedtls_ccm_auth_decrypt(&pState->ccmCtx, inputLen, pNonce, nonceSize, pAuthData, authDataLen, pInput,
+                                          pOutput, pCbcMac, macSize);
+    }
+    else
+    {
+        status = mbedtls_ccm_encrypt_and_tag(&pState->ccmCtx, inputLen, pNonce, nonceSize, pAuthData, authDataLen,
+                                             pInput, pOutput, pCbcMac, macSize);
+    }
+
+    SECLIB_MUTEX_UNLOCK();
+
+    return (status == 0) ? (uint8_t)gSecSuccess_c : (uint8_t)gSecError_c;
+}
+
 /*! *********************************************************************************
  * \brief  This function calculates XOR of individual byte pairs in two uint8_t arrays.
  *         pDst[i] := pDst[i] ^ pSrc[i] for i=0 to n-1
@@ -1518,6 +1807,110 @@ void HMAC_SHA256(const uint8_t *pKey, uint32_t keyLen, const uint8_t *pData, uin
     SECLIB_MUTEX_UNLOCK();
 }
 
+/*! *********************************************************************************
+ * \brief  This function sets up an HMAC-SHA256 key context.
+ *
+ * \param [out]   pCtx        Pointer to the key context to set up.
+ * \param [in]    pKey        Pointer to the HMAC key
+ * \param [in]    keyLen      Length of the HMAC key in bytes
+ *
+ * \return : gSecSuccess_c if no error,
+ *           gSecBadArgument_c in case of bad arguments,
+ *           gSecAllocError_c if the context state can't be allocated.
+ *
+ * \remarks The key is kept, hashed first if longer than a SHA256 block. The pad blocks are processed on each
+ *          HMAC_SHA256_KeyCtxStart().
+ *
+ ********************************************************************************** */
+secResultType_t HMAC_SHA256_KeyCtxInit(secHmacSha256KeyCtx_t *pCtx, const uint8_t *pKey, uint32_t keyLen)
+{
+    secResultType_t          result = gSecBadArgument_c;
+    secHmacSha256KeyState_t *pState;
+
+    do
+    {
+        if ((pCtx == NULL) || ((pKey == NULL) && (keyLen > 0u)))
+        {
+            break;
+        }
+        pCtx->pState = NULL;
+
+        pState = (secHmacSha256KeyState_t *)MEM_BufferAlloc(sizeof(secHmacSha256KeyState_t));
+        if (pState == NULL)
+        {
+            result = gSecAllocError_c;
+            break;
+        }
+
+        if (keyLen > SHA256_BLOCK_SIZE)
+        {
+            SHA256_Hash(pKey, keyLen, pState->key);
+            pState->keyLen = SHA256_HASH_SIZE;
+        }
+        else
+        {
+            FLib_MemCpy(pState->key, pKey, keyLen);
+            pState->keyLen = keyLen;
+        }
+
+        pCtx->pState = pState;
+        result       = gSecSuccess_c;
+    } while (false);
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function releases an HMAC-SHA256 key context. The key material is erased.
+ *
+ * \param [in, out]  pCtx     Pointer to the key context.
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxDestroy(secHmacSha256KeyCtx_t *pCtx)
+{
+    if ((pCtx != NULL) && (pCtx->pState != NULL))
+    {
+        FLib_MemSet(pCtx->pState, 0U, sizeof(secHmacSha256KeyState_t));
+        (void)MEM_BufferFree(pCtx->pState);
+        pCtx->pState = NULL;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  This function initializes an HMAC SHA256 context from a key context.
+ *
+ * \param [in]    pCtx        Pointer to the key context set up by HMAC_SHA256_KeyCtxInit().
+ * \param [out]   pContext    Pointer to the HMAC SHA256 context data
+ *                            Allocated using HMAC_SHA256_AllocCtx()
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxStart(const secHmacSha256KeyCtx_t *pCtx, void *pContext)
+{
+    const secHmacSha256KeyState_t *pState = (const secHmacSha256KeyState_t *)pCtx->pState;
+
+    HMAC_SHA256_Init(pContext, pState->key, pState->keyLen);
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs all HMAC SHA256 steps on multiple bytes with a key context.
+ *         The final HMAC value is stored at the provided output location.
+ *
+ * \param [in]       pCtx        Pointer to the key context set up by HMAC_SHA256_KeyCtxInit().
+ * \param [in]       pData       Pointer to the input data
+ * \param [in]       numBytes    Number of bytes to perform HMAC on
+ * \param [in,out]   pOutput     Pointer to the output location
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxCompute(const secHmacSha256KeyCtx_t *pCtx,
+                               const uint8_t               *pData,
+                               uint32_t                     numBytes,
+                               uint8_t                     *pOutput)
+{
+    const secHmacSha256KeyState_t *pState = (const secHmacSha256KeyState_t *)pCtx->pState;
+
+    HMAC_SHA256(pState->key, pState->keyLen, pData, numBytes, pOutput);
+}
+
 #define mRevertEcdhKeys_d 1
 
 mbedtls_ecdh_context gEcdhCtx;
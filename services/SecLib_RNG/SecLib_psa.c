@@ -28,6 +28,7 @@
 #include "fsl_component_mem_manager.h"
 #include "p256-m.h"
 #include "FunctionLib.h"
+#include "fsl_os_abstraction.h"
 #include "fwk_platform_crypto.h"
 #include "SecLib_ecp256.h"
 #include "CryptoLibSW.h"
@@ -39,6 +40,20 @@
 ********************************************************************************** */
 #define KEY_ID_BLE0 0x426c6530
 
+/* Number of counter blocks encrypted by one PSA call in AES_128_KeyCtxCtr() */
+#define PSA_AES_CTR_BLOCKS 4U
+
+/* Number of AES-128 keys kept imported by the functions taking the raw key, least recently used first out. 0 imports
+ * and destroys the key at each call. Each cached key holds a PSA key slot, see MBEDTLS_PSA_KEY_SLOT_COUNT. */
+#ifndef gSecLibPsaKeyCacheSize_d
+#define gSecLibPsaKeyCacheSize_d 0
+#endif
+
+/* Key policies shared by the encryption and decryption functions so that they use the same cached key. The CCM tag
+ * length is given on each call, the policy accepts all of them. */
+#define PSA_AES_CIPHER_USAGE (PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT)
+#define PSA_AES_CCM_POLICY   PSA_ALG_AEAD_WITH_AT_LEAST_THIS_LENGTH_TAG(PSA_ALG_CCM, 4U)
+
 #define RAISE_ERROR(st, expected)                                \
     if ((st) != (expected))                                      \
     {                                                            \
@@ -72,9 +87,36 @@ typedef struct psa_ecp256_context_t
     psa_key_id_t OwnKey;                                    /*! Own Key object reference */
 } psa_ecp256_context_t;
 
+/*! State of an AES-128 key context, see AES_128_KeyCtxInit() */
+typedef struct psa_aes_key_state_t
+{
+    psa_key_id_t ecbKey; /*! ECB encryption, also generates the CTR key stream */
+    psa_key_id_t cmacKey;
+    psa_key_id_t ccmKey; /*! CCM encryption and decryption, all tag lengths */
+} psa_aes_key_state_t;
+
+#if gSecLibPsaKeyCacheSize_d > 0
+/*! Imported key of the cache, free when keyId is PSA_KEY_ID_NULL */
+typedef struct psa_key_cache_entry_t
+{
+    psa_key_id_t    keyId;
+    uint32_t        hash;    /*! hash of the key material and the policy, checked before the key */
+    uint32_t        lastUse; /*! LRU stamp */
+    psa_algorithm_t alg;
+    psa_key_usage_t usage;
+    uint16_t        users; /*! calls using the key, it can't be evicted until they release it */
+    uint8_t         key[AES_128_KEY_BYTE_LEN];
+} psa_key_cache_entry_t;
+#endif
+
 static psa_ecp256_context_t  psa_g_ECP_KeyPair;
 static psa_ecp256_context_t *psa_pECPKeyPair = ((void *)0);
 
+#if gSecLibPsaKeyCacheSize_d > 0
+static psa_key_cache_entry_t psa_g_KeyCache[gSecLibPsaKeyCacheSize_d];
+static uint32_t              psa_g_KeyCacheStamp;
+#endif
+
 /*! *********************************************************************************
 *************************************************************************************
 * Private functions
@@ -94,6 +136,244 @@ static bool ECP256_LePointValid(const ecp256Point_t *P)
 #endif
 }
 
+#if gSecLibPsaKeyCacheSize_d > 0
+/* FNV-1a of the key and the policy, only used to skip the entries that can't match */
+static uint32_t psa_key_cache_hash(const uint8_t *pKey, psa_algorithm_t alg, psa_key_usage_t usage)
+{
+    uint32_t hash = 2166136261U;
+
+    for (uint32_t i = 0U; i < AES_128_KEY_BYTE_LEN; i++)
+    {
+        hash = (hash ^ pKey[i]) * 16777619U;
+    }
+    hash = (hash ^ (uint32_t)alg) * 16777619U;
+    hash = (hash ^ (uint32_t)usage) * 16777619U;
+
+    return hash;
+}
+
+/* Compares the key without early exit */
+static bool psa_key_cache_key_equal(const uint8_t *pKey1, const uint8_t *pKey2)
+{
+    uint8_t diff = 0U;
+
+    for (uint32_t i = 0U; i < AES_128_KEY_BYTE_LEN; i++)
+    {
+        diff |= pKey1[i] ^ pKey2[i];
+    }
+
+    return diff == 0U;
+}
+
+/* Least recently used entry not in use, a free entry first if allowed. Must be called with the interrupts masked. */
+static psa_key_cache_entry_t *psa_key_cache_victim(bool allowFree)
+{
+    psa_key_cache_entry_t *pVictim = NULL;
+
+    for (uint32_t i = 0U; i < (uint32_t)gSecLibPsaKeyCacheSize_d; i++)
+    {
+        psa_key_cache_entry_t *pEntry = &psa_g_KeyCache[i];
+
+        if (pEntry->keyId == PSA_KEY_ID_NULL)
+        {
+            if (allowFree)
+            {
+                pVictim = pEntry;
+                break;
+            }
+        }
+        /* the stamps wrap around, compare their age */
+        else if ((pEntry->users == 0U) &&
+                 ((pVictim == NULL) ||
+                  ((psa_g_KeyCacheStamp - pEntry->lastUse) > (psa_g_KeyCacheStamp - pVictim->lastUse))))
+        {
+            pVictim = pEntry;
+        }
+        else
+        {
+            /* in use or more recent */
+        }
+    }
+
+    return pVictim;
+}
+
+/* Erases an entry and returns its key, to be destroyed by the caller. Must be called with the interrupts masked. */
+static psa_key_id_t psa_key_cache_clear(psa_key_cache_entry_t *pEntry)
+{
+    psa_key_id_t keyId = pEntry->keyId;
+
+    FLib_MemSet(pEntry, 0U, sizeof(psa_key_cache_entry_t));
+    pEntry->keyId = PSA_KEY_ID_NULL;
+
+    return keyId;
+}
+
+/* Destroys the least recently used key not in use to free a PSA key slot */
+static bool psa_key_cache_evict(void)
+{
+    psa_key_cache_entry_t *pVictim;
+    psa_key_id_t           keyId = PSA_KEY_ID_NULL;
+
+    OSA_InterruptDisable();
+    pVictim = psa_key_cache_victim(false);
+    if (pVictim != NULL)
+    {
+        keyId = psa_key_cache_clear(pVictim);
+    }
+    OSA_InterruptEnable();
+
+    if (keyId != PSA_KEY_ID_NULL)
+    {
+        (void)psa_destroy_key(keyId);
+    }
+
+    return keyId != PSA_KEY_ID_NULL;
+}
+#endif /* gSecLibPsaKeyCacheSize_d */
+
+/* Imports an AES-128 key for one algorithm, the cached keys not in use are destroyed if the PSA key slots are full */
+static psa_status_t psa_aes_import_key(
+    const uint8_t *pKey, psa_algorithm_t alg, psa_key_usage_t usage, psa_key_id_t *pKeyId)
+{
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+    psa_status_t         status;
+
+    psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+    psa_set_key_algorithm(&attributes, alg);
+    psa_set_key_usage_flags(&attributes, usage);
+
+    status = psa_import_key(&attributes, pKey, AES_128_KEY_BYTE_LEN, pKeyId);
+#if gSecLibPsaKeyCacheSize_d > 0
+    while ((status == PSA_ERROR_INSUFFICIENT_MEMORY) && psa_key_cache_evict())
+    {
+        /* the cache held the last key slots */
+        status = psa_import_key(&attributes, pKey, AES_128_KEY_BYTE_LEN, pKeyId);
+    }
+#endif
+
+    return status;
+}
+
+/* Increments a 128-bit big endian counter */
+static void psa_aes_increment_counter(uint8_t *pCounter)
+{
+    for (uint32_t i = AES_BLOCK_SIZE; i > 0U; i--)
+    {
+        pCounter[i - 1U]++;
+        if (pCounter[i - 1U] != 0U)
+        {
+            break;
+        }
+    }
+}
+
+/* Returns the PSA key of an AES-128 key and policy, from the cache or imported. The key must be given back with
+ * psa_key_cache_release() after use. */
+static psa_status_t psa_key_cache_get(
+    const uint8_t *pKey, psa_algorithm_t alg, psa_key_usage_t usage, psa_key_id_t *pKeyId)
+{
+    psa_status_t status;
+#if gSecLibPsaKeyCacheSize_d > 0
+    uint32_t               hash    = psa_key_cache_hash(pKey, alg, usage);
+    psa_key_cache_entry_t *pEntry  = NULL;
+    psa_key_id_t           evicted = PSA_KEY_ID_NULL;
+
+    *pKeyId = PSA_KEY_ID_NULL;
+
+    OSA_InterruptDisable();
+    for (uint32_t i = 0U; i < (uint32_t)gSecLibPsaKeyCacheSize_d; i++)
+    {
+        psa_key_cache_entry_t *pCur = &psa_g_KeyCache[i];
+
+        if ((pCur->keyId != PSA_KEY_ID_NULL) && (pCur->hash == hash) && (pCur->alg == alg) &&
+            (pCur->usage == usage) && psa_key_cache_key_equal(pCur->key, pKey))
+        {
+            pEntry = pCur;
+            pEntry->users++;
+            psa_g_KeyCacheStamp++;
+            pEntry->lastUse = psa_g_KeyCacheStamp;
+            *pKeyId         = pEntry->keyId;
+            break;
+        }
+    }
+    OSA_InterruptEnable();
+
+    if (pEntry != NULL)
+    {
+        status = PSA_SUCCESS;
+    }
+    else
+    {
+        status = psa_aes_import_key(pKey, alg, usage, pKeyId);
+    }
+
+    if ((status == PSA_SUCCESS) && (pEntry == NULL))
+    {
+        OSA_InterruptDisable();
+        pEntry = psa_key_cache_victim(true);
+        if (pEntry != NULL)
+        {
+            evicted = psa_key_cache_clear(pEntry);
+            psa_g_KeyCacheStamp++;
+            pEntry->keyId   = *pKeyId;
+            pEntry->hash    = hash;
+            pEntry->lastUse = psa_g_KeyCacheStamp;
+            pEntry->alg     = alg;
+            pEntry->usage   = usage;
+            pEntry->users   = 1U;
+            FLib_MemCpy(pEntry->key, pKey, AES_128_KEY_BYTE_LEN);
+        }
+        /* else all the keys are in use, this one is destroyed at release */
+        OSA_InterruptEnable();
+
+        if (evicted != PSA_KEY_ID_NULL)
+        {
+            (void)psa_destroy_key(evicted);
+        }
+    }
+#else
+    status = psa_aes_import_key(pKey, alg, usage, pKeyId);
+#endif
+
+    return status;
+}
+
+/* Gives back a key returned by psa_key_cache_get(), it's destroyed if it's not cached */
+static void psa_key_cache_release(psa_key_id_t keyId)
+{
+    bool cached = false;
+
+#if gSecLibPsaKeyCacheSize_d > 0
+    OSA_InterruptDisable();
+    for (uint32_t i = 0U; i < (uint32_t)gSecLibPsaKeyCacheSize_d; i++)
+    {
+        if (psa_g_KeyCache[i].keyId == keyId)
+        {
+            psa_g_KeyCache[i].users--;
+            cached = true;
+            break;
+        }
+    }
+    OSA_InterruptEnable();
+#endif
+
+    if (!cached)
+    {
+        (void)psa_destroy_key(keyId);
+    }
+}
+
+/* Destroys the cached keys not in use */
+static void psa_key_cache_flush(void)
+{
+#if gSecLibPsaKeyCacheSize_d > 0
+    while (psa_key_cache_evict())
+    {
+    }
+#endif
+}
+
 /*! *********************************************************************************
 *************************************************************************************
 * Public functions
@@ -128,6 +408,9 @@ void SecLib_ReInit(void)
  ********************************************************************************** */
 void SecLib_DeInit(void)
 {
+    /* The imported keys may not survive the crypto hardware deinitialization */
+    psa_key_cache_flush();
+
     /* Deinitialize cryptographic hardware.*/
     (void)PLATFORM_TerminateCrypto();
 }
@@ -198,28 +481,19 @@ void SecLib_XorN(uint8_t *pDst, const uint8_t *pSrc, uint8_t n)
  ********************************************************************************** */
 void AES_128_Encrypt(const uint8_t *pInput, const uint8_t *pKey, uint8_t *pOutput)
 {
-    size_t                key_bits = AES_128_KEY_BYTE_LEN;
-    const psa_algorithm_t alg      = PSA_ALG_ECB_NO_PADDING;
+    const psa_algorithm_t alg = PSA_ALG_ECB_NO_PADDING;
     psa_status_t          status;
-    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
     psa_key_id_t          key        = 0U;
     size_t                output_len = 0U;
 
-    /* key initialisation before import */
-    psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
-    psa_set_key_algorithm(&attributes, alg);
-    psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
-
     do
     {
-        status = psa_import_key(&attributes, pKey, key_bits, &key); /* import the key in psa and get its id */
+        status = psa_key_cache_get(pKey, alg, PSA_AES_CIPHER_USAGE, &key); /* import the key in psa and get its id */
         RAISE_ERROR(status, PSA_SUCCESS);
 
         /* execute encryption with ECB NO PADDING */
         status = psa_cipher_encrypt(key, alg, pInput, AES_BLOCK_SIZE, pOutput, AES_BLOCK_SIZE, &output_len);
-        RAISE_ERROR(status, PSA_SUCCESS);
-
-        status = psa_destroy_key(key);
+        psa_key_cache_release(key);
         RAISE_ERROR(status, PSA_SUCCESS);
     } while (false);
 }
@@ -242,29 +516,20 @@ void AES_128_Encrypt(const uint8_t *pInput, const uint8_t *pKey, uint8_t *pOutpu
  ********************************************************************************** */
 void AES_128_ECB_Encrypt(const uint8_t *pInput, uint32_t inputLen, const uint8_t *pKey, uint8_t *pOutput)
 {
-    size_t                key_bits = AES_128_KEY_BYTE_LEN;
-    const psa_algorithm_t alg      = PSA_ALG_ECB_NO_PADDING;
+    const psa_algorithm_t alg = PSA_ALG_ECB_NO_PADDING;
     psa_status_t          status;
-    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
     psa_key_id_t          key        = 0U;
     size_t                output_len = 0U;
 
-    /* key initialisation before import */
-    psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
-    psa_set_key_algorithm(&attributes, alg);
-    psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
-
     do
     {
-        /* import pKey and get the address of the imported key */
-        status = psa_import_key(&attributes, pKey, key_bits, &key);
+        /* import pKey, or find it in the cache, and get the address of the imported key */
+        status = psa_key_cache_get(pKey, alg, PSA_AES_CIPHER_USAGE, &key);
         RAISE_ERROR(status, PSA_SUCCESS);
 
         /* execute the encryption with our key*/
         status = psa_cipher_encrypt(key, alg, pInput, inputLen, pOutput, inputLen, &output_len);
-        RAISE_ERROR(status, PSA_SUCCESS);
-
-        status = psa_destroy_key(key); /* destroy key after use */
+        psa_key_cache_release(key); /* destroy key after use if not cached */
         RAISE_ERROR(status, PSA_SUCCESS);
     } while (false);
 }
@@ -283,29 +548,21 @@ void AES_128_ECB_Encrypt(const uint8_t *pInput, uint32_t inputLen, const uint8_t
  ********************************************************************************** */
 void AES_128_Decrypt(const uint8_t *pInput, const uint8_t *pKey, uint8_t *pOutput)
 {
-    size_t                key_bits = AES_128_KEY_BYTE_LEN;
-    const psa_algorithm_t alg      = PSA_ALG_ECB_NO_PADDING;
+    const psa_algorithm_t alg = PSA_ALG_ECB_NO_PADDING;
     psa_status_t          status;
-    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
     psa_key_id_t          key        = 0U;
     size_t                output_len = 0U;
 
-    /* key initialisation before import */
-    psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
-    psa_set_key_algorithm(&attributes, alg);
-    psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_DECRYPT);
-
     do
     {
-        status = psa_import_key(&attributes, pKey, key_bits, &key);
+        status = psa_key_cache_get(pKey, alg, PSA_AES_CIPHER_USAGE, &key);
         RAISE_ERROR(status, PSA_SUCCESS);
 
         /* decrypt using ECB NO PADDING */
         status = psa_cipher_decrypt(key, alg, pInput, AES_BLOCK_SIZE, pOutput, AES_128_BLOCK_SIZE, &output_len);
-        RAISE_ERROR(status, PSA_SUCCESS);
 
-        /* destroy key after use */
-        status = psa_destroy_key(key);
+        /* destroy key after use if not cached */
+        psa_key_cache_release(key);
         RAISE_ERROR(status, PSA_SUCCESS);
     } while (false);
 }
@@ -327,26 +584,18 @@ void AES_128_Decrypt(const uint8_t *pInput, const uint8_t *pKey, uint8_t *pOutpu
 #ifdef FSL_FEATURE_SOC_AES_HW
 void AES_128_ECB_Decrypt(const uint8_t *pInput, uint32_t inputLen, const uint8_t *pKey, uint8_t *pOutput)
 {
-    size_t                key_bits = AES_128_KEY_BYTE_LEN;
-    const psa_algorithm_t alg      = PSA_ALG_ECB_NO_PADDING;
+    const psa_algorithm_t alg = PSA_ALG_ECB_NO_PADDING;
     psa_status_t          status;
-    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
     psa_key_id_t          key        = 0U;
     size_t                output_len = 0U;
 
-    psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
-    psa_set_key_algorithm(&attributes, alg);
-    psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_DECRYPT);
-
     do
     {
-        status = psa_import_key(&attributes, pKey, key_bits, &key);
+        status = psa_key_cache_get(pKey, alg, PSA_AES_CIPHER_USAGE, &key);
         RAISE_ERROR(status, PSA_SUCCESS);
 
         status = psa_cipher_decrypt(key, alg, pInput, inputLen, pOutput, inputLen, &output_len);
-        RAISE_ERROR(status, PSA_SUCCESS);
-
-        status = psa_destroy_key(key);
+        psa_key_cache_release(key);
         RAISE_ERROR(status, PSA_SUCCESS);
     } while (false);
 }
@@ -371,21 +620,14 @@ void AES_128_ECB_Decrypt(const uint8_t *pInput, uint32_t inputLen, const uint8_t
  ********************************************************************************** */
 void AES_128_CMAC_LsbFirstInput(const uint8_t *pInput, uint32_t inputLen, const uint8_t *pKey, uint8_t *pOutput)
 {
-    size_t                key_bits = AES_128_KEY_BYTE_LEN;
-    const psa_algorithm_t alg      = PSA_ALG_CMAC; /* Set algorithm to cmac */
+    const psa_algorithm_t alg = PSA_ALG_CMAC; /* Set algorithm to cmac */
     psa_status_t          status;
-    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
-    psa_key_id_t          key        = 0U;
+    psa_key_id_t          key        = PSA_KEY_ID_NULL;
     size_t                output_len = 0U;
 
-    /* key initialisation before import */
-    psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_MESSAGE);
-    psa_set_key_algorithm(&attributes, alg);
-    psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
-
     do
     {
-        status = psa_import_key(&attributes, pKey, key_bits, &key);
+        status = psa_key_cache_get(pKey, alg, PSA_KEY_USAGE_SIGN_MESSAGE, &key);
         RAISE_ERROR(status, PSA_SUCCESS);
 
         psa_mac_operation_t operation = PSA_MAC_OPERATION_INIT; /* init cmac operation */
@@ -425,10 +667,12 @@ void AES_128_CMAC_LsbFirstInput(const uint8_t *pInput, uint32_t inputLen, const
             16U; /* value of PSA_MAC_LENGTH(PSA_KEY_TYPE_AES, key_bits, alg) but macro has multiple misras; */
         status = psa_mac_sign_finish(&operation, pOutput, macLen, &output_len);
         RAISE_ERROR(status, PSA_SUCCESS);
-
-        status = psa_destroy_key(key); /* destroy key after use */
-        RAISE_ERROR(status, PSA_SUCCESS);
     } while (false);
+
+    if (key != PSA_KEY_ID_NULL)
+    {
+        psa_key_cache_release(key); /* destroy key after use if not cached */
+    }
 }
 
 /*! *********************************************************************************
@@ -448,28 +692,19 @@ void AES_128_CMAC_LsbFirstInput(const uint8_t *pInput, uint32_t inputLen, const
  ********************************************************************************** */
 void AES_128_CMAC(const uint8_t *pInput, const uint32_t inputLen, const uint8_t *pKey, uint8_t *pOutput)
 {
-    size_t                key_bits = AES_128_KEY_BYTE_LEN;
-    const psa_algorithm_t alg      = PSA_ALG_CMAC; /* set algorithm to cmac */
+    const psa_algorithm_t alg = PSA_ALG_CMAC; /* set algorithm to cmac */
     psa_status_t          status;
-    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
     psa_key_id_t          key        = 0U;
     size_t                output_len = 0U;
 
-    /* key initialisation before import */
-    psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_MESSAGE);
-    psa_set_key_algorithm(&attributes, alg);
-    psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
-
     do
     {
-        status = psa_import_key(&attributes, pKey, key_bits, &key);
+        status = psa_key_cache_get(pKey, alg, PSA_KEY_USAGE_SIGN_MESSAGE, &key);
         RAISE_ERROR(status, PSA_SUCCESS);
 
         /* compute mac operation on pInput */
         status = psa_mac_compute(key, alg, pInput, inputLen, pOutput, AES_BLOCK_SIZE, &output_len);
-        RAISE_ERROR(status, PSA_SUCCESS);
-
-        status = psa_destroy_key(key); /* destroy key after use */
+        psa_key_cache_release(key); /* destroy key after use if not cached */
         RAISE_ERROR(status, PSA_SUCCESS);
     } while (false);
 }
@@ -519,35 +754,19 @@ uint8_t AES_128_CCM(const uint8_t *pInput,
                     uint8_t        macSize,
                     uint32_t       flags)
 {
-    size_t               key_bits   = AES_128_KEY_BYTE_LEN;
-    psa_algorithm_t      alg        = PSA_ALG_CCM;
-    uint8_t             *buff       = MEM_BufferAlloc((uint32_t)(inputLen + (uint32_t)macSize));
-    psa_status_t         status     = PSA_ERROR_GENERIC_ERROR;
-    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
-    psa_key_id_t         key        = 0U;
-    size_t               output_len = 0U;
+    /* set the mac size of the algorithm to macSize, without this default is 32 */
+    psa_algorithm_t alg        = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, (uint32_t)macSize);
+    uint8_t        *buff       = MEM_BufferAlloc((uint32_t)(inputLen + (uint32_t)macSize));
+    psa_status_t    status     = PSA_ERROR_GENERIC_ERROR;
+    psa_key_id_t    key        = 0U;
+    size_t          output_len = 0U;
 
     if (buff != NULL && pInput != NULL && pAuthData != NULL && pNonce != NULL && pOutput != NULL && pCbcMac != NULL)
     {
-        /* set key usage depending on flags */
-        if ((flags & gSecLib_CCM_Decrypt_c) != 0U)
-        {
-            psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_DECRYPT);
-        }
-        else
-        {
-            psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
-        }
-
-        /* set the mac size of the algorithm to macSize, without this default is 32 */
-        alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(alg, (uint32_t)macSize);
-
-        psa_set_key_algorithm(&attributes, alg);
-        psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
-
         do
         {
-            status = psa_import_key(&attributes, pKey, key_bits, &key);
+            /* one key for both directions and all the MAC sizes */
+            status = psa_key_cache_get(pKey, PSA_AES_CCM_POLICY, PSA_AES_CIPHER_USAGE, &key);
             RAISE_ERROR(status, PSA_SUCCESS);
 
             if ((flags & gSecLib_CCM_Decrypt_c) != 0U)
@@ -567,14 +786,281 @@ uint8_t AES_128_CCM(const uint8_t *pInput,
                 FLib_MemCpy(pOutput, buff, inputLen);
                 FLib_MemCpy(pCbcMac, buff + inputLen, macSize);
             }
+            psa_key_cache_release(key); /* destroy key after use if not cached */
             RAISE_ERROR(status, PSA_SUCCESS);
+        } while (false);
+    }
 
-            status = psa_destroy_key(key); /* destroy key after use */
-            RAISE_ERROR(status, PSA_SUCCESS);
+    if (buff != NULL)
+    {
+        (void)MEM_BufferFree(buff);
+    }
 
-            (void)MEM_BufferFree(buff);
-        } while (false);
+    return (status == PSA_SUCCESS) ? (uint8_t)gSecSuccess_c : (uint8_t)gSecError_c;
+}
+
+/*! *********************************************************************************
+ * \brief  This function sets up an AES-128 key context.
+ *
+ * \param[out]  pCtx  Pointer to the key context to set up.
+ *
+ * \param[in]  pKey  Pointer to the location of the 128-bit key.
+ *
+ * \return : gSecSuccess_c if no error,
+ *           gSecBadArgument_c in case of bad arguments,
+ *           gSecAllocError_c if the context state can't be allocated,
+ *           gSecError_c if a key can't be imported.
+ *
+ * \remarks A PSA key policy allows one algorithm, the key is imported three times: for ECB (and the CTR key
+ *          stream), for CMAC and for CCM. Each context holds three volatile key slots until AES_128_KeyCtxDestroy().
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_KeyCtxInit(secAesKeyCtx_t *pCtx, const uint8_t *pKey)
+{
+    secResultType_t      result = gSecBadArgument_c;
+    psa_aes_key_state_t *pState = NULL;
+    psa_status_t         status;
+
+    do
+    {
+        if ((pCtx == NULL) || (pKey == NULL))
+        {
+            break;
+        }
+        pCtx->pState = NULL;
+
+        pState = (psa_aes_key_state_t *)MEM_BufferAlloc(sizeof(psa_aes_key_state_t));
+        if (pState == NULL)
+        {
+            result = gSecAllocError_c;
+            break;
+        }
+        pState->ecbKey  = PSA_KEY_ID_NULL;
+        pState->cmacKey = PSA_KEY_ID_NULL;
+        pState->ccmKey  = PSA_KEY_ID_NULL;
+
+        result = gSecError_c;
+        status = psa_aes_import_key(pKey, PSA_ALG_ECB_NO_PADDING, PSA_KEY_USAGE_ENCRYPT, &pState->ecbKey);
+        RAISE_ERROR(status, PSA_SUCCESS);
+
+        status = psa_aes_import_key(pKey, PSA_ALG_CMAC, PSA_KEY_USAGE_SIGN_MESSAGE, &pState->cmacKey);
+        RAISE_ERROR(status, PSA_SUCCESS);
+
+        status = psa_aes_import_key(pKey, PSA_AES_CCM_POLICY, PSA_AES_CIPHER_USAGE, &pState->ccmKey);
+        RAISE_ERROR(status, PSA_SUCCESS);
+
+        pCtx->pState = pState;
+        result       = gSecSuccess_c;
+    } while (false);
+
+    if ((result != gSecSuccess_c) && (pState != NULL))
+    {
+        (void)psa_destroy_key(pState->ecbKey);
+        (void)psa_destroy_key(pState->cmacKey);
+        (void)psa_destroy_key(pState->ccmKey);
+        (void)MEM_BufferFree(pState);
+    }
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function releases an AES-128 key context. The PSA keys are destroyed.
+ *
+ * \param[in, out]  pCtx  Pointer to the key context.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxDestroy(secAesKeyCtx_t *pCtx)
+{
+    psa_aes_key_state_t *pState;
+
+    if ((pCtx != NULL) && (pCtx->pState != NULL))
+    {
+        pState = (psa_aes_key_state_t *)pCtx->pState;
+
+        (void)psa_destroy_key(pState->ecbKey);
+        (void)psa_destroy_key(pState->cmacKey);
+        (void)psa_destroy_key(pState->ccmKey);
+        (void)MEM_BufferFree(pState);
+        pCtx->pState = NULL;
     }
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128 encryption on a 16-byte block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the 16-byte plain text block.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput)
+{
+    AES_128_KeyCtxEcbEncrypt(pCtx, pInput, AES_BLOCK_SIZE, pOutput);
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-ECB encryption on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes, must be a multiple of 16 bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEcbEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    const psa_aes_key_state_t *pState     = (const psa_aes_key_state_t *)pCtx->pState;
+    size_t                     output_len = 0U;
+    psa_status_t               status;
+
+    do
+    {
+        status = psa_cipher_encrypt(pState->ecbKey, PSA_ALG_ECB_NO_PADDING, pInput, inputLen, pOutput, inputLen,
+                                    &output_len);
+        RAISE_ERROR(status, PSA_SUCCESS);
+    } while (false);
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CTR encryption or decryption on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes.
+ *
+ * \param[in, out]  pCounter Pointer to the location of the 128-bit counter.
+ *
+ * \param[out]  pOutput Pointer to the location to store the output.
+ *
+ * \remarks The key stream is generated with the ECB key, PSA_AES_CTR_BLOCKS counter blocks per cipher call.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCtr(
+    const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pCounter, uint8_t *pOutput)
+{
+    uint8_t  counters[PSA_AES_CTR_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t  keyStream[PSA_AES_CTR_BLOCKS * AES_BLOCK_SIZE];
+    uint32_t chunkLen;
+    uint32_t blocks;
+
+    while (inputLen != 0U)
+    {
+        chunkLen = (inputLen > sizeof(keyStream)) ? sizeof(keyStream) : inputLen;
+        blocks   = (chunkLen + AES_BLOCK_SIZE - 1U) / AES_BLOCK_SIZE;
+
+        for (uint32_t i = 0U; i < blocks; i++)
+        {
+            FLib_MemCpy(&counters[i * AES_BLOCK_SIZE], pCounter, AES_BLOCK_SIZE);
+            psa_aes_increment_counter(pCounter);
+        }
+        AES_128_KeyCtxEcbEncrypt(pCtx, counters, blocks * AES_BLOCK_SIZE, keyStream);
+
+        for (uint32_t i = 0U; i < chunkLen; i++)
+        {
+            pOutput[i] = pInput[i] ^ keyStream[i];
+        }
+
+        pInput += chunkLen;
+        pOutput += chunkLen;
+        inputLen -= chunkLen;
+    }
+
+    FLib_MemSet(keyStream, 0U, sizeof(keyStream));
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CMAC on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message, MSB first.
+ *
+ * \param[in]  inputLen Length of the input message in bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte authentication code.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCmac(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    const psa_aes_key_state_t *pState     = (const psa_aes_key_state_t *)pCtx->pState;
+    size_t                     output_len = 0U;
+    psa_status_t               status;
+
+    do
+    {
+        status = psa_mac_compute(pState->cmacKey, PSA_ALG_CMAC, pInput, inputLen, pOutput, AES_BLOCK_SIZE, &output_len);
+        RAISE_ERROR(status, PSA_SUCCESS);
+    } while (false);
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CCM on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \remarks The other parameters are the ones of AES_128_CCM().
+ *
+ ********************************************************************************** */
+uint8_t AES_128_KeyCtxCcm(const secAesKeyCtx_t *pCtx,
+                          const uint8_t        *pInput,
+                          uint16_t              inputLen,
+                          const uint8_t        *pAuthData,
+                          uint16_t              authDataLen,
+                          const uint8_t        *pNonce,
+                          uint8_t               nonceSize,
+                          uint8_t              *pOutput,
+                          uint8_t              *pCbcMac,
+                          uint8_t               macSize,
+                          uint32_t              flags)
+{
+    const psa_aes_key_state_t *pState     = (const psa_aes_key_state_t *)pCtx->pState;
+    psa_algorithm_t            alg        = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, (uint32_t)macSize);
+    uint32_t                   buffLen    = (uint32_t)inputLen + (uint32_t)macSize;
+    uint8_t                   *buff       = MEM_BufferAlloc(buffLen);
+    psa_status_t               status     = PSA_ERROR_GENERIC_ERROR;
+    size_t                     output_len = 0U;
+
+    do
+    {
+        if (buff == NULL)
+        {
+            break;
+        }
+
+        /* PSA handles the ciphertext and the tag in one buffer */
+        if ((flags & gSecLib_CCM_Decrypt_c) != 0U)
+        {
+            FLib_MemCpy(buff, pInput, inputLen);
+            FLib_MemCpy(buff + inputLen, pCbcMac, macSize);
+            status = psa_aead_decrypt(pState->ccmKey, alg, pNonce, nonceSize, pAuthData, authDataLen, buff, buffLen,
+                                      pOutput, inputLen, &output_len);
+        }
+        else
+        {
+            status = psa_aead_encrypt(pState->ccmKey, alg, pNonce, nonceSize, pAuthData, authDataLen, pInput, inputLen,
+                                      buff, buffLen, &output_len);
+            if (status == PSA_SUCCESS)
+            {
+                FLib_MemCpy(pOutput, buff, inputLen);
+                FLib_MemCpy(pCbcMac, buff + inputLen, macSize);
+            }
+        }
+        RAISE_ERROR(status, PSA_SUCCESS);
+    } while (false);
+
+    if (buff != NULL)
+    {
+        (void)MEM_BufferFree(buff);
+    }
+
     return (status == PSA_SUCCESS) ? (uint8_t)gSecSuccess_c : (uint8_t)gSecError_c;
 }
 
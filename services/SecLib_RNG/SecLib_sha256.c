@@ -0,0 +1,150 @@
+/*! *********************************************************************************
+ * Copyright 2025 NXP
+ *
+ * \file
+ *
+ * This is the source file of the in-tree SHA-256 compression used by the SW port of SecLib when
+ * gSecLibSha256UnrolledEnable_d is set. The rounds are unrolled by eight: the working variables are renamed from one
+ * round to the next instead of being moved, and the message schedule is kept in a 16-word circular buffer.
+ * Reference: FIPS 180-4, Secure Hash Standard.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ ********************************************************************************** */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "SecLib.h"
+#include "CryptoLibSW.h"
+
+#if (defined(gSecLibSha256UnrolledEnable_d) && (gSecLibSha256UnrolledEnable_d > 0))
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+********************************************************************************** */
+#define SHA256_WORDS        16U
+#define SHA256_ROUNDS       64U
+#define SHA256_STATE_WORDS  8U
+#define SHA256_ROTR(x, n)   (((x) >> (n)) | ((x) << (32U - (n))))
+#define SHA256_CH(x, y, z)  ((z) ^ ((x) & ((y) ^ (z))))
+#define SHA256_MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
+#define SHA256_SUM0(x)      (SHA256_ROTR((x), 2U) ^ SHA256_ROTR((x), 13U) ^ SHA256_ROTR((x), 22U))
+#define SHA256_SUM1(x)      (SHA256_ROTR((x), 6U) ^ SHA256_ROTR((x), 11U) ^ SHA256_ROTR((x), 25U))
+#define SHA256_SIGMA0(x)    (SHA256_ROTR((x), 7U) ^ SHA256_ROTR((x), 18U) ^ ((x) >> 3U))
+#define SHA256_SIGMA1(x)    (SHA256_ROTR((x), 17U) ^ SHA256_ROTR((x), 19U) ^ ((x) >> 10U))
+
+/* Message word of the rounds 0 to 15 */
+#define SHA256_W_LOAD(w, i) ((w)[(i) & (SHA256_WORDS - 1U)])
+
+/* Message word of the rounds 16 to 63, computed in place of the word used 16 rounds before */
+#define SHA256_W_NEXT(w, i)                                                                          \
+    ((w)[(i) & (SHA256_WORDS - 1U)] += SHA256_SIGMA1((w)[((i) - 2U) & (SHA256_WORDS - 1U)]) +      \
+                                       (w)[((i) - 7U) & (SHA256_WORDS - 1U)] +                      \
+                                       SHA256_SIGMA0((w)[((i) - 15U) & (SHA256_WORDS - 1U)]))
+
+/* One round: only d and h get a new value, the other variables take the next name */
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, i, W)                                                       \
+    do                                                                                                   \
+    {                                                                                                    \
+        uint32_t t1_ = (h) + SHA256_SUM1(e) + SHA256_CH((e), (f), (g)) + mSha256K[(i)] + W(w, (i));      \
+        (d) += t1_;                                                                                      \
+        (h) = t1_ + SHA256_SUM0(a) + SHA256_MAJ((a), (b), (c));                                          \
+    } while (false)
+
+/* Eight rounds bring the variables back to their names */
+#define SHA256_8ROUNDS(i, W)                                   \
+    do                                                         \
+    {                                                          \
+        SHA256_ROUND(a, b, c, d, e, f, g, h, (i) + 0U, W);     \
+        SHA256_ROUND(h, a, b, c, d, e, f, g, (i) + 1U, W);     \
+        SHA256_ROUND(g, h, a, b, c, d, e, f, (i) + 2U, W);     \
+        SHA256_ROUND(f, g, h, a, b, c, d, e, (i) + 3U, W);     \
+        SHA256_ROUND(e, f, g, h, a, b, c, d, (i) + 4U, W);     \
+        SHA256_ROUND(d, e, f, g, h, a, b, c, (i) + 5U, W);     \
+        SHA256_ROUND(c, d, e, f, g, h, a, b, (i) + 6U, W);     \
+        SHA256_ROUND(b, c, d, e, f, g, h, a, (i) + 7U, W);     \
+    } while (false)
+
+/*! *********************************************************************************
+*************************************************************************************
+* Private memory declarations
+*************************************************************************************
+********************************************************************************** */
+static const uint32_t mSha256K[SHA256_ROUNDS] = {
+    0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+    0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+    0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU, 0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+    0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U, 0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+    0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U, 0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+    0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U, 0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+    0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U, 0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+    0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U, 0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U,
+};
+
+static const uint32_t mSha256InitialHash[SHA256_STATE_WORDS] = {
+    0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU, 0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U,
+};
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+
+void sw_sha256_unrolled_initialize_output(uint32_t *sha256_state)
+{
+    for (uint32_t i = 0U; i < SHA256_STATE_WORDS; i++)
+    {
+        sha256_state[i] = mSha256InitialHash[i];
+    }
+}
+
+void sw_sha256_unrolled_hash_n(const uint8_t *msg_data, int32_t num_blks, uint32_t *sha256_state)
+{
+    uint32_t w[SHA256_WORDS];
+    uint32_t a, b, c, d, e, f, g, h;
+
+    for (int32_t blk = 0; blk < num_blks; blk++)
+    {
+        /* The message words are big endian, the input has no alignment constraint */
+        for (uint32_t i = 0U; i < SHA256_WORDS; i++)
+        {
+            w[i] = ((uint32_t)msg_data[0] << 24) | ((uint32_t)msg_data[1] << 16) | ((uint32_t)msg_data[2] << 8) |
+                   (uint32_t)msg_data[3];
+            msg_data += sizeof(uint32_t);
+        }
+
+        a = sha256_state[0];
+        b = sha256_state[1];
+        c = sha256_state[2];
+        d = sha256_state[3];
+        e = sha256_state[4];
+        f = sha256_state[5];
+        g = sha256_state[6];
+        h = sha256_state[7];
+
+        for (uint32_t i = 0U; i < SHA256_WORDS; i += 8U)
+        {
+            SHA256_8ROUNDS(i, SHA256_W_LOAD);
+        }
+        for (uint32_t i = SHA256_WORDS; i < SHA256_ROUNDS; i += 8U)
+        {
+            SHA256_8ROUNDS(i, SHA256_W_NEXT);
+        }
+
+        sha256_state[0] += a;
+        sha256_state[1] += b;
+        sha256_state[2] += c;
+        sha256_state[3] += d;
+        sha256_state[4] += e;
+        sha256_state[5] += f;
+        sha256_state[6] += g;
+        sha256_state[7] += h;
+    }
+}
+
+#endif /* gSecLibSha256UnrolledEnable_d */
@@ -66,6 +66,12 @@ extern osa_status_t SecLibMutexUnlock(void);
     SSS_KEYPROP_OPERATION_AES | SSS_KEYPROP_OPERATION_MAC | SSS_KEYPROP_OPERATION_AEAD | SSS_KEYPROP_OPERATION_ASYM | \
         SSS_KEYPROP_OPERATION_KDF
 
+/* Crypto operations of the AES-128 key contexts */
+#define mSecLibKeyPropAesKeyCtx_c (SSS_KEYPROP_OPERATION_AES | SSS_KEYPROP_OPERATION_MAC | SSS_KEYPROP_OPERATION_AEAD)
+
+/* Number of counter blocks encrypted by one request to the secure subsystem in AES_128_KeyCtxCtr() */
+#define SSS_AES_CTR_BLOCKS 4U
+
 /*
  * __DSP_PRESENT is defined in the device specific file, however avoid use of __DSP_PRESENT to avoid
  * a dependency with SDK.
@@ -90,6 +96,19 @@ extern osa_status_t SecLibMutexUnlock(void);
 *************************************************************************************
 ********************************************************************************** */
 
+/*! State of an AES-128 key context, see AES_128_KeyCtxInit() */
+typedef struct sss_aes_key_state_t
+{
+    sss_sscp_object_t keyObj; /* AES key object in the key store of the secure subsystem */
+} sss_aes_key_state_t;
+
+/*! State of an HMAC-SHA256 key context, see HMAC_SHA256_KeyCtxInit() */
+typedef struct sss_hmac_key_state_t
+{
+    uint8_t  key[SHA256_BLOCK_SIZE];
+    uint32_t keyLen;
+} sss_hmac_key_state_t;
+
 /************************************************************************************
 *************************************************************************************
 * Private memory declarations
@@ -147,6 +166,7 @@ static sss_status_t ELKE_BLE_SM_F5_DeriveKeysSecure(sss_sscp_object_t *pPubDhKey
 static uint8_t SecLib_Padding(const uint8_t *lastb, uint8_t pad_block[AES_BLOCK_SIZE], uint8_t length);
 static uint8_t SecLib_DePadding(const uint8_t pad_block[AES_BLOCK_SIZE]);
 static bool    ECP256_LePointValid(const ecp256Point_t *P);
+static void    SecLib_IncrementCounter(uint8_t *pCounter);
 
 /*! *********************************************************************************
 *************************************************************************************
@@ -1110,6 +1130,286 @@ uint8_t AES_128_CCM(const uint8_t *pInput,
     return st;
 }
 
+/*! *********************************************************************************
+ * \brief  This function sets up an AES-128 key context.
+ *
+ * \param[out]  pCtx  Pointer to the key context to set up.
+ *
+ * \param[in]  pKey  Pointer to the location of the 128-bit key.
+ *
+ * \return : gSecSuccess_c if no error,
+ *           gSecBadArgument_c in case of bad arguments,
+ *           gSecAllocError_c if the context state can't be allocated,
+ *           gSecError_c if the key object can't be created.
+ *
+ * \remarks The key is written once in a key object of the secure subsystem, the operations only pass the key object
+ *          reference.
+ *
+ ********************************************************************************** */
+secResultType_t AES_128_KeyCtxInit(secAesKeyCtx_t *pCtx, const uint8_t *pKey)
+{
+    secResultType_t      result     = gSecBadArgument_c;
+    sss_aes_key_state_t *pState     = NULL;
+    bool_t               keyObjInit = false;
+
+    SECLIB_MUTEX_LOCK();
+    do
+    {
+        if ((pCtx == NULL) || (pKey == NULL))
+        {
+            break;
+        }
+        pCtx->pState = NULL;
+
+        pState = (sss_aes_key_state_t *)MEM_BufferAlloc(sizeof(sss_aes_key_state_t));
+        if (pState == NULL)
+        {
+            result = gSecAllocError_c;
+            break;
+        }
+
+        result = gSecError_c;
+        if ((CRYPTO_InitHardware()) != kStatus_Success)
+        {
+            break;
+        }
+
+        if (sss_sscp_key_object_init(&pState->keyObj, &g_keyStore) != kStatus_SSS_Success)
+        {
+            break;
+        }
+        keyObjInit = true;
+
+        if (sss_sscp_key_object_allocate_handle(&pState->keyObj, ELE_S200_KEY_STORE_USER_ID_GENERIC,
+                                                kSSS_KeyPart_Default, kSSS_CipherType_SYMMETRIC, AES_128_KEY_BYTE_LEN,
+                                                mSecLibKeyPropAesKeyCtx_c) != kStatus_SSS_Success)
+        {
+            break;
+        }
+
+        if (sss_sscp_key_store_set_key(&g_keyStore, &pState->keyObj, pKey, AES_128_KEY_BYTE_LEN, AES_128_KEY_BITS,
+                                       kSSS_KeyPart_Default) != kStatus_SSS_Success)
+        {
+            break;
+        }
+
+        pCtx->pState = pState;
+        result       = gSecSuccess_c;
+    } while (false);
+
+    if ((result != gSecSuccess_c) && (pState != NULL))
+    {
+        if (keyObjInit == true)
+        {
+            (void)sss_sscp_key_object_free(&pState->keyObj, kSSS_keyObjFree_KeysStoreDefragment);
+        }
+        (void)MEM_BufferFree(pState);
+    }
+    SECLIB_MUTEX_UNLOCK();
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function releases an AES-128 key context. The key object is freed.
+ *
+ * \param[in, out]  pCtx  Pointer to the key context.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxDestroy(secAesKeyCtx_t *pCtx)
+{
+    sss_aes_key_state_t *pState;
+
+    if ((pCtx != NULL) && (pCtx->pState != NULL))
+    {
+        pState = (sss_aes_key_state_t *)pCtx->pState;
+
+        SECLIB_MUTEX_LOCK();
+        (void)sss_sscp_key_object_free(&pState->keyObj, kSSS_keyObjFree_KeysStoreDefragment);
+        SECLIB_MUTEX_UNLOCK();
+
+        FLib_MemSet(pState, 0U, sizeof(sss_aes_key_state_t));
+        (void)MEM_BufferFree(pState);
+        pCtx->pState = NULL;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128 encryption on a 16-byte block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the 16-byte plain text block.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint8_t *pOutput)
+{
+    AES_128_KeyCtxEcbEncrypt(pCtx, pInput, AES_BLOCK_SIZE, pOutput);
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-ECB encryption on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes, must be a multiple of 16 bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the ciphered output.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxEcbEncrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    sss_aes_key_state_t *pState = (sss_aes_key_state_t *)pCtx->pState;
+    sss_sscp_symmetric_t context;
+    sss_status_t         st;
+
+    /* If the input length is not a multiple of AES 128 block size return */
+    if (!((inputLen == 0U) || ((inputLen % AES_128_BLOCK_SIZE) != 0U)))
+    {
+        SECLIB_MUTEX_LOCK();
+        st = sss_sscp_symmetric_context_init(&context, g_keyStore.session, &pState->keyObj, kAlgorithm_SSS_AES_ECB,
+                                             kMode_SSS_Encrypt);
+        if (st == kStatus_SSS_Success)
+        {
+            st = sss_sscp_cipher_one_go(&context, NULL, 0U, pInput, pOutput, inputLen);
+            (void)sss_sscp_symmetric_context_free(&context);
+        }
+        if (st != kStatus_SSS_Success)
+        {
+            assert(0);
+        }
+        SECLIB_MUTEX_UNLOCK();
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CTR encryption or decryption on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message.
+ *
+ * \param[in]  inputLen Input message length in bytes.
+ *
+ * \param[in, out]  pCounter Pointer to the location of the 128-bit counter.
+ *
+ * \param[out]  pOutput Pointer to the location to store the output.
+ *
+ * \remarks The key stream is generated in ECB, SSS_AES_CTR_BLOCKS counter blocks per request to the secure
+ *          subsystem.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCtr(
+    const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pCounter, uint8_t *pOutput)
+{
+    uint8_t  counters[SSS_AES_CTR_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t  keyStream[SSS_AES_CTR_BLOCKS * AES_BLOCK_SIZE];
+    uint32_t chunkLen;
+    uint32_t blocks;
+
+    while (inputLen != 0U)
+    {
+        chunkLen = (inputLen > sizeof(keyStream)) ? sizeof(keyStream) : inputLen;
+        blocks   = (chunkLen + AES_BLOCK_SIZE - 1U) / AES_BLOCK_SIZE;
+
+        for (uint32_t i = 0U; i < blocks; i++)
+        {
+            FLib_MemCpy(&counters[i * AES_BLOCK_SIZE], pCounter, AES_BLOCK_SIZE);
+            SecLib_IncrementCounter(pCounter);
+        }
+        AES_128_KeyCtxEcbEncrypt(pCtx, counters, blocks * AES_BLOCK_SIZE, keyStream);
+
+        for (uint32_t i = 0U; i < chunkLen; i++)
+        {
+            pOutput[i] = pInput[i] ^ keyStream[i];
+        }
+
+        pInput += chunkLen;
+        pOutput += chunkLen;
+        inputLen -= chunkLen;
+    }
+
+    FLib_MemSet(keyStream, 0U, sizeof(keyStream));
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CMAC on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \param[in]  pInput Pointer to the location of the input message, MSB first.
+ *
+ * \param[in]  inputLen Length of the input message in bytes.
+ *
+ * \param[out]  pOutput Pointer to the location to store the 16-byte authentication code.
+ *
+ ********************************************************************************** */
+void AES_128_KeyCtxCmac(const secAesKeyCtx_t *pCtx, const uint8_t *pInput, uint32_t inputLen, uint8_t *pOutput)
+{
+    sss_aes_key_state_t *pState = (sss_aes_key_state_t *)pCtx->pState;
+    sss_sscp_mac_t       context;
+    size_t               macLen = AES_BLOCK_SIZE;
+    sss_status_t         st;
+
+    SECLIB_MUTEX_LOCK();
+    st = sss_sscp_mac_context_init(&context, g_keyStore.session, &pState->keyObj, kAlgorithm_SSS_CMAC_AES,
+                                   kMode_SSS_Mac);
+    if (st == kStatus_SSS_Success)
+    {
+        st = sss_sscp_mac_one_go(&context, pInput, inputLen, pOutput, &macLen);
+        (void)sss_sscp_mac_context_free(&context);
+    }
+    if (st != kStatus_SSS_Success)
+    {
+        assert(0);
+    }
+    SECLIB_MUTEX_UNLOCK();
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs AES-128-CCM on a message block with a key context.
+ *
+ * \param[in]  pCtx  Pointer to the key context set up by AES_128_KeyCtxInit().
+ *
+ * \remarks The other parameters are the ones of AES_128_CCM().
+ *
+ ********************************************************************************** */
+uint8_t AES_128_KeyCtxCcm(const secAesKeyCtx_t *pCtx,
+                          const uint8_t        *pInput,
+                          uint16_t              inputLen,
+                          const uint8_t        *pAuthData,
+                          uint16_t              authDataLen,
+                          const uint8_t        *pNonce,
+                          uint8_t               nonceSize,
+                          uint8_t              *pOutput,
+                          uint8_t              *pCbcMac,
+                          uint8_t               macSize,
+                          uint32_t              flags)
+{
+    sss_aes_key_state_t *pState = (sss_aes_key_state_t *)pCtx->pState;
+    sss_sscp_aead_t      context;
+    size_t               tagLen = macSize;
+    sss_mode_t           mode   = ((flags & gSecLib_CCM_Decrypt_c) != 0U) ? kMode_SSS_Decrypt : kMode_SSS_Encrypt;
+    sss_status_t         st;
+
+    SECLIB_MUTEX_LOCK();
+    st = sss_sscp_aead_context_init(&context, g_keyStore.session, &pState->keyObj, kAlgorithm_SSS_AES_CCM, mode);
+    if (st == kStatus_SSS_Success)
+    {
+        /* the tag is an output when encrypting, an input when decrypting */
+        st = sss_sscp_aead_one_go(&context, pInput, pOutput, inputLen, (uint8_t *)pNonce, nonceSize, pAuthData,
+                                  authDataLen, pCbcMac, &tagLen);
+        (void)sss_sscp_aead_context_free(&context);
+    }
+    SECLIB_MUTEX_UNLOCK();
+
+    return (st == kStatus_SSS_Success) ? (uint8_t)gSecSuccess_c : (uint8_t)gSecError_c;
+}
+
 /*! *********************************************************************************
  * \brief  This function allocates a memory buffer for a SHA256 context structure
  *
@@ -1365,6 +1665,110 @@ void HMAC_SHA256(const uint8_t *pKey, uint32_t keyLen, const uint8_t *pData, uin
     SECLIB_MUTEX_UNLOCK();
 }
 
+/*! *********************************************************************************
+ * \brief  This function sets up an HMAC-SHA256 key context.
+ *
+ * \param [out]   pCtx        Pointer to the key context to set up.
+ * \param [in]    pKey        Pointer to the HMAC key
+ * \param [in]    keyLen      Length of the HMAC key in bytes
+ *
+ * \return : gSecSuccess_c if no error,
+ *           gSecBadArgument_c in case of bad arguments,
+ *           gSecAllocError_c if the context state can't be allocated.
+ *
+ * \remarks The key is kept, hashed first if longer than a SHA256 block. The pad blocks are processed on each
+ *          HMAC_SHA256_KeyCtxStart().
+ *
+ ********************************************************************************** */
+secResultType_t HMAC_SHA256_KeyCtxInit(secHmacSha256KeyCtx_t *pCtx, const uint8_t *pKey, uint32_t keyLen)
+{
+    secResultType_t       result = gSecBadArgument_c;
+    sss_hmac_key_state_t *pState;
+
+    do
+    {
+        if ((pCtx == NULL) || ((pKey == NULL) && (keyLen > 0u)))
+        {
+            break;
+        }
+        pCtx->pState = NULL;
+
+        pState = (sss_hmac_key_state_t *)MEM_BufferAlloc(sizeof(sss_hmac_key_state_t));
+        if (pState == NULL)
+        {
+            result = gSecAllocError_c;
+            break;
+        }
+
+        if (keyLen > SHA256_BLOCK_SIZE)
+        {
+            SHA256_Hash(pKey, keyLen, pState->key);
+            pState->keyLen = SHA256_HASH_SIZE;
+        }
+        else
+        {
+            FLib_MemCpy(pState->key, pKey, keyLen);
+            pState->keyLen = keyLen;
+        }
+
+        pCtx->pState = pState;
+        result       = gSecSuccess_c;
+    } while (false);
+
+    return result;
+}
+
+/*! *********************************************************************************
+ * \brief  This function releases an HMAC-SHA256 key context. The key material is erased.
+ *
+ * \param [in, out]  pCtx     Pointer to the key context.
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxDestroy(secHmacSha256KeyCtx_t *pCtx)
+{
+    if ((pCtx != NULL) && (pCtx->pState != NULL))
+    {
+        FLib_MemSet(pCtx->pState, 0U, sizeof(sss_hmac_key_state_t));
+        (void)MEM_BufferFree(pCtx->pState);
+        pCtx->pState = NULL;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  This function initializes an HMAC SHA256 context from a key context.
+ *
+ * \param [in]    pCtx        Pointer to the key context set up by HMAC_SHA256_KeyCtxInit().
+ * \param [out]   pContext    Pointer to the HMAC SHA256 context data
+ *                            Allocated using HMAC_SHA256_AllocCtx()
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxStart(const secHmacSha256KeyCtx_t *pCtx, void *pContext)
+{
+    const sss_hmac_key_state_t *pState = (const sss_hmac_key_state_t *)pCtx->pState;
+
+    HMAC_SHA256_Init(pContext, pState->key, pState->keyLen);
+}
+
+/*! *********************************************************************************
+ * \brief  This function performs all HMAC SHA256 steps on multiple bytes with a key context.
+ *         The final HMAC value is stored at the provided output location.
+ *
+ * \param [in]       pCtx        Pointer to the key context set up by HMAC_SHA256_KeyCtxInit().
+ * \param [in]       pData       Pointer to the input data
+ * \param [in]       numBytes    Number of bytes to perform HMAC on
+ * \param [in,out]   pOutput     Pointer to the output location
+ *
+ ********************************************************************************** */
+void HMAC_SHA256_KeyCtxCompute(const secHmacSha256KeyCtx_t *pCtx,
+                               const uint8_t               *pData,
+                               uint32_t                     numBytes,
+                               uint8_t                     *pOutput)
+{
+    const sss_hmac_key_state_t *pState = (const sss_hmac_key_state_t *)pCtx->pState;
+
+    HMAC_SHA256(pState->key, pState->keyLen, pData, numBytes, pOutput);
+}
+
 /************************************************************************************
  * \brief Generates a new ECDH P256 Private/Public key pair
  *
@@ -2827,6 +3231,24 @@ static sss_status_t ELKE_BLE_SM_F5_DeriveKeysSecure(sss_sscp_object_t *pPubDhKey
     return result;
 }
 
+/*! *********************************************************************************
+ * \brief  Increments a 128-bit big endian counter.
+ *
+ * \param [in,out]     pCounter         Counter.
+ *
+ ********************************************************************************** */
+static void SecLib_IncrementCounter(uint8_t *pCounter)
+{
+    for (uint32_t i = AES_BLOCK_SIZE; i > 0U; i--)
+    {
+        pCounter[i - 1U]++;
+        if (pCounter[i - 1U] != 0U)
+        {
+            break;
+        }
+    }
+}
+
 /*! *********************************************************************************
  * \brief  This function pads an incomplete 16 byte block of data, where padding is
  *         the concatenation of x and a single '1',
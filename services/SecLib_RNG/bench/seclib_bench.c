@@ -0,0 +1,998 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file seclib_bench.c
+ * \brief Known answer checks of the SecLib algorithms, then benchmark of the SecLib AES key contexts against the
+ *        functions taking the raw key, of the AES modes throughput, of SHA256 and HMAC-SHA256 and of the ECDH P-256
+ *        operations.
+ *
+ * The file builds with any SecLib backend, SECLIB_BENCH_Run() is called by the application after SecLib_Init().
+ * SECLIB_BENCH_MAIN adds a main() function for the host builds of the software backend.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <string.h>
+
+#include "EmbeddedTypes.h"
+#include "SecLib.h"
+#include "seclib_bench.h"
+
+#ifndef SECLIB_BENCH_PRINTF
+#include <stdio.h>
+#define SECLIB_BENCH_PRINTF printf
+#endif
+
+#if !defined(SECLIB_BENCH_GET_TIME)
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+#include "fsl_device_registers.h"
+#if !defined(DWT_CTRL_CYCCNTENA_Msk)
+#error No DWT cycle counter on this core, define SECLIB_BENCH_GET_TIME
+#endif
+#define SECLIB_BENCH_TIME_UNIT  "cycles"
+#define SECLIB_BENCH_RATE_UNIT  "bytes/cycle"
+#define SECLIB_BENCH_GET_TIME() (DWT->CYCCNT)
+#elif defined(__x86_64__) || defined(__i386__)
+/* time stamp counter, it runs at the nominal frequency of the CPU */
+#include <x86intrin.h>
+#define SECLIB_BENCH_TIME_UNIT  "cycles"
+#define SECLIB_BENCH_RATE_UNIT  "bytes/cycle"
+#define SECLIB_BENCH_GET_TIME() ((uint32_t)__rdtsc())
+#else
+#include <time.h>
+#define SECLIB_BENCH_TIME_UNIT  "ns"
+#define SECLIB_BENCH_RATE_UNIT  "bytes/ns"
+#define SECLIB_BENCH_GET_TIME() seclib_bench_host_time()
+#define SECLIB_BENCH_HOST_TIME  1
+#endif
+#endif
+
+#ifndef SECLIB_BENCH_TIME_UNIT
+#define SECLIB_BENCH_TIME_UNIT "ticks"
+#endif
+
+#ifndef SECLIB_BENCH_RATE_UNIT
+#define SECLIB_BENCH_RATE_UNIT "bytes/tick"
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#define SECLIB_BENCH_MAX_SIZE   251U /* BLE data channel PDU payload with the data length extension */
+#define SECLIB_BENCH_VERIFY_MAX 64U
+#define SECLIB_BENCH_NONCE_SIZE 13U
+#define SECLIB_BENCH_MIC_SIZE   4U
+#define SECLIB_BENCH_AAD_SIZE   1U /* BLE data channel PDU header */
+#define SECLIB_BENCH_BULK_SIZE  1024U
+#define SECLIB_BENCH_HMAC_SIZE  32U /* PBKDF2 iteration and HKDF expand step */
+#define SECLIB_BENCH_KAT_MAX    160U /* longest known answer key or message, the RFC 4231 HMAC key of 131 bytes */
+
+#if !defined(gSecLibUsePsa_d) || (gSecLibUsePsa_d == 0)
+#define SECLIB_BENCH_HMAC 1
+#if (gSecLibAesEaxEnable_d > 0)
+#define SECLIB_BENCH_EAX 1
+#endif
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                               Private types                                */
+/* -------------------------------------------------------------------------- */
+
+/* Both sides are called through the same signature so that the call cost is the same. The raw key functions ignore
+ * the context and the context functions ignore the key. */
+typedef uint32_t (*seclib_bench_fn_t)(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+
+typedef struct
+{
+    const char       *name;
+    seclib_bench_fn_t raw;
+    seclib_bench_fn_t ctx;
+    uint32_t          maxSize; /* the single block case is measured on one size */
+} seclib_bench_case_t;
+
+/* Throughput of a mode on SECLIB_BENCH_BULK_SIZE bytes with the raw key, the key setup included */
+typedef void (*seclib_bench_bulk_fn_t)(const uint8_t *pKey);
+
+typedef struct
+{
+    const char            *name;
+    seclib_bench_bulk_fn_t fn;
+} seclib_bench_bulk_case_t;
+
+/* SHA256 and HMAC-SHA256 of size bytes of s_bulkIn */
+typedef void (*seclib_bench_hash_fn_t)(uint32_t size);
+
+typedef struct
+{
+    const char            *name;
+    seclib_bench_hash_fn_t fn;
+    uint32_t               size;
+} seclib_bench_hash_case_t;
+
+/* Known answer vector of CCM or EAX, the byte strings are in hexadecimal */
+typedef struct
+{
+    const char *key;
+    const char *nonce;
+    const char *aad;
+    const char *plain;
+    const char *cipher; /* followed by the MIC or the tag */
+} seclib_bench_aead_kat_t;
+
+/* Known answer vector of SHA256 or HMAC-SHA256, the data is text */
+typedef struct
+{
+    const char *key; /* hexadecimal, HMAC only */
+    const char *data;
+    const char *digest;
+} seclib_bench_hash_kat_t;
+
+/* -------------------------------------------------------------------------- */
+/*                              Private prototypes                            */
+/* -------------------------------------------------------------------------- */
+
+static uint32_t raw_encrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static uint32_t ctx_encrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static uint32_t raw_ecb(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static uint32_t ctx_ecb(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static uint32_t raw_ctr(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static uint32_t ctx_ctr(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static uint32_t raw_cmac(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static uint32_t ctx_cmac(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static uint32_t raw_ccm(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static uint32_t ctx_ccm(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size);
+static void     bulk_ecb(const uint8_t *pKey);
+static void     bulk_cbc_encrypt(const uint8_t *pKey);
+static void     bulk_cbc_decrypt(const uint8_t *pKey);
+static void     bulk_ctr(const uint8_t *pKey);
+static void     bulk_cmac(const uint8_t *pKey);
+static void     hash_sha256(uint32_t size);
+#if defined(SECLIB_BENCH_HMAC)
+static void     hash_hmac(uint32_t size);
+static void     hash_hmac_ctx(uint32_t size);
+#endif
+static int      seclib_bench_hash(void);
+#if (SECLIB_BENCH_ECDH_ITERATIONS > 0U)
+static int      seclib_bench_ecdh(void);
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+static const seclib_bench_case_t s_cases[] = {
+    {"Encrypt", raw_encrypt, ctx_encrypt, 16U},
+    {"ECB", raw_ecb, ctx_ecb, SECLIB_BENCH_MAX_SIZE},
+    {"CTR", raw_ctr, ctx_ctr, SECLIB_BENCH_MAX_SIZE},
+    {"CMAC", raw_cmac, ctx_cmac, SECLIB_BENCH_MAX_SIZE},
+    {"CCM", raw_ccm, ctx_ccm, SECLIB_BENCH_MAX_SIZE},
+};
+
+static const seclib_bench_bulk_case_t s_bulkCases[] = {
+    {"ECB", bulk_ecb}, {"CBC enc", bulk_cbc_encrypt}, {"CBC dec", bulk_cbc_decrypt},
+    {"CTR", bulk_ctr}, {"CMAC", bulk_cmac},
+};
+
+static const seclib_bench_hash_case_t s_hashCases[] = {
+    {"SHA256", hash_sha256, 64U},
+    {"SHA256", hash_sha256, SECLIB_BENCH_BULK_SIZE},
+#if defined(SECLIB_BENCH_HMAC)
+    {"HMAC", hash_hmac, SECLIB_BENCH_HMAC_SIZE},
+    {"HMAC ctx", hash_hmac_ctx, SECLIB_BENCH_HMAC_SIZE},
+#endif
+};
+
+/* one block, BLE legacy and extended payloads, the ECB case rounds them down to whole blocks */
+static const uint32_t s_sizes[] = {16U, 27U, SECLIB_BENCH_MAX_SIZE};
+
+static const uint8_t s_key[16] = {0x2bU, 0x7eU, 0x15U, 0x16U, 0x28U, 0xaeU, 0xd2U, 0xa6U,
+                                  0xabU, 0xf7U, 0x15U, 0x88U, 0x09U, 0xcfU, 0x4fU, 0x3cU};
+
+/* FIPS-197 appendix C.1 */
+static const char s_katFips197[3][33] = {
+    "000102030405060708090a0b0c0d0e0f",
+    "00112233445566778899aabbccddeeff",
+    "69c4e0d86a7b0430d8cdb78070b4c55a",
+};
+
+/* SP 800-38A appendix F with the key s_key: plaintext, ECB, CBC IV and ciphertext, CTR counter and ciphertext */
+static const char s_katSp80038aPlain[] =
+    "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e5130c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17"
+    "ad2b417be66c3710";
+static const char s_katSp80038aEcb[] =
+    "3ad77bb40d7a3660a89ecaf32466ef97f5d3d58503b9699de785895a96fdbaaf43b1cd7f598ece23881b00e3ed0306887b0c785e27e8ad3f"
+    "8223207104725dd4";
+static const char s_katSp80038aCbcIv[] = "000102030405060708090a0b0c0d0e0f";
+static const char s_katSp80038aCbc[] =
+    "7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b273bed6b8e3c1743b7116e69e222295163ff1caa1681fac09"
+    "120eca307586e1a7";
+static const char s_katSp80038aCtrCounter[] = "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+static const char s_katSp80038aCtr[] =
+    "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1"
+    "792170a0f3009cee";
+
+/* RFC 4493 section 4 with the key s_key, the messages are the first bytes of the SP 800-38A plaintext */
+static const uint32_t s_katCmacLen[] = {0U, 16U, 40U, 64U};
+static const char     s_katCmac[][33] = {
+    "bb1d6929e95937287fa37d129b756746",
+    "070a16b46b4d4144f79bdd9dd04a287c",
+    "dfa66747de9ae63030ca32611497c827",
+    "51f0bebf7e3b9d92fc49741779363cfe",
+};
+
+/* RFC 3610 packet vector #1 and SP 800-38C example 1 */
+static const seclib_bench_aead_kat_t s_katCcm[] = {
+    {"c0c1c2c3c4c5c6c7c8c9cacbcccdcecf", "00000003020100a0a1a2a3a4a5", "0001020304050607",
+     "08090a0b0c0d0e0f101112131415161718191a1b1c1d1e",
+     "588c979a61c663d2f066d0c2c0f989806d5f6b61dac38417e8d12cfdf926e0"},
+    {"404142434445464748494a4b4c4d4e4f", "10111213141516", "0001020304050607", "20212223", "7162015b4dac255d"},
+};
+
+#if defined(SECLIB_BENCH_EAX)
+/* EAX paper (Bellare, Rogaway, Wagner) test vectors 1 to 3 */
+static const seclib_bench_aead_kat_t s_katEax[] = {
+    {"233952dee4d5ed5f9b9c6d6ff80ff478", "62ec67f9c3a4a407fcb2a8c49031a8b3", "6bfb914fd07eae6b", "",
+     "e037830e8389f27b025a2d6527e79d01"},
+    {"91945d3f4dcbee0bf45ef52255f095a4", "becaf043b0a23d843194ba972c66debd", "fa3bfd4806eb53fa", "f7fb",
+     "19dd5c4c9331049d0bdab0277408f67967e5"},
+    {"01f74ad64077f2e704c0f60ada3dd523", "70c3db4f0d26368400a10ed05d2bff5e", "234a3463c1264ac6", "1a47cb4933",
+     "d851d5bae03a59f238a23e39199dc9266626c40f80"},
+};
+#endif
+
+/* FIPS 180-4 examples, SHA256 of "", "abc" and of the two block message */
+static const seclib_bench_hash_kat_t s_katSha256[] = {
+    {NULL, "", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+    {NULL, "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+    {NULL, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+     "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+};
+
+#if defined(SECLIB_BENCH_HMAC)
+/* RFC 4231 test cases 1, 2 and 6, the last one with a key longer than a block */
+static const seclib_bench_hash_kat_t s_katHmac[] = {
+    {"0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b", "Hi There",
+     "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7"},
+    {"4a656665", "what do ya want for nothing?", "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"},
+    {"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+     "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+     "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+     "Test Using Larger Than Block-Size Key - Hash Key First",
+     "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"},
+};
+#endif
+
+#if (SECLIB_BENCH_ECDH_ITERATIONS > 0U)
+/* RFC 6979 appendix A.2.5 key pair, the public key is the private key times the SP 800-186 base point. Big endian
+ * here, the ECDH functions take little endian values */
+static const char s_katP256Private[] = "c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721";
+static const char s_katP256Point[4][65] = {
+    /* base point */
+    "6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296",
+    "4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5",
+    /* public key */
+    "60fed4ba255a9d31c961eb74c6356d68c049b8923b61fa6ce669622e60f29fb6",
+    "7903fe1008b8bc99a41ae9e95628bc64f2f1b20c2d7e9f5177a3c294d4462299",
+};
+#endif
+
+static uint8_t s_in[SECLIB_BENCH_MAX_SIZE];
+static uint8_t s_out[SECLIB_BENCH_MAX_SIZE];
+static uint8_t s_counter[16];
+static uint8_t s_nonce[SECLIB_BENCH_NONCE_SIZE];
+static uint8_t s_aad[SECLIB_BENCH_AAD_SIZE];
+static uint8_t s_mic[16];
+static uint8_t s_bulkIn[SECLIB_BENCH_BULK_SIZE];
+static uint8_t s_bulkOut[SECLIB_BENCH_BULK_SIZE];
+#if defined(SECLIB_BENCH_HMAC)
+static secHmacSha256KeyCtx_t s_hmacCtx;
+#endif
+
+/* results are accumulated here so that the calls are not removed */
+static volatile uint32_t s_sink;
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+#if defined(SECLIB_BENCH_HOST_TIME)
+static uint32_t seclib_bench_host_time(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec);
+}
+#endif
+
+static uint32_t raw_encrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    AES_128_Encrypt(s_in, pKey, s_out);
+    return 0U;
+}
+
+static uint32_t ctx_encrypt(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    AES_128_KeyCtxEncrypt(pCtx, s_in, s_out);
+    return 0U;
+}
+
+static uint32_t raw_ecb(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    AES_128_ECB_Encrypt(s_in, size & ~15U, pKey, s_out);
+    return 0U;
+}
+
+static uint32_t ctx_ecb(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    AES_128_KeyCtxEcbEncrypt(pCtx, s_in, size & ~15U, s_out);
+    return 0U;
+}
+
+static uint32_t raw_ctr(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    AES_128_CTR(s_in, size, s_counter, pKey, s_out);
+    return 0U;
+}
+
+static uint32_t ctx_ctr(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    AES_128_KeyCtxCtr(pCtx, s_in, size, s_counter, s_out);
+    return 0U;
+}
+
+static uint32_t raw_cmac(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    AES_128_CMAC(s_in, size, pKey, s_out);
+    return 0U;
+}
+
+static uint32_t ctx_cmac(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    AES_128_KeyCtxCmac(pCtx, s_in, size, s_out);
+    return 0U;
+}
+
+static uint32_t raw_ccm(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    return AES_128_CCM(s_in, (uint16_t)size, s_aad, SECLIB_BENCH_AAD_SIZE, s_nonce, SECLIB_BENCH_NONCE_SIZE, pKey,
+                       s_out, s_mic, SECLIB_BENCH_MIC_SIZE, gSecLib_CCM_Encrypt_c);
+}
+
+static uint32_t ctx_ccm(const secAesKeyCtx_t *pCtx, const uint8_t *pKey, uint32_t size)
+{
+    return AES_128_KeyCtxCcm(pCtx, s_in, (uint16_t)size, s_aad, SECLIB_BENCH_AAD_SIZE, s_nonce, SECLIB_BENCH_NONCE_SIZE,
+                             s_out, s_mic, SECLIB_BENCH_MIC_SIZE, gSecLib_CCM_Encrypt_c);
+}
+
+static void bulk_ecb(const uint8_t *pKey)
+{
+    AES_128_ECB_Encrypt(s_bulkIn, SECLIB_BENCH_BULK_SIZE, pKey, s_bulkOut);
+}
+
+static void bulk_cbc_encrypt(const uint8_t *pKey)
+{
+    (void)AES_128_CBC_Encrypt(s_bulkIn, SECLIB_BENCH_BULK_SIZE, s_counter, pKey, s_bulkOut);
+}
+
+static void bulk_cbc_decrypt(const uint8_t *pKey)
+{
+    (void)AES_128_CBC_Decrypt(s_bulkIn, SECLIB_BENCH_BULK_SIZE, s_counter, pKey, s_bulkOut);
+}
+
+static void bulk_ctr(const uint8_t *pKey)
+{
+    AES_128_CTR(s_bulkIn, SECLIB_BENCH_BULK_SIZE, s_counter, pKey, s_bulkOut);
+}
+
+static void bulk_cmac(const uint8_t *pKey)
+{
+    AES_128_CMAC(s_bulkIn, SECLIB_BENCH_BULK_SIZE, pKey, s_bulkOut);
+}
+
+static void hash_sha256(uint32_t size)
+{
+    SHA256_Hash(s_bulkIn, size, s_bulkOut);
+}
+
+#if defined(SECLIB_BENCH_HMAC)
+static void hash_hmac(uint32_t size)
+{
+    HMAC_SHA256(s_key, sizeof(s_key), s_bulkIn, size, s_bulkOut);
+}
+
+static void hash_hmac_ctx(uint32_t size)
+{
+    HMAC_SHA256_KeyCtxCompute(&s_hmacCtx, s_bulkIn, size, s_bulkOut);
+}
+#endif
+
+static void seclib_bench_fill(void)
+{
+    for (uint32_t i = 0U; i < sizeof(s_in); i++)
+    {
+        s_in[i] = (uint8_t)((i * 7U) + 1U);
+    }
+    for (uint32_t i = 0U; i < sizeof(s_nonce); i++)
+    {
+        s_nonce[i] = (uint8_t)(0xA0U + i);
+    }
+    /* counter close to a byte carry */
+    (void)memset(s_counter, 0, sizeof(s_counter));
+    s_counter[15] = 0xF0U;
+    s_aad[0]      = 0x02U;
+    (void)memset(s_out, 0, sizeof(s_out));
+    (void)memset(s_mic, 0, sizeof(s_mic));
+}
+
+/* Decodes a hexadecimal string, returns the number of bytes */
+static uint32_t seclib_bench_unhex(const char *pHex, uint8_t *pOut)
+{
+    uint32_t len = 0U;
+
+    while ((pHex[0] != '\0') && (pHex[1] != '\0') && (len < SECLIB_BENCH_KAT_MAX))
+    {
+        uint8_t byte = 0U;
+
+        for (uint32_t i = 0U; i < 2U; i++)
+        {
+            char c = pHex[i];
+
+            byte <<= 4;
+            byte |= (uint8_t)((c <= '9') ? (c - '0') : ((c | 0x20) - 'a' + 10));
+        }
+        pOut[len] = byte;
+        len++;
+        pHex += 2;
+    }
+
+    return len;
+}
+
+static int seclib_bench_kat_check(const char *name, uint32_t index, const uint8_t *pOut, const uint8_t *pExpected,
+                                  uint32_t len)
+{
+    int ret = 0;
+
+    if (memcmp(pOut, pExpected, len) != 0)
+    {
+        SECLIB_BENCH_PRINTF("KAT: %s #%u failed\r\n", name, (unsigned int)index);
+        ret = -1;
+    }
+
+    return ret;
+}
+
+/* Known answers of the AES block function and of the ECB, CBC, CTR and CMAC modes */
+static int seclib_bench_kat_aes(void)
+{
+    static uint8_t key[16];
+    static uint8_t plain[SECLIB_BENCH_KAT_MAX];
+    static uint8_t expected[SECLIB_BENCH_KAT_MAX];
+    static uint8_t out[SECLIB_BENCH_KAT_MAX];
+    uint8_t        iv[16];
+    uint32_t       len;
+    int            ret = 0;
+
+    (void)seclib_bench_unhex(s_katFips197[0], key);
+    (void)seclib_bench_unhex(s_katFips197[1], plain);
+    (void)seclib_bench_unhex(s_katFips197[2], expected);
+    AES_128_Encrypt(plain, key, out);
+    ret |= seclib_bench_kat_check("AES", 0U, out, expected, 16U);
+
+    len = seclib_bench_unhex(s_katSp80038aPlain, plain);
+
+    (void)seclib_bench_unhex(s_katSp80038aEcb, expected);
+    AES_128_ECB_Encrypt(plain, len, s_key, out);
+    ret |= seclib_bench_kat_check("ECB", 0U, out, expected, len);
+
+    (void)seclib_bench_unhex(s_katSp80038aCbc, expected);
+    (void)seclib_bench_unhex(s_katSp80038aCbcIv, iv);
+    (void)AES_128_CBC_Encrypt(plain, len, iv, s_key, out);
+    ret |= seclib_bench_kat_check("CBC enc", 0U, out, expected, len);
+    (void)seclib_bench_unhex(s_katSp80038aCbcIv, iv);
+    (void)AES_128_CBC_Decrypt(expected, len, iv, s_key, out);
+    ret |= seclib_bench_kat_check("CBC dec", 0U, out, plain, len);
+
+    (void)seclib_bench_unhex(s_katSp80038aCtr, expected);
+    (void)seclib_bench_unhex(s_katSp80038aCtrCounter, iv);
+    AES_128_CTR(plain, len, iv, s_key, out);
+    ret |= seclib_bench_kat_check("CTR", 0U, out, expected, len);
+
+    for (uint32_t i = 0U; i < (sizeof(s_katCmacLen) / sizeof(s_katCmacLen[0])); i++)
+    {
+        (void)seclib_bench_unhex(s_katCmac[i], expected);
+        AES_128_CMAC(plain, s_katCmacLen[i], s_key, out);
+        ret |= seclib_bench_kat_check("CMAC", i, out, expected, 16U);
+    }
+
+    return ret;
+}
+
+/* Known answers of CCM, or of EAX when eax is set, the encryption then the decryption of the expected ciphertext */
+static int seclib_bench_kat_aead(const seclib_bench_aead_kat_t *pKat, uint32_t count, bool_t eax)
+{
+    static uint8_t key[16];
+    static uint8_t nonce[16];
+    static uint8_t aad[SECLIB_BENCH_KAT_MAX];
+    static uint8_t plain[SECLIB_BENCH_KAT_MAX];
+    static uint8_t expected[SECLIB_BENCH_KAT_MAX];
+    static uint8_t out[SECLIB_BENCH_KAT_MAX];
+    uint8_t        mic[16];
+    const char    *name = (eax == TRUE) ? "EAX" : "CCM";
+    int            ret  = 0;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t nonceLen;
+        uint32_t aadLen;
+        uint32_t len;
+        uint32_t micLen;
+        uint32_t status;
+
+        (void)seclib_bench_unhex(pKat[i].key, key);
+        nonceLen = seclib_bench_unhex(pKat[i].nonce, nonce);
+        aadLen   = seclib_bench_unhex(pKat[i].aad, aad);
+        len      = seclib_bench_unhex(pKat[i].plain, plain);
+        micLen   = seclib_bench_unhex(pKat[i].cipher, expected) - len;
+
+#if defined(SECLIB_BENCH_EAX)
+        if (eax == TRUE)
+        {
+            status = (uint32_t)AES_128_EAX_Encrypt(plain, len, nonce, nonceLen, aad, (uint8_t)aadLen, key, out, mic);
+        }
+        else
+#endif
+        {
+            status = AES_128_CCM(plain, (uint16_t)len, aad, (uint16_t)aadLen, nonce, (uint8_t)nonceLen, key, out, mic,
+                                 (uint8_t)micLen, gSecLib_CCM_Encrypt_c);
+        }
+        (void)memcpy(&out[len], mic, micLen);
+        if (status != 0U)
+        {
+            SECLIB_BENCH_PRINTF("KAT: %s #%u failed\r\n", name, (unsigned int)i);
+            ret = -1;
+        }
+        ret |= seclib_bench_kat_check(name, i, out, expected, len + micLen);
+
+        (void)memcpy(mic, &expected[len], micLen);
+#if defined(SECLIB_BENCH_EAX)
+        if (eax == TRUE)
+        {
+            status = (uint32_t)AES_128_EAX_Decrypt(expected, len, nonce, nonceLen, aad, (uint8_t)aadLen, key, out, mic);
+        }
+        else
+#endif
+        {
+            status = AES_128_CCM(expected, (uint16_t)len, aad, (uint16_t)aadLen, nonce, (uint8_t)nonceLen, key, out,
+                                 mic, (uint8_t)micLen, gSecLib_CCM_Decrypt_c);
+        }
+        if (status != 0U)
+        {
+            SECLIB_BENCH_PRINTF("KAT: %s #%u decryption failed\r\n", name, (unsigned int)i);
+            ret = -1;
+        }
+        ret |= seclib_bench_kat_check(name, i, out, plain, len);
+    }
+
+    return ret;
+}
+
+/* Known answers of SHA256, or of HMAC-SHA256 when the vectors have a key */
+static int seclib_bench_kat_hash(const seclib_bench_hash_kat_t *pKat, uint32_t count)
+{
+    uint8_t expected[32];
+    uint8_t out[32];
+    int     ret = 0;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        const uint8_t *pData = (const uint8_t *)pKat[i].data;
+        uint32_t       len   = (uint32_t)strlen(pKat[i].data);
+
+        (void)seclib_bench_unhex(pKat[i].digest, expected);
+#if defined(SECLIB_BENCH_HMAC)
+        if (pKat[i].key != NULL)
+        {
+            static uint8_t key[SECLIB_BENCH_KAT_MAX];
+
+            HMAC_SHA256(key, seclib_bench_unhex(pKat[i].key, key), pData, len, out);
+        }
+        else
+#endif
+        {
+            SHA256_Hash(pData, len, out);
+        }
+        ret |= seclib_bench_kat_check((pKat[i].key != NULL) ? "HMAC" : "SHA256", i, out, expected, sizeof(out));
+    }
+
+    return ret;
+}
+
+#if (SECLIB_BENCH_ECDH_ITERATIONS > 0U)
+/* Reverses a big endian value of the vectors into the little endian format of the ECDH functions */
+static void seclib_bench_unhex_le(const char *pHex, uint8_t *pOut)
+{
+    uint32_t len = seclib_bench_unhex(pHex, pOut);
+
+    for (uint32_t i = 0U; i < (len / 2U); i++)
+    {
+        uint8_t byte = pOut[i];
+
+        pOut[i]            = pOut[len - 1U - i];
+        pOut[len - 1U - i] = byte;
+    }
+}
+
+/* Known answer of the P-256 multiplication, the public key of a known private key */
+static int seclib_bench_kat_p256(void)
+{
+    ecdhPrivateKey_t privateKey;
+    ecdhPublicKey_t  basePoint;
+    ecdhPublicKey_t  expected;
+    ecdhDhKey_t      publicKey;
+    int              ret = 0;
+
+    seclib_bench_unhex_le(s_katP256Private, privateKey.raw_8bit);
+    seclib_bench_unhex_le(s_katP256Point[0], basePoint.components_8bit.x);
+    seclib_bench_unhex_le(s_katP256Point[1], basePoint.components_8bit.y);
+    seclib_bench_unhex_le(s_katP256Point[2], expected.components_8bit.x);
+    seclib_bench_unhex_le(s_katP256Point[3], expected.components_8bit.y);
+
+    if (ECDH_P256_ComputeDhKey(&privateKey, &basePoint, &publicKey, FALSE) != gSecSuccess_c)
+    {
+        SECLIB_BENCH_PRINTF("KAT: P-256 #0 failed\r\n");
+        ret = -1;
+    }
+    ret |= seclib_bench_kat_check("P-256", 0U, publicKey.raw, expected.raw, sizeof(expected.raw));
+
+    return ret;
+}
+#endif
+
+/* Checks the known answer vectors of the standards, before the measurements */
+static int seclib_bench_kat(void)
+{
+    int ret = seclib_bench_kat_aes();
+
+    ret |= seclib_bench_kat_aead(s_katCcm, sizeof(s_katCcm) / sizeof(s_katCcm[0]), FALSE);
+#if defined(SECLIB_BENCH_EAX)
+    ret |= seclib_bench_kat_aead(s_katEax, sizeof(s_katEax) / sizeof(s_katEax[0]), TRUE);
+#endif
+    ret |= seclib_bench_kat_hash(s_katSha256, sizeof(s_katSha256) / sizeof(s_katSha256[0]));
+#if defined(SECLIB_BENCH_HMAC)
+    ret |= seclib_bench_kat_hash(s_katHmac, sizeof(s_katHmac) / sizeof(s_katHmac[0]));
+#endif
+#if (SECLIB_BENCH_ECDH_ITERATIONS > 0U)
+    ret |= seclib_bench_kat_p256();
+#endif
+    SECLIB_BENCH_PRINTF("KAT: %s\r\n", (ret == 0) ? "ok" : "FAILED");
+
+    return (ret == 0) ? 0 : -1;
+}
+
+/* Calls one side and copies its output, counter and MIC */
+static uint32_t seclib_bench_call(seclib_bench_fn_t fn, const secAesKeyCtx_t *pCtx, uint32_t size, uint8_t *pResult)
+{
+    uint32_t ret;
+
+    seclib_bench_fill();
+    ret = fn(pCtx, s_key, size);
+    (void)memcpy(pResult, s_out, sizeof(s_out));
+    (void)memcpy(&pResult[sizeof(s_out)], s_counter, sizeof(s_counter));
+    (void)memcpy(&pResult[sizeof(s_out) + sizeof(s_counter)], s_mic, sizeof(s_mic));
+
+    return ret;
+}
+
+/* Calls both sides on the same data and compares the results, then checks the CCM decryption with the context */
+static int seclib_bench_verify(const secAesKeyCtx_t *pCtx)
+{
+    static uint8_t raw[sizeof(s_out) + sizeof(s_counter) + sizeof(s_mic)];
+    static uint8_t ctx[sizeof(s_out) + sizeof(s_counter) + sizeof(s_mic)];
+    static uint8_t plain[SECLIB_BENCH_MAX_SIZE];
+    int            ret = 0;
+
+    for (uint32_t c = 0U; c < (sizeof(s_cases) / sizeof(s_cases[0])); c++)
+    {
+        for (uint32_t size = 1U; size <= SECLIB_BENCH_MAX_SIZE; size++)
+        {
+            uint32_t r1;
+            uint32_t r2;
+
+            if ((size > s_cases[c].maxSize) || ((size > SECLIB_BENCH_VERIFY_MAX) && (size != SECLIB_BENCH_MAX_SIZE)))
+            {
+                continue;
+            }
+
+            r1 = seclib_bench_call(s_cases[c].raw, NULL, size, raw);
+            r2 = seclib_bench_call(s_cases[c].ctx, pCtx, size, ctx);
+            if ((r1 != r2) || (memcmp(raw, ctx, sizeof(raw)) != 0))
+            {
+                SECLIB_BENCH_PRINTF("verify: %s failed, size %u\r\n", s_cases[c].name, (unsigned int)size);
+                ret = -1;
+            }
+        }
+    }
+
+    for (uint32_t size = 1U; size <= SECLIB_BENCH_VERIFY_MAX; size++)
+    {
+        uint8_t status;
+
+        seclib_bench_fill();
+        (void)ctx_ccm(pCtx, NULL, size);
+        status = AES_128_KeyCtxCcm(pCtx, s_out, (uint16_t)size, s_aad, SECLIB_BENCH_AAD_SIZE, s_nonce,
+                                   SECLIB_BENCH_NONCE_SIZE, plain, s_mic, SECLIB_BENCH_MIC_SIZE, gSecLib_CCM_Decrypt_c);
+        if ((status != 0U) || (memcmp(plain, s_in, size) != 0))
+        {
+            SECLIB_BENCH_PRINTF("verify: CCM decryption failed, size %u\r\n", (unsigned int)size);
+            ret = -1;
+        }
+
+        s_mic[0] ^= 0x01U;
+        status = AES_128_KeyCtxCcm(pCtx, s_out, (uint16_t)size, s_aad, SECLIB_BENCH_AAD_SIZE, s_nonce,
+                                   SECLIB_BENCH_NONCE_SIZE, plain, s_mic, SECLIB_BENCH_MIC_SIZE, gSecLib_CCM_Decrypt_c);
+        if (status == 0U)
+        {
+            SECLIB_BENCH_PRINTF("verify: CCM wrong MIC accepted, size %u\r\n", (unsigned int)size);
+            ret = -1;
+        }
+    }
+
+    return ret;
+}
+
+static uint32_t seclib_bench_measure(seclib_bench_fn_t fn, const secAesKeyCtx_t *pCtx, uint32_t size)
+{
+    uint32_t start;
+    uint32_t sink = 0U;
+
+    seclib_bench_fill();
+    start = SECLIB_BENCH_GET_TIME();
+    for (uint32_t i = 0U; i < SECLIB_BENCH_ITERATIONS; i++)
+    {
+        sink += fn(pCtx, s_key, size);
+    }
+    start = SECLIB_BENCH_GET_TIME() - start;
+    s_sink += sink;
+
+    return start;
+}
+
+static uint32_t seclib_bench_measure_bulk(seclib_bench_bulk_fn_t fn)
+{
+    uint32_t start;
+
+    seclib_bench_fill();
+    start = SECLIB_BENCH_GET_TIME();
+    for (uint32_t i = 0U; i < SECLIB_BENCH_ITERATIONS; i++)
+    {
+        fn(s_key);
+    }
+    start = SECLIB_BENCH_GET_TIME() - start;
+    s_sink += s_bulkOut[0];
+
+    return start;
+}
+
+/* Setup and release of a context, to compare with the gain per packet */
+static uint32_t seclib_bench_measure_setup(void)
+{
+    secAesKeyCtx_t ctx = {NULL};
+    uint32_t       start;
+
+    start = SECLIB_BENCH_GET_TIME();
+    for (uint32_t i = 0U; i < SECLIB_BENCH_ITERATIONS; i++)
+    {
+        if (AES_128_KeyCtxInit(&ctx, s_key) == gSecSuccess_c)
+        {
+            AES_128_KeyCtxDestroy(&ctx);
+        }
+    }
+    start = SECLIB_BENCH_GET_TIME() - start;
+
+    return start;
+}
+
+/* SHA256 on one block and on the bulk size, HMAC-SHA256 with the raw key and with the key context, which must give
+ * the same MAC */
+static int seclib_bench_hash(void)
+{
+    int ret = 0;
+
+#if defined(SECLIB_BENCH_HMAC)
+    uint8_t mac[32];
+
+    if (HMAC_SHA256_KeyCtxInit(&s_hmacCtx, s_key, sizeof(s_key)) != gSecSuccess_c)
+    {
+        SECLIB_BENCH_PRINTF("HMAC_SHA256_KeyCtxInit failed\r\n");
+        return -1;
+    }
+    hash_hmac(SECLIB_BENCH_HMAC_SIZE);
+    (void)memcpy(mac, s_bulkOut, sizeof(mac));
+    hash_hmac_ctx(SECLIB_BENCH_HMAC_SIZE);
+    if (memcmp(mac, s_bulkOut, sizeof(mac)) != 0)
+    {
+        ret = -1;
+    }
+    SECLIB_BENCH_PRINTF("HMAC verify: %s\r\n", (ret == 0) ? "ok" : "FAILED");
+#endif
+
+    SECLIB_BENCH_PRINTF("%-10s %6s %12s\r\n", "operation", "size", "time");
+    for (uint32_t c = 0U; c < (sizeof(s_hashCases) / sizeof(s_hashCases[0])); c++)
+    {
+        uint32_t start = SECLIB_BENCH_GET_TIME();
+
+        for (uint32_t i = 0U; i < SECLIB_BENCH_ITERATIONS; i++)
+        {
+            s_hashCases[c].fn(s_hashCases[c].size);
+        }
+        start = SECLIB_BENCH_GET_TIME() - start;
+        s_sink += s_bulkOut[0];
+
+        SECLIB_BENCH_PRINTF("%-10s %6u %12u %s\r\n", s_hashCases[c].name, (unsigned int)s_hashCases[c].size,
+                            (unsigned int)(start / SECLIB_BENCH_ITERATIONS), SECLIB_BENCH_TIME_UNIT);
+    }
+
+#if defined(SECLIB_BENCH_HMAC)
+    HMAC_SHA256_KeyCtxDestroy(&s_hmacCtx);
+#endif
+
+    return ret;
+}
+
+#if (SECLIB_BENCH_ECDH_ITERATIONS > 0U)
+/* Key pairs of both sides then the shared key on each side, which must be the same */
+static int seclib_bench_ecdh(void)
+{
+    ecdhPrivateKey_t privateKey[2];
+    ecdhPublicKey_t  publicKey[2];
+    ecdhDhKey_t      dhKey[2];
+    uint32_t         keyGen = 0U;
+    uint32_t         dh     = 0U;
+    uint32_t         start;
+    int              ret = 0;
+
+    for (uint32_t i = 0U; (i < SECLIB_BENCH_ECDH_ITERATIONS) && (ret == 0); i++)
+    {
+        for (uint32_t side = 0U; side < 2U; side++)
+        {
+            start = SECLIB_BENCH_GET_TIME();
+            if (ECDH_P256_GenerateKeys(&publicKey[side], &privateKey[side]) != gSecSuccess_c)
+            {
+                ret = -1;
+            }
+            keyGen += SECLIB_BENCH_GET_TIME() - start;
+        }
+        for (uint32_t side = 0U; side < 2U; side++)
+        {
+            start = SECLIB_BENCH_GET_TIME();
+            if (ECDH_P256_ComputeDhKey(&privateKey[side], &publicKey[1U - side], &dhKey[side], FALSE) != gSecSuccess_c)
+            {
+                ret = -1;
+            }
+            dh += SECLIB_BENCH_GET_TIME() - start;
+        }
+        if (memcmp(dhKey[0].raw, dhKey[1].raw, sizeof(dhKey[0].raw)) != 0)
+        {
+            ret = -1;
+        }
+    }
+
+    SECLIB_BENCH_PRINTF("ECDH verify: %s\r\n", (ret == 0) ? "ok" : "FAILED");
+    SECLIB_BENCH_PRINTF("%-10s %12u %s\r\n", "P-256 key", (unsigned int)(keyGen / (2U * SECLIB_BENCH_ECDH_ITERATIONS)),
+                        SECLIB_BENCH_TIME_UNIT);
+    SECLIB_BENCH_PRINTF("%-10s %12u %s\r\n", "P-256 DH", (unsigned int)(dh / (2U * SECLIB_BENCH_ECDH_ITERATIONS)),
+                        SECLIB_BENCH_TIME_UNIT);
+
+    return ret;
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+int SECLIB_BENCH_Run(void)
+{
+    secAesKeyCtx_t ctx = {NULL};
+    int            ret;
+    int            verify;
+
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M') && defined(DWT_CTRL_CYCCNTENA_Msk)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    ret = seclib_bench_kat();
+
+    if (AES_128_KeyCtxInit(&ctx, s_key) != gSecSuccess_c)
+    {
+        SECLIB_BENCH_PRINTF("AES_128_KeyCtxInit failed\r\n");
+        return -1;
+    }
+
+    verify = seclib_bench_verify(&ctx);
+    SECLIB_BENCH_PRINTF("verify: %s\r\n", (verify == 0) ? "ok" : "FAILED");
+    if (verify != 0)
+    {
+        ret = -1;
+    }
+
+    SECLIB_BENCH_PRINTF("%-10s %6s %12s %12s\r\n", "operation", "size", "raw key", "key context");
+    for (uint32_t c = 0U; c < (sizeof(s_cases) / sizeof(s_cases[0])); c++)
+    {
+        for (uint32_t s = 0U; s < (sizeof(s_sizes) / sizeof(s_sizes[0])); s++)
+        {
+            uint32_t size = s_sizes[s];
+            uint32_t raw;
+            uint32_t keyCtx;
+
+            if (size > s_cases[c].maxSize)
+            {
+                continue;
+            }
+            if (c == 1U)
+            {
+                /* 27 bytes would measure 16 again */
+                if (((size % 16U) != 0U) && (size != SECLIB_BENCH_MAX_SIZE))
+                {
+                    continue;
+                }
+                size &= ~15U;
+            }
+
+            raw    = seclib_bench_measure(s_cases[c].raw, NULL, size);
+            keyCtx = seclib_bench_measure(s_cases[c].ctx, &ctx, size);
+            SECLIB_BENCH_PRINTF("%-10s %6u %12u %12u %s/packet\r\n", s_cases[c].name, (unsigned int)size,
+                                (unsigned int)(raw / SECLIB_BENCH_ITERATIONS),
+                                (unsigned int)(keyCtx / SECLIB_BENCH_ITERATIONS), SECLIB_BENCH_TIME_UNIT);
+        }
+    }
+
+    SECLIB_BENCH_PRINTF("%-10s %6s %12s %12u %s\r\n", "setup", "", "",
+                        (unsigned int)(seclib_bench_measure_setup() / SECLIB_BENCH_ITERATIONS), SECLIB_BENCH_TIME_UNIT);
+
+    SECLIB_BENCH_PRINTF("%-10s %6s %12s %12s\r\n", "operation", "size", "raw key", "throughput");
+    for (uint32_t c = 0U; c < (sizeof(s_bulkCases) / sizeof(s_bulkCases[0])); c++)
+    {
+        uint32_t time = seclib_bench_measure_bulk(s_bulkCases[c].fn) / SECLIB_BENCH_ITERATIONS;
+        /* in thousandths, printed without floating point support */
+        uint32_t rate = (uint32_t)(((uint64_t)SECLIB_BENCH_BULK_SIZE * 1000U) / ((time != 0U) ? time : 1U));
+
+        SECLIB_BENCH_PRINTF("%-10s %6u %12u %8u.%03u %s\r\n", s_bulkCases[c].name, (unsigned int)SECLIB_BENCH_BULK_SIZE,
+                            (unsigned int)time, (unsigned int)(rate / 1000U), (unsigned int)(rate % 1000U),
+                            SECLIB_BENCH_RATE_UNIT);
+    }
+
+    AES_128_KeyCtxDestroy(&ctx);
+
+    if (seclib_bench_hash() != 0)
+    {
+        ret = -1;
+    }
+
+#if (SECLIB_BENCH_ECDH_ITERATIONS > 0U)
+    if (seclib_bench_ecdh() != 0)
+    {
+        ret = -1;
+    }
+#endif
+
+    return ret;
+}
+
+#if defined(SECLIB_BENCH_MAIN)
+int main(void)
+{
+    SecLib_Init();
+    return (SECLIB_BENCH_Run() == 0) ? 0 : 1;
+}
+#endif
@@ -0,0 +1,55 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file seclib_bench.h
+ * \brief Benchmark of the SecLib AES key contexts against the functions taking the raw key, and of the AES modes
+ *        throughput.
+ *
+ */
+
+#ifndef _SECLIB_BENCH_H_
+#define _SECLIB_BENCH_H_
+
+/* -------------------------------------------------------------------------- */
+/*                                Public macros                               */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Number of packets measured for each operation
+ */
+#ifndef SECLIB_BENCH_ITERATIONS
+#define SECLIB_BENCH_ITERATIONS 1000U
+#endif
+
+/*!
+ * \brief Number of ECDH P-256 key pairs and shared keys measured, 0 skips the ECDH check and measurements
+ */
+#ifndef SECLIB_BENCH_ECDH_ITERATIONS
+#define SECLIB_BENCH_ECDH_ITERATIONS 4U
+#endif
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+/*!
+ * \brief Checks the known answer vectors of the standards: FIPS-197 and SP 800-38A for AES, ECB, CBC and CTR,
+ *        RFC 4493 for CMAC, RFC 3610 and SP 800-38C for CCM, the EAX paper vectors when gSecLibAesEaxEnable_d is set,
+ *        FIPS 180-4 for SHA256, RFC 4231 for HMAC-SHA256 and the RFC 6979 P-256 key pair when
+ *        SECLIB_BENCH_ECDH_ITERATIONS is not 0.
+ *        Then checks that the AES_128_KeyCtx operations give the results of the functions taking the raw key, prints
+ *        the average duration of a packet for both, and the cost of the key context setup. Then prints the throughput of ECB, CBC, CTR and CMAC on 1024 bytes.
+ *        Last, checks that both sides of an ECDH P-256 exchange get the same key and prints the average duration of a
+ *        key pair generation and of a shared key computation.
+ *
+ * The packets are the size of a BLE or 802.15.4 link layer payload. SecLib_Init() must have been called. On Cortex-M
+ * targets the durations are in cycles of the DWT counter, on an x86 host in cycles of the time stamp counter, on other
+ * hosts in ns. The results are printed with
+ * SECLIB_BENCH_PRINTF, printf by default.
+ *
+ * \return 0 if the known answers and the results match, -1 otherwise.
+ */
+int SECLIB_BENCH_Run(void);
+
+#endif /* _SECLIB_BENCH_H_ */
@@ -0,0 +1,1246 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file lib_crypto_host.c
+ * \brief Host port of the routines of the prebuilt lib_crypto_m33.a called by the SW port of SecLib.
+ *
+ * The prebuilt library only contains Thumb objects, which cannot run on the host. This file is the C translation of
+ * their disassembly, with the same algorithms, tables, memory layout and call structure, so that the host benchmark
+ * compares the in-tree implementations with the library and not with another software implementation. The routines
+ * are kept in separate functions as in the library. The absolute numbers do not predict the Cortex-M33 cycles, the
+ * ratios between the two builds are the indication.
+ *
+ * - SW_AES128.c.obj: sw_Aes128() computes the round keys on the fly for the encryption, from a byte state transposed
+ *   in a static buffer. sw_AES128_CCM() calls AES_128_Encrypt() of SecLib.c for each block.
+ * - SW_SHA256.c.obj: sw_sha256_hash_n() runs the 64 rounds in one loop, the message schedule is computed in the loop
+ *   from round 16 in a 16-word circular buffer on the stack.
+ * - ec_p_256.c.obj, big_integer.c.obj and ecdh.c.obj: the P-256 scalar multiplication is a left to right double and
+ *   add over the 256 bits in Jacobian coordinates, with a mixed addition of the affine point. The field products are
+ *   computed by product scanning from 16-bit partial products and reduced by the NIST fast reduction, the inversion
+ *   is a binary extended Euclid.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include "EmbeddedTypes.h"
+#include "FunctionLib.h"
+#include "SecLib.h"
+#include "CryptoLibSW.h"
+#include "RNG_Interface.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#define LIB_AES_BLOCK_SIZE 16U
+
+#define LIB_ROTR(x, n) (((x) >> (n)) | ((x) << (32U - (n))))
+
+/* the library keeps each helper in its own function */
+#define LIB_NOINLINE __attribute__((noinline))
+
+/* -------------------------------------------------------------------------- */
+/*                         Private type definitions                           */
+/* -------------------------------------------------------------------------- */
+
+/* Multiplication buffer of the P-256 routines. The library starts it with a table of pointers to these fields, they
+ * are accessed directly here, the pointers do not fit in the buffer with the 64-bit host pointers. */
+typedef struct
+{
+    uint32_t M[16]; /* double length product */
+    uint32_t T0[8];
+    uint32_t T1[8];
+    uint32_t T2[8];
+    uint32_t T3[8];
+    uint32_t T4[8];
+    uint32_t T5[8];
+    uint32_t X[8]; /* Jacobian accumulator */
+    uint32_t Y[8];
+    uint32_t Z[8];
+} libEcWork_t;
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+/* SecLib.c, started by the segmented multiplication */
+extern secLibCallback_t pfSecLibMultCallback;
+
+static const uint8_t gSBox_c[256] = {
+    0x63U, 0x7cU, 0x77U, 0x7bU, 0xf2U, 0x6bU, 0x6fU, 0xc5U, 0x30U, 0x01U, 0x67U, 0x2bU, 0xfeU, 0xd7U, 0xabU, 0x76U,
+    0xcaU, 0x82U, 0xc9U, 0x7dU, 0xfaU, 0x59U, 0x47U, 0xf0U, 0xadU, 0xd4U, 0xa2U, 0xafU, 0x9cU, 0xa4U, 0x72U, 0xc0U,
+    0xb7U, 0xfdU, 0x93U, 0x26U, 0x36U, 0x3fU, 0xf7U, 0xccU, 0x34U, 0xa5U, 0xe5U, 0xf1U, 0x71U, 0xd8U, 0x31U, 0x15U,
+    0x04U, 0xc7U, 0x23U, 0xc3U, 0x18U, 0x96U, 0x05U, 0x9aU, 0x07U, 0x12U, 0x80U, 0xe2U, 0xebU, 0x27U, 0xb2U, 0x75U,
+    0x09U, 0x83U, 0x2cU, 0x1aU, 0x1bU, 0x6eU, 0x5aU, 0xa0U, 0x52U, 0x3bU, 0xd6U, 0xb3U, 0x29U, 0xe3U, 0x2fU, 0x84U,
+    0x53U, 0xd1U, 0x00U, 0xedU, 0x20U, 0xfcU, 0xb1U, 0x5bU, 0x6aU, 0xcbU, 0xbeU, 0x39U, 0x4aU, 0x4cU, 0x58U, 0xcfU,
+    0xd0U, 0xefU, 0xaaU, 0xfbU, 0x43U, 0x4dU, 0x33U, 0x85U, 0x45U, 0xf9U, 0x02U, 0x7fU, 0x50U, 0x3cU, 0x9fU, 0xa8U,
+    0x51U, 0xa3U, 0x40U, 0x8fU, 0x92U, 0x9dU, 0x38U, 0xf5U, 0xbcU, 0xb6U, 0xdaU, 0x21U, 0x10U, 0xffU, 0xf3U, 0xd2U,
+    0xcdU, 0x0cU, 0x13U, 0xecU, 0x5fU, 0x97U, 0x44U, 0x17U, 0xc4U, 0xa7U, 0x7eU, 0x3dU, 0x64U, 0x5dU, 0x19U, 0x73U,
+    0x60U, 0x81U, 0x4fU, 0xdcU, 0x22U, 0x2aU, 0x90U, 0x88U, 0x46U, 0xeeU, 0xb8U, 0x14U, 0xdeU, 0x5eU, 0x0bU, 0xdbU,
+    0xe0U, 0x32U, 0x3aU, 0x0aU, 0x49U, 0x06U, 0x24U, 0x5cU, 0xc2U, 0xd3U, 0xacU, 0x62U, 0x91U, 0x95U, 0xe4U, 0x79U,
+    0xe7U, 0xc8U, 0x37U, 0x6dU, 0x8dU, 0xd5U, 0x4eU, 0xa9U, 0x6cU, 0x56U, 0xf4U, 0xeaU, 0x65U, 0x7aU, 0xaeU, 0x08U,
+    0xbaU, 0x78U, 0x25U, 0x2eU, 0x1cU, 0xa6U, 0xb4U, 0xc6U, 0xe8U, 0xddU, 0x74U, 0x1fU, 0x4bU, 0xbdU, 0x8bU, 0x8aU,
+    0x70U, 0x3eU, 0xb5U, 0x66U, 0x48U, 0x03U, 0xf6U, 0x0eU, 0x61U, 0x35U, 0x57U, 0xb9U, 0x86U, 0xc1U, 0x1dU, 0x9eU,
+    0xe1U, 0xf8U, 0x98U, 0x11U, 0x69U, 0xd9U, 0x8eU, 0x94U, 0x9bU, 0x1eU, 0x87U, 0xe9U, 0xceU, 0x55U, 0x28U, 0xdfU,
+    0x8cU, 0xa1U, 0x89U, 0x0dU, 0xbfU, 0xe6U, 0x42U, 0x68U, 0x41U, 0x99U, 0x2dU, 0x0fU, 0xb0U, 0x54U, 0xbbU, 0x16U};
+
+static const uint8_t gInvSbox_s[256] = {
+    0x52U, 0x09U, 0x6aU, 0xd5U, 0x30U, 0x36U, 0xa5U, 0x38U, 0xbfU, 0x40U, 0xa3U, 0x9eU, 0x81U, 0xf3U, 0xd7U, 0xfbU,
+    0x7cU, 0xe3U, 0x39U, 0x82U, 0x9bU, 0x2fU, 0xffU, 0x87U, 0x34U, 0x8eU, 0x43U, 0x44U, 0xc4U, 0xdeU, 0xe9U, 0xcbU,
+    0x54U, 0x7bU, 0x94U, 0x32U, 0xa6U, 0xc2U, 0x23U, 0x3dU, 0xeeU, 0x4cU, 0x95U, 0x0bU, 0x42U, 0xfaU, 0xc3U, 0x4eU,
+    0x08U, 0x2eU, 0xa1U, 0x66U, 0x28U, 0xd9U, 0x24U, 0xb2U, 0x76U, 0x5bU, 0xa2U, 0x49U, 0x6dU, 0x8bU, 0xd1U, 0x25U,
+    0x72U, 0xf8U, 0xf6U, 0x64U, 0x86U, 0x68U, 0x98U, 0x16U, 0xd4U, 0xa4U, 0x5cU, 0xccU, 0x5dU, 0x65U, 0xb6U, 0x92U,
+    0x6cU, 0x70U, 0x48U, 0x50U, 0xfdU, 0xedU, 0xb9U, 0xdaU, 0x5eU, 0x15U, 0x46U, 0x57U, 0xa7U, 0x8dU, 0x9dU, 0x84U,
+    0x90U, 0xd8U, 0xabU, 0x00U, 0x8cU, 0xbcU, 0xd3U, 0x0aU, 0xf7U, 0xe4U, 0x58U, 0x05U, 0xb8U, 0xb3U, 0x45U, 0x06U,
+    0xd0U, 0x2cU, 0x1eU, 0x8fU, 0xcaU, 0x3fU, 0x0fU, 0x02U, 0xc1U, 0xafU, 0xbdU, 0x03U, 0x01U, 0x13U, 0x8aU, 0x6bU,
+    0x3aU, 0x91U, 0x11U, 0x41U, 0x4fU, 0x67U, 0xdcU, 0xeaU, 0x97U, 0xf2U, 0xcfU, 0xceU, 0xf0U, 0xb4U, 0xe6U, 0x73U,
+    0x96U, 0xacU, 0x74U, 0x22U, 0xe7U, 0xadU, 0x35U, 0x85U, 0xe2U, 0xf9U, 0x37U, 0xe8U, 0x1cU, 0x75U, 0xdfU, 0x6eU,
+    0x47U, 0xf1U, 0x1aU, 0x71U, 0x1dU, 0x29U, 0xc5U, 0x89U, 0x6fU, 0xb7U, 0x62U, 0x0eU, 0xaaU, 0x18U, 0xbeU, 0x1bU,
+    0xfcU, 0x56U, 0x3eU, 0x4bU, 0xc6U, 0xd2U, 0x79U, 0x20U, 0x9aU, 0xdbU, 0xc0U, 0xfeU, 0x78U, 0xcdU, 0x5aU, 0xf4U,
+    0x1fU, 0xddU, 0xa8U, 0x33U, 0x88U, 0x07U, 0xc7U, 0x31U, 0xb1U, 0x12U, 0x10U, 0x59U, 0x27U, 0x80U, 0xecU, 0x5fU,
+    0x60U, 0x51U, 0x7fU, 0xa9U, 0x19U, 0xb5U, 0x4aU, 0x0dU, 0x2dU, 0xe5U, 0x7aU, 0x9fU, 0x93U, 0xc9U, 0x9cU, 0xefU,
+    0xa0U, 0xe0U, 0x3bU, 0x4dU, 0xaeU, 0x2aU, 0xf5U, 0xb0U, 0xc8U, 0xebU, 0xbbU, 0x3cU, 0x83U, 0x53U, 0x99U, 0x61U,
+    0x17U, 0x2bU, 0x04U, 0x7eU, 0xbaU, 0x77U, 0xd6U, 0x26U, 0xe1U, 0x69U, 0x14U, 0x63U, 0x55U, 0x21U, 0x0cU, 0x7dU};
+
+/* multiplication by x in GF(2^8) */
+static const uint8_t gpXTimeTable[256] = {
+    0x00U, 0x02U, 0x04U, 0x06U, 0x08U, 0x0aU, 0x0cU, 0x0eU, 0x10U, 0x12U, 0x14U, 0x16U, 0x18U, 0x1aU, 0x1cU, 0x1eU,
+    0x20U, 0x22U, 0x24U, 0x26U, 0x28U, 0x2aU, 0x2cU, 0x2eU, 0x30U, 0x32U, 0x34U, 0x36U, 0x38U, 0x3aU, 0x3cU, 0x3eU,
+    0x40U, 0x42U, 0x44U, 0x46U, 0x48U, 0x4aU, 0x4cU, 0x4eU, 0x50U, 0x52U, 0x54U, 0x56U, 0x58U, 0x5aU, 0x5cU, 0x5eU,
+    0x60U, 0x62U, 0x64U, 0x66U, 0x68U, 0x6aU, 0x6cU, 0x6eU, 0x70U, 0x72U, 0x74U, 0x76U, 0x78U, 0x7aU, 0x7cU, 0x7eU,
+    0x80U, 0x82U, 0x84U, 0x86U, 0x88U, 0x8aU, 0x8cU, 0x8eU, 0x90U, 0x92U, 0x94U, 0x96U, 0x98U, 0x9aU, 0x9cU, 0x9eU,
+    0xa0U, 0xa2U, 0xa4U, 0xa6U, 0xa8U, 0xaaU, 0xacU, 0xaeU, 0xb0U, 0xb2U, 0xb4U, 0xb6U, 0xb8U, 0xbaU, 0xbcU, 0xbeU,
+    0xc0U, 0xc2U, 0xc4U, 0xc6U, 0xc8U, 0xcaU, 0xccU, 0xceU, 0xd0U, 0xd2U, 0xd4U, 0xd6U, 0xd8U, 0xdaU, 0xdcU, 0xdeU,
+    0xe0U, 0xe2U, 0xe4U, 0xe6U, 0xe8U, 0xeaU, 0xecU, 0xeeU, 0xf0U, 0xf2U, 0xf4U, 0xf6U, 0xf8U, 0xfaU, 0xfcU, 0xfeU,
+    0x1bU, 0x19U, 0x1fU, 0x1dU, 0x13U, 0x11U, 0x17U, 0x15U, 0x0bU, 0x09U, 0x0fU, 0x0dU, 0x03U, 0x01U, 0x07U, 0x05U,
+    0x3bU, 0x39U, 0x3fU, 0x3dU, 0x33U, 0x31U, 0x37U, 0x35U, 0x2bU, 0x29U, 0x2fU, 0x2dU, 0x23U, 0x21U, 0x27U, 0x25U,
+    0x5bU, 0x59U, 0x5fU, 0x5dU, 0x53U, 0x51U, 0x57U, 0x55U, 0x4bU, 0x49U, 0x4fU, 0x4dU, 0x43U, 0x41U, 0x47U, 0x45U,
+    0x7bU, 0x79U, 0x7fU, 0x7dU, 0x73U, 0x71U, 0x77U, 0x75U, 0x6bU, 0x69U, 0x6fU, 0x6dU, 0x63U, 0x61U, 0x67U, 0x65U,
+    0x9bU, 0x99U, 0x9fU, 0x9dU, 0x93U, 0x91U, 0x97U, 0x95U, 0x8bU, 0x89U, 0x8fU, 0x8dU, 0x83U, 0x81U, 0x87U, 0x85U,
+    0xbbU, 0xb9U, 0xbfU, 0xbdU, 0xb3U, 0xb1U, 0xb7U, 0xb5U, 0xabU, 0xa9U, 0xafU, 0xadU, 0xa3U, 0xa1U, 0xa7U, 0xa5U,
+    0xdbU, 0xd9U, 0xdfU, 0xddU, 0xd3U, 0xd1U, 0xd7U, 0xd5U, 0xcbU, 0xc9U, 0xcfU, 0xcdU, 0xc3U, 0xc1U, 0xc7U, 0xc5U,
+    0xfbU, 0xf9U, 0xffU, 0xfdU, 0xf3U, 0xf1U, 0xf7U, 0xf5U, 0xebU, 0xe9U, 0xefU, 0xedU, 0xe3U, 0xe1U, 0xe7U, 0xe5U};
+
+static const uint8_t gRcon_c[10] = {0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U, 0x1bU, 0x36U};
+
+static const uint32_t gSha256K_c[64] = {
+    0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+    0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+    0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU, 0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+    0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U, 0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+    0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U, 0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+    0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U, 0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+    0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U, 0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+    0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U, 0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U};
+
+/* P-256 constants, 32-bit words, least significant first */
+static const uint32_t P256_prime_m[8] = {
+    0xffffffffU, 0xffffffffU, 0xffffffffU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000001U, 0xffffffffU};
+
+/* 2^256 - p, added when a sum overflows 2^256 */
+static const uint32_t P256_prime_r[8] = {
+    0x00000001U, 0x00000000U, 0x00000000U, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xfffffffeU, 0x00000000U};
+
+static const uint32_t P256_curve_a[8] = {
+    0xfffffffcU, 0xffffffffU, 0xffffffffU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000001U, 0xffffffffU};
+
+static const uint32_t P256_curve_b[8] = {
+    0x27d2604bU, 0x3bce3c3eU, 0xcc53b0f6U, 0x651d06b0U, 0x769886bcU, 0xb3ebbd55U, 0xaa3a93e7U, 0x5ac635d8U};
+
+static const uint32_t P256_one[8] = {1U, 0U, 0U, 0U, 0U, 0U, 0U, 0U};
+
+static const uint32_t P256_orderMinusOne[8] = {
+    0xfc632550U, 0xf3b9cac2U, 0xa7179e84U, 0xbce6faadU, 0xffffffffU, 0xffffffffU, 0x00000000U, 0xffffffffU};
+
+static const uint32_t P256_order_m[9] = {
+    0xfc632551U, 0xf3b9cac2U, 0xa7179e84U, 0xbce6faadU, 0xffffffffU, 0xffffffffU, 0x00000000U, 0xffffffffU,
+    0x00000000U};
+
+static const uint32_t P256_Gx[8] = {
+    0xd898c296U, 0xf4a13945U, 0x2deb33a0U, 0x77037d81U, 0x63a440f2U, 0xf8bce6e5U, 0xe12c4247U, 0x6b17d1f2U};
+
+static const uint32_t P256_Gy[8] = {
+    0x37bf51f5U, 0xcbb64068U, 0x6b315eceU, 0x2bce3357U, 0x7c0f9e16U, 0x8ee7eb4aU, 0xfe1a7f9bU, 0x4fe342e2U};
+
+/* State and keys are stored by rows: byte (row r, column c) at index 4 * r + c */
+static uint8_t gsState[LIB_AES_BLOCK_SIZE];
+static uint8_t gsKey[LIB_AES_BLOCK_SIZE];
+static uint8_t gsExpandedKey[10U * LIB_AES_BLOCK_SIZE];
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+/* Next round key, pIn and pOut may be the same buffer */
+static LIB_NOINLINE void AES_ExpandKey(const uint8_t *pIn, uint8_t *pOut, uint8_t rcon)
+{
+    uint8_t t0 = gSBox_c[pIn[7]] ^ rcon;
+    uint8_t t1 = gSBox_c[pIn[11]];
+    uint8_t t2 = gSBox_c[pIn[15]];
+    uint8_t t3 = gSBox_c[pIn[3]];
+
+    pOut[0]  = pIn[0] ^ t0;
+    pOut[1]  = pOut[0] ^ pIn[1];
+    pOut[2]  = pOut[1] ^ pIn[2];
+    pOut[3]  = pOut[2] ^ pIn[3];
+    pOut[4]  = pIn[4] ^ t1;
+    pOut[5]  = pOut[4] ^ pIn[5];
+    pOut[6]  = pOut[5] ^ pIn[6];
+    pOut[7]  = pOut[6] ^ pIn[7];
+    pOut[8]  = pIn[8] ^ t2;
+    pOut[9]  = pOut[8] ^ pIn[9];
+    pOut[10] = pOut[9] ^ pIn[10];
+    pOut[11] = pOut[10] ^ pIn[11];
+    pOut[12] = pIn[12] ^ t3;
+    pOut[13] = pOut[12] ^ pIn[13];
+    pOut[14] = pOut[13] ^ pIn[14];
+    pOut[15] = pOut[14] ^ pIn[15];
+}
+
+/* AddRoundKey, SubBytes and ShiftRows, then the next round key in place */
+static LIB_NOINLINE void AES_AddKeyByteSubShiftKeyExpand(uint8_t rcon)
+{
+    uint8_t t0;
+    uint8_t t1;
+
+    gsState[0] = gSBox_c[gsState[0] ^ gsKey[0]];
+    gsState[1] = gSBox_c[gsState[1] ^ gsKey[1]];
+    gsState[2] = gSBox_c[gsState[2] ^ gsKey[2]];
+    gsState[3] = gSBox_c[gsState[3] ^ gsKey[3]];
+
+    t0         = gSBox_c[gsState[4] ^ gsKey[4]];
+    gsState[4] = gSBox_c[gsState[5] ^ gsKey[5]];
+    gsState[5] = gSBox_c[gsState[6] ^ gsKey[6]];
+    gsState[6] = gSBox_c[gsState[7] ^ gsKey[7]];
+    gsState[7] = t0;
+
+    t0          = gSBox_c[gsState[8] ^ gsKey[8]];
+    t1          = gSBox_c[gsState[9] ^ gsKey[9]];
+    gsState[8]  = gSBox_c[gsState[10] ^ gsKey[10]];
+    gsState[9]  = gSBox_c[gsState[11] ^ gsKey[11]];
+    gsState[10] = t0;
+    gsState[11] = t1;
+
+    t0          = gSBox_c[gsState[15] ^ gsKey[15]];
+    gsState[15] = gSBox_c[gsState[14] ^ gsKey[14]];
+    gsState[14] = gSBox_c[gsState[13] ^ gsKey[13]];
+    gsState[13] = gSBox_c[gsState[12] ^ gsKey[12]];
+    gsState[12] = t0;
+
+    AES_ExpandKey(gsKey, gsKey, rcon);
+}
+
+static LIB_NOINLINE void AES_MixColumn(void)
+{
+    for (uint32_t c = 0U; c < 4U; c++)
+    {
+        uint8_t a0 = gsState[c];
+        uint8_t a1 = gsState[4U + c];
+        uint8_t a2 = gsState[8U + c];
+        uint8_t a3 = gsState[12U + c];
+        uint8_t t  = a0 ^ a1 ^ a2 ^ a3;
+
+        gsState[c]       = gpXTimeTable[a0 ^ a1] ^ a0 ^ t;
+        gsState[4U + c]  = gpXTimeTable[a1 ^ a2] ^ a1 ^ t;
+        gsState[8U + c]  = gpXTimeTable[a2 ^ a3] ^ a2 ^ t;
+        gsState[12U + c] = gpXTimeTable[a3 ^ a0] ^ a3 ^ t;
+    }
+}
+
+/* InvShiftRows and InvSubBytes */
+static LIB_NOINLINE void AES_InverseShiftSubBytes(void)
+{
+    uint8_t t0;
+    uint8_t t1;
+
+    gsState[0] = gInvSbox_s[gsState[0]];
+    gsState[1] = gInvSbox_s[gsState[1]];
+    gsState[2] = gInvSbox_s[gsState[2]];
+    gsState[3] = gInvSbox_s[gsState[3]];
+
+    t0         = gInvSbox_s[gsState[7]];
+    gsState[7] = gInvSbox_s[gsState[6]];
+    gsState[6] = gInvSbox_s[gsState[5]];
+    gsState[5] = gInvSbox_s[gsState[4]];
+    gsState[4] = t0;
+
+    t0          = gInvSbox_s[gsState[8]];
+    t1          = gInvSbox_s[gsState[9]];
+    gsState[8]  = gInvSbox_s[gsState[10]];
+    gsState[9]  = gInvSbox_s[gsState[11]];
+    gsState[10] = t0;
+    gsState[11] = t1;
+
+    t0          = gInvSbox_s[gsState[12]];
+    gsState[12] = gInvSbox_s[gsState[13]];
+    gsState[13] = gInvSbox_s[gsState[14]];
+    gsState[14] = gInvSbox_s[gsState[15]];
+    gsState[15] = t0;
+}
+
+/* InvMixColumns from the multiplications by x, x^2 and x^3 of each byte */
+static void AES_InverseMixColumn(void)
+{
+    for (uint32_t c = 0U; c < 4U; c++)
+    {
+        uint8_t a[4];
+        uint8_t x2[4];
+        uint8_t x4[4];
+        uint8_t x8[4];
+
+        for (uint32_t r = 0U; r < 4U; r++)
+        {
+            a[r]  = gsState[(4U * r) + c];
+            x2[r] = gpXTimeTable[a[r]];
+            x4[r] = gpXTimeTable[x2[r]];
+            x8[r] = gpXTimeTable[x4[r]];
+        }
+        for (uint32_t r = 0U; r < 4U; r++)
+        {
+            uint32_t r1 = (r + 1U) & 3U;
+            uint32_t r2 = (r + 2U) & 3U;
+            uint32_t r3 = (r + 3U) & 3U;
+
+            /* 14 a[r] + 11 a[r + 1] + 13 a[r + 2] + 9 a[r + 3] */
+            gsState[(4U * r) + c] = x8[r] ^ x4[r] ^ x2[r] ^ x8[r1] ^ x2[r1] ^ a[r1] ^ x8[r2] ^ x4[r2] ^ a[r2] ^
+                                    x8[r3] ^ a[r3];
+        }
+    }
+}
+
+/* big_integer.c.obj */
+
+/* out = a + b, returns the carry */
+static LIB_NOINLINE uint32_t Bi_Add(const uint32_t *a, const uint32_t *b, uint32_t *out, uint8_t n)
+{
+    uint32_t carry = 0U;
+
+    for (uint8_t i = 0U; i < n; i++)
+    {
+        uint32_t bi = b[i];
+        uint32_t s  = a[i] + carry;
+
+        carry = (s < carry) ? 1U : 0U;
+        s += bi;
+        carry += (s < bi) ? 1U : 0U;
+        out[i] = s;
+    }
+
+    return carry;
+}
+
+/* out = a - b, returns the borrow */
+static LIB_NOINLINE uint32_t Bi_Sub(const uint32_t *a, const uint32_t *b, uint32_t *out, uint8_t n)
+{
+    uint32_t borrow = 0U;
+
+    for (uint8_t i = 0U; i < n; i++)
+    {
+        uint32_t ai = a[i];
+        uint32_t bi = b[i];
+        uint32_t d  = ai - bi;
+        uint32_t br = (ai < bi) ? 1U : 0U;
+
+        br |= (d < borrow) ? 1U : 0U;
+        out[i] = d - borrow;
+        borrow = br;
+    }
+
+    return borrow;
+}
+
+static LIB_NOINLINE bool_t Bi_IsZero(const uint32_t *a)
+{
+    uint32_t zeros = 0U;
+
+    for (uint32_t i = 0U; i < 8U; i++)
+    {
+        if (a[i] == 0U)
+        {
+            zeros++;
+        }
+    }
+
+    return (zeros == 8U) ? TRUE : FALSE;
+}
+
+static LIB_NOINLINE bool_t Bi_IsOne(const uint32_t *a)
+{
+    bool_t one = (a[0] == 1U) ? TRUE : FALSE;
+
+    for (uint32_t i = 1U; i < 8U; i++)
+    {
+        if (a[i] != 0U)
+        {
+            one = FALSE;
+        }
+    }
+
+    return one;
+}
+
+static LIB_NOINLINE void Bi_RightShift(uint32_t *a)
+{
+    uint32_t carry = 0U;
+
+    for (uint32_t i = 8U; i > 0U; i--)
+    {
+        uint32_t w = a[i - 1U];
+
+        a[i - 1U] = (w >> 1) | carry;
+        carry     = w << 31;
+    }
+}
+
+static LIB_NOINLINE void Bi_Copy(const uint32_t *src, uint32_t *dst, uint8_t n)
+{
+    for (uint8_t i = 0U; i < n; i++)
+    {
+        dst[i] = src[i];
+    }
+}
+
+static LIB_NOINLINE void Bi_SetZero(uint32_t *a, int n)
+{
+    for (int i = 0; i < n; i++)
+    {
+        a[i] = 0U;
+    }
+}
+
+static LIB_NOINLINE int Bi_Compare(const uint32_t *a, const uint32_t *b, uint8_t n)
+{
+    int result = 0;
+
+    for (uint8_t i = n; i > 0U; i--)
+    {
+        if (a[i - 1U] > b[i - 1U])
+        {
+            result = 1;
+            break;
+        }
+        if (a[i - 1U] < b[i - 1U])
+        {
+            result = -1;
+            break;
+        }
+    }
+
+    return result;
+}
+
+/* ec_p_256.c.obj */
+
+/* out = a + b, mod = 2^256 - p is added on a carry, the result is not fully reduced */
+static LIB_NOINLINE void EcP256_FieldAdd(const uint32_t *a, const uint32_t *b, const uint32_t *mod, uint32_t *out)
+{
+    if (Bi_Add(a, b, out, 8U) != 0U)
+    {
+        (void)Bi_Add(out, mod, out, 8U);
+    }
+}
+
+/* out = a - b, the modulus is added on a borrow */
+static LIB_NOINLINE void EcP256_FieldSub(const uint32_t *a, const uint32_t *b, const uint32_t *mod, uint32_t *out)
+{
+    if (Bi_Sub(a, b, out, 8U) != 0U)
+    {
+        (void)Bi_Add(out, mod, out, 8U);
+    }
+}
+
+static LIB_NOINLINE void EcP256_SubModN(const uint32_t *a, const uint32_t *b, uint32_t *out)
+{
+    EcP256_FieldSub(a, b, P256_order_m, out);
+}
+
+/* out[2n] = a[n] * b[n], product scanning with a three word accumulator, the 32x32 products from 16-bit halves */
+static LIB_NOINLINE void EcP256_FieldMult(const uint32_t *a, const uint32_t *b, uint32_t *out, uint8_t n)
+{
+    uint32_t acc0 = 0U;
+    uint32_t acc1 = 0U;
+    uint32_t acc2 = 0U;
+
+    for (uint32_t k = 0U; k < (2U * (uint32_t)n); k++)
+    {
+        uint32_t i = (k < n) ? k : ((uint32_t)n - 1U);
+
+        for (uint32_t j = k - i; (j < n) && (j <= k); j++, i--)
+        {
+            uint32_t al = a[i] & 0xffffU;
+            uint32_t ah = a[i] >> 16;
+            uint32_t bl = b[j] & 0xffffU;
+            uint32_t bh = b[j] >> 16;
+            uint32_t hi = ah * bh;
+            uint32_t mid;
+            uint32_t lo;
+            uint32_t t;
+
+            mid = al * bh;
+            t   = ah * bl;
+            mid += t;
+            if (mid < t)
+            {
+                hi += 0x10000U;
+            }
+            hi += mid >> 16;
+            lo = al * bl;
+            t  = mid << 16;
+            lo += t;
+            if (lo < t)
+            {
+                hi++;
+            }
+
+            acc0 += lo;
+            if (acc0 < lo)
+            {
+                hi++;
+            }
+            acc1 += hi;
+            if (acc1 < hi)
+            {
+                acc2++;
+            }
+
+            if (i == 0U)
+            {
+                break;
+            }
+        }
+
+        out[k] = acc0;
+        acc0   = acc1;
+        acc1   = acc2;
+        acc2   = 0U;
+    }
+}
+
+/* out = in mod p, NIST fast reduction of the 16-word product */
+static LIB_NOINLINE void EcP256_FieldModP(uint32_t *out, const uint32_t *in)
+{
+    const uint32_t *c = in;
+    uint32_t        s[8];
+
+    Bi_Copy(in, out, 8U);
+
+    /* S1, twice */
+    s[0] = 0U;
+    s[1] = 0U;
+    s[2] = 0U;
+    s[3] = c[11];
+    s[4] = c[12];
+    s[5] = c[13];
+    s[6] = c[14];
+    s[7] = c[15];
+    EcP256_FieldAdd(out, s, P256_prime_r, out);
+    EcP256_FieldAdd(out, s, P256_prime_r, out);
+
+    /* S2, twice */
+    s[3] = c[12];
+    s[4] = c[13];
+    s[5] = c[14];
+    s[6] = c[15];
+    s[7] = 0U;
+    EcP256_FieldAdd(out, s, P256_prime_r, out);
+    EcP256_FieldAdd(out, s, P256_prime_r, out);
+
+    /* S3 */
+    s[0] = c[8];
+    s[1] = c[9];
+    s[2] = c[10];
+    s[3] = 0U;
+    s[4] = 0U;
+    s[5] = 0U;
+    s[6] = c[14];
+    s[7] = c[15];
+    EcP256_FieldAdd(out, s, P256_prime_r, out);
+
+    /* D1 */
+    s[0] = c[11];
+    s[1] = c[12];
+    s[2] = c[13];
+    s[6] = c[8];
+    s[7] = c[10];
+    EcP256_FieldSub(out, s, P256_prime_m, out);
+
+    /* S4 */
+    s[0] = c[9];
+    s[1] = c[10];
+    s[2] = c[11];
+    s[3] = c[13];
+    s[4] = c[14];
+    s[5] = c[15];
+    s[6] = c[13];
+    s[7] = c[8];
+    EcP256_FieldAdd(out, s, P256_prime_r, out);
+
+    /* D2 */
+    s[0] = c[12];
+    s[1] = c[13];
+    s[2] = c[14];
+    s[3] = c[15];
+    s[4] = 0U;
+    s[5] = 0U;
+    s[6] = c[9];
+    s[7] = c[11];
+    EcP256_FieldSub(out, s, P256_prime_m, out);
+
+    /* D3 */
+    s[0] = c[13];
+    s[1] = c[14];
+    s[2] = c[15];
+    s[3] = c[8];
+    s[4] = c[9];
+    s[5] = c[10];
+    s[6] = 0U;
+    s[7] = c[12];
+    EcP256_FieldSub(out, s, P256_prime_m, out);
+
+    /* D4 */
+    s[0] = c[14];
+    s[1] = c[15];
+    s[2] = 0U;
+    s[3] = c[9];
+    s[4] = c[10];
+    s[5] = c[11];
+    s[6] = 0U;
+    s[7] = c[13];
+    EcP256_FieldSub(out, s, P256_prime_m, out);
+}
+
+/* out = in^-1 mod p, binary extended Euclid */
+static LIB_NOINLINE void EcP256_FieldInv(const uint32_t *in, uint32_t *out)
+{
+    uint32_t u[8];
+    uint32_t v[8];
+    uint32_t x1[8];
+    uint32_t x2[8];
+
+    Bi_Copy(in, u, 8U);
+    Bi_Copy(P256_prime_m, v, 8U);
+    Bi_Copy(P256_one, x1, 8U);
+    Bi_SetZero(x2, 8);
+
+    while ((Bi_IsOne(u) == FALSE) && (Bi_IsOne(v) == FALSE))
+    {
+        while ((u[0] & 1U) == 0U)
+        {
+            Bi_RightShift(u);
+            if ((x1[0] & 1U) != 0U)
+            {
+                uint32_t carry = Bi_Add(x1, P256_prime_m, x1, 8U);
+                Bi_RightShift(x1);
+                x1[7] |= carry << 31;
+            }
+            else
+            {
+                Bi_RightShift(x1);
+            }
+        }
+        while ((v[0] & 1U) == 0U)
+        {
+            Bi_RightShift(v);
+            if ((x2[0] & 1U) != 0U)
+            {
+                uint32_t carry = Bi_Add(x2, P256_prime_m, x2, 8U);
+                Bi_RightShift(x2);
+                x2[7] |= carry << 31;
+            }
+            else
+            {
+                Bi_RightShift(x2);
+            }
+        }
+        if (Bi_Compare(u, v, 8U) >= 0)
+        {
+            (void)Bi_Sub(u, v, u, 8U);
+            EcP256_FieldSub(x1, x2, P256_prime_m, x1);
+        }
+        else
+        {
+            (void)Bi_Sub(v, u, v, 8U);
+            EcP256_FieldSub(x2, x1, P256_prime_m, x2);
+        }
+    }
+
+    Bi_Copy((Bi_IsOne(u) == TRUE) ? x1 : x2, out, 8U);
+}
+
+/* out = a * b mod p through the product buffer */
+static inline void EcP256_MultModP(libEcWork_t *pW, const uint32_t *a, const uint32_t *b, uint32_t *out)
+{
+    EcP256_FieldMult(a, b, pW->M, 8U);
+    EcP256_FieldModP(out, pW->M);
+}
+
+static LIB_NOINLINE void ec_SetupWork(libEcWork_t *pW)
+{
+    Bi_SetZero(pW->X, 8);
+    Bi_SetZero(pW->Y, 8);
+    Bi_SetZero(pW->Z, 8);
+}
+
+/* (X, Y, Z) = 2 (X, Y, Z) */
+static LIB_NOINLINE void ec_JacobiDouble(libEcWork_t *pW)
+{
+    if (Bi_IsZero(pW->Y) == TRUE)
+    {
+        ec_SetupWork(pW);
+    }
+    else
+    {
+        EcP256_MultModP(pW, pW->Y, pW->Y, pW->T1);
+        EcP256_FieldAdd(pW->T1, pW->T1, P256_prime_r, pW->T1);
+        EcP256_MultModP(pW, pW->X, pW->T1, pW->T2);
+        EcP256_FieldAdd(pW->T2, pW->T2, P256_prime_r, pW->T2);
+        EcP256_MultModP(pW, pW->T1, pW->T1, pW->T1);
+        EcP256_FieldAdd(pW->T1, pW->T1, P256_prime_r, pW->T1);
+        EcP256_MultModP(pW, pW->Y, pW->Z, pW->T4);
+        EcP256_MultModP(pW, pW->Z, pW->Z, pW->T5);
+        EcP256_FieldAdd(pW->T4, pW->T4, P256_prime_r, pW->Z);
+        EcP256_FieldAdd(pW->X, pW->T5, P256_prime_r, pW->T3);
+        EcP256_FieldAdd(pW->T5, pW->T5, P256_prime_r, pW->T5);
+        EcP256_FieldSub(pW->T3, pW->T5, P256_prime_m, pW->T5);
+        EcP256_MultModP(pW, pW->T3, pW->T5, pW->T3);
+        EcP256_FieldAdd(pW->T3, pW->T3, P256_prime_r, pW->T5);
+        EcP256_FieldAdd(pW->T3, pW->T5, P256_prime_r, pW->T3);
+        EcP256_MultModP(pW, pW->T3, pW->T3, pW->T5);
+        EcP256_FieldSub(pW->T5, pW->T2, P256_prime_m, pW->T5);
+        EcP256_FieldSub(pW->T5, pW->T2, P256_prime_m, pW->X);
+        EcP256_FieldSub(pW->T2, pW->X, P256_prime_m, pW->T2);
+        EcP256_MultModP(pW, pW->T3, pW->T2, pW->T3);
+        EcP256_FieldSub(pW->T3, pW->T1, P256_prime_m, pW->Y);
+    }
+}
+
+/* (X, Y, Z) += (x2, y2, 1) */
+static LIB_NOINLINE void ec_JacobiAdd(const uint32_t *x2, const uint32_t *y2, libEcWork_t *pW)
+{
+    if (Bi_IsZero(pW->Y) == TRUE)
+    {
+        Bi_Copy(x2, pW->X, 8U);
+        Bi_Copy(y2, pW->Y, 8U);
+        Bi_SetZero(pW->Z, 8);
+        pW->Z[0] = 1U;
+    }
+    else
+    {
+        EcP256_MultModP(pW, pW->Z, pW->Z, pW->T0);
+        EcP256_MultModP(pW, pW->T0, x2, pW->T1);
+        EcP256_MultModP(pW, y2, pW->Z, pW->T2);
+        EcP256_MultModP(pW, pW->T2, pW->T0, pW->T2);
+        EcP256_FieldSub(pW->X, pW->T1, P256_prime_m, pW->T4);
+        EcP256_MultModP(pW, pW->T4, pW->Z, pW->Z);
+        EcP256_FieldSub(pW->Y, pW->T2, P256_prime_m, pW->T5);
+        EcP256_MultModP(pW, pW->T4, pW->T4, pW->T0);
+        EcP256_MultModP(pW, pW->T5, pW->T5, pW->T3);
+        EcP256_MultModP(pW, pW->T1, pW->T0, pW->T1);
+        EcP256_MultModP(pW, pW->T0, pW->T4, pW->T4);
+        EcP256_FieldSub(pW->T3, pW->T4, P256_prime_m, pW->T3);
+        EcP256_FieldAdd(pW->T1, pW->T1, P256_prime_r, pW->T0);
+        EcP256_FieldSub(pW->T3, pW->T0, P256_prime_m, pW->X);
+        EcP256_FieldSub(pW->T1, pW->X, P256_prime_m, pW->T1);
+        EcP256_MultModP(pW, pW->T5, pW->T1, pW->T5);
+        EcP256_MultModP(pW, pW->T2, pW->T4, pW->T0);
+        EcP256_FieldSub(pW->T5, pW->T0, P256_prime_m, pW->Y);
+    }
+}
+
+/* Affine coordinates of the accumulator: x = X / Z^2, y = Y / Z^3 */
+static void ec_JacobiToAffine(libEcWork_t *pW, uint32_t *pOutX, uint32_t *pOutY)
+{
+    EcP256_FieldInv(pW->Z, pW->T0);
+    EcP256_MultModP(pW, pW->X, pW->T0, pW->X);
+    EcP256_MultModP(pW, pW->X, pW->T0, pOutX);
+    EcP256_MultModP(pW, pW->Y, pW->T0, pW->Y);
+    EcP256_MultModP(pW, pW->Y, pW->T0, pW->Y);
+    EcP256_MultModP(pW, pW->Y, pW->T0, pOutY);
+}
+
+/* Left to right double and add over the 256 scalar bits */
+static LIB_NOINLINE void EcP256_PointMult(const uint32_t *x,
+                                          const uint32_t *y,
+                                          const uint32_t *pScalar,
+                                          uint32_t       *pOutX,
+                                          uint32_t       *pOutY,
+                                          void           *pBuffer)
+{
+    libEcWork_t *pW = (libEcWork_t *)pBuffer;
+
+    ec_SetupWork(pW);
+    for (uint32_t i = 256U; i > 0U; i--)
+    {
+        ec_JacobiDouble(pW);
+        if (((pScalar[(i - 1U) / 32U] >> ((i - 1U) % 32U)) & 1U) != 0U)
+        {
+            ec_JacobiAdd(x, y, pW);
+        }
+    }
+    ec_JacobiToAffine(pW, pOutX, pOutY);
+}
+
+static LIB_NOINLINE void EcP256_PointMultSeg(computeDhKeyParam_t *pDhKeyData)
+{
+    if (pDhKeyData->pWorkBuffer != NULL)
+    {
+        ec_SetupWork((libEcWork_t *)pDhKeyData->pWorkBuffer);
+        pDhKeyData->procStep = 0U;
+        if (pfSecLibMultCallback != NULL)
+        {
+            pfSecLibMultCallback(pDhKeyData);
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+void CCM_CreateA0(uint8_t *pData, const uint8_t *nonce, uint8_t size)
+{
+    pData[0] = (uint8_t)(14U - size);
+    FLib_MemCpy(&pData[1], nonce, size);
+    FLib_MemSet(&pData[1U + size], 0U, 15U - (uint32_t)size);
+}
+
+void sw_Aes128(const uint8_t *pData, const uint8_t *pKey, uint8_t enc, uint8_t *pReturnData)
+{
+    for (uint32_t r = 0U; r < 4U; r++)
+    {
+        for (uint32_t c = 0U; c < 4U; c++)
+        {
+            gsState[(4U * r) + c] = pData[(4U * c) + r];
+            gsKey[(4U * r) + c]   = pKey[(4U * c) + r];
+        }
+    }
+
+    if (enc != 0U)
+    {
+        for (uint32_t round = 0U; round < 9U; round++)
+        {
+            AES_AddKeyByteSubShiftKeyExpand(gRcon_c[round]);
+            AES_MixColumn();
+        }
+        AES_AddKeyByteSubShiftKeyExpand(gRcon_c[9]);
+        /* gsKey is the last round key */
+    }
+    else
+    {
+        AES_ExpandKey(gsKey, gsExpandedKey, gRcon_c[0]);
+        for (uint32_t round = 1U; round < 10U; round++)
+        {
+            AES_ExpandKey(&gsExpandedKey[LIB_AES_BLOCK_SIZE * (round - 1U)], &gsExpandedKey[LIB_AES_BLOCK_SIZE * round],
+                          gRcon_c[round]);
+        }
+        for (uint32_t i = 0U; i < LIB_AES_BLOCK_SIZE; i++)
+        {
+            gsState[i] ^= gsExpandedKey[(9U * LIB_AES_BLOCK_SIZE) + i];
+        }
+        AES_InverseShiftSubBytes();
+        for (uint32_t round = 9U; round > 0U; round--)
+        {
+            for (uint32_t i = 0U; i < LIB_AES_BLOCK_SIZE; i++)
+            {
+                gsState[i] ^= gsExpandedKey[(LIB_AES_BLOCK_SIZE * (round - 1U)) + i];
+            }
+            AES_InverseMixColumn();
+            AES_InverseShiftSubBytes();
+        }
+        /* gsKey is the first round key */
+    }
+
+    for (uint32_t r = 0U; r < 4U; r++)
+    {
+        for (uint32_t c = 0U; c < 4U; c++)
+        {
+            pReturnData[(4U * c) + r] = gsState[(4U * r) + c] ^ gsKey[(4U * r) + c];
+        }
+    }
+}
+
+uint8_t sw_AES128_CCM(const uint8_t *pInput,
+                      uint16_t       inputLen,
+                      const uint8_t *pAuthData,
+                      uint16_t       authDataLen,
+                      const uint8_t *pNonce,
+                      uint8_t        nonceSize,
+                      const uint8_t *pKey,
+                      uint8_t       *pOutput,
+                      uint8_t       *pCbcMac,
+                      uint8_t        macSize,
+                      uint32_t       flags)
+{
+    uint8_t  block[LIB_AES_BLOCK_SIZE];
+    uint8_t  buffer[LIB_AES_BLOCK_SIZE];
+    uint32_t lenSize  = 15U - (uint32_t)nonceSize;
+    bool_t   decrypt  = ((flags & 1U) != 0U) ? TRUE : FALSE;
+    bool_t   macError = FALSE;
+
+    /* Decryption: CTR then MAC of the plaintext written to pOutput, encryption: MAC then CTR */
+    for (uint32_t pass = 0U; pass < 2U; pass++)
+    {
+        if ((pass == 0U) == (decrypt == TRUE))
+        {
+            const uint8_t *pIn    = pInput;
+            uint8_t       *pOut   = pOutput;
+            uint32_t       remain = inputLen;
+            uint64_t       ctr    = 0U;
+
+            CCM_CreateA0(block, pNonce, nonceSize);
+            while (remain != 0U)
+            {
+                uint32_t size = (remain < LIB_AES_BLOCK_SIZE) ? remain : LIB_AES_BLOCK_SIZE;
+
+                ctr++;
+                FLib_MemCpyReverseOrder(&block[LIB_AES_BLOCK_SIZE - lenSize], &ctr, lenSize);
+                AES_128_Encrypt(block, pKey, buffer);
+                if (pIn == pOut)
+                {
+                    SecLib_XorN(pOut, buffer, (uint8_t)size);
+                }
+                else
+                {
+                    SecLib_XorN(buffer, pIn, (uint8_t)size);
+                    FLib_MemCpy(pOut, buffer, size);
+                }
+                pIn += size;
+                pOut += size;
+                remain -= size;
+            }
+            pInput = pOutput;
+        }
+        else if ((pCbcMac != NULL) && (macSize > 3U))
+        {
+            const uint8_t *pData;
+            uint32_t       remain;
+            bool_t         first = TRUE;
+
+            /* B0 */
+            CCM_CreateA0(block, pNonce, nonceSize);
+            block[0] |= (uint8_t)((((authDataLen != 0U) ? 1U : 0U) << 6) | (((uint32_t)macSize - 2U) << 2));
+            block[14] = (uint8_t)(inputLen >> 8);
+            block[15] = (uint8_t)inputLen;
+            AES_128_Encrypt(block, pKey, block);
+
+            /* The authentication data is prefixed with its length on 2 bytes, then the input */
+            for (uint32_t part = (authDataLen != 0U) ? 0U : 1U; part < 2U; part++)
+            {
+                if (part == 0U)
+                {
+                    FLib_MemSet(buffer, 0U, sizeof(buffer));
+                    FLib_MemCpy(&buffer[2], pAuthData, (authDataLen < 14U) ? authDataLen : 14U);
+                    buffer[0] = (uint8_t)(authDataLen >> 8);
+                    buffer[1] = (uint8_t)authDataLen;
+                    pData     = buffer;
+                    remain    = (uint32_t)authDataLen + 2U;
+                }
+                else
+                {
+                    pData  = pInput;
+                    remain = inputLen;
+                }
+                while (remain != 0U)
+                {
+                    uint32_t size = (remain < LIB_AES_BLOCK_SIZE) ? remain : LIB_AES_BLOCK_SIZE;
+
+                    remain -= size;
+                    SecLib_XorN(block, pData, (uint8_t)size);
+                    AES_128_Encrypt(block, pKey, block);
+                    if ((part == 0U) && (first == TRUE))
+                    {
+                        pData = &pAuthData[size - 2U];
+                        first = FALSE;
+                    }
+                    else
+                    {
+                        pData += size;
+                    }
+                }
+            }
+
+            /* T = first M bytes of CBC-MAC ^ E(A0) */
+            CCM_CreateA0(buffer, pNonce, nonceSize);
+            AES_128_Encrypt(buffer, pKey, buffer);
+            SecLib_XorN(buffer, block, macSize);
+            if (decrypt == TRUE)
+            {
+                if (FLib_MemCmp(pCbcMac, buffer, macSize) == FALSE)
+                {
+                    macError = TRUE;
+                }
+            }
+            else
+            {
+                FLib_MemCpy(pCbcMac, buffer, macSize);
+            }
+        }
+        else
+        {
+            /* no MAC */
+        }
+    }
+
+    return (macError == TRUE) ? 1U : 0U;
+}
+
+void sw_sha256_initialize_output(uint32_t *sha256_state)
+{
+    sha256_state[0] = 0x6a09e667U;
+    sha256_state[1] = 0xbb67ae85U;
+    sha256_state[2] = 0x3c6ef372U;
+    sha256_state[3] = 0xa54ff53aU;
+    sha256_state[4] = 0x510e527fU;
+    sha256_state[5] = 0x9b05688cU;
+    sha256_state[6] = 0x1f83d9abU;
+    sha256_state[7] = 0x5be0cd19U;
+}
+
+void sw_sha256_hash_n(const uint8_t *msg_data, int32_t num_blks, uint32_t *sha256_state)
+{
+    for (int32_t blk = 0; blk < num_blks; blk++)
+    {
+        const uint8_t *pBlock = &msg_data[(uint32_t)blk * 64U];
+        uint32_t       w[16];
+        uint32_t       a = sha256_state[0];
+        uint32_t       b = sha256_state[1];
+        uint32_t       c = sha256_state[2];
+        uint32_t       d = sha256_state[3];
+        uint32_t       e = sha256_state[4];
+        uint32_t       f = sha256_state[5];
+        uint32_t       g = sha256_state[6];
+        uint32_t       h = sha256_state[7];
+
+        for (uint32_t i = 0U; i < 16U; i++)
+        {
+            w[i] = ((uint32_t)pBlock[4U * i] << 24) | ((uint32_t)pBlock[(4U * i) + 1U] << 16) |
+                   ((uint32_t)pBlock[(4U * i) + 2U] << 8) | (uint32_t)pBlock[(4U * i) + 3U];
+        }
+
+        for (uint32_t t = 0U; t < 64U; t++)
+        {
+            uint32_t t1;
+            uint32_t t2;
+
+            if (t > 15U)
+            {
+                uint32_t w15 = w[(t - 15U) & 15U];
+                uint32_t w2  = w[(t - 2U) & 15U];
+
+                w[t & 15U] += (LIB_ROTR(w15, 7U) ^ LIB_ROTR(w15, 18U) ^ (w15 >> 3)) + w[(t - 7U) & 15U] +
+                              (LIB_ROTR(w2, 17U) ^ LIB_ROTR(w2, 19U) ^ (w2 >> 10));
+            }
+
+            t2 = (LIB_ROTR(a, 2U) ^ LIB_ROTR(a, 13U) ^ LIB_ROTR(a, 22U)) + (((b ^ c) & a) ^ (b & c));
+            t1 = h + (LIB_ROTR(e, 6U) ^ LIB_ROTR(e, 11U) ^ LIB_ROTR(e, 25U)) + ((g & ~e) ^ (e & f)) + gSha256K_c[t] +
+                 w[t & 15U];
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        sha256_state[0] += a;
+        sha256_state[1] += b;
+        sha256_state[2] += c;
+        sha256_state[3] += d;
+        sha256_state[4] += e;
+        sha256_state[5] += f;
+        sha256_state[6] += g;
+        sha256_state[7] += h;
+    }
+}
+
+const uint32_t gEcP256_MultiplicationBufferSize_c = 392U;
+
+secEcp256Status_t ECP256_GeneratePrivateKey(big_int256_t *pOutPrivateKey)
+{
+    secEcp256Status_t status = gSecEcp256Success_c;
+
+    do
+    {
+        if (pOutPrivateKey == NULL)
+        {
+            status = gSecEcp256BadParameters_c;
+            break;
+        }
+        if ((RNG_GetPseudoRandomData(&pOutPrivateKey->raw_8bit[0], 16U, NULL) == -1) ||
+            (RNG_GetPseudoRandomData(&pOutPrivateKey->raw_8bit[16], 16U, NULL) == -1))
+        {
+            status = gSecEcp256RngError_c;
+            break;
+        }
+        /* 1 <= private key <= n - 1 */
+        while (Bi_Compare(pOutPrivateKey->raw_32bit, P256_orderMinusOne, 8U) >= 0)
+        {
+            (void)Bi_Sub(pOutPrivateKey->raw_32bit, P256_orderMinusOne, pOutPrivateKey->raw_32bit, 8U);
+        }
+        (void)Bi_Add(pOutPrivateKey->raw_32bit, P256_one, pOutPrivateKey->raw_32bit, 8U);
+    } while (false);
+
+    return status;
+}
+
+secEcp256Status_t ECP256_GeneratePublicKey(uint8_t       *pOutPublicKey,
+                                           const uint8_t *pInPrivateKey,
+                                           void          *pMultiplicationBuffer)
+{
+    EcP256_PointMult(P256_Gx, P256_Gy, (const uint32_t *)pInPrivateKey, (uint32_t *)pOutPublicKey,
+                     (uint32_t *)&pOutPublicKey[32], pMultiplicationBuffer);
+
+    return gSecEcp256Success_c;
+}
+
+secEcp256Status_t ECP256_GenerateKeyPair(ecp256Point_t *pOutPublicKey,
+                                         big_int256_t  *pOutPrivateKey,
+                                         void          *pMultiplicationBuffer)
+{
+    secEcp256Status_t status = gSecEcp256BadParameters_c;
+
+    if (pMultiplicationBuffer != NULL)
+    {
+        status = ECP256_GeneratePrivateKey(pOutPrivateKey);
+        if (status == gSecEcp256Success_c)
+        {
+            status = ECP256_GeneratePublicKey(pOutPublicKey->raw, pOutPrivateKey->raw_8bit, pMultiplicationBuffer);
+        }
+    }
+
+    return status;
+}
+
+bool_t EcP256_IsPointOnCurve(const uint32_t *X, const uint32_t *Y)
+{
+    bool_t   onCurve = FALSE;
+    uint32_t m1[16];
+    uint32_t m2[16];
+    uint32_t t[8];
+
+    if ((Bi_Compare(X, P256_prime_m, 8U) < 0) && (Bi_Compare(Y, P256_prime_m, 8U) < 0))
+    {
+        /* (x^2 + a) x + b */
+        EcP256_FieldMult(X, X, m1, 8U);
+        EcP256_FieldModP(t, m1);
+        Bi_SetZero(m1, 16);
+        EcP256_FieldAdd(t, P256_curve_a, P256_prime_r, m1);
+        if ((m1[8] != 0U) || (Bi_Compare(m1, P256_prime_m, 8U) > 0))
+        {
+            EcP256_SubModN(m1, P256_prime_m, m1);
+        }
+        EcP256_FieldMult(m1, X, m2, 8U);
+        EcP256_FieldModP(t, m2);
+        Bi_SetZero(m2, 16);
+        EcP256_FieldAdd(t, P256_curve_b, P256_prime_r, m2);
+        if ((m2[8] != 0U) || (Bi_Compare(m2, P256_prime_m, 8U) > 0))
+        {
+            EcP256_SubModN(m2, P256_prime_m, m2);
+        }
+        /* y^2 */
+        EcP256_FieldMult(Y, Y, m1, 8U);
+        EcP256_FieldModP(t, m1);
+        onCurve = (Bi_Compare(t, m2, 8U) == 0) ? TRUE : FALSE;
+    }
+
+    return onCurve;
+}
+
+secEcdhStatus_t Ecdh_GenerateNewKeys(ecdhPublicKey_t  *pOutPublicKey,
+                                     ecdhPrivateKey_t *pOutPrivateKey,
+                                     void             *pMultiplicationBuffer)
+{
+    return (secEcdhStatus_t)ECP256_GenerateKeyPair(pOutPublicKey, pOutPrivateKey, pMultiplicationBuffer);
+}
+
+secEcdhStatus_t Ecdh_GenerateNewKeysSeg(computeDhKeyParam_t *pDhKeyData)
+{
+    secEcdhStatus_t status = (secEcdhStatus_t)ECP256_GeneratePrivateKey(&pDhKeyData->privateKey);
+
+    if (status == gSecEcdhSuccess_c)
+    {
+        FLib_MemCpy(pDhKeyData->peerPublicKey.components_32bit.x, P256_Gx, sizeof(P256_Gx));
+        FLib_MemCpy(pDhKeyData->peerPublicKey.components_32bit.y, P256_Gy, sizeof(P256_Gy));
+        EcP256_PointMultSeg(pDhKeyData);
+    }
+
+    return status;
+}
+
+secEcdhStatus_t Ecdh_ComputeDhKey(const ecdhPrivateKey_t *pPrivateKey,
+                                  const ecdhPublicKey_t  *pPeerPublicKey,
+                                  ecdhDhKey_t            *pOutDhKey,
+                                  void                   *pMultiplicationBuffer)
+{
+    secEcdhStatus_t status = gSecEcdhBadParameters_c;
+
+    do
+    {
+        if ((pMultiplicationBuffer == NULL) || (pPrivateKey == NULL) || (pPeerPublicKey == NULL) ||
+            (pOutDhKey == NULL) || (Bi_IsZero(pPrivateKey->raw_32bit) == TRUE))
+        {
+            break;
+        }
+        if (EcP256_IsPointOnCurve(pPeerPublicKey->components_32bit.x, pPeerPublicKey->components_32bit.y) == FALSE)
+        {
+            status = gSecEcdhInvalidPublicKey_c;
+            break;
+        }
+        EcP256_PointMult(pPeerPublicKey->components_32bit.x, pPeerPublicKey->components_32bit.y,
+                         pPrivateKey->raw_32bit, pOutDhKey->components_32bit.x, pOutDhKey->components_32bit.y,
+                         pMultiplicationBuffer);
+        status = gSecEcdhSuccess_c;
+    } while (false);
+
+    return status;
+}
+
+secEcdhStatus_t Ecdh_ComputeDhKeySeg(computeDhKeyParam_t *pDhKeyData)
+{
+    secEcdhStatus_t status = gSecEcdhBadParameters_c;
+
+    do
+    {
+        if ((pDhKeyData->pWorkBuffer == NULL) || (Bi_IsZero(pDhKeyData->privateKey.raw_32bit) == TRUE))
+        {
+            break;
+        }
+        if (EcP256_IsPointOnCurve(pDhKeyData->peerPublicKey.components_32bit.x,
+                                  pDhKeyData->peerPublicKey.components_32bit.y) == FALSE)
+        {
+            status = gSecEcdhInvalidPublicKey_c;
+            break;
+        }
+        EcP256_PointMultSeg(pDhKeyData);
+        status = gSecEcdhSuccess_c;
+    } while (false);
+
+    return status;
+}
+
+void Ecdh_ComputeJacobiChunk(uint8_t index, uint8_t stepSize, computeDhKeyParam_t *pData)
+{
+    libEcWork_t *pW  = (libEcWork_t *)pData->pWorkBuffer;
+    uint8_t      end = (uint8_t)(index - stepSize);
+
+    for (uint8_t i = index; i != end; i--)
+    {
+        ec_JacobiDouble(pW);
+        if (((pData->privateKey.raw_32bit[i / 32U] >> (i % 32U)) & 1U) != 0U)
+        {
+            ec_JacobiAdd(pData->peerPublicKey.components_32bit.x, pData->peerPublicKey.components_32bit.y, pW);
+        }
+    }
+}
+
+void Ecdh_JacobiCompleteMult(computeDhKeyParam_t *pData)
+{
+    ec_JacobiToAffine((libEcWork_t *)pData->pWorkBuffer, pData->outPoint.components_32bit.x,
+                      pData->outPoint.components_32bit.y);
+}
@@ -0,0 +1,47 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file rng_host.c
+ * \brief Host replacement of RNG.c for the SecLib benchmark. The pseudo random data come from a xorshift generator
+ *        with a fixed seed, so that all the builds generate the same keys. It has no entropy, the keys are only for
+ *        the measurements.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include "EmbeddedTypes.h"
+#include "RNG_Interface.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+static uint64_t mRngState = 0x9e3779b97f4a7c15ULL;
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+int RNG_GetPseudoRandomData(uint8_t *pOut, uint8_t outBytes, uint8_t *pSeed)
+{
+    int ret = gRngBadArguments_d;
+
+    if ((pOut != NULL) && (outBytes != 0U))
+    {
+        for (uint8_t i = 0U; i < outBytes; i++)
+        {
+            /* xorshift64* */
+            mRngState ^= mRngState >> 12;
+            mRngState ^= mRngState << 25;
+            mRngState ^= mRngState >> 27;
+            pOut[i] = (uint8_t)((mRngState * 0x2545f4914f6cdd1dULL) >> 56);
+        }
+        ret = (int)outBytes;
+    }
+
+    return ret;
+}
@@ -54,6 +54,18 @@ static OSA_MUTEX_HANDLE_DEFINE(mADCMutexId);
 #define gSensorsAdcCalibrationDurationInMs_c 0U
 #endif
 
+/* The periodic trigger is a delayed work, the workqueue thread waits for it with an OSA timeout. With FreeRTOS, the
+ * tickless idle of the LowPower service bounds the sleep by the next task timeout, so this timeout wakes the device.
+ * On bare metal the systicks are stopped in low power and nothing wakes the device at the deadline, a timer manager
+ * instance then submits the trigger work */
+#ifndef gSensorsUseTimerManager_c
+#if USE_RTOS
+#define gSensorsUseTimerManager_c 0
+#else
+#define gSensorsUseTimerManager_c 1
+#endif
+#endif
+
 typedef enum _sensors_measurement_s
 {
     MEASUREMENT_IDLE,
@@ -78,13 +90,14 @@ static const Sensors_LowpowerCriticalCBs_t *pfSensorsLowpowerCriticalCallbacks =
 
 static volatile uint32_t CurrentTemperatureMeasIntervalMs = VALUE_NOT_AVAILABLE_32;
 
-static TIMER_MANAGER_HANDLE_DEFINE(mTempSensorTimer);
-
 static void Sensors_PeriodicTempWorkHandler(fwk_work_t *work);
 
-static fwk_work_t periodic_temp_trig_work = {
-    .handler = Sensors_PeriodicTempWorkHandler,
-};
+/* Scheduled on the system workqueue after the measurement interval */
+static FWK_DELAYED_WORK_DEFINE(periodic_temp_trig_work, Sensors_PeriodicTempWorkHandler);
+
+#if gSensorsUseTimerManager_c
+static TIMER_MANAGER_HANDLE_DEFINE(mTempSensorTimer);
+#endif
 
 /*! *********************************************************************************
 *************************************************************************************
@@ -116,6 +129,49 @@ static int32_t Sensors_ReleaseLpConstraint(int32_t power_mode)
     return status;
 }
 
+/* Run the trigger work after delayMs */
+static void Sensors_ScheduleTrigger(uint32_t delayMs)
+{
+#if gSensorsUseTimerManager_c
+    (void)TM_Start((timer_handle_t)mTempSensorTimer, kTimerModeSingleShot, delayMs);
+#else
+    (void)WORKQ_RescheduleDelayed(&periodic_temp_trig_work, delayMs);
+#endif
+}
+
+static void Sensors_CancelTrigger(void)
+{
+#if gSensorsUseTimerManager_c
+    (void)TM_Stop((timer_handle_t)mTempSensorTimer);
+#else
+    (void)WORKQ_CancelDelayed(&periodic_temp_trig_work);
+#endif
+}
+
+/* Run the trigger work now */
+static void Sensors_SubmitTrigger(void)
+{
+    int status = WORKQ_Submit(&periodic_temp_trig_work.work);
+
+    if (status == -EBUSY)
+    {
+        /* The system workqueue is drained before a low power mode, the measurement is dropped and the periodic
+         * measurements retry after the interval */
+        if (CurrentTemperatureMeasIntervalMs != VALUE_NOT_AVAILABLE_32)
+        {
+            Sensors_ScheduleTrigger(CurrentTemperatureMeasIntervalMs);
+        }
+    }
+    else if (status < 0)
+    {
+        assert(0);
+    }
+    else
+    {
+        /* queued */
+    }
+}
+
 static void Sensors_TemperatureReqCb(uint32_t temperature_meas_interval_ms)
 {
     if (temperature_meas_interval_ms == 0U)
@@ -131,38 +187,15 @@ static void Sensors_TemperatureReqCb(uint32_t temperature_meas_interval_ms)
      * SENSORS_RefreshTemperatureValue function will be called once the measurement is ready
      * and will schedule the next measurement to be done after interval time
      */
-    if (WORKQ_Submit(&periodic_temp_trig_work) < 0)
-    {
-        assert(0);
-    }
+    Sensors_SubmitTrigger();
 }
 
+#if gSensorsUseTimerManager_c
 static void Sensors_TempMeasTimerCallback(void *pParam)
 {
     (void)pParam;
     /* Submit temperature measurement job on timer expiration */
-    if (WORKQ_Submit(&periodic_temp_trig_work) < 0)
-    {
-        assert(0);
-    }
-}
-
-static void Sensors_TemperatureReadyCb(int32_t temperature_value)
-{
-    (void)SENSORS_RefreshTemperatureValue();
-}
-
-static void Sensors_PeriodicTempWorkHandler(fwk_work_t *work)
-{
-    if (measurement_status == MEASUREMENT_IDLE)
-    {
-        SENSORS_TriggerTemperatureMeasurement();
-    }
-    else
-    {
-        /* For recovery, retry to trigger after 1ms time */
-        (void)TM_Start((timer_handle_t)mTempSensorTimer, kTimerModeSingleShot, 1U);
-    }
+    Sensors_SubmitTrigger();
 }
 
 static timer_status_t Sensors_InitTimer(void)
@@ -185,6 +218,38 @@ static timer_status_t Sensors_InitTimer(void)
     } while (false);
     return st;
 }
+#endif /* gSensorsUseTimerManager_c */
+
+static void Sensors_TemperatureReadyCb(int32_t temperature_value)
+{
+    (void)SENSORS_RefreshTemperatureValue();
+}
+
+static void Sensors_PeriodicTempWorkHandler(fwk_work_t *work)
+{
+    if (measurement_status == TMP_MEASUREMENT_ONGOING)
+    {
+        /* The temperature ready event of the previous measurement was dropped while the system workqueue was
+         * drained, read its result */
+        (void)SENSORS_RefreshTemperatureValue();
+    }
+
+    if (measurement_status == MEASUREMENT_IDLE)
+    {
+        if (CurrentTemperatureMeasIntervalMs != VALUE_NOT_AVAILABLE_32)
+        {
+            /* Scheduled again when the temperature is ready, this schedule only matters if the ready event is
+             * dropped */
+            Sensors_ScheduleTrigger(CurrentTemperatureMeasIntervalMs);
+        }
+        SENSORS_TriggerTemperatureMeasurement();
+    }
+    else
+    {
+        /* For recovery, retry to trigger after 1ms time */
+        Sensors_ScheduleTrigger(1U);
+    }
+}
 
 /************************************************************************************
 *************************************************************************************
@@ -200,11 +265,6 @@ void SENSORS_Init(void)
 {
     PLATFORM_InitAdc();
 
-    if (PLATFORM_InitTimerManager() < 0)
-    {
-        assert(0);
-    }
-
 #if gSensorsUseMutex_c
     /*! Initialize the ADC Mutex here. */
     if (KOSA_StatusSuccess != OSA_MutexCreate((osa_mutex_handle_t)mADCMutexId))
@@ -213,13 +273,20 @@ void SENSORS_Init(void)
     }
 #endif
 
+#if gSensorsUseTimerManager_c
+    if (PLATFORM_InitTimerManager() < 0)
+    {
+        assert(0);
+    }
+
     if (kStatus_TimerSuccess != Sensors_InitTimer())
     {
         assert(0);
     }
+#endif
 
     /* The workqueue is used to post and execute the temperature
-     * trigger function upon periodic timer timeout events.
+     * trigger function, periodically with a delayed work or upon the timer timeout events.
      */
     if (WORKQ_InitSysWorkQ() < 0)
     {
@@ -236,6 +303,15 @@ void SENSORS_Init(void)
  */
 void SENSORS_Deinit(void)
 {
+    /* Stop the periodic measurements and wait for a trigger in progress, before taking the mutex it uses. The
+     * temperature ready callback is removed first as it reschedules the trigger work */
+    PLATFORM_RegisterNbuTemperatureRequestEventCb(NULL);
+    PLATFORM_RegisterTemperatureReadyEventCb(NULL);
+#if gSensorsUseTimerManager_c
+    (void)TM_Close((timer_handle_t)mTempSensorTimer);
+#endif
+    (void)WORKQ_CancelSync(&periodic_temp_trig_work.work);
+
     ADC_MUTEX_LOCK();
     PLATFORM_DeinitAdc();
 
@@ -247,10 +323,6 @@ void SENSORS_Deinit(void)
     }
 #endif
 
-    (void)TM_Close((timer_handle_t)mTempSensorTimer);
-
-    PLATFORM_RegisterNbuTemperatureRequestEventCb(NULL);
-    PLATFORM_RegisterTemperatureReadyEventCb(NULL);
     ADC_MUTEX_UNLOCK();
 }
 
@@ -322,18 +394,17 @@ int32_t SENSORS_RefreshTemperatureValue(void)
         (void)Sensors_ReleaseLpConstraint(gSensorsLpConstraint_c);
         LastTemperature = temperature;
 
-        /* Temperature is ready, Stop timer and restart it if a periodic interval is requested */
+        /* Temperature is ready, schedule the next measurement if a periodic interval is requested */
         if (CurrentTemperatureMeasIntervalMs != VALUE_NOT_AVAILABLE_32)
         {
-            /* Restart a oneshot timer with the requested interval.
-             * Timer's timeout callback will trigger the measurement.
-             * Timer is restarted each time the temperature is ready to make the measurement periodic.
+            /* Schedule the trigger work after the requested interval.
+             * The work is rescheduled each time the temperature is ready to make the measurement periodic.
              */
-            (void)TM_Start((timer_handle_t)mTempSensorTimer, kTimerModeSingleShot, CurrentTemperatureMeasIntervalMs);
+            Sensors_ScheduleTrigger(CurrentTemperatureMeasIntervalMs);
         }
         else
         {
-            (void)TM_Stop((timer_handle_t)mTempSensorTimer);
+            Sensors_CancelTrigger();
         }
         measurement_status = MEASUREMENT_IDLE;
     }
@@ -26,12 +26,24 @@
 #define CONFIG_FWK_SYSWORKQ_PRIO 4U
 #endif
 
+#ifndef CONFIG_FWK_SYSWORKQ_THREADS
+#define CONFIG_FWK_SYSWORKQ_THREADS 1U
+#endif
+
 /* -------------------------------------------------------------------------- */
 /*                               Private memory                               */
 /* -------------------------------------------------------------------------- */
 
 static fwk_workq_t sysworkq;
+#if (CONFIG_FWK_SYSWORKQ_THREADS > 1U)
+static fwk_workq_worker_t sysworkq_workers[CONFIG_FWK_SYSWORKQ_THREADS];
+FWK_WORKQ_POOL_THREAD_DEFINE(sysworkq_thread,
+                             CONFIG_FWK_SYSWORKQ_PRIO,
+                             CONFIG_FWK_SYSWORKQ_STACK_SIZE,
+                             CONFIG_FWK_SYSWORKQ_THREADS);
+#else
 FWK_WORKQ_THREAD_DEFINE(sysworkq_thread, CONFIG_FWK_SYSWORKQ_PRIO, CONFIG_FWK_SYSWORKQ_STACK_SIZE);
+#endif
 
 /* -------------------------------------------------------------------------- */
 /*                              Public functions                              */
@@ -39,10 +51,57 @@ FWK_WORKQ_THREAD_DEFINE(sysworkq_thread, CONFIG_FWK_SYSWORKQ_PRIO, CONFIG_FWK_SY
 
 int WORKQ_InitSysWorkQ(void)
 {
+#if (CONFIG_FWK_SYSWORKQ_THREADS > 1U)
+    return WORKQ_StartPool(&sysworkq, FWK_WORKQ_THREAD(sysworkq_thread), sysworkq_workers,
+                           (uint8_t)CONFIG_FWK_SYSWORKQ_THREADS);
+#else
     return WORKQ_Start(&sysworkq, FWK_WORKQ_THREAD(sysworkq_thread));
+#endif
 }
 
 int WORKQ_Submit(fwk_work_t *work)
 {
     return WORKQ_SubmitToQueue(&sysworkq, work);
 }
+
+int WORKQ_SubmitFromIsr(fwk_work_t *work)
+{
+    return WORKQ_SubmitToQueueFromIsr(&sysworkq, work);
+}
+
+int WORKQ_ScheduleDelayed(fwk_delayed_work_t *dwork, uint32_t delayMs)
+{
+    return WORKQ_ScheduleDelayedToQueue(&sysworkq, dwork, delayMs);
+}
+
+int WORKQ_RescheduleDelayed(fwk_delayed_work_t *dwork, uint32_t delayMs)
+{
+    return WORKQ_RescheduleDelayedToQueue(&sysworkq, dwork, delayMs);
+}
+
+int WORKQ_FlushSysWorkQ(void)
+{
+    return WORKQ_Flush(&sysworkq);
+}
+
+int WORKQ_DrainSysWorkQ(bool plug)
+{
+    return WORKQ_Drain(&sysworkq, plug);
+}
+
+int WORKQ_UnplugSysWorkQ(void)
+{
+    return WORKQ_Unplug(&sysworkq);
+}
+
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+int WORKQ_GetSysWorkQStats(fwk_workq_stats_t *stats)
+{
+    return WORKQ_GetStats(&sysworkq, stats);
+}
+
+int WORKQ_ResetSysWorkQStats(void)
+{
+    return WORKQ_ResetStats(&sysworkq);
+}
+#endif
@@ -4,7 +4,7 @@
  *
  * \file fwk_workq.c
  * \brief Simple workqueue implementation. A workqueue is an object that uses a dedicated thread
- *        to process work items in a FIFO manner.
+ *        to process work items in a FIFO manner within each priority level.
  *
  */
 
@@ -21,6 +21,11 @@
 #include "fsl_component_generic_list.h"
 #include "fsl_os_abstraction.h"
 
+#if defined(SDK_OS_FREE_RTOS)
+#include "FreeRTOS.h"
+#include "task.h"
+#endif
+
 /* -------------------------------------------------------------------------- */
 /*                               Private macros                               */
 /* -------------------------------------------------------------------------- */
@@ -29,38 +34,204 @@
 #define FWK_WORKQ_WAIT_TIME_MS osaWaitForever_c
 #endif
 
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0) && \
+    (defined(__ARM_ARCH_6M__) || (defined(__CORE__) && defined(__ARM6M__) && (__CORE__ == __ARM6M__)))
+#error "CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT requires the LDREX/STREX instructions, not available on Armv6-M"
+#endif
+
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+#ifndef FWK_WORKQ_STATS_GET_TIME_US
+/* The OSA time has a 1 ms resolution, redefine this macro with a microsecond timer for accurate handler durations */
+#define FWK_WORKQ_STATS_GET_TIME_US() (OSA_TimeGetMsec() * 1000U)
+#endif
+#endif
+
 /* -------------------------------------------------------------------------- */
 /*                                Private types                               */
 /* -------------------------------------------------------------------------- */
 
 enum
 {
-    FWK_WORK_QUEUED  = 1U << 0,
-    FWK_WORK_RUNNING = 1U << 1,
+    FWK_WORK_QUEUED    = 1U << 0,
+    FWK_WORK_RUNNING   = 1U << 1,
+    FWK_WORK_DELAYED   = 1U << 2,
+    FWK_WORK_CANCELING = 1U << 3,
+    FWK_WORK_BARRIER   = 1U << 4,
+    FWK_WORK_INBOX     = 1U << 5,
 };
 
 enum
 {
-    FWK_WORKQ_STARTED = 1U << 0,
+    FWK_WORKQ_STARTED  = 1U << 0,
+    FWK_WORKQ_DRAINING = 1U << 1,
+    FWK_WORKQ_PLUGGED  = 1U << 2,
 };
 
+/* Work queued by the functions waiting for the queue threads. It's not run: once picked, the caller is released
+ * when the works picked before it have completed. */
+typedef struct
+{
+    fwk_work_t    work;
+    uint32_t      seq;
+    volatile bool done;
+    OSA_SEMAPHORE_HANDLE_DEFINE(sem);
+} workq_barrier_t;
+
 /* -------------------------------------------------------------------------- */
 /*                              Private functions                             */
 /* -------------------------------------------------------------------------- */
 
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0)
+#if defined(__GNUC__)
+/* GCC and clang emit LDREX/STREX loops for these builtins on Armv7-M and Armv8-M mainline */
+static inline uint32_t workq_atomic_load(const uint32_t *addr)
+{
+    return __atomic_load_n(addr, __ATOMIC_RELAXED);
+}
+
+static inline fwk_work_t *workq_atomic_load_work(fwk_work_t *volatile *addr)
+{
+    return __atomic_load_n(addr, __ATOMIC_RELAXED);
+}
+
+static inline bool workq_atomic_cas(uint32_t *addr, uint32_t expected, uint32_t desired)
+{
+    return __atomic_compare_exchange_n(addr, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+static inline bool workq_atomic_cas_work(fwk_work_t *volatile *addr, fwk_work_t *expected, fwk_work_t *desired)
+{
+    return __atomic_compare_exchange_n(addr, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+static inline fwk_work_t *workq_atomic_xchg_work(fwk_work_t *volatile *addr, fwk_work_t *value)
+{
+    return __atomic_exchange_n(addr, value, __ATOMIC_SEQ_CST);
+}
+
+static inline void workq_atomic_inc(uint32_t *addr)
+{
+    (void)__atomic_fetch_add(addr, 1U, __ATOMIC_RELAXED);
+}
+
+static inline void workq_atomic_or(uint32_t *addr, uint32_t mask)
+{
+    (void)__atomic_fetch_or(addr, mask, __ATOMIC_SEQ_CST);
+}
+
+static inline void workq_atomic_and(uint32_t *addr, uint32_t mask)
+{
+    (void)__atomic_fetch_and(addr, mask, __ATOMIC_SEQ_CST);
+}
+#else
+/* CMSIS exclusive accesses, the pointers are 32 bits wide */
+static inline bool workq_atomic_cas(uint32_t *addr, uint32_t expected, uint32_t desired)
+{
+    bool done = false;
+
+    while (done == false)
+    {
+        if (__LDREXW((volatile uint32_t *)addr) != expected)
+        {
+            __CLREX();
+            break;
+        }
+        done = (__STREXW(desired, (volatile uint32_t *)addr) == 0U);
+    }
+    __DMB();
+
+    return done;
+}
+
+static inline uint32_t workq_atomic_load(const uint32_t *addr)
+{
+    /* aligned word accesses are single-copy atomic */
+    return *(const volatile uint32_t *)addr;
+}
+
+static inline fwk_work_t *workq_atomic_load_work(fwk_work_t *volatile *addr)
+{
+    return *addr;
+}
+
+static inline bool workq_atomic_cas_work(fwk_work_t *volatile *addr, fwk_work_t *expected, fwk_work_t *desired)
+{
+    return workq_atomic_cas((uint32_t *)(void *)addr, (uint32_t)expected, (uint32_t)desired);
+}
+
+static inline fwk_work_t *workq_atomic_xchg_work(fwk_work_t *volatile *addr, fwk_work_t *value)
+{
+    uint32_t old;
+
+    do
+    {
+        old = __LDREXW((volatile uint32_t *)(void *)addr);
+    } while (__STREXW((uint32_t)value, (volatile uint32_t *)(void *)addr) != 0U);
+    __DMB();
+
+    return (fwk_work_t *)old;
+}
+
+static inline void workq_atomic_inc(uint32_t *addr)
+{
+    uint32_t value;
+
+    do
+    {
+        value = __LDREXW((volatile uint32_t *)addr) + 1U;
+    } while (__STREXW(value, (volatile uint32_t *)addr) != 0U);
+}
+
+static inline void workq_atomic_or(uint32_t *addr, uint32_t mask)
+{
+    uint32_t value;
+
+    do
+    {
+        value = __LDREXW((volatile uint32_t *)addr) | mask;
+    } while (__STREXW(value, (volatile uint32_t *)addr) != 0U);
+    __DMB();
+}
+
+static inline void workq_atomic_and(uint32_t *addr, uint32_t mask)
+{
+    uint32_t value;
+
+    do
+    {
+        value = __LDREXW((volatile uint32_t *)addr) & mask;
+    } while (__STREXW(value, (volatile uint32_t *)addr) != 0U);
+    __DMB();
+}
+#endif
+#endif /* CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT */
+
 static inline bool flag_test(const uint32_t *flags, uint32_t mask)
 {
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0)
+    return ((workq_atomic_load(flags) & mask) != 0U);
+#else
     return ((*flags & mask) != 0U);
+#endif
 }
 
 static inline void flag_set(uint32_t *flags, uint32_t mask)
 {
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0)
+    /* the work flags may be claimed concurrently by a lock-free submission */
+    workq_atomic_or(flags, mask);
+#else
     *flags |= mask;
+#endif
 }
 
 static inline void flag_clear(uint32_t *flags, uint32_t mask)
 {
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0)
+    workq_atomic_and(flags, ~mask);
+#else
     *flags &= ~mask;
+#endif
 }
 
 static inline uint32_t fwk_workq_lock(void)
@@ -76,154 +247,1192 @@ static inline void fwk_workq_unlock(uint32_t intMask)
     OSA_ExitCritical(intMask);
 }
 
-static void workq_thread(void *workq)
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+/* Latency histogram bucket: the first one is up to 64 us, each next one is 4 times larger, the last one is unbounded */
+static inline uint32_t workq_stats_bucket(uint32_t latency)
 {
-    fwk_workq_t      *queue = (struct fwk_workq_t *)workq;
-    fwk_work_t       *work;
-    list_element_t   *node;
-    osa_status_t      status;
-    osa_event_flags_t flags;
+    uint32_t bucket = 0U;
+    uint32_t value  = latency >> 6U;
 
-    while (true)
+    while ((value != 0U) && (bucket < (FWK_WORKQ_STATS_LATENCY_BUCKETS - 1U)))
     {
-        status = OSA_EventWait(queue->notify, 1U, 1U, FWK_WORKQ_WAIT_TIME_MS, &flags);
+        value >>= 2U;
+        bucket++;
+    }
 
-        if (status == KOSA_StatusSuccess)
-        {
-            node = LIST_RemoveHead(&queue->pending);
+    return bucket;
+}
 
-            while (node != NULL)
-            {
-                uint32_t intMask = fwk_workq_lock();
-                work             = CONTAINER_OF(node, fwk_work_t, node);
-                flag_set(&work->flags, FWK_WORK_RUNNING);
-                flag_clear(&work->flags, FWK_WORK_QUEUED);
-                fwk_workq_unlock(intMask);
+static void workq_stats_reset(fwk_workq_stats_t *stats)
+{
+    uint16_t depth = stats->depth;
 
-                work->handler(work);
+    (void)memset(stats, 0, sizeof(fwk_workq_stats_t));
+    stats->depth    = depth;
+    stats->depthMax = depth;
+    stats->runMin   = UINT32_MAX;
+}
+#endif /* CONFIG_FWK_WORKQ_STATS */
 
-                intMask = fwk_workq_lock();
-                flag_clear(&work->flags, FWK_WORK_RUNNING);
-                fwk_workq_unlock(intMask);
+/* The statistics functions must be called with the lock held, or by the owner of a work for the submission time */
+static inline void workq_stats_submitted(fwk_work_t *work)
+{
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+    work->stats.submitTime = FWK_WORKQ_STATS_GET_TIME_US();
+#else
+    (void)work;
+#endif
+}
 
-                node = LIST_RemoveHead(&queue->pending);
-            }
-        }
+static inline void workq_stats_queued(fwk_workq_t *queue)
+{
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+    queue->stats.depth++;
+    if (queue->stats.depth > queue->stats.depthMax)
+    {
+        queue->stats.depthMax = queue->stats.depth;
+    }
+#else
+    (void)queue;
+#endif
+}
 
-        if (gUseRtos_c == 0U)
-        {
-            /* baremetal support */
-            break;
-        }
+static inline void workq_stats_unqueued(fwk_workq_t *queue)
+{
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+    queue->stats.depth--;
+#else
+    (void)queue;
+#endif
+}
+
+static inline void workq_stats_resubmitted(fwk_work_t *work)
+{
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+    work->stats.resubmitted++;
+    work->queue->stats.resubmitted++;
+#else
+    (void)work;
+#endif
+}
+
+/* Returns the start time of the handler */
+static inline uint32_t workq_stats_started(fwk_workq_t *queue, fwk_work_t *work)
+{
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+    uint32_t now     = FWK_WORKQ_STATS_GET_TIME_US();
+    uint32_t latency = now - work->stats.submitTime;
+
+    queue->stats.depth--;
+    queue->stats.latencyHist[workq_stats_bucket(latency)]++;
+    if (latency > queue->stats.latencyMax)
+    {
+        queue->stats.latencyMax = latency;
+    }
+    if (latency > work->stats.latencyMax)
+    {
+        work->stats.latencyMax = latency;
     }
+
+    return now;
+#else
+    (void)queue;
+    (void)work;
+    return 0U;
+#endif
 }
 
-/* -------------------------------------------------------------------------- */
-/*                              Public functions                              */
-/* -------------------------------------------------------------------------- */
+static inline void workq_stats_done(fwk_workq_t *queue, fwk_work_t *work, uint32_t start)
+{
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+    uint32_t duration = FWK_WORKQ_STATS_GET_TIME_US() - start;
 
-int WORKQ_Start(fwk_workq_t *queue, const osa_task_def_t *thread_def)
+    queue->stats.processed++;
+    queue->stats.runTotal += duration;
+    if (duration < queue->stats.runMin)
+    {
+        queue->stats.runMin = duration;
+    }
+    if (duration > queue->stats.runMax)
+    {
+        queue->stats.runMax = duration;
+    }
+
+    work->stats.processed++;
+    work->stats.runTotal += duration;
+    if (duration > work->stats.runMax)
+    {
+        work->stats.runMax = duration;
+    }
+#else
+    (void)queue;
+    (void)work;
+    (void)start;
+#endif
+}
+
+/* Returns the pending list matching the priority of a work */
+static inline list_label_t *workq_pending_list(fwk_workq_t *queue, const fwk_work_t *work)
 {
-    int ret = 0;
+    uint8_t prio = (work->prio > FWK_WORK_PRIO_HIGHEST) ? FWK_WORK_PRIO_HIGHEST : work->prio;
 
-    do
+    return &queue->pending[prio];
+}
+
+/* Appends a work to the pending list matching its priority. Must be called with the lock held. */
+static void workq_link(fwk_workq_t *queue, fwk_work_t *work)
+{
+    /* We are using a list not limited in size and in this case, LIST always returns success */
+    (void)LIST_AddTail(workq_pending_list(queue, work), &work->node);
+    flag_set(&work->flags, FWK_WORK_QUEUED);
+    work->queue = queue;
+    workq_stats_queued(queue);
+}
+
+static void workq_enqueue(fwk_workq_t *queue, fwk_work_t *work)
+{
+    workq_stats_submitted(work);
+    workq_link(queue, work);
+}
+
+/* Moves the works submitted from ISRs to the pending lists, in submission order. Must be called with the lock held. */
+static void workq_collect(fwk_workq_t *queue)
+{
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0)
+    fwk_work_t *work = NULL;
+    fwk_work_t *next;
+
+    if (workq_atomic_load_work(&queue->inbox) != NULL)
     {
-        if ((queue == NULL) || (thread_def->stacksize == 0U))
+        /* taking the whole inbox at once is safe against concurrent pushes */
+        fwk_work_t *lifo = workq_atomic_xchg_work(&queue->inbox, NULL);
+
+        while (lifo != NULL)
         {
-            ret = -EINVAL;
-            break;
+            next            = lifo->inboxNext;
+            lifo->inboxNext = work;
+            work            = lifo;
+            lifo            = next;
         }
 
-        if (flag_test(&queue->flags, FWK_WORKQ_STARTED) == true)
+        while (work != NULL)
         {
-            ret = 1;
-            break;
+            next            = work->inboxNext;
+            work->inboxNext = NULL;
+            flag_clear(&work->flags, FWK_WORK_INBOX);
+            workq_link(queue, work);
+            work = next;
         }
+    }
+#else
+    (void)queue;
+#endif
+}
 
-        /* the OSA thread definition are const so make a local copy in RAM to change the thread handler */
-        osa_task_def_t thread_local;
-        (void)memcpy(&thread_local, thread_def, sizeof(osa_task_def_t));
-        thread_local.pthread = workq_thread;
+/* Collects the inbox holding a work, if any. Must be called with the lock held.
+ * Returns false if the work is still being added to an inbox by an interrupted submission. */
+static bool workq_collect_work(fwk_work_t *work)
+{
+    if (flag_test(&work->flags, FWK_WORK_INBOX) == true)
+    {
+        workq_collect(work->queue);
+    }
 
-        LIST_Init(&queue->pending, 0U);
+    return !flag_test(&work->flags, FWK_WORK_INBOX);
+}
 
-        if (OSA_EventCreate(queue->notify, 1U) != KOSA_StatusSuccess)
+/* Removes a work from the pending or delayed list it's in. Must be called with the lock held. */
+static void workq_unlink(fwk_work_t *work)
+{
+    if (flag_test(&work->flags, FWK_WORK_QUEUED) == true)
+    {
+        workq_stats_unqueued(work->queue);
+    }
+    (void)LIST_RemoveElement(&work->node);
+    flag_clear(&work->flags, FWK_WORK_QUEUED | FWK_WORK_DELAYED);
+}
+
+/* Inserts a delayed work in the delayed list of the queue, sorted by deadline.
+ * Returns true if the work is now the earliest one. Must be called with the lock held. */
+static bool workq_insert_delayed(fwk_workq_t *queue, fwk_delayed_work_t *dwork)
+{
+    list_element_t *node = LIST_GetHead(&queue->delayed);
+
+    while (node != NULL)
+    {
+        fwk_work_t         *work  = CONTAINER_OF(node, fwk_work_t, node);
+        fwk_delayed_work_t *other = CONTAINER_OF(work, fwk_delayed_work_t, work);
+
+        /* Works with the same deadline run in the order they were scheduled */
+        if ((int32_t)(dwork->deadline - other->deadline) < 0)
         {
-            ret = -ENOMEM;
             break;
         }
+        node = LIST_GetNext(node);
+    }
+
+    if (node == NULL)
+    {
+        (void)LIST_AddTail(&queue->delayed, &dwork->work.node);
+    }
+    else
+    {
+        (void)LIST_AddPrevElement(node, &dwork->work.node);
+    }
+
+    return (LIST_GetHead(&queue->delayed) == &dwork->work.node);
+}
+
+/* Moves the delayed works whose deadline has elapsed to the pending list.
+ * Returns the time to wait until the next deadline. */
+static uint32_t workq_expire_delayed(fwk_workq_t *queue)
+{
+    uint32_t        timeout = FWK_WORKQ_WAIT_TIME_MS;
+    uint32_t        now     = OSA_TimeGetMsec();
+    uint32_t        intMask = fwk_workq_lock();
+    list_element_t *node    = LIST_GetHead(&queue->delayed);
+
+    while (node != NULL)
+    {
+        fwk_work_t         *work      = CONTAINER_OF(node, fwk_work_t, node);
+        fwk_delayed_work_t *dwork     = CONTAINER_OF(work, fwk_delayed_work_t, work);
+        int32_t             remaining = (int32_t)(dwork->deadline - now);
 
-        if (OSA_TaskCreate(queue->thread, &thread_local, queue) != KOSA_StatusSuccess)
+        if (remaining > 0)
         {
-            (void)OSA_EventDestroy(queue->notify);
-            ret = -ENOMEM;
+            if ((uint32_t)remaining < timeout)
+            {
+                timeout = (uint32_t)remaining;
+            }
             break;
         }
 
-        uint32_t intMask = fwk_workq_lock();
-        flag_set(&queue->flags, FWK_WORKQ_STARTED);
-        fwk_workq_unlock(intMask);
+        (void)LIST_RemoveHead(&queue->delayed);
+        flag_clear(&work->flags, FWK_WORK_DELAYED);
+        workq_enqueue(queue, work);
 
-    } while (false);
+        node = LIST_GetHead(&queue->delayed);
+    }
 
-    return ret;
+    fwk_workq_unlock(intMask);
+
+    return timeout;
 }
 
-int WORKQ_SubmitToQueue(fwk_workq_t *queue, fwk_work_t *work)
+/* Returns true if no worker is running a work picked before the barrier. Must be called with the lock held. */
+static bool workq_barrier_ready(fwk_workq_t *queue, const workq_barrier_t *barrier)
 {
-    int ret = 0;
+    bool ready = true;
 
-    do
+    for (uint32_t i = 0U; i < queue->workerCount; i++)
     {
-        if ((queue == NULL) || (work == NULL))
-        {
-            ret = -EINVAL;
-            break;
-        }
+        const fwk_workq_worker_t *worker = &queue->workers[i];
 
-        if (work->handler == NULL)
+        if ((worker->work != NULL) && ((int32_t)(worker->seq - barrier->seq) < 0))
         {
-            ret = -EINVAL;
+            ready = false;
             break;
         }
+    }
 
-        uint32_t intMask = fwk_workq_lock();
+    return ready;
+}
 
-        if (flag_test(&work->flags, FWK_WORK_QUEUED) == true)
+/* Removes the first barrier that can be released. Must be called with the lock held. */
+static workq_barrier_t *workq_next_barrier(fwk_workq_t *queue)
+{
+    workq_barrier_t *barrier = NULL;
+    list_element_t  *node    = LIST_GetHead(&queue->barriers);
+
+    /* the barriers are in pick order, the first one is released first */
+    if (node != NULL)
+    {
+        barrier = CONTAINER_OF(CONTAINER_OF(node, fwk_work_t, node), workq_barrier_t, work);
+
+        if (workq_barrier_ready(queue, barrier) == true)
         {
-            /* already queued */
-            ret = 1;
-            fwk_workq_unlock(intMask);
-            break;
+            (void)LIST_RemoveHead(&queue->barriers);
+            flag_clear(&barrier->work.flags, FWK_WORK_RUNNING);
         }
-
-        if (flag_test(&work->flags, FWK_WORK_RUNNING) == true)
+        else
         {
-            /* if the work is currently running we have to use the
-             * same queue it's running on to prevent handler re-entrancy */
-            queue = work->queue;
-            ret   = 2;
+            barrier = NULL;
         }
+    }
 
-        if (flag_test(&queue->flags, FWK_WORKQ_STARTED) == false)
+    return barrier;
+}
+
+static void workq_barrier_release(workq_barrier_t *barrier)
+{
+    barrier->done = true;
+
+    if (gUseRtos_c != 0U)
+    {
+        (void)OSA_SemaphorePost(barrier->sem);
+    }
+}
+
+/* Releases the barriers whose preceding works have completed */
+static void workq_release_barriers(fwk_workq_t *queue)
+{
+    workq_barrier_t *barrier;
+
+    do
+    {
+        uint32_t intMask = fwk_workq_lock();
+        barrier          = workq_next_barrier(queue);
+        fwk_workq_unlock(intMask);
+
+        if (barrier != NULL)
         {
-            /* the queue is not started */
-            ret = -ENODEV;
-            fwk_workq_unlock(intMask);
-            break;
+            /* the barrier lives on the stack of the waiter, it must not be accessed after this point */
+            workq_barrier_release(barrier);
         }
+    } while (barrier != NULL);
+}
 
-        /* We are using a list not limited in size and in this case, LIST always returns success */
-        (void)LIST_AddTail(&queue->pending, &work->node);
+/* Removes the next work from the highest priority non-empty pending list and marks it running.
+ * The works already running on another worker are skipped, and the barriers are moved to the barrier list. */
+static fwk_work_t *workq_next_work(fwk_workq_worker_t *worker, uint32_t *pStart)
+{
+    fwk_workq_t    *queue   = worker->queue;
+    fwk_work_t     *work    = NULL;
+    list_element_t *node    = NULL;
+    uint32_t        level   = CONFIG_FWK_WORKQ_PRIO_LEVELS;
+    uint32_t        intMask = fwk_workq_lock();
 
-        flag_set(&work->flags, FWK_WORK_QUEUED);
-        work->queue = queue;
+    workq_collect(queue);
 
-        fwk_workq_unlock(intMask);
+    while ((work == NULL) && (level > 0U))
+    {
+        level--;
+        node = LIST_GetHead(&queue->pending[level]);
 
-        /* Event set can't fail as we control the event handler */
-        (void)OSA_EventSet(queue->notify, 1U);
-    } while (false);
+        while (node != NULL)
+        {
+            fwk_work_t *candidate = CONTAINER_OF(node, fwk_work_t, node);
+            node                  = LIST_GetNext(node);
+
+            if (flag_test(&candidate->flags, FWK_WORK_RUNNING) == true)
+            {
+                /* keep the order and never run a handler twice at the same time */
+                continue;
+            }
+
+            (void)LIST_RemoveElement(&candidate->node);
+            flag_set(&candidate->flags, FWK_WORK_RUNNING);
+            flag_clear(&candidate->flags, FWK_WORK_QUEUED);
+            queue->seq++;
+
+            if (flag_test(&candidate->flags, FWK_WORK_BARRIER) == true)
+            {
+                CONTAINER_OF(candidate, workq_barrier_t, work)->seq = queue->seq;
+                workq_stats_unqueued(queue);
+                (void)LIST_AddTail(&queue->barriers, &candidate->node);
+            }
+            else
+            {
+                work         = candidate;
+                worker->work = work;
+                worker->seq  = queue->seq;
+                *pStart      = workq_stats_started(queue, work);
+                break;
+            }
+        }
+    }
+
+    fwk_workq_unlock(intMask);
+
+    /* the barriers picked may be ready already */
+    workq_release_barriers(queue);
+
+    return work;
+}
+
+/* Returns true if the caller is a thread of the queue */
+static bool workq_in_thread(fwk_workq_t *queue)
+{
+    bool inThread = false;
+
+    if (gUseRtos_c == 0U)
+    {
+        /* baremetal support: the queue may be run by any caller, the only handler is the one running */
+        inThread = (queue->workers[0].work != NULL);
+    }
+    else
+    {
+        osa_task_handle_t current = OSA_TaskGetCurrentHandle();
+
+        for (uint32_t i = 0U; i < queue->workerCount; i++)
+        {
+            if (current == (osa_task_handle_t)queue->workers[i].thread)
+            {
+                inThread = true;
+                break;
+            }
+        }
+    }
+
+    return inThread;
+}
+
+/* Checks if a submission must be rejected because the work is being cancelled or the queue drained.
+ * The works submitted by the queue thread itself are accepted while draining. Must be called with the lock held. */
+static bool workq_rejects(fwk_workq_t *queue, const fwk_work_t *work)
+{
+    bool reject = flag_test(&work->flags, FWK_WORK_CANCELING);
+
+    if ((reject == false) && (flag_test(&queue->flags, FWK_WORKQ_DRAINING | FWK_WORKQ_PLUGGED) == true))
+    {
+        reject = !workq_in_thread(queue);
+    }
+
+    return reject;
+}
+
+static void workq_barrier_handler(fwk_work_t *work)
+{
+    /* never called, the barriers are released by the threads */
+    (void)work;
+}
+
+static void workq_thread(void *arg)
+{
+    fwk_workq_worker_t *worker  = (fwk_workq_worker_t *)arg;
+    fwk_workq_t        *queue   = worker->queue;
+    uint32_t            timeout = FWK_WORKQ_WAIT_TIME_MS;
+    uint32_t            start   = 0U;
+    fwk_work_t         *work;
+    osa_event_flags_t   flags;
+
+#if defined(SDK_OS_FREE_RTOS) && defined(configUSE_CORE_AFFINITY) && (configUSE_CORE_AFFINITY == 1) && \
+    (configNUMBER_OF_CORES > 1)
+    if (worker->coreAffinity != 0U)
+    {
+        vTaskCoreAffinitySet(NULL, (UBaseType_t)worker->coreAffinity);
+    }
+#endif
+
+    while (true)
+    {
+        /* The threads wake up on a submission or when the earliest delayed work is due */
+        (void)OSA_EventWait(queue->notify, 1U, 1U, timeout, &flags);
+
+        timeout = workq_expire_delayed(queue);
+        work    = workq_next_work(worker, &start);
+
+        while (work != NULL)
+        {
+            work->handler(work);
+
+            uint32_t intMask = fwk_workq_lock();
+            workq_stats_done(queue, work, start);
+            flag_clear(&work->flags, FWK_WORK_RUNNING);
+            worker->work = NULL;
+            fwk_workq_unlock(intMask);
+
+            /* the barriers picked meanwhile may wait for this work only */
+            workq_release_barriers(queue);
+
+            timeout = workq_expire_delayed(queue);
+            work    = workq_next_work(worker, &start);
+        }
+
+        if (gUseRtos_c == 0U)
+        {
+            /* baremetal support */
+            break;
+        }
+    }
+}
+
+static int workq_schedule(fwk_workq_t *queue, fwk_delayed_work_t *dwork, uint32_t delayMs, bool reschedule)
+{
+    int  ret    = 0;
+    bool notify = false;
+
+    do
+    {
+        if ((queue == NULL) || (dwork == NULL))
+        {
+            ret = -EINVAL;
+            break;
+        }
+
+        fwk_work_t *work = &dwork->work;
+
+        if (work->handler == NULL)
+        {
+            ret = -EINVAL;
+            break;
+        }
+
+        uint32_t intMask = fwk_workq_lock();
+        bool     idle    = workq_collect_work(work);
+
+        if ((reschedule == false) &&
+            (flag_test(&work->flags, FWK_WORK_QUEUED | FWK_WORK_DELAYED | FWK_WORK_INBOX) == true))
+        {
+            /* already scheduled or queued */
+            workq_stats_resubmitted(work);
+            ret = 1;
+            fwk_workq_unlock(intMask);
+            break;
+        }
+
+        if (idle == false)
+        {
+            /* being queued by an interrupted submission, it can't be moved */
+            ret = -EBUSY;
+            fwk_workq_unlock(intMask);
+            break;
+        }
+
+        if (flag_test(&work->flags, FWK_WORK_RUNNING) == true)
+        {
+            /* same as WORKQ_SubmitToQueue(), stay on the queue the work is running on */
+            queue = work->queue;
+            ret   = 2;
+        }
+
+        if (flag_test(&queue->flags, FWK_WORKQ_STARTED) == false)
+        {
+            /* the queue is not started */
+            ret = -ENODEV;
+            fwk_workq_unlock(intMask);
+            break;
+        }
+
+        /* a delay is kept while the queue is drained, like the delayed works already scheduled */
+        if ((flag_test(&work->flags, FWK_WORK_CANCELING) == true) ||
+            ((delayMs == 0U) && (workq_rejects(queue, work) == true)))
+        {
+            ret = -EBUSY;
+            fwk_workq_unlock(intMask);
+            break;
+        }
+
+        if (flag_test(&work->flags, FWK_WORK_QUEUED | FWK_WORK_DELAYED) == true)
+        {
+            /* reschedule: drop the previous schedule */
+            workq_unlink(work);
+        }
+
+        if (delayMs == 0U)
+        {
+            workq_enqueue(queue, work);
+            notify = true;
+        }
+        else
+        {
+            work->queue     = queue;
+            dwork->deadline = OSA_TimeGetMsec() + delayMs;
+            /* Wake up the thread only if its wait time must be shortened */
+            notify = workq_insert_delayed(queue, dwork);
+            flag_set(&work->flags, FWK_WORK_DELAYED);
+        }
+
+        fwk_workq_unlock(intMask);
+
+        if (notify == true)
+        {
+            /* Event set can't fail as we control the event handler */
+            (void)OSA_EventSet(queue->notify, 1U);
+        }
+    } while (false);
+
+    return ret;
+}
+
+static int workq_submit(fwk_workq_t *queue, fwk_work_t *work, bool force)
+{
+    int ret = 0;
+
+    do
+    {
+        if ((queue == NULL) || (work == NULL))
+        {
+            ret = -EINVAL;
+            break;
+        }
+
+        if (work->handler == NULL)
+        {
+            ret = -EINVAL;
+            break;
+        }
+
+        uint32_t intMask = fwk_workq_lock();
+
+        (void)workq_collect_work(work);
+
+        if (flag_test(&work->flags, FWK_WORK_QUEUED | FWK_WORK_INBOX) == true)
+        {
+            /* already queued */
+            workq_stats_resubmitted(work);
+            ret = 1;
+            fwk_workq_unlock(intMask);
+            break;
+        }
+
+        if (flag_test(&work->flags, FWK_WORK_RUNNING) == true)
+        {
+            /* if the work is currently running we have to use the
+             * same queue it's running on to prevent handler re-entrancy */
+            queue = work->queue;
+            ret   = 2;
+        }
+
+        if (flag_test(&queue->flags, FWK_WORKQ_STARTED) == false)
+        {
+            /* the queue is not started */
+            ret = -ENODEV;
+            fwk_workq_unlock(intMask);
+            break;
+        }
+
+        if ((force == false) && (workq_rejects(queue, work) == true))
+        {
+            ret = -EBUSY;
+            fwk_workq_unlock(intMask);
+            break;
+        }
+
+        if (flag_test(&work->flags, FWK_WORK_DELAYED) == true)
+        {
+            /* a delayed work submitted directly runs without waiting for its deadline */
+            workq_unlink(work);
+        }
+
+        /* the works already submitted from ISRs go first */
+        workq_collect(queue);
+        workq_enqueue(queue, work);
+
+        fwk_workq_unlock(intMask);
+
+        /* Event set can't fail as we control the event handler */
+        (void)OSA_EventSet(queue->notify, 1U);
+    } while (false);
+
+    return ret;
+}
+
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0)
+/* Adds a work to the inbox of a queue without masking the interrupts.
+ * Returns -EAGAIN if the submission must go through workq_submit(). */
+static int workq_submit_lockfree(fwk_workq_t *queue, fwk_work_t *work)
+{
+    int          ret;
+    uint32_t     flags;
+    fwk_workq_t *target;
+    fwk_work_t  *head;
+
+    do
+    {
+        ret    = 0;
+        target = queue;
+        flags  = workq_atomic_load(&work->flags);
+
+        if (flag_test(&flags, FWK_WORK_QUEUED | FWK_WORK_INBOX) == true)
+        {
+            /* already queued */
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+            workq_atomic_inc(&work->stats.resubmitted);
+            /* work->queue may not be set yet by a concurrent submission, count it on the requested queue */
+            workq_atomic_inc(&target->stats.resubmitted);
+#endif
+            ret = 1;
+            break;
+        }
+
+        if (flag_test(&flags, FWK_WORK_RUNNING) == true)
+        {
+            /* stay on the queue the work is running on to prevent handler re-entrancy */
+            target = work->queue;
+            ret    = 2;
+        }
+
+        if (flag_test(&target->flags, FWK_WORKQ_STARTED) == false)
+        {
+            ret = -ENODEV;
+            break;
+        }
+
+        if ((flag_test(&flags, FWK_WORK_DELAYED | FWK_WORK_CANCELING) == true) ||
+            (flag_test(&target->flags, FWK_WORKQ_DRAINING | FWK_WORKQ_PLUGGED) == true))
+        {
+            /* needs the lists or the rejection rules */
+            ret = -EAGAIN;
+            break;
+        }
+
+        /* claim the work, it fails if its flags changed since they were read */
+    } while (workq_atomic_cas(&work->flags, flags, flags | FWK_WORK_INBOX) == false);
+
+    if ((ret == 0) || (ret == 2))
+    {
+        /* the work is owned until it's pushed */
+        work->queue = target;
+        workq_stats_submitted(work);
+
+        do
+        {
+            head            = workq_atomic_load_work(&target->inbox);
+            work->inboxNext = head;
+        } while (workq_atomic_cas_work(&target->inbox, head, work) == false);
+
+        if (head == NULL)
+        {
+            /* the thread is already notified if the inbox was not empty */
+            (void)OSA_EventSet(target->notify, 1U);
+        }
+    }
+
+    return ret;
+}
+#endif /* CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT */
+
+/* Returns true if works are waiting in the pending lists of the queue or being run */
+static bool workq_has_pending(fwk_workq_t *queue)
+{
+    bool     pending = false;
+    uint32_t intMask = fwk_workq_lock();
+
+    workq_collect(queue);
+
+    for (uint32_t level = 0U; level < CONFIG_FWK_WORKQ_PRIO_LEVELS; level++)
+    {
+        if (LIST_GetHead(&queue->pending[level]) != NULL)
+        {
+            pending = true;
+            break;
+        }
+    }
+
+    for (uint32_t i = 0U; (pending == false) && (i < queue->workerCount); i++)
+    {
+        pending = (queue->workers[i].work != NULL);
+    }
+
+    fwk_workq_unlock(intMask);
+
+    return pending;
+}
+
+/* Queues a barrier work at the given priority and waits until the works picked before it have completed */
+static int workq_wait_barrier(fwk_workq_t *queue, uint8_t prio)
+{
+    int             ret = 0;
+    workq_barrier_t barrier;
+
+    (void)memset(&barrier, 0, sizeof(barrier));
+    barrier.work.handler = workq_barrier_handler;
+    barrier.work.prio    = prio;
+    barrier.work.flags   = FWK_WORK_BARRIER;
+
+    if (gUseRtos_c == 0U)
+    {
+        /* baremetal support: the caller runs the queue until the barrier is reached */
+        (void)workq_submit(queue, &barrier.work, true);
+        while (barrier.done == false)
+        {
+            workq_thread(&queue->workers[0]);
+        }
+    }
+    else if (OSA_SemaphoreCreate(barrier.sem, 0U) != KOSA_StatusSuccess)
+    {
+        ret = -ENOMEM;
+    }
+    else
+    {
+        (void)workq_submit(queue, &barrier.work, true);
+        (void)OSA_SemaphoreWait(barrier.sem, osaWaitForever_c);
+        (void)OSA_SemaphoreDestroy(barrier.sem);
+    }
+
+    return ret;
+}
+
+/* Checks that the caller can wait for the queue thread */
+static int workq_check_wait(fwk_workq_t *queue)
+{
+    int ret = 0;
+
+    if (queue == NULL)
+    {
+        ret = -EINVAL;
+    }
+    else if (flag_test(&queue->flags, FWK_WORKQ_STARTED) == false)
+    {
+        ret = -ENODEV;
+    }
+    else if (workq_in_thread(queue) == true)
+    {
+        /* the queue thread can't wait for itself */
+        ret = -EDEADLK;
+    }
+    else
+    {
+        /* the caller can wait */
+    }
+
+    return ret;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+int WORKQ_Start(fwk_workq_t *queue, const osa_task_def_t *thread_def)
+{
+    return (queue == NULL) ? -EINVAL : WORKQ_StartPool(queue, thread_def, &queue->worker, 1U);
+}
+
+int WORKQ_StartPool(fwk_workq_t *queue, const osa_task_def_t *thread_def, fwk_workq_worker_t *workers, uint8_t count)
+{
+    int     ret     = 0;
+    uint8_t created = 0U;
+
+    do
+    {
+        if ((queue == NULL) || (thread_def == NULL) || (thread_def->stacksize == 0U) || (workers == NULL) ||
+            (count == 0U))
+        {
+            ret = -EINVAL;
+            break;
+        }
+
+        if (flag_test(&queue->flags, FWK_WORKQ_STARTED) == true)
+        {
+            ret = 1;
+            break;
+        }
+
+        if (gUseRtos_c == 0U)
+        {
+            /* baremetal support: the queue is run by its callers, one work at a time */
+            count = 1U;
+        }
+
+        /* the OSA thread definition are const so make a local copy in RAM to change the thread handler */
+        osa_task_def_t thread_local;
+        (void)memcpy(&thread_local, thread_def, sizeof(osa_task_def_t));
+        thread_local.pthread = workq_thread;
+
+        for (uint32_t level = 0U; level < CONFIG_FWK_WORKQ_PRIO_LEVELS; level++)
+        {
+            LIST_Init(&queue->pending[level], 0U);
+        }
+        LIST_Init(&queue->delayed, 0U);
+        LIST_Init(&queue->barriers, 0U);
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+        workq_stats_reset(&queue->stats);
+#endif
+        queue->workers     = workers;
+        queue->workerCount = count;
+
+        if (OSA_EventCreate(queue->notify, 1U) != KOSA_StatusSuccess)
+        {
+            ret = -ENOMEM;
+            break;
+        }
+
+        while (created < count)
+        {
+            fwk_workq_worker_t *worker = &workers[created];
+
+            worker->queue = queue;
+            worker->work  = NULL;
+
+            if (OSA_TaskCreate(worker->thread, &thread_local, worker) != KOSA_StatusSuccess)
+            {
+                ret = -ENOMEM;
+                break;
+            }
+            created++;
+        }
+
+        if (ret != 0)
+        {
+            while (created > 0U)
+            {
+                created--;
+                (void)OSA_TaskDestroy(workers[created].thread);
+            }
+            (void)OSA_EventDestroy(queue->notify);
+            break;
+        }
+
+        uint32_t intMask = fwk_workq_lock();
+        flag_set(&queue->flags, FWK_WORKQ_STARTED);
+        fwk_workq_unlock(intMask);
+
+    } while (false);
+
+    return ret;
+}
+
+int WORKQ_SubmitToQueue(fwk_workq_t *queue, fwk_work_t *work)
+{
+    return workq_submit(queue, work, false);
+}
+
+int WORKQ_SubmitToQueueFromIsr(fwk_workq_t *queue, fwk_work_t *work)
+{
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0)
+    int ret = -EINVAL;
+
+    if ((queue != NULL) && (work != NULL) && (work->handler != NULL))
+    {
+        ret = workq_submit_lockfree(queue, work);
+        if (ret == -EAGAIN)
+        {
+            ret = workq_submit(queue, work, false);
+        }
+    }
+
+    return ret;
+#else
+    return workq_submit(queue, work, false);
+#endif
+}
+
+int WORKQ_ScheduleDelayedToQueue(fwk_workq_t *queue, fwk_delayed_work_t *dwork, uint32_t delayMs)
+{
+    return workq_schedule(queue, dwork, delayMs, false);
+}
+
+int WORKQ_RescheduleDelayedToQueue(fwk_workq_t *queue, fwk_delayed_work_t *dwork, uint32_t delayMs)
+{
+    return workq_schedule(queue, dwork, delayMs, true);
+}
+
+int WORKQ_Cancel(fwk_work_t *work)
+{
+    int ret = 1;
+
+    do
+    {
+        if (work == NULL)
+        {
+            ret = -EINVAL;
+            break;
+        }
+
+        uint32_t intMask = fwk_workq_lock();
+
+        if (workq_collect_work(work) == false)
+        {
+            /* being queued by an interrupted submission */
+            ret = -EBUSY;
+            fwk_workq_unlock(intMask);
+            break;
+        }
+
+        if (flag_test(&work->flags, FWK_WORK_QUEUED | FWK_WORK_DELAYED) == true)
+        {
+            workq_unlink(work);
+            ret = 0;
+        }
+
+        if (flag_test(&work->flags, FWK_WORK_RUNNING) == true)
+        {
+            /* the handler can't be interrupted */
+            ret = -EBUSY;
+        }
+
+        fwk_workq_unlock(intMask);
+    } while (false);
+
+    return ret;
+}
+
+int WORKQ_CancelSync(fwk_work_t *work)
+{
+    int          ret     = 1;
+    bool         running = false;
+    fwk_workq_t *queue   = NULL;
+
+    do
+    {
+        if (work == NULL)
+        {
+            ret = -EINVAL;
+            break;
+        }
+
+        uint32_t intMask = fwk_workq_lock();
+
+        if (workq_collect_work(work) == false)
+        {
+            /* being queued by an interrupted submission */
+            ret = -EBUSY;
+            fwk_workq_unlock(intMask);
+            break;
+        }
+
+        if (flag_test(&work->flags, FWK_WORK_QUEUED | FWK_WORK_DELAYED) == true)
+        {
+            workq_unlink(work);
+            ret = 0;
+        }
+
+        if (flag_test(&work->flags, FWK_WORK_RUNNING) == true)
+        {
+            /* the handler can't resubmit the work while we wait for it */
+            flag_set(&work->flags, FWK_WORK_CANCELING);
+            queue   = work->queue;
+            running = true;
+        }
+
+        fwk_workq_unlock(intMask);
+
+        if (running == true)
+        {
+            /* a barrier of the highest priority is picked next, and released once the handler has returned */
+            ret = workq_check_wait(queue);
+            if (ret == 0)
+            {
+                ret = workq_wait_barrier(queue, FWK_WORK_PRIO_HIGHEST);
+            }
+
+            intMask = fwk_workq_lock();
+            flag_clear(&work->flags, FWK_WORK_CANCELING);
+            fwk_workq_unlock(intMask);
+        }
+    } while (false);
+
+    return ret;
+}
+
+int WORKQ_Flush(fwk_workq_t *queue)
+{
+    int ret = workq_check_wait(queue);
+
+    if (ret == 0)
+    {
+        /* a barrier of the lowest priority runs after all the works already queued */
+        ret = workq_wait_barrier(queue, FWK_WORK_PRIO_LOWEST);
+    }
+
+    return ret;
+}
+
+int WORKQ_Drain(fwk_workq_t *queue, bool plug)
+{
+    int ret = workq_check_wait(queue);
+
+    if (ret == 0)
+    {
+        uint32_t intMask = fwk_workq_lock();
+        flag_set(&queue->flags, FWK_WORKQ_DRAINING);
+        if (plug == true)
+        {
+            flag_set(&queue->flags, FWK_WORKQ_PLUGGED);
+        }
+        fwk_workq_unlock(intMask);
+
+        /* the handlers may submit new works, flush until the queue is empty */
+        do
+        {
+            ret = workq_wait_barrier(queue, FWK_WORK_PRIO_LOWEST);
+        } while ((ret == 0) && (workq_has_pending(queue) == true));
+
+        intMask = fwk_workq_lock();
+        flag_clear(&queue->flags, FWK_WORKQ_DRAINING);
+        fwk_workq_unlock(intMask);
+    }
+
+    return ret;
+}
+
+int WORKQ_Unplug(fwk_workq_t *queue)
+{
+    int ret = 0;
+
+    if (queue == NULL)
+    {
+        ret = -EINVAL;
+    }
+    else
+    {
+        uint32_t intMask = fwk_workq_lock();
+
+        if (flag_test(&queue->flags, FWK_WORKQ_PLUGGED) == true)
+        {
+            flag_clear(&queue->flags, FWK_WORKQ_PLUGGED);
+        }
+        else
+        {
+            /* not plugged */
+            ret = 1;
+        }
+
+        fwk_workq_unlock(intMask);
+    }
+
+    return ret;
+}
+
+int WORKQ_CancelDelayed(fwk_delayed_work_t *dwork)
+{
+    return (dwork == NULL) ? -EINVAL : WORKQ_Cancel(&dwork->work);
+}
+
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+int WORKQ_GetStats(fwk_workq_t *queue, fwk_workq_stats_t *stats)
+{
+    int ret = 0;
+
+    if ((queue == NULL) || (stats == NULL))
+    {
+        ret = -EINVAL;
+    }
+    else
+    {
+        uint32_t intMask = fwk_workq_lock();
+        workq_collect(queue);
+        (void)memcpy(stats, &queue->stats, sizeof(fwk_workq_stats_t));
+        fwk_workq_unlock(intMask);
+    }
+
+    return ret;
+}
+
+int WORKQ_ResetStats(fwk_workq_t *queue)
+{
+    int ret = 0;
+
+    if (queue == NULL)
+    {
+        ret = -EINVAL;
+    }
+    else
+    {
+        uint32_t intMask = fwk_workq_lock();
+        workq_stats_reset(&queue->stats);
+        fwk_workq_unlock(intMask);
+    }
+
+    return ret;
+}
+
+int WORKQ_GetWorkStats(fwk_work_t *work, fwk_work_stats_t *stats)
+{
+    int ret = 0;
+
+    if ((work == NULL) || (stats == NULL))
+    {
+        ret = -EINVAL;
+    }
+    else
+    {
+        uint32_t intMask = fwk_workq_lock();
+        (void)memcpy(stats, &work->stats, sizeof(fwk_work_stats_t));
+        fwk_workq_unlock(intMask);
+    }
 
     return ret;
 }
+#endif /* CONFIG_FWK_WORKQ_STATS */
@@ -4,7 +4,7 @@
  *
  * \file fwk_workq.h
  * \brief Simple workqueue implementation. A workqueue is an object that uses a dedicated thread
- *        to process work items in a FIFO manner.
+ *        to process work items in a FIFO manner within each priority level.
  *
  */
 
@@ -15,13 +15,57 @@
 /*                                  Includes                                  */
 /* -------------------------------------------------------------------------- */
 
+#include <stdbool.h>
+
 #include "fsl_os_abstraction.h"
 #include "fsl_component_generic_list.h"
+#include "fwk_errno.h"
 
 /* -------------------------------------------------------------------------- */
 /*                                Public macros                               */
 /* -------------------------------------------------------------------------- */
 
+/*!
+ * \brief Number of work priority levels of a workqueue, each level has its own pending list
+ */
+#ifndef CONFIG_FWK_WORKQ_PRIO_LEVELS
+#define CONFIG_FWK_WORKQ_PRIO_LEVELS 3U
+#endif
+
+/*!
+ * \brief Lowest work priority, used by default
+ */
+#define FWK_WORK_PRIO_LOWEST 0U
+
+/*!
+ * \brief Highest work priority, the works with a higher priority value are queued at this level
+ */
+#define FWK_WORK_PRIO_HIGHEST ((uint8_t)(CONFIG_FWK_WORKQ_PRIO_LEVELS - 1U))
+
+/*!
+ * \brief Enables the latency and utilization statistics of the workqueues and works
+ */
+#ifndef CONFIG_FWK_WORKQ_STATS
+#define CONFIG_FWK_WORKQ_STATS 0
+#endif
+
+/*!
+ * \brief Number of buckets of the queuing latency histogram
+ *
+ * The first bucket counts the latencies up to 64us, each next bucket is 4 times larger and the last one is unbounded.
+ */
+#define FWK_WORKQ_STATS_LATENCY_BUCKETS 8U
+
+/*!
+ * \brief Enables the lock-free submission path used by WORKQ_SubmitToQueueFromIsr()
+ *
+ * Requires exclusive load/store instructions (Armv7-M or Armv8-M), so it's not available on Armv6-M (Cortex-M0/M0+).
+ * The work flags are then always updated atomically.
+ */
+#ifndef CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT
+#define CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT 0
+#endif
+
 /*!
  * \brief Defines a workqueue thread
  *
@@ -29,12 +73,19 @@
  * thread handler which will be replaced by the internal thread handler from
  * the workqueue service.
  */
-#define FWK_WORKQ_THREAD_DEFINE(name, prio, stackSize) \
-    static void name(void *workq)                      \
-    {                                                  \
-        (void)workq;                                   \
-    }                                                  \
-    static OSA_TASK_DEFINE(name, prio, 1, stackSize, false)
+#define FWK_WORKQ_THREAD_DEFINE(name, prio, stackSize) FWK_WORKQ_POOL_THREAD_DEFINE(name, prio, stackSize, 1)
+
+/*!
+ * \brief Defines the worker threads of a workqueue pool
+ *
+ * Same as FWK_WORKQ_THREAD_DEFINE, for count threads created from the same definition.
+ */
+#define FWK_WORKQ_POOL_THREAD_DEFINE(name, prio, stackSize, count) \
+    static void name(void *workq)                                  \
+    {                                                              \
+        (void)workq;                                               \
+    }                                                              \
+    static OSA_TASK_DEFINE(name, prio, count, stackSize, false)
 
 /*!
  * \brief Access a workqueue thread definition
@@ -49,20 +100,80 @@
         .handler = work_handler,            \
     }
 
+/*!
+ * \brief Defines and initializes a delayed work
+ */
+#define FWK_DELAYED_WORK_DEFINE(dwork, work_handler) \
+    fwk_delayed_work_t dwork = {                     \
+        .work =                                      \
+            {                                        \
+                .handler = work_handler,             \
+            },                                       \
+    }
+
 /* -------------------------------------------------------------------------- */
 /*                                Public types                                */
 /* -------------------------------------------------------------------------- */
 
-typedef struct fwk_workq_t fwk_workq_t;
-typedef struct fwk_work_t  fwk_work_t;
+typedef struct fwk_workq_t        fwk_workq_t;
+typedef struct fwk_work_t         fwk_work_t;
+typedef struct fwk_delayed_work_t fwk_delayed_work_t;
 typedef void (*fwk_work_handler_t)(fwk_work_t *work);
 
-struct fwk_workq_t
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+/*! Workqueue statistics, times in us */
+typedef struct fwk_workq_stats_t
+{
+    uint32_t processed;   /* works processed */
+    uint32_t resubmitted; /* submissions ignored as the work was already queued or scheduled */
+    uint32_t latencyHist[FWK_WORKQ_STATS_LATENCY_BUCKETS]; /* time from queuing to handler start */
+    uint32_t latencyMax;
+    uint32_t runMin; /* handler duration */
+    uint32_t runMax;
+    uint64_t runTotal;
+    uint16_t depth; /* works currently queued, the delayed works not expired are not counted */
+    uint16_t depthMax;
+} fwk_workq_stats_t;
+
+/*! Work statistics, times in us */
+typedef struct fwk_work_stats_t
+{
+    uint32_t submitTime; /* time of the last queuing */
+    uint32_t processed;
+    uint32_t resubmitted;
+    uint32_t latencyMax;
+    uint32_t runMax;
+    uint64_t runTotal;
+} fwk_work_stats_t;
+#endif
+
+/*! Worker thread of a workqueue */
+typedef struct fwk_workq_worker_t
 {
     OSA_TASK_HANDLE_DEFINE(thread);
+    fwk_workq_t *queue;
+    fwk_work_t  *work;         /* work being processed, NULL if idle */
+    uint32_t     seq;          /* pick sequence number of the work being processed */
+    uint32_t     coreAffinity; /* FreeRTOS SMP core mask of the thread, 0 for any core */
+} fwk_workq_worker_t;
+
+struct fwk_workq_t
+{
+    fwk_workq_worker_t  worker; /* worker of a single thread queue */
+    fwk_workq_worker_t *workers;
+    uint8_t             workerCount;
     OSA_EVENT_HANDLE_DEFINE(notify);
-    list_label_t pending;
+    list_label_t pending[CONFIG_FWK_WORKQ_PRIO_LEVELS]; /* one FIFO per priority level */
+    list_label_t delayed;  /* delayed works sorted by deadline, the earliest first */
+    list_label_t barriers; /* barriers waiting for the works picked before them */
+    uint32_t     seq;      /* number of works picked */
     uint32_t     flags;
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+    fwk_workq_stats_t stats;
+#endif
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0)
+    fwk_work_t *volatile inbox; /* works submitted from ISRs, the last one first */
+#endif
 };
 
 struct fwk_work_t
@@ -71,6 +182,19 @@ struct fwk_work_t
     fwk_work_handler_t handler;
     fwk_workq_t       *queue;
     uint32_t           flags;
+    uint8_t            prio; /* FWK_WORK_PRIO_LOWEST to FWK_WORK_PRIO_HIGHEST */
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+    fwk_work_stats_t stats;
+#endif
+#if (CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT > 0)
+    fwk_work_t *inboxNext;
+#endif
+};
+
+struct fwk_delayed_work_t
+{
+    fwk_work_t work;
+    uint32_t   deadline; /* OSA time in ms at which the work is queued */
 };
 
 /* -------------------------------------------------------------------------- */
@@ -91,18 +215,196 @@ struct fwk_work_t
  */
 int WORKQ_Start(fwk_workq_t *queue, const osa_task_def_t *thread_def);
 
+/*!
+ * \brief Initializes a work queue served by a pool of threads and starts them.
+ *
+ * The threads share the pending lists of the queue, so a blocking handler doesn't stall the other works.
+ * A work is never run by two threads at the same time. The coreAffinity member of each worker can be set
+ * before the call to pin its thread on FreeRTOS SMP builds. On baremetal systems, only the first worker is used.
+ * This function should not be called twice for the same queue.
+ *
+ * \param[in] queue pointer to the queue.
+ * \param[in] thread_def pointer to the thread definition provided by FWK_WORKQ_THREAD, defined with
+ *                       FWK_WORKQ_POOL_THREAD_DEFINE for count instances.
+ * \param[in] workers array of count workers, which must remain valid while the queue is used.
+ * \param[in] count number of threads.
+ * \return int as WORKQ_Start().
+ */
+int WORKQ_StartPool(fwk_workq_t *queue, const osa_task_def_t *thread_def, fwk_workq_worker_t *workers, uint8_t count);
+
 /*!
  * \brief Submit a work item to a work queue.
  *
+ * The work is queued after the works of the same priority. The workqueue thread always processes the
+ * works of the highest priority first.
+ *
  * \param[in] queue pointer to the work queue on which the work should run.
  * \param[in] work pointer to the work item.
  * \return int 0 if the work has been queued.
  * \return int 1 if the work was already queued.
  * \return int -EINVAL if incorrect parameters.
  * \return int -ENODEV if the queue is not started.
+ * \return int -EBUSY if the work is being cancelled or the queue drained.
  */
 int WORKQ_SubmitToQueue(fwk_workq_t *queue, fwk_work_t *work);
 
+/*!
+ * \brief Submit a work item to a queue from an interrupt handler.
+ *
+ * With CONFIG_FWK_WORKQ_LOCKFREE_SUBMIT, the work item is added to the queue without masking the interrupts and the
+ * queue thread is notified only if no other work item was waiting to be collected. A delayed work item, a work item
+ * being cancelled or a queue being drained falls back to WORKQ_SubmitToQueue(). Without it, this function is
+ * WORKQ_SubmitToQueue().
+ *
+ * \param[in] queue pointer to the queue.
+ * \param[in] work pointer to the work item.
+ * \return int as WORKQ_SubmitToQueue().
+ */
+int WORKQ_SubmitToQueueFromIsr(fwk_workq_t *queue, fwk_work_t *work);
+
+/*!
+ * \brief Submit a delayed work item to a work queue after a delay.
+ *
+ * The work is queued when the delay has elapsed. The handler receives a pointer to the work member
+ * of the delayed work. A delay of 0 queues the work immediately.
+ *
+ * \param[in] queue pointer to the work queue on which the work should run.
+ * \param[in] dwork pointer to the delayed work item.
+ * \param[in] delayMs delay in milliseconds, lower than 2^31.
+ * \return int 0 if the work has been scheduled.
+ * \return int 1 if the work was already scheduled or queued (no change done).
+ * \return int 2 if the work is running and has been scheduled on the queue it's running on.
+ * \return int -EINVAL if incorrect parameters.
+ * \return int -ENODEV if the queue is not started.
+ * \return int -EBUSY if the work is being cancelled, or the delay is 0 and the queue drained.
+ */
+int WORKQ_ScheduleDelayedToQueue(fwk_workq_t *queue, fwk_delayed_work_t *dwork, uint32_t delayMs);
+
+/*!
+ * \brief Submit a delayed work item to a work queue after a delay, replacing any pending schedule.
+ *
+ * If the work is already scheduled or queued, it is removed first, so the work runs once after the
+ * new delay.
+ *
+ * \param[in] queue pointer to the work queue on which the work should run.
+ * \param[in] dwork pointer to the delayed work item.
+ * \param[in] delayMs delay in milliseconds, lower than 2^31.
+ * \return int as WORKQ_ScheduleDelayedToQueue(), 1 is never returned.
+ */
+int WORKQ_RescheduleDelayedToQueue(fwk_workq_t *queue, fwk_delayed_work_t *dwork, uint32_t delayMs);
+
+/*!
+ * \brief Cancel a work item.
+ *
+ * The work is removed from its queue if it is queued, or scheduled for a delayed work.
+ * A handler already running is not interrupted.
+ *
+ * \param[in] work pointer to the work item.
+ * \return int 0 if the work has been cancelled.
+ * \return int 1 if the work was neither queued nor running (no change done).
+ * \return int -EBUSY if the handler is running, or if a WORKQ_SubmitToQueueFromIsr() call adding the work was
+ *                    interrupted, it must not be released yet.
+ * \return int -EINVAL if incorrect parameters.
+ */
+int WORKQ_Cancel(fwk_work_t *work);
+
+/*!
+ * \brief Cancel a work item and wait for its handler to complete.
+ *
+ * Same as WORKQ_Cancel(), but if the handler is running, the function blocks until it returns.
+ * The submissions of the work are rejected meanwhile, so the work is idle when the function returns
+ * 0 or 1, and can be released. Must not be called from the thread of the work queue, nor from an ISR.
+ *
+ * \param[in] work pointer to the work item.
+ * \return int 0 if the work has been cancelled or its handler has completed.
+ * \return int 1 if the work was neither queued nor running (no change done).
+ * \return int -EINVAL if incorrect parameters.
+ * \return int -EBUSY if a WORKQ_SubmitToQueueFromIsr() call adding the work was interrupted.
+ * \return int -EDEADLK if called from the thread of the work queue.
+ * \return int -ENOMEM if the wait could not be set up.
+ */
+int WORKQ_CancelSync(fwk_work_t *work);
+
+/*!
+ * \brief Wait until the work items queued before the call have been processed.
+ *
+ * The delayed works whose delay has not elapsed are not waited for.
+ * Must not be called from the thread of the work queue, nor from an ISR.
+ *
+ * \param[in] queue pointer to the work queue.
+ * \return int 0 if success.
+ * \return int -EINVAL if incorrect parameters.
+ * \return int -ENODEV if the queue is not started.
+ * \return int -EDEADLK if called from the thread of the work queue.
+ * \return int -ENOMEM if the wait could not be set up.
+ */
+int WORKQ_Flush(fwk_workq_t *queue);
+
+/*!
+ * \brief Wait until a work queue is empty.
+ *
+ * While the queue is drained, the submissions from other contexts than the queue thread are rejected
+ * with -EBUSY, and the works submitted by the handlers are processed too. With plug set, the submissions
+ * stay rejected after the function returns, until WORKQ_Unplug() is called. This is typically used before
+ * entering a low power mode. The delayed works whose delay has not elapsed are kept, and the delayed works
+ * scheduled with a non-zero delay are accepted, so a rejected submitter can retry later.
+ * Must not be called from the thread of the work queue, nor from an ISR.
+ *
+ * \param[in] queue pointer to the work queue.
+ * \param[in] plug keep rejecting the submissions after the queue is drained.
+ * \return int as WORKQ_Flush().
+ */
+int WORKQ_Drain(fwk_workq_t *queue, bool plug);
+
+/*!
+ * \brief Accept the submissions again on a work queue plugged by WORKQ_Drain().
+ *
+ * \param[in] queue pointer to the work queue.
+ * \return int 0 if success.
+ * \return int 1 if the queue was not plugged (no change done).
+ * \return int -EINVAL if incorrect parameters.
+ */
+int WORKQ_Unplug(fwk_workq_t *queue);
+
+/*!
+ * \brief Cancel a delayed work item.
+ *
+ * \param[in] dwork pointer to the delayed work item.
+ * \return int as WORKQ_Cancel().
+ */
+int WORKQ_CancelDelayed(fwk_delayed_work_t *dwork);
+
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+/*!
+ * \brief Get the statistics of a work queue.
+ *
+ * \param[in] queue pointer to the queue.
+ * \param[out] stats copy of the queue statistics.
+ * \return int 0 if success
+ * \return int -EINVAL if incorrect parameters.
+ */
+int WORKQ_GetStats(fwk_workq_t *queue, fwk_workq_stats_t *stats);
+
+/*!
+ * \brief Reset the statistics of a work queue, the current depth is kept.
+ *
+ * \param[in] queue pointer to the queue.
+ * \return int 0 if success
+ * \return int -EINVAL if incorrect parameters.
+ */
+int WORKQ_ResetStats(fwk_workq_t *queue);
+
+/*!
+ * \brief Get the statistics of a work item.
+ *
+ * \param[in] work pointer to the work item.
+ * \param[out] stats copy of the work statistics.
+ * \return int 0 if success
+ * \return int -EINVAL if incorrect parameters.
+ */
+int WORKQ_GetWorkStats(fwk_work_t *work, fwk_work_stats_t *stats);
+#endif
+
 /*!
  * \brief Initializes and starts the system work queue.
  *
@@ -113,9 +415,80 @@ int WORKQ_InitSysWorkQ(void);
 /*!
  * \brief Submit a work item to the system work queue.
  *
+ * The system work queue may be drained and plugged before a low power mode, WORKQ_DrainSysWorkQ(). The submitters
+ * from other contexts than its thread must then tolerate -EBUSY: the work is dropped, and is submitted again later,
+ * typically on the next period or with a delayed work, which is accepted.
+ *
  * \param[in] work pointer to the work item.
  * \return int as WORKQ_SubmitToQueue().
  */
 int WORKQ_Submit(fwk_work_t *work);
 
+/*!
+ * \brief Submit a work item to the system work queue from an interrupt handler.
+ *
+ * As WORKQ_Submit(), -EBUSY must be tolerated.
+ *
+ * \param[in] work pointer to the work item.
+ * \return int as WORKQ_SubmitToQueueFromIsr().
+ */
+int WORKQ_SubmitFromIsr(fwk_work_t *work);
+
+/*!
+ * \brief Submit a delayed work item to the system work queue after a delay.
+ *
+ * \param[in] dwork pointer to the delayed work item.
+ * \param[in] delayMs delay in milliseconds.
+ * \return int as WORKQ_ScheduleDelayedToQueue().
+ */
+int WORKQ_ScheduleDelayed(fwk_delayed_work_t *dwork, uint32_t delayMs);
+
+/*!
+ * \brief Submit a delayed work item to the system work queue after a delay, replacing any pending schedule.
+ *
+ * \param[in] dwork pointer to the delayed work item.
+ * \param[in] delayMs delay in milliseconds.
+ * \return int as WORKQ_RescheduleDelayedToQueue().
+ */
+int WORKQ_RescheduleDelayed(fwk_delayed_work_t *dwork, uint32_t delayMs);
+
+/*!
+ * \brief Wait until the work items queued on the system work queue have been processed.
+ *
+ * \return int as WORKQ_Flush().
+ */
+int WORKQ_FlushSysWorkQ(void);
+
+/*!
+ * \brief Wait until the system work queue is empty.
+ *
+ * \param[in] plug keep rejecting the submissions after the queue is drained.
+ * \return int as WORKQ_Drain().
+ */
+int WORKQ_DrainSysWorkQ(bool plug);
+
+/*!
+ * \brief Accept the submissions again on the system work queue.
+ *
+ * \return int as WORKQ_Unplug().
+ */
+int WORKQ_UnplugSysWorkQ(void);
+
+#if (CONFIG_FWK_WORKQ_STATS > 0)
+/*!
+ * \brief Get the statistics of the system work queue.
+ *
+ * \param[out] stats copy of the queue statistics.
+ * \return int as WORKQ_GetStats().
+ */
+int WORKQ_GetSysWorkQStats(fwk_workq_stats_t *stats);
+
+/*!
+ * \brief Reset the statistics of the system work queue.
+ *
+ * \return int as WORKQ_ResetStats().
+ */
+int WORKQ_ResetSysWorkQStats(void);
+#endif
+
 #endif /* _FWK_WORKQ_H_ */
\ No newline at end of file
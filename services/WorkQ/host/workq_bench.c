@@ -0,0 +1,318 @@
+/*!
+ * Copyright 2025 NXP
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * \file workq_bench.c
+ * \brief Host benchmark of the workqueue service, built with the POSIX OSA port.
+ *
+ * The throughput test runs producer threads submitting their own work items as fast as possible to a queue served by
+ * a pool of workers, and reports the submissions and executions per second. The latency test measures the time from
+ * the submission of a high priority work item to the start of its handler, while the producers keep loading the queue.
+ *
+ */
+
+/* -------------------------------------------------------------------------- */
+/*                                  Includes                                  */
+/* -------------------------------------------------------------------------- */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "fwk_hal_macros.h"
+#include "fwk_workq.h"
+
+/* -------------------------------------------------------------------------- */
+/*                               Private macros                               */
+/* -------------------------------------------------------------------------- */
+
+#define BENCH_MAX_PRODUCERS 16U
+#define BENCH_MAX_WORKERS   8U
+#define BENCH_MAX_ITEMS     256U
+
+/* -------------------------------------------------------------------------- */
+/*                               Private types                                */
+/* -------------------------------------------------------------------------- */
+
+typedef struct
+{
+    fwk_work_t work;
+    uint64_t   executions;
+} bench_item_t;
+
+typedef struct
+{
+    pthread_t    thread;
+    bench_item_t items[BENCH_MAX_ITEMS];
+    uint64_t     submits;
+} bench_producer_t;
+
+typedef struct
+{
+    fwk_work_t        work;
+    volatile uint64_t submitNs;
+    uint64_t          latencyNs;
+    OSA_SEMAPHORE_HANDLE_DEFINE(done);
+} bench_probe_t;
+
+/* -------------------------------------------------------------------------- */
+/*                               Private memory                               */
+/* -------------------------------------------------------------------------- */
+
+FWK_WORKQ_POOL_THREAD_DEFINE(bench_thread, 0, 4096, BENCH_MAX_WORKERS);
+
+static fwk_workq_t        s_queue;
+static fwk_workq_worker_t s_workers[BENCH_MAX_WORKERS];
+static bench_producer_t   s_producers[BENCH_MAX_PRODUCERS];
+static bench_probe_t      s_probe;
+static atomic_bool        s_stop;
+
+static unsigned int s_producerCount = 4U;
+static unsigned int s_workerCount   = 2U;
+static unsigned int s_itemCount     = 16U;
+static unsigned int s_durationMs    = 1000U;
+static unsigned int s_samples       = 2000U;
+static unsigned int s_handlerNs     = 0U;
+static bool         s_fromIsr       = false;
+
+/* -------------------------------------------------------------------------- */
+/*                              Private functions                             */
+/* -------------------------------------------------------------------------- */
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+static void bench_spin(unsigned int ns)
+{
+    uint64_t end = bench_now_ns() + ns;
+
+    while (bench_now_ns() < end)
+    {
+    }
+}
+
+static int bench_submit(fwk_work_t *work)
+{
+    return s_fromIsr ? WORKQ_SubmitToQueueFromIsr(&s_queue, work) : WORKQ_SubmitToQueue(&s_queue, work);
+}
+
+static void bench_item_handler(fwk_work_t *work)
+{
+    bench_item_t *item = CONTAINER_OF(work, bench_item_t, work);
+
+    /* a work item is never run by two workers at the same time, so no atomic is needed */
+    item->executions++;
+    if (s_handlerNs != 0U)
+    {
+        bench_spin(s_handlerNs);
+    }
+}
+
+static void bench_probe_handler(fwk_work_t *work)
+{
+    bench_probe_t *probe = CONTAINER_OF(work, bench_probe_t, work);
+
+    probe->latencyNs = bench_now_ns() - probe->submitNs;
+    (void)OSA_SemaphorePost(probe->done);
+}
+
+static void *bench_producer(void *arg)
+{
+    bench_producer_t *producer = (bench_producer_t *)arg;
+    unsigned int      index    = 0U;
+
+    while (!atomic_load(&s_stop))
+    {
+        (void)bench_submit(&producer->items[index].work);
+        producer->submits++;
+        index++;
+        if (index == s_itemCount)
+        {
+            /* give the workers a chance to run on hosts with few cores */
+            index = 0U;
+            OSA_TaskYield();
+        }
+    }
+
+    return NULL;
+}
+
+static void bench_start_producers(void)
+{
+    atomic_store(&s_stop, false);
+    for (unsigned int i = 0U; i < s_producerCount; i++)
+    {
+        bench_producer_t *producer = &s_producers[i];
+
+        producer->submits = 0U;
+        for (unsigned int j = 0U; j < s_itemCount; j++)
+        {
+            producer->items[j].work.handler = bench_item_handler;
+            producer->items[j].executions   = 0U;
+        }
+        (void)pthread_create(&producer->thread, NULL, bench_producer, producer);
+    }
+}
+
+static void bench_stop_producers(uint64_t *submits, uint64_t *executions)
+{
+    atomic_store(&s_stop, true);
+    for (unsigned int i = 0U; i < s_producerCount; i++)
+    {
+        (void)pthread_join(s_producers[i].thread, NULL);
+    }
+
+    /* let the workers complete the submitted items before counting */
+    (void)WORKQ_Flush(&s_queue);
+
+    *submits    = 0U;
+    *executions = 0U;
+    for (unsigned int i = 0U; i < s_producerCount; i++)
+    {
+        *submits += s_producers[i].submits;
+        for (unsigned int j = 0U; j < s_itemCount; j++)
+        {
+            *executions += s_producers[i].items[j].executions;
+        }
+    }
+}
+
+static int bench_compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void bench_throughput(void)
+{
+    uint64_t submits;
+    uint64_t executions;
+    uint64_t start;
+    double   seconds;
+
+    start = bench_now_ns();
+    bench_start_producers();
+    (void)usleep(s_durationMs * 1000U);
+    bench_stop_producers(&submits, &executions);
+    seconds = (double)(bench_now_ns() - start) / 1e9;
+
+    printf("throughput: %.0f submits/s, %.0f executions/s, %.2f submits per execution\n", (double)submits / seconds,
+           (double)executions / seconds, (executions != 0U) ? ((double)submits / (double)executions) : 0.0);
+}
+
+static void bench_latency(void)
+{
+    uint64_t *latencies = calloc(s_samples, sizeof(uint64_t));
+
+    if (latencies == NULL)
+    {
+        return;
+    }
+
+    s_probe.work.handler = bench_probe_handler;
+    s_probe.work.prio    = FWK_WORK_PRIO_HIGHEST;
+    (void)OSA_SemaphoreCreate(s_probe.done, 0U);
+
+    bench_start_producers();
+    for (unsigned int i = 0U; i < s_samples; i++)
+    {
+        s_probe.submitNs = bench_now_ns();
+        (void)bench_submit(&s_probe.work);
+        (void)OSA_SemaphoreWait(s_probe.done, osaWaitForever_c);
+        latencies[i] = s_probe.latencyNs;
+    }
+
+    uint64_t submits;
+    uint64_t executions;
+    bench_stop_producers(&submits, &executions);
+
+    qsort(latencies, s_samples, sizeof(uint64_t), bench_compare);
+    printf("latency: p50 %.1f us, p99 %.1f us, max %.1f us (%u samples)\n",
+           (double)latencies[s_samples / 2U] / 1000.0, (double)latencies[(s_samples * 99U) / 100U] / 1000.0,
+           (double)latencies[s_samples - 1U] / 1000.0, s_samples);
+
+    (void)OSA_SemaphoreDestroy(s_probe.done);
+    free(latencies);
+}
+
+static void bench_usage(const char *name)
+{
+    printf("usage: %s [-p producers] [-w workers] [-n items per producer] [-t duration ms] [-s latency samples]\n"
+           "          [-h handler duration ns] [-i]\n"
+           "  -i submits with WORKQ_SubmitToQueueFromIsr()\n",
+           name);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                              Public functions                              */
+/* -------------------------------------------------------------------------- */
+
+int main(int argc, char **argv)
+{
+    int opt;
+
+    while ((opt = getopt(argc, argv, "p:w:n:t:s:h:i")) != -1)
+    {
+        switch (opt)
+        {
+            case 'p':
+                s_producerCount = (unsigned int)strtoul(optarg, NULL, 0);
+                break;
+            case 'w':
+                s_workerCount = (unsigned int)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                s_itemCount = (unsigned int)strtoul(optarg, NULL, 0);
+                break;
+            case 't':
+                s_durationMs = (unsigned int)strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                s_samples = (unsigned int)strtoul(optarg, NULL, 0);
+                break;
+            case 'h':
+                s_handlerNs = (unsigned int)strtoul(optarg, NULL, 0);
+                break;
+            case 'i':
+                s_fromIsr = true;
+                break;
+            default:
+                bench_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if ((s_producerCount == 0U) || (s_producerCount > BENCH_MAX_PRODUCERS) || (s_workerCount == 0U) ||
+        (s_workerCount > BENCH_MAX_WORKERS) || (s_itemCount == 0U) || (s_itemCount > BENCH_MAX_ITEMS) ||
+        (s_samples == 0U))
+    {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    if (WORKQ_StartPool(&s_queue, FWK_WORKQ_THREAD(bench_thread), s_workers, (uint8_t)s_workerCount) != 0)
+    {
+        printf("failed to start the workqueue\n");
+        return 1;
+    }
+
+    printf("%u producers x %u items, %u workers, %s submission, handler %u ns\n", s_producerCount, s_itemCount,
+           s_workerCount, s_fromIsr ? "ISR" : "thread", s_handlerNs);
+
+    bench_throughput();
+    bench_latency();
+
+    return 0;
+}